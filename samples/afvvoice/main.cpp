@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup sampleafvvoice
+//! Packets per second through the AFV voice path, serializing and from the encrypted datagram to the mixed samples
+
+#include <cmath>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QVector>
+
+#include "core/afv/audio/soundcardsampleprovider.h"
+#include "core/afv/crypto/cryptodtochannel.h"
+#include "core/afv/crypto/cryptodtocontext.h"
+#include "core/afv/crypto/cryptodtoserializer.h"
+#include "core/afv/dto.h"
+#include "core/application.h"
+#include "core/registermetadata.h"
+#include "sound/codecs/opusencoder.h"
+
+using namespace swift::misc;
+using namespace swift::core;
+using namespace swift::core::afv;
+using namespace swift::core::afv::audio;
+using namespace swift::core::afv::crypto;
+using namespace swift::sound::codecs;
+
+namespace
+{
+    constexpr int SampleRate = 48000;
+    constexpr int FrameSize = 960; // 20ms
+    constexpr int Packets = 20000;
+
+    //! Encrypted audio packets as received from the voice server
+    QVector<QByteArray> createDatagrams(CCryptoDtoChannel &channel)
+    {
+        COpusEncoder encoder(SampleRate, 1);
+        QVector<qint16> pcm(FrameSize);
+        QVector<QByteArray> datagrams;
+        for (int i = 0; i < Packets; i++)
+        {
+            for (int s = 0; s < FrameSize; s++)
+            {
+                pcm[s] = static_cast<qint16>(8000.0 * std::sin(2.0 * M_PI * 440.0 * (i * FrameSize + s) / SampleRate));
+            }
+            int encodedLength = 0;
+            const QByteArray opus = encoder.encode(pcm, pcm.size(), &encodedLength);
+
+            AudioRxOnTransceiversDto dto;
+            dto.callsign = "DLH" + std::to_string(i % 4); // 4 stations talking
+            dto.sequenceCounter = static_cast<uint>(i);
+            dto.audio = std::vector<char>(opus.begin(), opus.begin() + encodedLength);
+            dto.lastPacket = false;
+            dto.transceivers = { { 0, 122800000, 1.0F }, { 1, 121500000, 0.5F } };
+            datagrams.push_back(CryptoDtoSerializer::serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, dto));
+        }
+        return datagrams;
+    }
+
+    //! Print the rate
+    void report(QTextStream &out, const QString &name, qint64 packets, qint64 ns)
+    {
+        out << name << ": " << qRound64(packets * 1.0e9 / ns) << " packets/s, " << (ns / packets) << " ns/packet"
+            << Qt::endl;
+    }
+
+    //! Decode all datagrams and mix them, as the AFV client does
+    template <typename Decode>
+    void runReceive(QTextStream &out, const QString &name, const QVector<QByteArray> &datagrams, Decode decode)
+    {
+        CSoundcardSampleProvider soundcard(SampleRate, { 0, 1 });
+        QVector<float> samples(FrameSize);
+        QElapsedTimer timer;
+        timer.start();
+        for (const QByteArray &datagram : datagrams)
+        {
+            decode(datagram, soundcard);
+            soundcard.readSamples(samples, FrameSize);
+        }
+        report(out, name, datagrams.size(), timer.nsecsElapsed());
+    }
+
+    //! Serialize the same voice packet over and over
+    template <typename Serialize>
+    void runTransmit(QTextStream &out, const QString &name, Serialize serialize)
+    {
+        AudioTxOnTransceiversDto dto;
+        dto.callsign = "DLH123";
+        dto.audio = std::vector<char>(100, 'a');
+        dto.lastPacket = false;
+        dto.transceivers = { { 0 }, { 1 } };
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < Packets; i++)
+        {
+            dto.sequenceCounter = static_cast<uint>(i);
+            serialize(dto);
+        }
+        report(out, name, Packets, timer.nsecsElapsed());
+    }
+} // namespace
+
+//! main
+int main(int argc, char *argv[])
+{
+    QCoreApplication qa(argc, argv);
+    registerMetadata();
+    CApplication a("sampleafvvoice", CApplicationInfo::Sample);
+    Q_UNUSED(a)
+
+    const QByteArray key(32, 'k');
+    CryptoDtoChannelConfigDto config { "benchmark", key, key, key };
+    CCryptoDtoChannel channel(config);
+
+    QTextStream out(stdout);
+    out << "Creating " << Packets << " packets" << Qt::endl;
+    const QVector<QByteArray> datagrams = createDatagrams(channel);
+
+    runTransmit(out, "serialize copy", [&channel](const AudioTxOnTransceiversDto &dto) {
+        CryptoDtoSerializer::serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, dto);
+    });
+    CCryptoDtoContext transmit;
+    runTransmit(out, "serialize context", [&channel, &transmit](const AudioTxOnTransceiversDto &dto) {
+        transmit.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, dto);
+    });
+
+    runReceive(out, "receive copy", datagrams, [&](const QByteArray &datagram, CSoundcardSampleProvider &soundcard) {
+        CryptoDtoSerializer::Deserializer deserializer = CryptoDtoSerializer::deserialize(channel, datagram, true);
+        const auto dto = deserializer.getDto<AudioRxOnTransceiversDto>();
+        IAudioDto audioDto;
+        audioDto.callsign = QString::fromStdString(dto.callsign);
+        audioDto.sequenceCounter = dto.sequenceCounter;
+        audioDto.audio = QByteArrayView(dto.audio.data(), static_cast<qsizetype>(dto.audio.size()));
+        audioDto.lastPacket = dto.lastPacket;
+        soundcard.addOpusSamples(audioDto, dto.transceivers);
+    });
+
+    CCryptoDtoContext receive;
+    AudioRxOnTransceiversDto pooled;
+    runReceive(out, "receive context", datagrams, [&](const QByteArray &datagram, CSoundcardSampleProvider &soundcard) {
+        if (!receive.deserialize(channel, datagram, true) || !receive.getDto(pooled)) { return; }
+        soundcard.addOpusSamples(pooled);
+    });
+    out << "buffer growths: " << (transmit.getGrowthCount() + receive.getGrowthCount()) << Qt::endl;
+    return 0;
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup sampledbusblob
+//! Round trip times of large lists over a local P2P DBus server, marshalled field by field and as CDBusBlob
+
+#include <QCoreApplication>
+#include <QDBusConnection>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QThread>
+
+#include "misc/aviation/callsign.h"
+#include "misc/dbusblob.h"
+#include "misc/dbusserver.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/genericdbusinterface.h"
+#include "misc/registermetadata.h"
+#include "misc/simulation/aircraftmodel.h"
+#include "misc/simulation/simulatedaircraftlist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::simulation;
+
+namespace
+{
+    constexpr int Rounds = 20;
+    const QString Address = QStringLiteral("tcp:host=127.0.0.1,port=45099");
+    const QString Path = QStringLiteral("/sample/dbusblob");
+    const QString Interface = QStringLiteral("org.swift_project.sample.dbusblob");
+} // namespace
+
+//! Server side, as a context implementation would provide it
+class CBlobSampleService : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.swift_project.sample.dbusblob")
+
+public:
+    //! Aircraft returned
+    void setAircraft(const CSimulatedAircraftList &aircraft) { m_aircraft = aircraft; }
+
+public slots:
+    //! All aircraft
+    CSimulatedAircraftList getAircraft() const { return m_aircraft; }
+
+    //! All aircraft as blob
+    QByteArray getAircraftBlob(bool compress) const { return CDBusBlob::toBlob(m_aircraft, compress); }
+
+    //! \copydoc swift::misc::CDBusBlob::Version
+    int getBlobMarshallingVersion() const { return CDBusBlob::Version; }
+
+private:
+    CSimulatedAircraftList m_aircraft;
+};
+
+namespace
+{
+    //! Aircraft with models, as in range on a busy event
+    CSimulatedAircraftList createAircraft(int count)
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < count; i++)
+        {
+            const CCallsign callsign(QStringLiteral("DLH%1").arg(i));
+            CAircraftModel model(QStringLiteral("A320 Lufthansa %1").arg(i), CAircraftModel::TypeModelMatching);
+            model.setDescription(QStringLiteral("Airbus A320 Lufthansa livery"));
+            CSimulatedAircraft a(callsign, model, {}, {});
+            a.setPosition(CCoordinateGeodetic(48.0 + i * 0.001, 11.0 + i * 0.001, 1000.0 + i));
+            aircraft.push_back(a);
+        }
+        return aircraft;
+    }
+
+    //! Average round trip time
+    template <typename Call>
+    void run(QTextStream &out, const QString &name, int count, Call call)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        int received = 0;
+        for (int i = 0; i < Rounds; i++) { received += call().size(); }
+        out << name << " " << count << " aircraft: " << (timer.nsecsElapsed() / Rounds / 1000) << " us/call";
+        if (received != Rounds * count) { out << " (received only " << received << ")"; }
+        out << Qt::endl;
+    }
+} // namespace
+
+//! main
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    registerMetadata();
+    QTextStream out(stdout);
+
+    // the server runs in its own thread, the client calls are synchronous
+    QThread serverThread;
+    CDBusServer server(Address);
+    CBlobSampleService service;
+    server.addObject(Path, &service);
+    server.moveToThread(&serverThread);
+    service.moveToThread(&serverThread);
+    serverThread.start();
+
+    QDBusConnection connection = CDBusServer::connectToDBus(Address, QStringLiteral("sampledbusblob"));
+    CGenericDBusInterface fieldByField({}, Path, Interface, connection);
+    CGenericDBusInterface blob({}, Path, Interface, connection);
+    CGenericDBusInterface compressed({}, Path, Interface, connection);
+    blob.setBlobMarshalling(true);
+    compressed.setBlobMarshalling(true, true);
+
+    // objects are registered when the server sees the new connection
+    QElapsedTimer wait;
+    wait.start();
+    while (!blob.isBlobMarshallingSupported() && wait.elapsed() < 5000)
+    {
+        blob.setBlobMarshalling(true); // ask again
+        QThread::msleep(50);
+    }
+    if (!blob.isBlobMarshallingSupported() || !compressed.isBlobMarshallingSupported())
+    {
+        out << "Cannot reach server on " << Address << Qt::endl;
+        return 1;
+    }
+
+    for (int count : { 100, 1000, 5000 })
+    {
+        const CSimulatedAircraftList aircraft = createAircraft(count);
+        QMetaObject::invokeMethod(&service, [&] { service.setAircraft(aircraft); }, Qt::BlockingQueuedConnection);
+
+        run(out, "field by field ", count, [&] {
+            return fieldByField.callDBusRet<CSimulatedAircraftList>(QLatin1String("getAircraft"));
+        });
+        run(out, "blob           ", count, [&] {
+            return blob.callDBusRetBlob<CSimulatedAircraftList>(QLatin1String("getAircraft"));
+        });
+        run(out, "blob compressed", count, [&] {
+            return compressed.callDBusRetBlob<CSimulatedAircraftList>(QLatin1String("getAircraft"));
+        });
+        out << "blob size: " << CDBusBlob::toBlob(aircraft, false).size()
+            << " bytes, compressed: " << CDBusBlob::toBlob(aircraft, true).size() << " bytes" << Qt::endl;
+    }
+
+    QDBusConnection::disconnectFromPeer(connection.name());
+    serverThread.quit();
+    serverThread.wait();
+    return 0;
+}
+
+#include "main.moc"
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplefsdreplay
+
+#include "fsdreplayserver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QFile>
+#include <QHostAddress>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTime>
+#include <QTimer>
+#include <QtMath>
+
+#include "core/fsd/enums.h"
+#include "core/fsd/messagebase.h"
+#include "core/fsd/pilotdataupdate.h"
+#include "core/fsd/planeinformation.h"
+#include "core/fsd/rawfsdcapture.h"
+#include "misc/aviation/transponder.h"
+#include "misc/pq/units.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+using namespace swift::core::fsd;
+
+namespace swift::sample
+{
+    CFsdReplayServer::Session CFsdReplayServer::loadCapture(const QString &fileName, QString &errorMessage)
+    {
+        if (CRawFsdCapture::isCaptureFile(fileName))
+        {
+            QVector<CRawFsdCapture::Record> records;
+            if (!CRawFsdCapture::readCapture(fileName, records, errorMessage)) { return {}; }
+            Session session;
+            qint64 first = -1;
+            for (const CRawFsdCapture::Record &record : std::as_const(records))
+            {
+                if (record.sent) { continue; }
+                if (first < 0) { first = record.timestampMs; }
+                session.push_back({ record.timestampMs - first, record.message + "\r\n" });
+            }
+            if (session.isEmpty()) { errorMessage = QStringLiteral("No received FSD messages in '%1'").arg(fileName); }
+            return session;
+        }
+
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            errorMessage = file.errorString();
+            return {};
+        }
+
+        // "hh:mm:ss.zzz FSD Recv=>@N:DLH123:..."
+        static const QByteArray received(" FSD Recv=>");
+        constexpr qint64 day = 24 * 3600 * 1000;
+        Session session;
+        qint64 first = -1;
+        qint64 dayOffset = 0;
+        qint64 previous = 0;
+        while (!file.atEnd())
+        {
+            const QByteArray line = file.readLine().trimmed();
+            const qsizetype separator = line.indexOf(received);
+            if (separator < 0) { continue; }
+            const QTime time = QTime::fromString(QString::fromLatin1(line.left(separator)), "hh:mm:ss.zzz");
+            if (!time.isValid()) { continue; }
+
+            qint64 ms = time.msecsSinceStartOfDay();
+            if (ms + dayOffset < previous - day / 2) { dayOffset += day; } // past midnight
+            ms += dayOffset;
+            if (first < 0) { first = ms; }
+            previous = ms;
+            session.push_back({ ms - first, line.mid(separator + received.size()) + "\r\n" });
+        }
+        if (session.isEmpty()) { errorMessage = QStringLiteral("No received FSD messages in '%1'").arg(fileName); }
+        return session;
+    }
+
+    CFsdReplayServer::Session CFsdReplayServer::generateSession(int aircraft, int durationS, const CCallsign &receiver,
+                                                                const CCoordinateGeodetic &center)
+    {
+        static const QStringList airlines { "DLH", "BAW", "AFR", "UAL", "SWR", "KLM", "AUA", "EZY" };
+        constexpr qint64 intervalMs = 5000; // pilot data updates are sent every 5s
+        constexpr double groundSpeedKts = 250.0;
+        constexpr double metersPerDeg = 111120.0;
+
+        const double centerLatitudeDeg = center.latitude().value(CAngleUnit::deg());
+        const double centerLongitudeDeg = center.longitude().value(CAngleUnit::deg());
+        const double longitudeScale = 1.0 / std::cos(qDegreesToRadians(centerLatitudeDeg));
+
+        Session session;
+        session.reserve(aircraft * (durationS * 1000 / intervalMs + 2));
+        for (int i = 0; i < aircraft; i++)
+        {
+            const QString airline = airlines.at(i % airlines.size());
+            const QString callsign = airline + QString::number(100 + i);
+            const double radiusDeg = 0.2 + 1.3 * (i % 100) / 100.0;
+            const double angularSpeed = groundSpeedKts * 1852.0 / 3600.0 / (radiusDeg * metersPerDeg); // rad/s
+            const int altitudeFt = 5000 + (i % 30) * 1000;
+            const qint64 startMs = i * intervalMs / aircraft; // evenly spread
+
+            // the reply to the plane information request of the airspace monitor, sent right away
+            const PlaneInformation info(callsign, receiver.asString(), "A320", airline, {});
+            session.push_back({ startMs, messageToFSDString(info).toLatin1() });
+
+            for (qint64 t = startMs; t < durationS * 1000; t += intervalMs)
+            {
+                const double angle = 2.0 * M_PI * i / aircraft + angularSpeed * t / 1000.0;
+                const double latitude = centerLatitudeDeg + radiusDeg * std::sin(angle);
+                const double longitude = centerLongitudeDeg + radiusDeg * std::cos(angle) * longitudeScale;
+                const double heading = 360.0 - std::fmod(qRadiansToDegrees(angle), 360.0);
+                const PilotDataUpdate position(CTransponder::ModeC, callsign, 2000, PilotRating::Student,
+                                               latitude, longitude, altitudeFt, altitudeFt, qRound(groundSpeedKts),
+                                               0.0, -15.0, heading, false);
+                session.push_back({ t, messageToFSDString(position).toLatin1() });
+            }
+        }
+        std::stable_sort(session.begin(), session.end(),
+                         [](const Line &a, const Line &b) { return a.offsetMs < b.offsetMs; });
+        return session;
+    }
+
+    CFsdReplayServer::CFsdReplayServer(Session session, double speed, QObject *parent)
+        : QObject(parent), m_session(std::move(session)), m_speed(speed), m_server(new QTcpServer(this)),
+          m_timer(new QTimer(this))
+    {
+        m_timer->setTimerType(Qt::PreciseTimer);
+        m_timer->setInterval(m_speed > 0 ? TickMs : 0);
+        connect(m_server, &QTcpServer::newConnection, this, &CFsdReplayServer::onNewConnection);
+        connect(m_timer, &QTimer::timeout, this, &CFsdReplayServer::sendDueLines);
+    }
+
+    CFsdReplayServer::~CFsdReplayServer() = default;
+
+    bool CFsdReplayServer::listen(quint16 port) { return m_server->listen(QHostAddress::LocalHost, port); }
+
+    quint16 CFsdReplayServer::serverPort() const { return m_server->serverPort(); }
+
+    void CFsdReplayServer::onNewConnection()
+    {
+        while (QTcpSocket *socket = m_server->nextPendingConnection())
+        {
+            connect(socket, &QTcpSocket::readyRead, this, [this, socket] {
+                socket->readAll();
+                if (m_socket) { return; }
+                m_socket = socket;
+                m_clock.start();
+                m_timer->start();
+                emit this->clientConnected();
+            });
+            connect(socket, &QTcpSocket::disconnected, this, [this, socket] {
+                if (socket == m_socket) { m_timer->stop(); }
+                socket->deleteLater();
+            });
+        }
+    }
+
+    void CFsdReplayServer::sendDueLines()
+    {
+        if (!m_socket || m_socket->bytesToWrite() > MaxPendingBytes) { return; }
+
+        const qint64 dueMs =
+            m_speed > 0 ? qRound64(m_clock.elapsed() * m_speed) : std::numeric_limits<qint64>::max();
+        int sent = 0;
+        while (m_next < m_session.size() && m_session[m_next].offsetMs <= dueMs)
+        {
+            if (m_speed <= 0 && sent >= MaxLinesPerTick) { break; }
+            const QByteArray &line = m_session[m_next++].data;
+            m_socket->write(line);
+            if (m_lineSent) { m_lineSent(line); }
+            sent++;
+        }
+        m_sentLines += sent;
+
+        if (m_next < m_session.size()) { return; }
+        m_timer->stop();
+        m_socket->flush();
+        m_finished = true;
+        emit this->finished(m_sentLines, m_clock.elapsed());
+    }
+} // namespace swift::sample
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplefsdreplay
+
+#ifndef SWIFT_SAMPLE_FSDREPLAYSERVER_H
+#define SWIFT_SAMPLE_FSDREPLAYSERVER_H
+
+#include <atomic>
+#include <functional>
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+
+#include "misc/aviation/callsign.h"
+#include "misc/geo/coordinategeodetic.h"
+
+class QTcpServer;
+class QTcpSocket;
+class QTimer;
+
+namespace swift::sample
+{
+    /*!
+     * Local stand-in for an FSD server, replaying a session to the first client sending its login.
+     *
+     * Connections which do not send anything (like the reachability check before connecting) are ignored, as is
+     * everything the client sends. So the client has to use the classic protocol without authentication
+     * (server type FSDServer). Lines are sent at their recorded time divided by the speed, or as fast as the
+     * client reads them.
+     */
+    class CFsdReplayServer : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Line sent by the server
+        struct Line
+        {
+            qint64 offsetMs = 0; //!< time since the start of the session
+            QByteArray data; //!< including the line end
+        };
+
+        //! All lines of a session, ordered by time
+        using Session = QVector<Line>;
+
+        //! Lines received by the client in a raw FSD message capture or text log, as written by
+        //! swift::core::fsd::CFSDClient
+        static Session loadCapture(const QString &fileName, QString &errorMessage);
+
+        //! Synthetic session, aircraft circling around a center and sending a position every 5s
+        static Session generateSession(int aircraft, int durationS, const swift::misc::aviation::CCallsign &receiver,
+                                       const swift::misc::geo::CCoordinateGeodetic &center);
+
+        //! Constructor
+        //! \param session lines to be replayed
+        //! \param speed 1.0 for real time, 0 for as fast as possible
+        CFsdReplayServer(Session session, double speed, QObject *parent = nullptr);
+
+        //! Destructor
+        ~CFsdReplayServer() override;
+
+        //! Listen on localhost, 0 for any free port
+        bool listen(quint16 port);
+
+        //! Port listening on
+        quint16 serverPort() const;
+
+        //! Called for every line sent, in the thread of the server
+        //! \remark set before the server is started
+        void setLineSentHook(std::function<void(const QByteArray &line)> hook) { m_lineSent = std::move(hook); }
+
+        //! Number of lines in the session
+        int getSessionSize() const { return m_session.size(); }
+
+        //! Number of lines sent
+        //! \threadsafe
+        int getSentLines() const { return m_sentLines; }
+
+        //! All lines sent?
+        //! \threadsafe
+        bool isFinished() const { return m_finished; }
+
+    signals:
+        //! A client has logged in, the replay starts
+        void clientConnected();
+
+        //! All lines have been sent
+        void finished(int lines, qint64 elapsedMs);
+
+    private:
+        static constexpr int TickMs = 5; //!< timer interval when replaying in real time or faster
+        static constexpr int MaxLinesPerTick = 500; //!< when replaying as fast as possible
+        static constexpr qint64 MaxPendingBytes = 1024 * 1024; //!< wait while the client does not read
+
+        //! New connections
+        void onNewConnection();
+
+        //! Send all lines which are due
+        void sendDueLines();
+
+        const Session m_session;
+        const double m_speed;
+        QTcpServer *m_server = nullptr;
+        QTimer *m_timer = nullptr;
+        QPointer<QTcpSocket> m_socket;
+        QElapsedTimer m_clock;
+        std::function<void(const QByteArray &line)> m_lineSent;
+        int m_next = 0;
+        std::atomic_int m_sentLines { 0 };
+        std::atomic_bool m_finished { false };
+    };
+} // namespace swift::sample
+
+#endif // SWIFT_SAMPLE_FSDREPLAYSERVER_H
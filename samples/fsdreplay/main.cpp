@@ -0,0 +1,381 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplefsdreplay
+//! Replays a recorded or synthetic FSD session into a core with the emulated simulator, and reports the throughput,
+//! the latency until positions reach the remote aircraft provider, and CPU and memory per stage.
+//! Run with QT_QPA_PLATFORM=offscreen on machines without display.
+
+#include <cstdlib>
+
+#include <QApplication>
+#include <QCommandLineOption>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPixmap>
+#include <QTextStream>
+#include <QThread>
+
+#ifdef Q_OS_UNIX
+#    include <time.h>
+#    include <unistd.h>
+#endif
+
+#include "fsdreplayserver.h"
+
+#include "core/airspacemonitor.h"
+#include "core/context/contextnetworkimpl.h"
+#include "core/context/contextownaircraft.h"
+#include "core/context/contextsimulatorimpl.h"
+#include "core/corefacade.h"
+#include "core/corefacadeconfig.h"
+#include "core/fsd/fsdclient.h"
+#include "core/fsd/rawfsdcapture.h"
+#include "core/simulator.h"
+#include "gui/guiapplication.h"
+#include "misc/aviation/aircrafticaocode.h"
+#include "misc/aviation/airlineicaocode.h"
+#include "misc/aviation/altitude.h"
+#include "misc/latencyhistogram.h"
+#include "misc/network/loginmode.h"
+#include "misc/network/server.h"
+#include "misc/network/user.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/simulatorplugininfolist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::network;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+using namespace swift::core;
+using namespace swift::core::context;
+using namespace swift::core::fsd;
+using namespace swift::gui;
+using namespace swift::sample;
+
+namespace
+{
+    //! Monotonic clock shared by all threads
+    const QElapsedTimer &sharedClock()
+    {
+        static const QElapsedTimer clock = [] {
+            QElapsedTimer c;
+            c.start();
+            return c;
+        }();
+        return clock;
+    }
+
+    //! CPU time of the calling thread, -1 if not available
+    qint64 currentThreadCpuNs()
+    {
+#ifdef Q_OS_UNIX
+        timespec ts {};
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) { return ts.tv_sec * 1000000000LL + ts.tv_nsec; }
+#endif
+        return -1;
+    }
+
+    //! CPU time of the thread an object lives in, -1 if not available
+    qint64 objectThreadCpuNs(QObject *object)
+    {
+        if (!object || object->thread() == QThread::currentThread()) { return currentThreadCpuNs(); }
+        qint64 ns = -1;
+        QMetaObject::invokeMethod(object, [&ns] { ns = currentThreadCpuNs(); }, Qt::BlockingQueuedConnection);
+        return ns;
+    }
+
+    //! CPU time of the process, -1 if not available
+    qint64 processCpuNs()
+    {
+#ifdef Q_OS_UNIX
+        timespec ts {};
+        if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) { return ts.tv_sec * 1000000000LL + ts.tv_nsec; }
+#endif
+        return -1;
+    }
+
+    //! Resident memory of the process, -1 if not available
+    qint64 residentBytes()
+    {
+#ifdef Q_OS_LINUX
+        QFile statm("/proc/self/statm");
+        if (statm.open(QIODevice::ReadOnly))
+        {
+            const QList<QByteArray> pages = statm.readAll().split(' ');
+            if (pages.size() > 1) { return pages.at(1).toLongLong() * sysconf(_SC_PAGESIZE); }
+        }
+#endif
+        return -1;
+    }
+
+    //! CPU times of the stages
+    struct CpuSample
+    {
+        qint64 wallNs = 0; //!< shared clock
+        qint64 serverNs = 0; //!< replay server thread, not part of the core
+        qint64 fsdNs = 0; //!< FSD client thread: socket, parsing
+        qint64 mainNs = 0; //!< main thread: airspace monitor, remote aircraft provider, simulator plugin
+        qint64 processNs = 0; //!< all threads
+    };
+
+    //! Matches positions sent by the server with the situations added to the remote aircraft provider
+    //! \threadsafe
+    class CPositionLatency
+    {
+    public:
+        //! Line sent by the server
+        void sent(const QByteArray &line)
+        {
+            // "@N:DLH123:2000:1:48.12345:11.12345:..."
+            if (!line.startsWith('@')) { return; }
+            const QList<QByteArray> tokens = line.split(':');
+            if (tokens.size() < 6) { return; }
+            const QString key = QString::fromLatin1(tokens.at(1)) + u':' + position(tokens.at(4).toDouble());
+            const qint64 now = sharedClock().nsecsElapsed();
+            QMutexLocker lock(&m_mutex);
+            m_sent.insert(key, now);
+        }
+
+        //! Situation added to the provider
+        void received(const CAircraftSituation &situation)
+        {
+            const QString key =
+                situation.getCallsign().asString() + u':' + position(situation.latitude().value(CAngleUnit::deg()));
+            const qint64 now = sharedClock().nsecsElapsed();
+            QMutexLocker lock(&m_mutex);
+            const auto it = m_sent.find(key);
+            if (it == m_sent.end())
+            {
+                m_unmatched++;
+                return;
+            }
+            m_latency.record(now - it.value());
+            m_sent.erase(it);
+        }
+
+        //! Latency from sending until added to the provider
+        CLatencyHistogram getLatency() const
+        {
+            QMutexLocker lock(&m_mutex);
+            return m_latency;
+        }
+
+        //! Positions sent, but not yet received
+        int getPending() const
+        {
+            QMutexLocker lock(&m_mutex);
+            return m_sent.size();
+        }
+
+        //! Situations received which were not sent by the server (e.g. extrapolated)
+        qint64 getUnmatched() const
+        {
+            QMutexLocker lock(&m_mutex);
+            return m_unmatched;
+        }
+
+    private:
+        //! Position as sent by FSD
+        static QString position(double degrees) { return QString::number(degrees, 'f', 5); }
+
+        mutable QMutex m_mutex;
+        QHash<QString, qint64> m_sent;
+        CLatencyHistogram m_latency;
+        qint64 m_unmatched = 0;
+    };
+
+    //! Process events until the condition is met
+    template <typename Condition>
+    bool waitFor(Condition condition, qint64 timeoutMs)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!condition())
+        {
+            if (timer.elapsed() > timeoutMs) { return false; }
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+        }
+        return true;
+    }
+
+    //! CPU usage of a stage
+    QString cpu(qint64 from, qint64 to, qint64 wallNs)
+    {
+        if (from < 0 || to < 0 || wallNs <= 0) { return QStringLiteral("n/a"); }
+        return QStringLiteral("%1s (%2%)")
+            .arg((to - from) / 1.0e9, 0, 'f', 2)
+            .arg(100.0 * (to - from) / wallNs, 0, 'f', 1);
+    }
+
+    //! Memory in MiB
+    QString mib(qint64 bytes)
+    {
+        return bytes < 0 ? QStringLiteral("n/a") : QString::number(bytes / (1024.0 * 1024.0), 'f', 1) + "MiB";
+    }
+} // namespace
+
+//! main
+int main(int argc, char *argv[])
+{
+    QApplication qa(argc, argv);
+    Q_UNUSED(qa)
+    CGuiApplication a("samplefsdreplay", CApplicationInfo::Sample, QPixmap());
+    const QCommandLineOption captureOption({ "c", "capture" }, "Raw FSD message capture or log to replay.", "file");
+    const QCommandLineOption toTextOption({ "t", "to-text" }, "Only convert the capture to a text log.", "file");
+    const QCommandLineOption aircraftOption({ "n", "aircraft" }, "Aircraft in a synthetic session.", "number", "500");
+    const QCommandLineOption durationOption({ "d", "duration" }, "Duration of a synthetic session.", "s", "120");
+    const QCommandLineOption speedOption({ "s", "speed" }, "Replay speed: 1, 10, ... or max.", "speed", "1");
+    a.addParserOptions({ captureOption, toTextOption, aircraftOption, durationOption, speedOption });
+    if (!a.parseCommandLineArgsAndLoadSetup()) { return EXIT_FAILURE; }
+
+    QTextStream out(stdout);
+    if (a.isParserOptionSet(toTextOption))
+    {
+        QString error;
+        const bool converted = CRawFsdCapture::convertToText(a.getParserValue(captureOption),
+                                                             a.getParserValue(toTextOption), error);
+        if (!error.isEmpty()) { out << error << Qt::endl; }
+        return converted ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const CCallsign ownCallsign("SWIFT1");
+    const CCoordinateGeodetic center(48.353783, 11.786086, 1487.0); // EDDM
+    const QString speedValue = a.getParserValue(speedOption);
+    const double speed = speedValue == "max" ? 0.0 : speedValue.toDouble();
+
+    CFsdReplayServer::Session session;
+    if (a.isParserOptionSet(captureOption))
+    {
+        QString error;
+        session = CFsdReplayServer::loadCapture(a.getParserValue(captureOption), error);
+        if (session.isEmpty())
+        {
+            out << error << Qt::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        session = CFsdReplayServer::generateSession(a.getParserValue(aircraftOption).toInt(),
+                                                    a.getParserValue(durationOption).toInt(), ownCallsign, center);
+    }
+
+    a.initContextsAndStartCoreFacade(CCoreFacadeConfig(CCoreFacadeConfig::Local));
+    if (!a.start())
+    {
+        a.gracefulShutdown();
+        return EXIT_FAILURE;
+    }
+
+    // emulated simulator
+    CContextSimulator *simulatorContext = a.getCoreFacade()->getCContextSimulator();
+    CContextNetwork *networkContext = a.getCoreFacade()->getCContextNetwork();
+    for (const CSimulatorPluginInfo &plugin : simulatorContext->getAvailableSimulatorPlugins())
+    {
+        if (plugin.isEmulatedPlugin()) { simulatorContext->startSimulatorPlugin(plugin); }
+    }
+    if (!waitFor([&] { return simulatorContext->hasSimulator(); }, 15000))
+    {
+        out << "Emulated simulator plugin not available" << Qt::endl;
+        a.gracefulShutdown();
+        return EXIT_FAILURE;
+    }
+
+    IContextOwnAircraft *ownAircraft = a.getIContextOwnAircraft();
+    ownAircraft->updateOwnCallsign(ownCallsign);
+    ownAircraft->updateOwnIcaoCodes(CAircraftIcaoCode("A320"), CAirlineIcaoCode("DLH"));
+    ownAircraft->updateOwnPosition(center, CAltitude(1487, CAltitude::MeanSeaLevel, CLengthUnit::ft()),
+                                   CAltitude(1487, CAltitude::MeanSeaLevel, CAltitude::PressureAltitude,
+                                             CLengthUnit::ft()));
+
+    // the server runs in its own thread, so it keeps its pace while the core is busy
+    CPositionLatency latency;
+    QThread serverThread;
+    serverThread.setObjectName("FSD replay server");
+    CFsdReplayServer server(session, speed);
+    server.setLineSentHook([&latency](const QByteArray &line) { latency.sent(line); });
+    if (!server.listen(0))
+    {
+        out << "Cannot listen on localhost" << Qt::endl;
+        a.gracefulShutdown();
+        return EXIT_FAILURE;
+    }
+    server.moveToThread(&serverThread);
+    serverThread.start();
+
+    QObject::connect(networkContext->airspace(), &CAirspaceMonitor::addedAircraftSituation, networkContext,
+                     [&latency](const CAircraftSituation &situation) { latency.received(situation); });
+
+    out << "Replaying " << server.getSessionSize() << " lines at " << (speed > 0 ? speedValue + "x" : "max. speed")
+        << " on port " << server.serverPort() << Qt::endl;
+    CServer fsdServer("127.0.0.1", server.serverPort(),
+                      CUser("1234567", "FSD replay", "", "123456", ownCallsign));
+    fsdServer.setServerType(CServer::FSDServer);
+    const CStatusMessage status =
+        networkContext->connectToNetwork(fsdServer, {}, false, {}, false, {}, CLoginMode::Pilot);
+    if (status.isFailure() || !waitFor([&] { return server.getSentLines() > 0; }, 10000))
+    {
+        out << "Cannot connect: " << status.getMessage() << Qt::endl;
+        serverThread.quit();
+        serverThread.wait();
+        a.gracefulShutdown();
+        return EXIT_FAILURE;
+    }
+
+    QObject *fsdClient = networkContext->fsdClient();
+    const qint64 memoryBefore = residentBytes();
+    const auto sampleCpu = [&] {
+        return CpuSample { sharedClock().nsecsElapsed(), objectThreadCpuNs(&server), objectThreadCpuNs(fsdClient),
+                           currentThreadCpuNs(), processCpuNs() };
+    };
+    const CpuSample start = sampleCpu();
+
+    // progress every 5s, until all lines are sent and the core caught up (or gave up on some positions)
+    QElapsedTimer progress;
+    progress.start();
+    int lastPending = -1;
+    waitFor(
+        [&] {
+            if (progress.elapsed() < 5000) { return false; }
+            progress.restart();
+            out << "sent: " << server.getSentLines() << " aircraft: " << networkContext->getAircraftInRangeCount()
+                << " latency: " << latency.getLatency().toQString() << Qt::endl;
+            const int pending = latency.getPending();
+            const bool done = server.isFinished() && pending == lastPending;
+            lastPending = pending;
+            return done;
+        },
+        24 * 3600 * 1000);
+    const CpuSample end = sampleCpu();
+    const qint64 memoryAfter = residentBytes();
+    const qint64 wallNs = end.wallNs - start.wallNs;
+
+    out << Qt::endl << "lines: " << server.getSentLines() << " in " << (wallNs / 1000000) << "ms, "
+        << qRound64(server.getSentLines() * 1.0e9 / wallNs) << " packets/s" << Qt::endl;
+    out << "aircraft in range: " << networkContext->getAircraftInRangeCount() << Qt::endl;
+    out << "position latency (server to remote aircraft provider): " << latency.getLatency().toQString() << Qt::endl;
+    out << "positions not arrived: " << latency.getPending() << ", situations not sent: " << latency.getUnmatched()
+        << Qt::endl;
+    out << "CPU replay server: " << cpu(start.serverNs, end.serverNs, wallNs) << Qt::endl;
+    out << "CPU FSD client: " << cpu(start.fsdNs, end.fsdNs, wallNs) << Qt::endl;
+    out << "CPU airspace, provider, simulator: " << cpu(start.mainNs, end.mainNs, wallNs) << Qt::endl;
+    out << "CPU process: " << cpu(start.processNs, end.processNs, wallNs) << Qt::endl;
+    out << "memory: " << mib(memoryBefore) << " -> " << mib(memoryAfter) << Qt::endl;
+    if (const QPointer<ISimulator> simulator = simulatorContext->simulator())
+    {
+        out << "simulator update phases:" << Qt::endl << simulator->getStatisticsUpdateLatencies() << Qt::endl;
+    }
+
+    networkContext->disconnectFromNetwork();
+    serverThread.quit();
+    serverThread.wait();
+    a.gracefulShutdown();
+    return EXIT_SUCCESS;
+}
@@ -6,6 +6,7 @@
 
 #include "samplesphysicalquantities.h"
 
+#include <QElapsedTimer>
 #include <QString>
 #include <QTextStream>
 
@@ -18,6 +19,7 @@
 #include "misc/pq/physicalquantity.h"
 #include "misc/pq/pressure.h"
 #include "misc/pq/speed.h"
+#include "misc/pq/staticquantity.h"
 #include "misc/pq/temperature.h"
 #include "misc/pq/time.h"
 #include "misc/pq/units.h"
@@ -132,6 +134,39 @@ namespace swift::sample
         out << ac1 << " " << ac1.toQString(true) << " " << ac1.valueRoundedWithUnit(-1, true) << " "
             << "I18N/UTF" << Qt::endl;
 
+        // interpolation like arithmetic, physical quantities vs. static quantities
+        constexpr int steps = 1000000;
+        const CLength oldAlt(10000, CLengthUnit::ft());
+        const CLength newAlt(12000, CLengthUnit::ft());
+        const CAngle oldHdg(350, CAngleUnit::deg());
+        const CAngle newHdg(10, CAngleUnit::deg());
+        QElapsedTimer timer;
+        timer.start();
+        double pqSum = 0;
+        for (int i = 0; i < steps; i++)
+        {
+            const double fraction = static_cast<double>(i) / steps;
+            const CLength alt = (newAlt - oldAlt) * fraction + oldAlt;
+            const CAngle hdg = (newHdg - oldHdg) * fraction + oldHdg;
+            pqSum += alt.value(CLengthUnit::ft()) + hdg.value(CAngleUnit::deg());
+        }
+        const qint64 pqMs = timer.restart();
+        const CStaticLength oldStaticAlt = toStatic(oldAlt);
+        const CStaticLength newStaticAlt = toStatic(newAlt);
+        const CStaticAngle oldStaticHdg = toStatic(oldHdg);
+        const CStaticAngle newStaticHdg = toStatic(newHdg);
+        double staticSum = 0;
+        for (int i = 0; i < steps; i++)
+        {
+            const double fraction = static_cast<double>(i) / steps;
+            const CStaticLength alt = (newStaticAlt - oldStaticAlt) * fraction + oldStaticAlt;
+            const CStaticAngle hdg = (newStaticHdg - oldStaticHdg) * fraction + oldStaticHdg;
+            staticSum += alt.in<static_units::Foot>() + hdg.in<static_units::Degree>();
+        }
+        const qint64 staticMs = timer.elapsed();
+        out << "interpolation steps: " << steps << " physical quantities: " << pqMs << "ms "
+            << "static quantities: " << staticMs << "ms, sums " << pqSum << " " << staticSum << Qt::endl;
+
         // bye
         out << "-----------------------------------------------" << Qt::endl;
         return 0;
@@ -13,11 +13,14 @@
 #include <QTextStream>
 #include <QtGlobal>
 
+#include "samplesairspace.h"
 #include "samplesfscommon.h"
 #include "samplesfsx.h"
 #include "samplesmodelmapping.h"
+#include "samplesmodelscanning.h"
 #include "samplesp3d.h"
 #include "samplesvpilotrules.h"
+#include "samplesxplane.h"
 
 #include "core/application.h"
 #include "misc/directoryutils.h"
@@ -46,6 +49,9 @@ int main(int argc, char *argv[])
         streamOut << "3 .. Mappings" << Qt::endl;
         streamOut << "4 .. vPilot rules" << Qt::endl;
         streamOut << "5 .. P3D cfg files" << Qt::endl;
+        streamOut << "6 .. Model directory scanning (benchmark)" << Qt::endl;
+        streamOut << "7 .. X-Plane CSL package parsing (benchmark)" << Qt::endl;
+        streamOut << "8 .. Airspace snapshot (benchmark)" << Qt::endl;
         streamOut << "x .. exit" << Qt::endl;
         QString i = streamIn.readLine().toLower().trimmed();
 
@@ -55,6 +61,9 @@ int main(int argc, char *argv[])
         else if (i.startsWith("3")) { CSamplesModelMapping::samples(streamOut, streamIn); }
         else if (i.startsWith("4")) { CSamplesVPilotRules::samples(streamOut, streamIn); }
         else if (i.startsWith("5")) { CSamplesP3D::samplesMisc(streamOut); }
+        else if (i.startsWith("6")) { CSamplesModelScanning::samples(streamOut); }
+        else if (i.startsWith("7")) { CSamplesXPlane::samplesCslParsing(streamOut); }
+        else if (i.startsWith("8")) { CSamplesAirspace::samplesSnapshot(streamOut); }
         else if (i.startsWith("x"))
         {
             run = false;
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#include "samplesairspace.h"
+
+#include <utility>
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+#include <QTextStream>
+
+#include "misc/aviation/callsign.h"
+#include "misc/pq/length.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/airspaceaircraftindex.h"
+#include "misc/simulation/airspaceaircraftsnapshot.h"
+#include "misc/simulation/simulatedaircraft.h"
+#include "misc/simulation/simulatedaircraftlist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+
+namespace swift::sample
+{
+    void CSamplesAirspace::samplesSnapshot(QTextStream &streamOut)
+    {
+        constexpr int NumberOfAircraft = 1000;
+        constexpr int Runs = 100;
+        constexpr int MaxRendered = 50;
+        const CLength maxDistance(100, CLengthUnit::NM());
+
+        // every 10th aircraft is disabled
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < NumberOfAircraft; i++)
+        {
+            CSimulatedAircraft a;
+            a.setCallsign(CCallsign(QStringLiteral("SWIFT%1").arg(i)));
+            a.setRelativeDistance(CLength((i * 7919) % 2000 / 10.0, CLengthUnit::NM()));
+            a.setEnabled(i % 10 != 0);
+            aircraft.push_back(a);
+        }
+
+        // full rebuild as before: copy from provider, sort, filter
+        QElapsedTimer time;
+        time.start();
+        int enabledRebuild = 0;
+        for (int run = 0; run < Runs; run++)
+        {
+            const CSimulatedAircraftList copy(aircraft);
+            const CAirspaceAircraftSnapshot snapshot(copy, true, true, MaxRendered, maxDistance);
+            enabledRebuild = snapshot.getEnabledAircraftCallsignsByDistance().size();
+        }
+        const qint64 rebuildMs = time.elapsed();
+
+        // index kept up to date with each position, the snapshot is taken from the index
+        CAirspaceAircraftIndex index;
+        for (const CSimulatedAircraft &a : std::as_const(aircraft)) { index.update(a); }
+        const QList<CCallsign> callsigns = aircraft.getCallsigns().toQList();
+        qint64 updateNs = 0;
+        qint64 snapshotNs = 0;
+        int enabledIndex = 0;
+        for (int run = 0; run < Runs; run++)
+        {
+            // one position update per aircraft and run
+            time.start();
+            for (int i = 0; i < NumberOfAircraft; i++)
+            {
+                index.updateDistance(callsigns[i], ((i * 7919 + run) % 2000) * 185.2);
+            }
+            updateNs += time.nsecsElapsed();
+
+            time.start();
+            const CAirspaceAircraftSnapshot snapshot(index, true, true, MaxRendered, maxDistance);
+            enabledIndex = snapshot.getEnabledAircraftCallsignsByDistance().size();
+            snapshotNs += time.nsecsElapsed();
+        }
+
+        streamOut << NumberOfAircraft << " aircraft, " << Runs << " snapshots, max. " << MaxRendered << " rendered"
+                  << Qt::endl;
+        streamOut << "Full rebuild: " << rebuildMs << "ms, " << enabledRebuild << " enabled" << Qt::endl;
+        streamOut << "Index snapshot: " << snapshotNs / 1000000 << "ms, " << enabledIndex << " enabled" << Qt::endl;
+        streamOut << "Index updates (" << NumberOfAircraft * Runs << " positions): " << updateNs / 1000000 << "ms"
+                  << Qt::endl;
+    }
+} // namespace swift::sample
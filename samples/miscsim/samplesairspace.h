@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#ifndef SWIFT_SAMPLE_SAMPLESAIRSPACE_H
+#define SWIFT_SAMPLE_SAMPLESAIRSPACE_H
+
+class QTextStream;
+
+namespace swift::sample
+{
+    //! Samples for the airspace classes
+    class CSamplesAirspace
+    {
+    public:
+        //! Benchmark of the airspace snapshot, full rebuild vs. incrementally maintained index
+        static void samplesSnapshot(QTextStream &streamOut);
+    };
+} // namespace swift::sample
+
+#endif
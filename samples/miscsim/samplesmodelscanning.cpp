@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#include "samplesmodelscanning.h"
+
+#include <atomic>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QString>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QVector>
+
+#include "misc/simulation/fscommon/aircraftcfgentrieslist.h"
+#include "misc/simulation/fscommon/aircraftcfgparser.h"
+#include "misc/simulation/modeldirectoryscanner.h"
+#include "misc/statusmessagelist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::simulation;
+using namespace swift::misc::simulation::fscommon;
+
+namespace swift::sample
+{
+    void CSamplesModelScanning::samples(QTextStream &streamOut)
+    {
+        constexpr int NumberOfPackages = 10000;
+        QTemporaryDir tempDir;
+        if (!tempDir.isValid())
+        {
+            streamOut << "Cannot create temp. directory" << Qt::endl;
+            return;
+        }
+
+        streamOut << "Generating " << NumberOfPackages << " packages in " << tempDir.path() << Qt::endl;
+        const QDir root(tempDir.path());
+        for (int i = 0; i < NumberOfPackages; i++)
+        {
+            const QString pkg = QStringLiteral("package%1/SimObjects/Airplanes/aircraft%1").arg(i);
+            root.mkpath(pkg);
+            QFile file(root.filePath(pkg + "/aircraft.cfg"));
+            if (!file.open(QIODevice::WriteOnly)) { continue; }
+            file.write(QStringLiteral("[GENERAL]\natc_type=BOEING\nicao_type_designator=B738\n"
+                                      "[FLTSIM.0]\ntitle=Sample model %1\nui_manufacturer=Boeing\n"
+                                      "ui_type=737-800\natc_airline=SWIFT\n")
+                           .arg(i)
+                           .toUtf8());
+        }
+
+        const std::atomic<bool> cancel { false };
+        const auto parseFile = [](const QFileInfo &fileInfo) {
+            bool ok = false;
+            CStatusMessageList msgs;
+            return CAircraftCfgParser::performParsingOfSingleFile(fileInfo.absoluteFilePath(), ok, msgs);
+        };
+
+        QElapsedTimer time;
+        time.start();
+        CModelDirectoryScanner sequentialScanner(cancel, 1);
+        sequentialScanner.setNameFilters({ "aircraft.cfg" });
+        CAircraftCfgEntriesList sequentialEntries;
+        for (const QFileInfo &fileInfo : sequentialScanner.enumerate(root.absolutePath()))
+        {
+            sequentialEntries.push_back(parseFile(fileInfo));
+        }
+        const qint64 sequentialMs = time.elapsed();
+
+        time.start();
+        CModelDirectoryScanner parallelScanner(cancel);
+        parallelScanner.setNameFilters({ "aircraft.cfg" });
+        CAircraftCfgEntriesList parallelEntries;
+        for (const CAircraftCfgEntriesList &entries :
+             parallelScanner.scan<CAircraftCfgEntriesList>(root.absolutePath(), parseFile))
+        {
+            parallelEntries.push_back(entries);
+        }
+        const qint64 parallelMs = time.elapsed();
+
+        streamOut << "Sequential: " << sequentialEntries.size() << " entries in " << sequentialMs << "ms" << Qt::endl;
+        streamOut << "Parallel (" << parallelScanner.getMaxParserThreads()
+                  << " threads): " << parallelEntries.size() << " entries in " << parallelMs << "ms" << Qt::endl;
+        streamOut << "Directories: " << parallelScanner.getEnumeratedDirectories()
+                  << " files: " << parallelScanner.getEnumeratedFiles() << Qt::endl;
+    }
+} // namespace swift::sample
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#ifndef SWIFT_SAMPLE_SAMPLESMODELSCANNING_H
+#define SWIFT_SAMPLE_SAMPLESMODELSCANNING_H
+
+class QTextStream;
+
+namespace swift::sample
+{
+    //! Benchmark of the model directory scanning
+    class CSamplesModelScanning
+    {
+    public:
+        //! Sequential vs. parallel scanning of a generated package tree
+        static void samples(QTextStream &streamOut);
+    };
+} // namespace swift::sample
+
+#endif
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#include "samplesxplane.h"
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QString>
+#include <QStringList>
+#include <QTextStream>
+#include <QVector>
+
+#include "misc/simulation/xplane/cslpackageparser.h"
+#include "misc/stringutils.h"
+
+using namespace swift::misc;
+using namespace swift::misc::simulation::xplane;
+
+namespace swift::sample
+{
+    void CSamplesXPlane::samplesCslParsing(QTextStream &streamOut)
+    {
+        constexpr int NumberOfPackages = 100;
+        constexpr int PlanesPerPackage = 500;
+        static const QStringList icaos { "A320", "A321", "B738", "B77W", "E190", "CRJ9", "DH8D", "AT76" };
+        static const QStringList airlines { "DLH", "BAW", "AFR", "KLM", "UAL", "AAL", "SWR", "AUA" };
+
+        // generate the CSL set in memory, so the benchmark measures parsing only
+        QVector<CCslPackageParser::CSLPackage> headers;
+        const CCslPackageParser headerParser;
+        int lines = 0;
+        for (int p = 0; p < NumberOfPackages; p++)
+        {
+            const QString name = QStringLiteral("__Package%1").arg(p);
+            QByteArray content = "EXPORT_NAME " + name.toUtf8() + "\n";
+            for (int i = 0; i < PlanesPerPackage; i++)
+            {
+                const QByteArray icao = icaos[i % icaos.size()].toUtf8();
+                const QByteArray airline = airlines[(i / icaos.size()) % airlines.size()].toUtf8();
+                content += "\nOBJ8_AIRCRAFT " + icao + "_" + airline + "_" + QByteArray::number(i) + "\n";
+                content += "OBJ8 SOLID YES " + name.toUtf8() + ":" + icao + ":" + icao + "_" + airline + ".obj\n";
+                content += "LIVERY " + icao + " " + airline + " " + airline + "\n";
+                lines += 4;
+            }
+            headers.push_back(headerParser.parseHeader("/csl/Package" + QString::number(p), content));
+        }
+
+        // legacy approach, QString lines split into QStringList tokens
+        QElapsedTimer time;
+        time.start();
+        int legacyTokens = 0;
+        for (const CCslPackageParser::CSLPackage &header : std::as_const(headers))
+        {
+            QString content = QString::fromUtf8(header.content);
+            QTextStream in(&content);
+            while (!in.atEnd())
+            {
+                const QString line = in.readLine();
+                if (line.isEmpty() || line[0] == '#') { continue; }
+                legacyTokens += splitString(line, [](QChar c) { return c.isSpace(); }).size();
+            }
+        }
+        const qint64 legacyMs = time.elapsed();
+
+        time.start();
+        QVector<CCslPackageParser::CSLPackage> packages(headers);
+        const CCslPackageParser parser(packages);
+        int planes = 0;
+        for (CCslPackageParser::CSLPackage &package : packages)
+        {
+            parser.parseFull(package);
+            planes += package.planes.size();
+        }
+        const qint64 parserMs = time.elapsed();
+
+        streamOut << "Generated " << NumberOfPackages << " packages with " << lines << " lines" << Qt::endl;
+        streamOut << "QString tokenizing only: " << legacyTokens << " tokens in " << legacyMs << "ms" << Qt::endl;
+        streamOut << "Byte level parser: " << planes << " planes in " << parserMs << "ms" << Qt::endl;
+    }
+} // namespace swift::sample
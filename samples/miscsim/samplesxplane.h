@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemiscsim
+
+#ifndef SWIFT_SAMPLE_SAMPLESXPLANE_H
+#define SWIFT_SAMPLE_SAMPLESXPLANE_H
+
+class QTextStream;
+
+namespace swift::sample
+{
+    //! Samples for X-Plane classes
+    class CSamplesXPlane
+    {
+    public:
+        //! Benchmark of the CSL package parser on a generated CSL set
+        static void samplesCslParsing(QTextStream &streamOut);
+    };
+} // namespace swift::sample
+
+#endif
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup samplemodelupdate
+//! Updates the aircraft model and the simulated aircraft list models with mostly unchanged containers, once with
+//! a model reset as before and once signaling the changed rows only, and reports update times and signals.
+//! Also reports sort times per column and frame times when scrolling through the aircraft models.
+//! Run with QT_QPA_PLATFORM=offscreen on machines without display.
+
+#include <cstdlib>
+
+#include <QApplication>
+#include <QCommandLineOption>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QScrollBar>
+#include <QTableView>
+#include <QTextStream>
+
+#include "gui/models/aircraftmodellistmodel.h"
+#include "gui/models/simulatedaircraftlistmodel.h"
+#include "misc/aviation/callsign.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/latencyhistogram.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/aircraftmodellist.h"
+#include "misc/simulation/simulatedaircraftlist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+using namespace swift::gui::models;
+
+namespace
+{
+    //! Aircraft model list model reset on every update, as before
+    class CResetAircraftModelListModel : public CAircraftModelListModel
+    {
+    public:
+        using CAircraftModelListModel::CAircraftModelListModel;
+
+    protected:
+        QString diffKey(const CAircraftModel &model) const override
+        {
+            Q_UNUSED(model)
+            return {};
+        }
+    };
+
+    //! Simulated aircraft list model reset on every update, as before
+    class CResetSimulatedAircraftListModel : public CSimulatedAircraftListModel
+    {
+    public:
+        using CSimulatedAircraftListModel::CSimulatedAircraftListModel;
+
+    protected:
+        QString diffKey(const CSimulatedAircraft &aircraft) const override
+        {
+            Q_UNUSED(aircraft)
+            return {};
+        }
+    };
+
+    //! Signals emitted by a model
+    struct SignalCounts
+    {
+        int resets = 0; //!< model resets
+        int inserts = 0; //!< row insertions
+        int removes = 0; //!< row removals
+        int layouts = 0; //!< layout changes
+        int dataChanges = 0; //!< data changes
+
+        //! Connect to a model
+        void connectTo(QAbstractItemModel &model)
+        {
+            QObject::connect(&model, &QAbstractItemModel::modelReset, [this] { resets++; });
+            QObject::connect(&model, &QAbstractItemModel::rowsInserted, [this] { inserts++; });
+            QObject::connect(&model, &QAbstractItemModel::rowsRemoved, [this] { removes++; });
+            QObject::connect(&model, &QAbstractItemModel::layoutChanged, [this] { layouts++; });
+            QObject::connect(&model, &QAbstractItemModel::dataChanged, [this] { dataChanges++; });
+        }
+
+        //! Like "resets=1 inserts=0 ..."
+        QString toQString() const
+        {
+            return QStringLiteral("resets=%1 inserts=%2 removes=%3 layouts=%4 dataChanged=%5")
+                .arg(resets)
+                .arg(inserts)
+                .arg(removes)
+                .arg(layouts)
+                .arg(dataChanges);
+        }
+    };
+
+    //! Update a model shown in a view with slightly changed containers
+    template <class Model, class Container, class Change>
+    void run(QTextStream &out, const QString &name, Model &model, Container container, int updates, Change change)
+    {
+        QTableView view;
+        view.setModel(&model);
+        view.resize(1200, 800);
+        view.show();
+        model.update(container, true);
+        QApplication::processEvents();
+
+        SignalCounts signalCounts;
+        signalCounts.connectTo(model);
+        CLatencyHistogram update;
+        CLatencyHistogram frame;
+        QElapsedTimer timer;
+        for (int i = 0; i < updates; i++)
+        {
+            change(container, i);
+            timer.start();
+            model.update(container, true);
+            update.record(timer.nsecsElapsed());
+            view.viewport()->repaint();
+            frame.record(timer.nsecsElapsed());
+        }
+        out << name << " update " << update.toQString() << Qt::endl;
+        out << name << " frame  " << frame.toQString() << Qt::endl;
+        out << name << " " << signalCounts.toQString() << Qt::endl;
+    }
+
+    //! Sort by every sortable column and scroll through the sorted model page by page
+    template <class Model, class Container>
+    void sortAndScroll(QTextStream &out, const QString &name, Model &model, const Container &container)
+    {
+        QTableView view;
+        view.setModel(&model);
+        view.resize(1200, 800);
+        view.show();
+        model.update(container, false);
+        QApplication::processEvents();
+
+        CLatencyHistogram sort;
+        QElapsedTimer timer;
+        Container sorted = container;
+        for (int column = 0; column < model.columnCount(); column++)
+        {
+            for (const Qt::SortOrder order : { Qt::AscendingOrder, Qt::DescendingOrder })
+            {
+                timer.start();
+                sorted = model.sortContainerByColumn(container, column, order);
+                sort.record(timer.nsecsElapsed());
+            }
+        }
+        model.update(sorted, false);
+
+        // every page twice, the second time the values are formatted already
+        CLatencyHistogram frame;
+        QScrollBar *scrollBar = view.verticalScrollBar();
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int value = scrollBar->minimum(); value <= scrollBar->maximum(); value += scrollBar->pageStep())
+            {
+                timer.start();
+                scrollBar->setValue(value);
+                view.viewport()->repaint();
+                frame.record(timer.nsecsElapsed());
+            }
+        }
+        out << name << " sort   " << sort.toQString() << Qt::endl;
+        out << name << " scroll " << frame.toQString() << Qt::endl;
+    }
+} // namespace
+
+//! main
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+    QCommandLineParser parser;
+    parser.setApplicationDescription("List model update times");
+    parser.addHelpOption();
+    const QCommandLineOption modelsOption("models", "Number of aircraft models", "count", "30000");
+    const QCommandLineOption aircraftOption("aircraft", "Number of simulated aircraft", "count", "1000");
+    const QCommandLineOption updatesOption("updates", "Updates per run", "count", "50");
+    parser.addOptions({ modelsOption, aircraftOption, updatesOption });
+    parser.process(app);
+    const int modelCount = qMax(1, parser.value(modelsOption).toInt());
+    const int aircraftCount = qMax(1, parser.value(aircraftOption).toInt());
+    const int updates = qMax(1, parser.value(updatesOption).toInt());
+    QTextStream out(stdout);
+
+    CAircraftModelList models;
+    for (int i = 0; i < modelCount; i++)
+    {
+        CAircraftModel model(QStringLiteral("MODEL %1").arg(i), CAircraftModel::TypeOwnSimulatorModel);
+        model.setDescription(QStringLiteral("Description %1").arg(i));
+        models.push_back(model);
+    }
+
+    // a few descriptions changed, one model replaced
+    const auto changeModels = [](CAircraftModelList &container, int update) {
+        QRandomGenerator random(static_cast<quint32>(update));
+        for (int n = 0; n < 10; n++)
+        {
+            CAircraftModel &model = container[random.bounded(static_cast<int>(container.size()))];
+            model.setDescription(QStringLiteral("Changed %1").arg(update));
+        }
+        container[random.bounded(static_cast<int>(container.size()))] = CAircraftModel(
+            QStringLiteral("NEW MODEL %1").arg(update), CAircraftModel::TypeOwnSimulatorModel);
+    };
+
+    CSimulatedAircraftList aircraft;
+    for (int i = 0; i < aircraftCount; i++)
+    {
+        CSimulatedAircraft a(CAircraftModel(QStringLiteral("MODEL %1").arg(i), CAircraftModel::TypeOwnSimulatorModel));
+        a.setCallsign(CCallsign(QStringLiteral("SWF%1").arg(i)));
+        a.setPosition(CCoordinateGeodetic(48.0 + i * 0.001, 11.0, 5000.0));
+        aircraft.push_back(a);
+    }
+
+    // a fifth of the aircraft moved
+    const auto changeAircraft = [](CSimulatedAircraftList &container, int update) {
+        for (int i = update % 5; i < container.size(); i += 5)
+        {
+            CSimulatedAircraft &a = container[i];
+            const double latitudeDeg = a.latitude().value(CAngleUnit::deg());
+            a.setPosition(CCoordinateGeodetic(latitudeDeg + 0.0001, 11.0, 5000.0));
+        }
+    };
+
+    {
+        CResetAircraftModelListModel model(CAircraftModelListModel::OwnModelSet);
+        run(out, "models reset   ", model, models, updates, changeModels);
+    }
+    {
+        CAircraftModelListModel model(CAircraftModelListModel::OwnModelSet);
+        run(out, "models diff    ", model, models, updates, changeModels);
+    }
+    {
+        CResetSimulatedAircraftListModel model;
+        run(out, "aircraft reset ", model, aircraft, updates, changeAircraft);
+    }
+    {
+        CSimulatedAircraftListModel model;
+        run(out, "aircraft diff  ", model, aircraft, updates, changeAircraft);
+    }
+    {
+        CAircraftModelListModel model(CAircraftModelListModel::OwnModelSet);
+        sortAndScroll(out, "models         ", model, models);
+    }
+    return EXIT_SUCCESS;
+}
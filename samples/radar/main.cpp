@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+//! \ingroup sampleradar
+//! Renders a radar with many moving targets and reports the frame times, once rebuilding all items per frame as the
+//! radar component used to and once with the retained targets updated in place.
+//! Run with QT_QPA_PLATFORM=offscreen on machines without display.
+
+#include <cmath>
+#include <cstdlib>
+
+#include <QApplication>
+#include <QCommandLineOption>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QGraphicsEllipseItem>
+#include <QGraphicsItemGroup>
+#include <QGraphicsLineItem>
+#include <QGraphicsScene>
+#include <QGraphicsTextItem>
+#include <QPixmap>
+#include <QRandomGenerator>
+#include <QStringBuilder>
+#include <QTextStream>
+#include <QtMath>
+
+#include "gui/views/radartargets.h"
+#include "gui/views/radarview.h"
+#include "misc/aviation/aircraftsituationlist.h"
+#include "misc/aviation/altitude.h"
+#include "misc/aviation/heading.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/latencyhistogram.h"
+#include "misc/pq/units.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+using namespace swift::gui::views;
+
+namespace
+{
+    //! Synthetic traffic around the own position
+    class CTraffic
+    {
+    public:
+        //! Constructor
+        CTraffic(int count, double latitudeDeg, double longitudeDeg)
+        {
+            QRandomGenerator random(4711);
+            for (int i = 0; i < count; i++)
+            {
+                Aircraft a;
+                a.callsign = CCallsign(QStringLiteral("SWF%1").arg(i));
+                a.latitudeDeg = latitudeDeg + (random.generateDouble() - 0.5);
+                a.longitudeDeg = longitudeDeg + (random.generateDouble() - 0.5);
+                a.headingDeg = random.bounded(360.0);
+                a.groundSpeedKts = 120.0 + random.bounded(350.0);
+                a.altitudeFt = 1000.0 * random.bounded(1, 40);
+                m_aircraft.push_back(a);
+            }
+        }
+
+        //! Move every n-th aircraft, starting with offset, by the time passed
+        CAircraftSituationList move(int every, int offset, double seconds)
+        {
+            CAircraftSituationList situations;
+            for (int i = offset; i < m_aircraft.size(); i += every)
+            {
+                Aircraft &a = m_aircraft[i];
+                const double distanceDeg = a.groundSpeedKts * seconds / 3600.0 / 60.0;
+                const double headingRad = qDegreesToRadians(a.headingDeg);
+                a.latitudeDeg += distanceDeg * std::cos(headingRad);
+                a.longitudeDeg += distanceDeg * std::sin(headingRad) / std::cos(qDegreesToRadians(a.latitudeDeg));
+                situations.push_back(situation(a));
+            }
+            return situations;
+        }
+
+        //! All aircraft
+        CAircraftSituationList all() const
+        {
+            CAircraftSituationList situations;
+            for (const Aircraft &a : m_aircraft) { situations.push_back(situation(a)); }
+            return situations;
+        }
+
+    private:
+        struct Aircraft
+        {
+            CCallsign callsign;
+            double latitudeDeg = 0;
+            double longitudeDeg = 0;
+            double headingDeg = 0;
+            double groundSpeedKts = 0;
+            double altitudeFt = 0;
+        };
+
+        static CAircraftSituation situation(const Aircraft &a)
+        {
+            const CCoordinateGeodetic position(CLatitude(a.latitudeDeg, CAngleUnit::deg()),
+                                               CLongitude(a.longitudeDeg, CAngleUnit::deg()),
+                                               CAltitude(a.altitudeFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
+            return CAircraftSituation(a.callsign, position, CHeading(a.headingDeg, CHeading::True, CAngleUnit::deg()),
+                                      {}, {}, CSpeed(a.groundSpeedKts, CSpeedUnit::kts()));
+        }
+
+        QVector<Aircraft> m_aircraft;
+    };
+
+    //! Targets as the radar component created them before, all items rebuilt per update
+    void rebuildAll(QGraphicsItemGroup &group, const CAircraftSituationList &situations, const CCoordinateGeodetic &own,
+                    const QFont &font)
+    {
+        qDeleteAll(group.childItems());
+        QPen pen(Qt::green, 1);
+        pen.setCosmetic(true);
+        for (const CAircraftSituation &situation : situations)
+        {
+            const double distanceNM = situation.calculateGreatCircleDistance(own).value(CLengthUnit::NM());
+            const double bearingRad = own.calculateBearing(situation).value(CAngleUnit::rad());
+            const QPointF position(distanceNM * std::sin(bearingRad), -distanceNM * std::cos(bearingRad));
+
+            auto *dot = new QGraphicsEllipseItem(-2.0, -2.0, 4.0, 4.0, &group);
+            dot->setPos(position);
+            dot->setPen(pen);
+            dot->setBrush(pen.color());
+            dot->setFlags(QGraphicsItem::ItemIgnoresTransformations);
+
+            auto *tag = new QGraphicsTextItem(&group);
+            const int flightLevel = situation.getAltitude().valueInteger(CLengthUnit::ft()) / 100;
+            const int groundSpeedKts = situation.getGroundSpeed().valueInteger(CSpeedUnit::kts());
+            tag->setPlainText(situation.getCallsign().asString() % u"\nFL" %
+                              QStringLiteral("%1").arg(flightLevel, 3, 10, QChar('0')) % u' ' %
+                              QString::number(groundSpeedKts) % u" kt");
+            tag->setFont(font);
+            tag->setPos(position);
+            tag->setDefaultTextColor(Qt::green);
+            tag->setFlags(QGraphicsItem::ItemIgnoresTransformations);
+
+            const double headingRad = situation.getHeading().value(CAngleUnit::rad());
+            const QLineF headingLine(0.0, 0.0, 5.0 * std::sin(headingRad), -5.0 * std::cos(headingRad));
+            auto *line = new QGraphicsLineItem(headingLine, &group);
+            line->setPos(position);
+            line->setPen(pen);
+        }
+    }
+} // namespace
+
+//! main
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Radar frame times");
+    parser.addHelpOption();
+    const QCommandLineOption targetsOption("targets", "Number of targets", "count", "1000");
+    const QCommandLineOption framesOption("frames", "Frames rendered per run", "count", "300");
+    const QCommandLineOption everyOption("every", "Each frame moves every n-th target", "n", "5");
+    parser.addOptions({ targetsOption, framesOption, everyOption });
+    parser.process(app);
+    const int targets = qMax(1, parser.value(targetsOption).toInt());
+    const int frames = qMax(1, parser.value(framesOption).toInt());
+    const int every = qMax(1, parser.value(everyOption).toInt());
+
+    constexpr double rangeNM = 40.0;
+    constexpr double frameSeconds = 1.0 / 30.0;
+    const CCoordinateGeodetic own(48.353, 11.786);
+
+    QGraphicsScene scene;
+    scene.setItemIndexMethod(QGraphicsScene::NoIndex);
+    CRadarView view;
+    view.setScene(&scene);
+    view.resize(800, 800);
+    view.show();
+    view.fitInView(-rangeNM, -rangeNM, 2.0 * rangeNM, 2.0 * rangeNM, Qt::KeepAspectRatio);
+    QTextStream out(stdout);
+
+    // before: every update deletes and creates all items
+    {
+        CTraffic traffic(targets, own.latitude().value(CAngleUnit::deg()), own.longitude().value(CAngleUnit::deg()));
+        QGraphicsItemGroup group;
+        scene.addItem(&group);
+        CLatencyHistogram update;
+        CLatencyHistogram frame;
+        QElapsedTimer timer;
+        for (int i = 0; i < frames; i++)
+        {
+            timer.start();
+            traffic.move(every, i % every, frameSeconds * every);
+            rebuildAll(group, traffic.all(), own, app.font());
+            update.record(timer.nsecsElapsed());
+            view.viewport()->grab();
+            frame.record(timer.nsecsElapsed());
+        }
+        scene.removeItem(&group);
+        qDeleteAll(group.childItems());
+        out << "rebuild all    update " << update.toQString() << Qt::endl;
+        out << "rebuild all    frame  " << frame.toQString() << Qt::endl;
+    }
+
+    // after: targets kept, only the moved ones are updated
+    {
+        CTraffic traffic(targets, own.latitude().value(CAngleUnit::deg()), own.longitude().value(CAngleUnit::deg()));
+        CRadarTargets radarTargets;
+        radarTargets.setTagFont(app.font());
+        scene.addItem(&radarTargets);
+        radarTargets.setOwnPosition(own);
+        radarTargets.updateTargets(traffic.all());
+        CLatencyHistogram update;
+        CLatencyHistogram frame;
+        QElapsedTimer timer;
+        for (int i = 0; i < frames; i++)
+        {
+            timer.start();
+            radarTargets.updateTargets(traffic.move(every, i % every, frameSeconds * every));
+            update.record(timer.nsecsElapsed());
+            view.viewport()->grab();
+            frame.record(timer.nsecsElapsed());
+        }
+        scene.removeItem(&radarTargets);
+        out << "retained       update " << update.toQString() << Qt::endl;
+        out << "retained       frame  " << frame.toQString() << Qt::endl;
+    }
+    return EXIT_SUCCESS;
+}
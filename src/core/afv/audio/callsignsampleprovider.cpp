@@ -8,11 +8,8 @@
 #include <QtMath>
 
 #include "config/buildconfig.h"
-#include "core/afv/audio/callsigndelaycache.h"
 #include "core/afv/audio/receiversampleprovider.h"
-#include "misc/logmessage.h"
 #include "misc/metadatautils.h"
-#include "sound/audioutilities.h"
 #include "sound/sampleprovider/samples.h"
 
 using namespace swift::misc;
@@ -22,9 +19,9 @@ using namespace swift::config;
 namespace swift::core::afv::audio
 {
     CCallsignSampleProvider::CCallsignSampleProvider(const QAudioFormat &audioFormat,
-                                                     const CReceiverSampleProvider *receiver, QObject *parent)
-        : ISampleProvider(parent), m_audioFormat(audioFormat), m_receiver(receiver),
-          m_decoder(audioFormat.sampleRate(), 1)
+                                                     const CReceiverSampleProvider *receiver,
+                                                     COpusDecodeWorker *decodeWorker, QObject *parent)
+        : ISampleProvider(parent), m_audioFormat(audioFormat), m_receiver(receiver)
     {
         Q_ASSERT(audioFormat.channelCount() == 1);
         Q_ASSERT(receiver);
@@ -43,10 +40,10 @@ namespace swift::core::afv::audio
         m_hfWhiteNoise->setLooping(true);
         m_hfWhiteNoise->setGain(0.0);
         m_acBusNoise = new CSawToothGenerator(400, m_mixer);
-        m_audioInput = new CBufferedWaveProvider(audioFormat, m_mixer);
+        m_jitterBuffer = new CJitterBuffer(audioFormat.sampleRate(), decodeWorker, m_mixer);
 
         // Create the compressor
-        m_simpleCompressorEffect = new CSimpleCompressorEffect(m_audioInput, m_mixer);
+        m_simpleCompressorEffect = new CSimpleCompressorEffect(m_jitterBuffer, m_mixer);
         m_simpleCompressorEffect->setMakeUpGain(-5.5);
 
         // Create the voice EQ
@@ -69,25 +66,17 @@ namespace swift::core::afv::audio
     {
         const int noOfSamples = m_mixer->readSamples(samples, count);
 
-        if (m_inUse && m_lastPacketLatch && m_audioInput->getBufferedBytes() == 0)
+        if (m_inUse && m_lastPacketLatch && m_jitterBuffer->getBufferedSamples() == 0)
         {
             idle();
             m_lastPacketLatch = false;
         }
-
-        if (m_inUse && !m_underflow && m_audioInput->getBufferedBytes() == 0)
-        {
-            if (verbose()) { CLogMessage(this).debug(u"[%1] [Delay++]") << m_callsign; }
-            CallsignDelayCache::instance().underflow(m_callsign);
-            m_underflow = true;
-        }
-
         return noOfSamples;
     }
 
     void CCallsignSampleProvider::timerElapsed()
     {
-        if (m_inUse && m_audioInput->getBufferedBytes() == 0 &&
+        if (m_inUse && m_jitterBuffer->getBufferedSamples() == 0 &&
             m_lastSamplesAddedUtc.msecsTo(QDateTime::currentDateTimeUtc()) > m_idleTimeoutMs)
         {
             idle();
@@ -96,39 +85,27 @@ namespace swift::core::afv::audio
 
     void CCallsignSampleProvider::active(const QString &callsign, const QString &aircraftType)
     {
+        // the jitter buffer delays playing until enough is buffered
         m_callsign = callsign;
-        CallsignDelayCache::instance().initialise(callsign);
         m_aircraftType = aircraftType;
-        m_decoder.resetState();
+        m_jitterBuffer->reset();
         m_inUse = true;
         setEffects();
-        m_underflow = false;
-
-        const int delayMs = CallsignDelayCache::instance().get(callsign);
-        if (verbose()) { CLogMessage(this).debug(u"[%1] [Delay %2ms]") << m_callsign << delayMs; }
-        if (delayMs > 0)
-        {
-            const int phaseDelayLength = (m_audioFormat.sampleRate() / 1000) * delayMs;
-            const QVector<float> phaseDelay(phaseDelayLength * 2, 0);
-            m_audioInput->addSamples(phaseDelay);
-        }
     }
 
     void CCallsignSampleProvider::activeSilent(const QString &callsign, const QString &aircraftType)
     {
         m_callsign = callsign;
-        CallsignDelayCache::instance().initialise(callsign);
         m_aircraftType = aircraftType;
-        m_decoder.resetState();
+        m_jitterBuffer->reset();
         m_inUse = true;
         setEffects(true);
-        m_underflow = true;
     }
 
     void CCallsignSampleProvider::clear()
     {
         idle();
-        m_audioInput->clearBuffer();
+        m_jitterBuffer->reset();
     }
 
     void CCallsignSampleProvider::addOpusSamples(const IAudioDto &audioDto, float distanceRatio)
@@ -136,10 +113,9 @@ namespace swift::core::afv::audio
         m_distanceRatio = distanceRatio;
         setEffects();
 
-        const QVector<qint16> audio = decodeOpus(audioDto.audio);
-        m_audioInput->addSamples(swift::sound::convertFromShortToFloat(audio));
+        // decoded by the worker
+        m_jitterBuffer->addPacket(audioDto.audio, audioDto.sequenceCounter, audioDto.lastPacket);
         m_lastPacketLatch = audioDto.lastPacket;
-        if (audioDto.lastPacket && !m_underflow) { CallsignDelayCache::instance().success(m_callsign); }
         m_lastSamplesAddedUtc = QDateTime::currentDateTimeUtc();
         if (!m_timer->isActive()) { m_timer->start(); }
     }
@@ -165,13 +141,6 @@ namespace swift::core::afv::audio
         m_aircraftType.clear();
     }
 
-    QVector<qint16> CCallsignSampleProvider::decodeOpus(const QByteArray &opusData)
-    {
-        int decodedLength = 0;
-        const QVector<qint16> decoded = m_decoder.decode(opusData, opusData.size(), &decodedLength);
-        return decoded;
-    }
-
     void CCallsignSampleProvider::setEffects(bool noEffects)
     {
         if (noEffects || m_bypassEffects || !m_inUse)
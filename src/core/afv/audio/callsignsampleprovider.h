@@ -11,9 +11,8 @@
 #include <QSoundEffect>
 #include <QTimer>
 
+#include "core/afv/audio/jitterbuffer.h"
 #include "core/afv/dto.h"
-#include "sound/codecs/opusdecoder.h"
-#include "sound/sampleprovider/bufferedwaveprovider.h"
 #include "sound/sampleprovider/equalizersampleprovider.h"
 #include "sound/sampleprovider/mixingsampleprovider.h"
 #include "sound/sampleprovider/resourcesoundsampleprovider.h"
@@ -22,6 +21,7 @@
 
 namespace swift::core::afv::audio
 {
+    class COpusDecodeWorker;
     class CReceiverSampleProvider;
 
     //! Callsign provider
@@ -33,7 +33,7 @@ namespace swift::core::afv::audio
         //! Ctor
         CCallsignSampleProvider(const QAudioFormat &audioFormat,
                                 const swift::core::afv::audio::CReceiverSampleProvider *receiver,
-                                QObject *parent = nullptr);
+                                COpusDecodeWorker *decodeWorker, QObject *parent = nullptr);
 
         //! Read samples
         int readSamples(QVector<float> &samples, qint64 count) override;
@@ -65,13 +65,16 @@ namespace swift::core::afv::audio
         //! Bypass effects
         void setBypassEffects(bool bypassEffects);
 
+        //! Statistics of the jitter buffer
+        //! \threadsafe
+        JitterBufferStatistics getJitterBufferStatistics() const { return m_jitterBuffer->getStatistics(); }
+
         //! Info
         QString toQString() const;
 
     private:
         void timerElapsed();
         void idle();
-        QVector<qint16> decodeOpus(const QByteArray &opusData);
         void setEffects(bool noEffects = false);
 
         QAudioFormat m_audioFormat;
@@ -96,13 +99,11 @@ namespace swift::core::afv::audio
         swift::sound::sample_provider::CSawToothGenerator *m_acBusNoise = nullptr;
         swift::sound::sample_provider::CSimpleCompressorEffect *m_simpleCompressorEffect = nullptr;
         swift::sound::sample_provider::CEqualizerSampleProvider *m_voiceEqualizer = nullptr;
-        swift::sound::sample_provider::CBufferedWaveProvider *m_audioInput = nullptr;
+        CJitterBuffer *m_jitterBuffer = nullptr;
         QTimer *m_timer = nullptr;
 
-        swift::sound::codecs::COpusDecoder m_decoder;
         bool m_lastPacketLatch = false;
         QDateTime m_lastSamplesAddedUtc;
-        bool m_underflow = false;
     };
 } // namespace swift::core::afv::audio
 
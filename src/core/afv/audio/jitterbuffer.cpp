@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "core/afv/audio/jitterbuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <QStringBuilder>
+
+#include "core/afv/audio/opusdecodeworker.h"
+
+namespace swift::core::afv::audio
+{
+    namespace
+    {
+        //! Target depth for a jitter, a frame is added for each third of a frame of jitter
+        int targetDepthFrames(double jitterMs)
+        {
+            const int frames =
+                CJitterBuffer::MinDepthFrames + static_cast<int>(std::ceil(3.0 * jitterMs / CJitterBuffer::FrameMs));
+            return std::clamp(frames, CJitterBuffer::MinDepthFrames, CJitterBuffer::MaxDepthFrames);
+        }
+    } // namespace
+
+    JitterBufferStatistics &JitterBufferStatistics::operator+=(const JitterBufferStatistics &other)
+    {
+        received += other.received;
+        late += other.late;
+        lost += other.lost;
+        concealed += other.concealed;
+        dropped += other.dropped;
+        underruns += other.underruns;
+        depthFrames = qMax(depthFrames, other.depthFrames);
+        targetDepthFrames = qMax(targetDepthFrames, other.targetDepthFrames);
+        jitterMs = qMax(jitterMs, other.jitterMs);
+        return *this;
+    }
+
+    QString JitterBufferStatistics::toQString() const
+    {
+        return u"received: " % QString::number(received) % u" late: " % QString::number(late) % u" lost: " %
+               QString::number(lost) % u" concealed: " % QString::number(concealed) % u" dropped: " %
+               QString::number(dropped) % u" underruns: " % QString::number(underruns) % u" depth: " %
+               QString::number(depthFrames) % u'/' % QString::number(targetDepthFrames) % u" frames jitter: " %
+               QString::number(jitterMs, 'f', 1) % u"ms";
+    }
+
+    CJitterBuffer::CJitterBuffer(int sampleRate, COpusDecodeWorker *worker, QObject *parent)
+        : ISampleProvider(parent), m_worker(worker), m_decoder(sampleRate, 1)
+    {
+        Q_ASSERT_X(worker, Q_FUNC_INFO, "need worker");
+        this->setObjectName(QStringLiteral("CJitterBuffer"));
+        m_targetDepthFrames = targetDepthFrames(InitialJitterMs);
+        m_clock.start();
+        m_worker->add(this);
+    }
+
+    CJitterBuffer::~CJitterBuffer() { m_worker->remove(this); }
+
+    bool CJitterBuffer::addPacket(QByteArrayView opusData, uint sequence, bool lastPacket)
+    {
+        EncodedPacket *packet = opusData.size() <= MaxPacketBytes ? m_packets.beginPush() : nullptr;
+        if (!packet)
+        {
+            m_dropped++;
+            return false;
+        }
+        std::memcpy(packet->data.data(), opusData.data(), static_cast<std::size_t>(opusData.size()));
+        packet->length = static_cast<int>(opusData.size());
+        packet->sequence = sequence;
+        packet->lastPacket = lastPacket;
+        packet->generation = m_generation;
+        packet->arrivalNs = m_clock.nsecsElapsed();
+        m_packets.endPush();
+        m_worker->wakeUp();
+        return true;
+    }
+
+    void CJitterBuffer::reset()
+    {
+        // frames and packets still queued are recognized by their generation and dropped
+        m_generation++;
+        m_readOffset = 0;
+        m_playing = false;
+        this->dropStaleFrames();
+    }
+
+    void CJitterBuffer::dropStaleFrames()
+    {
+        for (const DecodedFrame *frame = m_frames.front(); frame && frame->generation != m_generation;
+             frame = m_frames.front())
+        {
+            m_frames.pop();
+        }
+    }
+
+    int CJitterBuffer::readSamples(QVector<float> &samples, qint64 count)
+    {
+        this->dropStaleFrames();
+        const bool ended = m_endedGeneration.load(std::memory_order_acquire) == m_generation;
+        if (!m_playing)
+        {
+            // wait for the target depth, short transmissions are played when complete
+            const int frames = m_frames.size();
+            if (frames == 0 || (frames < m_targetDepthFrames && !ended))
+            {
+                samples.clear();
+                return 0;
+            }
+            m_playing = true;
+        }
+
+        samples.resize(static_cast<int>(count));
+        int copied = 0;
+        while (copied < count)
+        {
+            const DecodedFrame *frame = m_frames.front();
+            if (!frame) { break; }
+            if (frame->generation != m_generation)
+            {
+                m_frames.pop();
+                continue;
+            }
+            const int n = qMin(FrameSize - m_readOffset, static_cast<int>(count) - copied);
+            std::copy_n(frame->samples.data() + m_readOffset, n, samples.data() + copied);
+            copied += n;
+            m_readOffset += n;
+            if (m_readOffset < FrameSize) { continue; }
+            m_readOffset = 0;
+            m_frames.pop();
+        }
+        samples.resize(copied);
+
+        if (copied < count)
+        {
+            // drained, at the end of the transmission this is expected
+            m_playing = false;
+            if (!ended) { m_underruns++; }
+        }
+        return copied;
+    }
+
+    int CJitterBuffer::getBufferedSamples() const
+    {
+        // packets not yet decoded count as one frame each
+        const int frames = m_frames.size();
+        const int pending = m_packets.size() * FrameSize;
+        return frames > 0 ? pending + frames * FrameSize - m_readOffset : pending;
+    }
+
+    JitterBufferStatistics CJitterBuffer::getStatistics() const
+    {
+        JitterBufferStatistics statistics;
+        statistics.received = m_received;
+        statistics.late = m_late;
+        statistics.lost = m_lost;
+        statistics.concealed = m_concealed;
+        statistics.dropped = m_dropped;
+        statistics.underruns = m_underruns;
+        statistics.depthFrames = m_frames.size();
+        statistics.targetDepthFrames = m_targetDepthFrames;
+        statistics.jitterMs = m_jitterUs / 1000.0;
+        return statistics;
+    }
+
+    void CJitterBuffer::resetStatistics()
+    {
+        m_received = 0;
+        m_late = 0;
+        m_lost = 0;
+        m_concealed = 0;
+        m_dropped = 0;
+        m_underruns = 0;
+    }
+
+    void CJitterBuffer::decodePending()
+    {
+        for (const EncodedPacket *packet = m_packets.front(); packet; packet = m_packets.front())
+        {
+            this->decode(*packet);
+            m_packets.pop();
+        }
+    }
+
+    void CJitterBuffer::decode(const EncodedPacket &packet)
+    {
+        m_received++;
+        if (packet.generation != m_decodeGeneration)
+        {
+            // new transmission
+            m_decodeGeneration = packet.generation;
+            m_decoder.resetState();
+            m_hasSequence = false;
+        }
+
+        if (m_hasSequence)
+        {
+            const qint64 delta = static_cast<qint64>(packet.sequence) - static_cast<qint64>(m_lastSequence);
+            if (delta <= 0)
+            {
+                // its time has passed, concealed or already played
+                m_late++;
+                return;
+            }
+
+            // interarrival jitter as in RFC 3550, the expected interval is the frame duration
+            const double intervalMs = (packet.arrivalNs - m_lastArrivalNs) / 1.0e6;
+            const double transitMs = intervalMs - static_cast<double>(delta * FrameMs);
+            m_jitterMs += (qAbs(transitMs) - m_jitterMs) / 16.0;
+            m_jitterUs = static_cast<qint64>(m_jitterMs * 1000.0);
+            m_targetDepthFrames = targetDepthFrames(m_jitterMs);
+
+            const qint64 missing = delta - 1;
+            if (missing > 0)
+            {
+                m_lost += missing;
+                const int conceal = static_cast<int>(qMin<qint64>(missing, MaxConcealedFrames));
+                for (int i = 0; i < conceal; i++)
+                {
+                    const int decoded = m_decoder.decode({}, m_pcm.data(), FrameSize);
+                    if (!this->pushFrame(decoded, packet.generation)) { break; }
+                    m_concealed++;
+                }
+            }
+        }
+        m_hasSequence = true;
+        m_lastSequence = packet.sequence;
+        m_lastArrivalNs = packet.arrivalNs;
+
+        const int decoded =
+            m_decoder.decode(QByteArrayView(packet.data.data(), packet.length), m_pcm.data(), FrameSize);
+        if (decoded < 0) { m_lost++; }
+        this->pushFrame(decoded, packet.generation);
+        if (packet.lastPacket) { m_endedGeneration.store(packet.generation, std::memory_order_release); }
+    }
+
+    bool CJitterBuffer::pushFrame(int decodedSamples, quint32 generation)
+    {
+        if (decodedSamples < 0) { decodedSamples = 0; }
+        DecodedFrame *frame = m_frames.beginPush();
+        if (!frame)
+        {
+            m_dropped++;
+            return false;
+        }
+        constexpr float scale = 1.0F / 32768.0F;
+        for (int i = 0; i < decodedSamples; i++) { frame->samples[i] = m_pcm[i] * scale; }
+        std::fill(frame->samples.begin() + decodedSamples, frame->samples.end(), 0.0F);
+        frame->generation = generation;
+        m_frames.endPush();
+        return true;
+    }
+} // namespace swift::core::afv::audio
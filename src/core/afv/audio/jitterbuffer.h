@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_CORE_AFV_AUDIO_JITTERBUFFER_H
+#define SWIFT_CORE_AFV_AUDIO_JITTERBUFFER_H
+
+#include <array>
+#include <atomic>
+
+#include <QByteArrayView>
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+#include "core/swiftcoreexport.h"
+#include "misc/spscqueue.h"
+#include "sound/codecs/opusdecoder.h"
+#include "sound/sampleprovider/sampleprovider.h"
+
+namespace swift::core::afv::audio
+{
+    class COpusDecodeWorker;
+
+    //! Statistics of jitter buffers
+    struct SWIFT_CORE_EXPORT JitterBufferStatistics
+    {
+        qint64 received = 0; //!< packets received
+        qint64 late = 0; //!< packets dropped, they arrived after a later packet of the same transmission
+        qint64 lost = 0; //!< packets never received
+        qint64 concealed = 0; //!< frames generated by the decoder for lost packets
+        qint64 dropped = 0; //!< packets or frames dropped because the buffer was full
+        qint64 underruns = 0; //!< buffer ran empty while playing, it is filled again before playing on
+        int depthFrames = 0; //!< decoded frames waiting to be played
+        int targetDepthFrames = 0; //!< frames buffered before playing starts
+        double jitterMs = 0.0; //!< packet inter-arrival jitter
+
+        //! Add the statistics of another buffer, depth and jitter are the maximum of both
+        JitterBufferStatistics &operator+=(const JitterBufferStatistics &other);
+
+        //! As string
+        QString toQString() const;
+    };
+
+    /*!
+     * Jitter buffer of a callsign, decoded by a COpusDecodeWorker and played by the audio thread.
+     *
+     * Packets are queued by addPacket, the worker decodes them and queues the frames. Both queues are lock free and
+     * preallocated. Playing starts when the target depth is buffered, the target follows the measured inter-arrival
+     * jitter. Lost packets are concealed by the decoder.
+     * \remark addPacket, reset and readSamples have to be called by the same (audio) thread
+     */
+    class SWIFT_CORE_EXPORT CJitterBuffer : public swift::sound::sample_provider::ISampleProvider
+    {
+        Q_OBJECT
+
+    public:
+        static constexpr int FrameSize = 960; //!< samples per frame, 20ms at 48kHz
+        static constexpr int FrameMs = 20; //!< duration of a frame
+        static constexpr int MinDepthFrames = 2; //!< min. target depth
+        static constexpr int MaxDepthFrames = 15; //!< max. target depth
+        static constexpr int MaxPacketBytes = 1275; //!< largest Opus packet
+        static constexpr int MaxConcealedFrames = 3; //!< longer gaps are not concealed
+        static constexpr double InitialJitterMs = 6.0; //!< before measured, 60ms target depth
+
+        //! Ctor, registers with the worker
+        CJitterBuffer(int sampleRate, COpusDecodeWorker *worker, QObject *parent = nullptr);
+
+        //! Dtor, unregisters from the worker
+        ~CJitterBuffer() override;
+
+        //! Queue an Opus packet to be decoded
+        //! \return false if dropped
+        bool addPacket(QByteArrayView opusData, uint sequence, bool lastPacket);
+
+        //! Drop all packets and frames, the next packet starts a new transmission
+        void reset();
+
+        //! \copydoc swift::sound::sample_provider::ISampleProvider::readSamples
+        int readSamples(QVector<float> &samples, qint64 count) override;
+
+        //! Samples not yet played, including the packets not yet decoded
+        int getBufferedSamples() const;
+
+        //! Statistics
+        //! \threadsafe
+        JitterBufferStatistics getStatistics() const;
+
+        //! Reset statistics
+        //! \threadsafe
+        void resetStatistics();
+
+        //! Decode all queued packets
+        //! \remark called by the worker thread
+        void decodePending();
+
+    private:
+        //! Packet queued for decoding
+        struct EncodedPacket
+        {
+            std::array<char, MaxPacketBytes> data; //!< Opus data
+            int length = 0; //!< bytes in data
+            uint sequence = 0; //!< sequence of the transmission
+            bool lastPacket = false; //!< last packet of the transmission
+            quint32 generation = 0; //!< transmission
+            qint64 arrivalNs = 0; //!< when received
+        };
+
+        //! Decoded frame
+        struct DecodedFrame
+        {
+            std::array<float, FrameSize> samples; //!< samples
+            quint32 generation = 0; //!< transmission
+        };
+
+        //! Decode a packet, conceals the packets lost before
+        void decode(const EncodedPacket &packet);
+
+        //! Queue a frame decoded into m_pcm, false if the buffer is full
+        bool pushFrame(int decodedSamples, quint32 generation);
+
+        //! Drop frames of previous transmissions
+        void dropStaleFrames();
+
+        COpusDecodeWorker *m_worker = nullptr;
+        QElapsedTimer m_clock;
+        swift::misc::CSpscQueue<EncodedPacket> m_packets { 16 };
+        swift::misc::CSpscQueue<DecodedFrame> m_frames { MaxDepthFrames + 5 };
+
+        // audio thread
+        quint32 m_generation = 1;
+        int m_readOffset = 0; //!< samples of the front frame already played
+        bool m_playing = false;
+
+        // worker thread
+        swift::sound::codecs::COpusDecoder m_decoder;
+        std::array<qint16, FrameSize> m_pcm {};
+        quint32 m_decodeGeneration = 0;
+        bool m_hasSequence = false;
+        uint m_lastSequence = 0;
+        qint64 m_lastArrivalNs = 0;
+        double m_jitterMs = InitialJitterMs;
+
+        // shared
+        std::atomic<quint32> m_endedGeneration { 0 }; //!< last packet of this transmission decoded
+        std::atomic_int m_targetDepthFrames { MinDepthFrames };
+        std::atomic<qint64> m_jitterUs { static_cast<qint64>(InitialJitterMs * 1000) };
+        std::atomic<qint64> m_received { 0 };
+        std::atomic<qint64> m_late { 0 };
+        std::atomic<qint64> m_lost { 0 };
+        std::atomic<qint64> m_concealed { 0 };
+        std::atomic<qint64> m_dropped { 0 };
+        std::atomic<qint64> m_underruns { 0 };
+    };
+} // namespace swift::core::afv::audio
+
+#endif // SWIFT_CORE_AFV_AUDIO_JITTERBUFFER_H
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "core/afv/audio/opusdecodeworker.h"
+
+#include "core/afv/audio/jitterbuffer.h"
+#include "misc/threadutils.h"
+
+using namespace swift::misc;
+
+namespace swift::core::afv::audio
+{
+    COpusDecodeWorker::COpusDecodeWorker(QObject *owner) : CContinuousWorker(owner, "COpusDecodeWorker") {}
+
+    void COpusDecodeWorker::add(CJitterBuffer *buffer)
+    {
+        QMetaObject::invokeMethod(this, [=] {
+            if (!m_buffers.contains(buffer)) { m_buffers.push_back(buffer); }
+        });
+    }
+
+    void COpusDecodeWorker::remove(CJitterBuffer *buffer)
+    {
+        // not started, quit or called by the worker thread itself
+        if (!this->isEnabled() || CThreadUtils::isInThisThread(this))
+        {
+            m_buffers.removeAll(buffer);
+            return;
+        }
+
+        // runs after a decode in progress, so the buffer can be destroyed afterwards
+        QMetaObject::invokeMethod(this, [=] { m_buffers.removeAll(buffer); }, Qt::BlockingQueuedConnection);
+    }
+
+    void COpusDecodeWorker::wakeUp()
+    {
+        // one queued decode is enough, it decodes everything queued until it runs
+        if (m_wakeUpPending.exchange(true)) { return; }
+        QMetaObject::invokeMethod(this, &COpusDecodeWorker::decodePending, Qt::QueuedConnection);
+    }
+
+    void COpusDecodeWorker::decodePending()
+    {
+        m_wakeUpPending = false; // packets queued from now on wake up again
+        for (CJitterBuffer *buffer : std::as_const(m_buffers)) { buffer->decodePending(); }
+    }
+} // namespace swift::core::afv::audio
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_CORE_AFV_AUDIO_OPUSDECODEWORKER_H
+#define SWIFT_CORE_AFV_AUDIO_OPUSDECODEWORKER_H
+
+#include <atomic>
+
+#include <QObject>
+#include <QVector>
+
+#include "core/swiftcoreexport.h"
+#include "misc/worker.h"
+
+namespace swift::core::afv::audio
+{
+    class CJitterBuffer;
+
+    /*!
+     * Worker decoding the packets queued in the jitter buffers, so the audio thread only queues and plays.
+     *
+     * Queuing packets wakes the worker up, the buffers are only accessed in the worker thread.
+     */
+    class SWIFT_CORE_EXPORT COpusDecodeWorker : public swift::misc::CContinuousWorker
+    {
+        Q_OBJECT
+
+    public:
+        //! Ctor
+        COpusDecodeWorker(QObject *owner);
+
+        //! Register a jitter buffer
+        //! \threadsafe
+        void add(CJitterBuffer *buffer);
+
+        //! Unregister a jitter buffer, waits for a decode in progress
+        //! \remark has to be called before the buffer is destroyed, and not while the worker is quitting
+        //! \threadsafe
+        void remove(CJitterBuffer *buffer);
+
+        //! Packets have been queued
+        //! \threadsafe
+        void wakeUp();
+
+    private:
+        //! Decode the packets of all buffers
+        void decodePending();
+
+        QVector<CJitterBuffer *> m_buffers; //!< worker thread only
+        std::atomic_bool m_wakeUpPending { false }; //!< a decode is queued
+    };
+} // namespace swift::core::afv::audio
+
+#endif // SWIFT_CORE_AFV_AUDIO_OPUSDECODEWORKER_H
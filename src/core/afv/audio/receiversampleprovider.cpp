@@ -26,7 +26,7 @@ namespace swift::core::afv::audio
     }
 
     CReceiverSampleProvider::CReceiverSampleProvider(const QAudioFormat &audioFormat, quint16 id, int voiceInputNumber,
-                                                     QObject *parent)
+                                                     COpusDecodeWorker *decodeWorker, QObject *parent)
         : ISampleProvider(parent), m_id(id)
     {
         const QString on = QStringLiteral("%1 id: %2").arg(classNameShort(this)).arg(id);
@@ -35,7 +35,7 @@ namespace swift::core::afv::audio
         m_mixer = new CMixingSampleProvider(this);
         for (int i = 0; i < voiceInputNumber; i++)
         {
-            const auto voiceInput = new CCallsignSampleProvider(audioFormat, this, m_mixer);
+            const auto voiceInput = new CCallsignSampleProvider(audioFormat, this, decodeWorker, m_mixer);
             m_voiceInputs.push_back(voiceInput);
             m_mixer->addMixerInput(voiceInput);
         }
@@ -43,6 +43,15 @@ namespace swift::core::afv::audio
         m_blockTone = new CSinusGenerator(180, this);
         m_mixer->addMixerInput(m_blockTone);
         m_volume = new CVolumeSampleProvider(m_mixer);
+        this->onSettingsChanged();
+    }
+
+    void CReceiverSampleProvider::onSettingsChanged()
+    {
+        // read once here, not for every received packet
+        const CSettings s = m_audioSettings.get();
+        m_afvClicked = s.afvClicked();
+        m_afvBlocked = s.afvBlocked();
     }
 
     void CReceiverSampleProvider::setBypassEffects(bool value)
@@ -121,7 +130,7 @@ namespace swift::core::afv::audio
 
         auto it =
             std::find_if(m_voiceInputs.begin(), m_voiceInputs.end(),
-                         [audioDto](const CCallsignSampleProvider *p) { return p->callsign() == audioDto.callsign; });
+                         [&audioDto](const CCallsignSampleProvider *p) { return p->callsign() == audioDto.callsign; });
 
         if (it != m_voiceInputs.end()) { voiceInput = *it; }
 
@@ -138,9 +147,8 @@ namespace swift::core::afv::audio
 
         if (voiceInput) { voiceInput->addOpusSamples(audioDto, distanceRatio); }
 
-        const CSettings s = m_audioSettings.get();
-        m_doClickWhenAppropriate = s.afvClicked();
-        m_doBlockWhenAppropriate = s.afvBlocked();
+        m_doClickWhenAppropriate = m_afvClicked;
+        m_doBlockWhenAppropriate = m_afvBlocked;
     }
 
     void CReceiverSampleProvider::addSilentSamples(const IAudioDto &audioDto, uint frequency, float distanceRatio)
@@ -151,7 +159,7 @@ namespace swift::core::afv::audio
         CCallsignSampleProvider *voiceInput = nullptr;
         auto it =
             std::find_if(m_voiceInputs.begin(), m_voiceInputs.end(),
-                         [audioDto](const CCallsignSampleProvider *p) { return p->callsign() == audioDto.callsign; });
+                         [&audioDto](const CCallsignSampleProvider *p) { return p->callsign() == audioDto.callsign; });
 
         if (it != m_voiceInputs.end()) { voiceInput = *it; }
 
@@ -171,6 +179,16 @@ namespace swift::core::afv::audio
 
     uint CReceiverSampleProvider::getFrequencyHz() const { return m_frequencyHz; }
 
+    JitterBufferStatistics CReceiverSampleProvider::getJitterBufferStatistics() const
+    {
+        JitterBufferStatistics statistics;
+        for (const CCallsignSampleProvider *voiceInput : std::as_const(m_voiceInputs))
+        {
+            statistics += voiceInput->getJitterBufferStatistics();
+        }
+        return statistics;
+    }
+
     void CReceiverSampleProvider::logVoiceInputs(const QString &prefix, qint64 timeCheckOffsetMs)
     {
         if (timeCheckOffsetMs > 100)
@@ -6,6 +6,8 @@
 #ifndef SWIFT_CORE_AFV_AUDIO_RECEIVERSAMPLEPROVIDER_H
 #define SWIFT_CORE_AFV_AUDIO_RECEIVERSAMPLEPROVIDER_H
 
+#include <atomic>
+
 #include <QtGlobal>
 
 #include "core/afv/audio/callsignsampleprovider.h"
@@ -36,7 +38,7 @@ namespace swift::core::afv::audio
 
         //! Ctor
         CReceiverSampleProvider(const QAudioFormat &audioFormat, quint16 id, int voiceInputNumber,
-                                QObject *parent = nullptr);
+                                COpusDecodeWorker *decodeWorker, QObject *parent = nullptr);
 
         //! Bypass effects
         void setBypassEffects(bool value);
@@ -79,6 +81,9 @@ namespace swift::core::afv::audio
         //! Get frequency in Hz
         uint getFrequencyHz() const;
 
+        //! Statistics of the jitter buffers of all callsigns
+        JitterBufferStatistics getJitterBufferStatistics() const;
+
         //! Set gain ratio
         bool setGainRatio(double gainRatio) { return m_volume->setGainRatio(gainRatio); }
 
@@ -91,13 +96,20 @@ namespace swift::core::afv::audio
         void receivingCallsignsChanged(const TransceiverReceivingCallsignsChangedArgs &args);
 
     private:
+        //! Audio settings have been changed
+        void onSettingsChanged();
+
         uint m_frequencyHz = 122800000;
         bool m_mute = false;
         const double m_clickGain = 1.0;
         const double m_blockToneGain = 0.10;
 
         quint16 m_id;
-        swift::misc::CSettingReadOnly<swift::misc::audio::TSettings> m_audioSettings { this };
+        swift::misc::CSettingReadOnly<swift::misc::audio::TSettings> m_audioSettings {
+            this, &CReceiverSampleProvider::onSettingsChanged
+        };
+        std::atomic_bool m_afvClicked { false }; //!< cached setting
+        std::atomic_bool m_afvBlocked { false }; //!< cached setting
 
         swift::sound::sample_provider::CVolumeSampleProvider *m_volume = nullptr;
         swift::sound::sample_provider::CMixingSampleProvider *m_mixer = nullptr;
@@ -3,6 +3,8 @@
 
 #include "core/afv/audio/soundcardsampleprovider.h"
 
+#include <QVarLengthArray>
+
 #include "config/buildconfig.h"
 #include "misc/metadatautils.h"
 
@@ -29,11 +31,14 @@ namespace swift::core::afv::audio
 
         m_mixer = new CMixingSampleProvider(this);
         m_receiverIDs = transceiverIDs;
+        m_decodeWorker = new COpusDecodeWorker(this);
+        m_decodeWorker->start(QThread::TimeCriticalPriority);
 
         constexpr int voiceInputNumber = 4; // number of CallsignSampleProviders
         for (quint16 transceiverID : transceiverIDs)
         {
-            auto transceiverInput = new CReceiverSampleProvider(m_waveFormat, transceiverID, voiceInputNumber, m_mixer);
+            auto transceiverInput = new CReceiverSampleProvider(m_waveFormat, transceiverID, voiceInputNumber,
+                                                                m_decodeWorker, m_mixer);
             connect(transceiverInput, &CReceiverSampleProvider::receivingCallsignsChanged, this,
                     &CSoundcardSampleProvider::receivingCallsignsChanged);
             m_receiverInputs.push_back(transceiverInput);
@@ -42,6 +47,16 @@ namespace swift::core::afv::audio
         }
     }
 
+    CSoundcardSampleProvider::~CSoundcardSampleProvider()
+    {
+        // the jitter buffers unregister from the running worker, so they go first
+        delete m_mixer;
+        m_mixer = nullptr;
+        m_receiverInputs.clear();
+        m_decodeWorker->quitAndWait(); // deletes itself
+        m_decodeWorker = nullptr;
+    }
+
     void CSoundcardSampleProvider::setBypassEffects(bool value)
     {
         for (CReceiverSampleProvider *receiverInput : std::as_const(m_receiverInputs))
@@ -87,15 +102,34 @@ namespace swift::core::afv::audio
         return m_mixer->readSamples(samples, count);
     }
 
-    void CSoundcardSampleProvider::addOpusSamples(const IAudioDto &audioDto,
-                                                  const QVector<RxTransceiverDto> &rxTransceivers)
+    void CSoundcardSampleProvider::addOpusSamples(const AudioRxOnTransceiversDto &dto)
     {
-        QVector<RxTransceiverDto> rxTransceiversFilteredAndSorted = rxTransceivers;
+        IAudioDto audioDto;
+        audioDto.callsign = this->internCallsign(dto.callsign);
+        audioDto.sequenceCounter = dto.sequenceCounter;
+        audioDto.audio = QByteArrayView(dto.audio.data(), static_cast<qsizetype>(dto.audio.size()));
+        audioDto.lastPacket = dto.lastPacket;
+        this->addOpusSamples(audioDto, dto.transceivers);
+    }
+
+    const QString &CSoundcardSampleProvider::internCallsign(const std::string &callsign)
+    {
+        auto it = m_callsigns.find(callsign);
+        if (it != m_callsigns.end()) { return it->second; }
+        if (m_callsigns.size() >= 256) { m_callsigns.clear(); } // many callsigns over time, only few at once
+        it = m_callsigns.emplace(callsign, QString::fromStdString(callsign)).first;
+        return it->second;
+    }
 
-        rxTransceiversFilteredAndSorted.erase(
-            std::remove_if(rxTransceiversFilteredAndSorted.begin(), rxTransceiversFilteredAndSorted.end(),
-                           [this](const RxTransceiverDto &r) { return !m_receiverIDs.contains(r.id); }),
-            rxTransceiversFilteredAndSorted.end());
+    void CSoundcardSampleProvider::addOpusSamples(const IAudioDto &audioDto,
+                                                  const std::vector<RxTransceiverDto> &rxTransceivers)
+    {
+        // a packet is received by a few transceivers only, so no heap allocation here
+        QVarLengthArray<RxTransceiverDto, 8> rxTransceiversFilteredAndSorted;
+        for (const RxTransceiverDto &rxTransceiver : rxTransceivers)
+        {
+            if (m_receiverIDs.contains(rxTransceiver.id)) { rxTransceiversFilteredAndSorted.push_back(rxTransceiver); }
+        }
 
         std::sort(rxTransceiversFilteredAndSorted.begin(), rxTransceiversFilteredAndSorted.end(),
                   [](const RxTransceiverDto &a, const RxTransceiverDto &b) -> bool {
@@ -105,8 +139,8 @@ namespace swift::core::afv::audio
         if (!rxTransceiversFilteredAndSorted.isEmpty())
         {
             bool audioPlayed = false;
-            QVector<quint16> handledTransceiverIDs;
-            for (const auto rxTransceiver : rxTransceiversFilteredAndSorted)
+            QVarLengthArray<quint16, 8> handledTransceiverIDs;
+            for (const RxTransceiverDto &rxTransceiver : rxTransceiversFilteredAndSorted)
             {
                 if (!handledTransceiverIDs.contains(rxTransceiver.id))
                 {
@@ -115,7 +149,7 @@ namespace swift::core::afv::audio
                     CReceiverSampleProvider *receiverInput = nullptr;
                     auto it = std::find_if(
                         m_receiverInputs.begin(), m_receiverInputs.end(),
-                        [rxTransceiver](const CReceiverSampleProvider *p) { return p->getId() == rxTransceiver.id; });
+                        [&rxTransceiver](const CReceiverSampleProvider *p) { return p->getId() == rxTransceiver.id; });
 
                     if (it != m_receiverInputs.end()) { receiverInput = *it; }
 
@@ -180,4 +214,14 @@ namespace swift::core::afv::audio
         return m_receiverInputs.at(transceiverID)->getReceivingCallsigns();
     }
 
+    JitterBufferStatistics CSoundcardSampleProvider::getJitterBufferStatistics() const
+    {
+        JitterBufferStatistics statistics;
+        for (const CReceiverSampleProvider *receiverInput : m_receiverInputs)
+        {
+            statistics += receiverInput->getJitterBufferStatistics();
+        }
+        return statistics;
+    }
+
 } // namespace swift::core::afv::audio
@@ -6,10 +6,16 @@
 #ifndef SWIFT_CORE_AFV_AUDIO_SOUNDCARDSAMPLEPROVIDER_H
 #define SWIFT_CORE_AFV_AUDIO_SOUNDCARDSAMPLEPROVIDER_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <QAudioFormat>
 #include <QObject>
 
+#include "core/afv/audio/opusdecodeworker.h"
 #include "core/afv/audio/receiversampleprovider.h"
+#include "core/swiftcoreexport.h"
 #include "misc/aviation/callsignset.h"
 #include "sound/sampleprovider/mixingsampleprovider.h"
 #include "sound/sampleprovider/sampleprovider.h"
@@ -17,7 +23,7 @@
 namespace swift::core::afv::audio
 {
     //! Soundcard sample
-    class CSoundcardSampleProvider : public swift::sound::sample_provider::ISampleProvider
+    class SWIFT_CORE_EXPORT CSoundcardSampleProvider : public swift::sound::sample_provider::ISampleProvider
     {
         Q_OBJECT
 
@@ -25,6 +31,9 @@ namespace swift::core::afv::audio
         //! Ctor
         CSoundcardSampleProvider(int sampleRate, const QVector<quint16> &transceiverIDs, QObject *parent = nullptr);
 
+        //! Dtor
+        ~CSoundcardSampleProvider() override;
+
         //! Wave format
         const QAudioFormat &waveFormat() const { return m_waveFormat; }
 
@@ -38,7 +47,10 @@ namespace swift::core::afv::audio
         int readSamples(QVector<float> &samples, qint64 count) override;
 
         //! Add OPUS samples
-        void addOpusSamples(const IAudioDto &audioDto, const QVector<RxTransceiverDto> &rxTransceivers);
+        void addOpusSamples(const IAudioDto &audioDto, const std::vector<RxTransceiverDto> &rxTransceivers);
+
+        //! Add OPUS samples of a received packet, the packet is not copied
+        void addOpusSamples(const AudioRxOnTransceiversDto &dto);
 
         //! Update all tranceivers
         void updateRadioTransceivers(const QVector<TransceiverDto> &radioTransceivers);
@@ -52,15 +64,23 @@ namespace swift::core::afv::audio
         //! Setting gain for specified receiver
         bool setGainRatioForTransceiver(quint16 transceiverID, double gainRatio);
 
+        //! Statistics of the jitter buffers of all receivers
+        JitterBufferStatistics getJitterBufferStatistics() const;
+
     signals:
         //! Changed callsigns
         void receivingCallsignsChanged(const TransceiverReceivingCallsignsChangedArgs &args);
 
     private:
+        //! The callsign as QString, all packets of a callsign share the same string
+        const QString &internCallsign(const std::string &callsign);
+
         QAudioFormat m_waveFormat;
+        COpusDecodeWorker *m_decodeWorker = nullptr; //!< decodes for all receivers, deletes itself once quit
         swift::sound::sample_provider::CMixingSampleProvider *m_mixer = nullptr;
         QVector<CReceiverSampleProvider *> m_receiverInputs;
         QVector<quint16> m_receiverIDs;
+        std::unordered_map<std::string, QString> m_callsigns; //!< callsigns of received packets
     };
 
 } // namespace swift::core::afv::audio
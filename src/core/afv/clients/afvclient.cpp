@@ -49,7 +49,8 @@ namespace swift::core::afv::clients
         connect(m_input, &CInput::inputVolumeStream, this, &CAfvClient::inputVolumeStream);
 
         connect(m_output, &COutput::outputVolumeStream, this, &CAfvClient::outputVolumeStream);
-        connect(m_connection, &CClientConnection::audioReceived, this, &CAfvClient::audioOutDataAvailable);
+        connect(m_connection, &CClientConnection::audioReceived, this, &CAfvClient::audioOutDataAvailable,
+                Qt::DirectConnection); // the DTO is reused for the next packet
         connect(m_voiceServerTimer, &QTimer::timeout, this, &CAfvClient::onTimerUpdate);
 
         // deferred init - use swift::misc:: singleShot to call in correct thread, "myself" NOT needed
@@ -869,10 +870,10 @@ namespace swift::core::afv::clients
         if (loopback && transmit)
         {
             IAudioDto audioData;
-            audioData.audio = QByteArray(args.audio.data(), args.audio.size());
+            audioData.audio = args.audio;
             audioData.callsign = QStringLiteral("loopback");
             audioData.lastPacket = false;
-            audioData.sequenceCounter = 0;
+            audioData.sequenceCounter = args.sequenceCounter; // the jitter buffer drops repeated sequences as late
 
             const RxTransceiverDto com1 = { 0, transceivers.size() > 0 ? transceivers[0].frequencyHz : UniCom, 1.0 };
             const RxTransceiverDto com2 = { 1, transceivers.size() > 1 ? transceivers[1].frequencyHz : UniCom, 1.0 };
@@ -919,15 +920,8 @@ namespace swift::core::afv::clients
 
     void CAfvClient::audioOutDataAvailable(const AudioRxOnTransceiversDto &dto)
     {
-        IAudioDto audioData;
-        audioData.audio = QByteArray(dto.audio.data(), static_cast<int>(dto.audio.size()));
-        audioData.callsign = QString::fromStdString(dto.callsign);
-        audioData.lastPacket = dto.lastPacket;
-        audioData.sequenceCounter = dto.sequenceCounter;
-
         QMutexLocker lock(&m_mutexSampleProviders);
-        m_soundcardSampleProvider->addOpusSamples(
-            audioData, QVector<RxTransceiverDto>(dto.transceivers.begin(), dto.transceivers.end()));
+        m_soundcardSampleProvider->addOpusSamples(dto);
     }
 
     void CAfvClient::inputVolumeStream(const InputVolumeStreamArgs &args)
@@ -988,6 +982,13 @@ namespace swift::core::afv::clients
         return coms;
     }
 
+    JitterBufferStatistics CAfvClient::getJitterBufferStatistics() const
+    {
+        QMutexLocker lock(&m_mutexSampleProviders);
+        if (!m_soundcardSampleProvider) { return {}; }
+        return m_soundcardSampleProvider->getJitterBufferStatistics();
+    }
+
     bool CAfvClient::updateVoiceServerUrl(const QString &url)
     {
         QMutexLocker lock(&m_mutexConnection);
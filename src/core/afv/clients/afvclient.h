@@ -276,6 +276,10 @@ namespace swift::core::afv::clients
         QStringList getReceivingCallsignsStringCom1Com2() const;
         //! @}
 
+        //! Receive statistics (late, lost, concealed packets, buffer depth) of all callsigns
+        //! \threadsafe
+        audio::JitterBufferStatistics getJitterBufferStatistics() const;
+
         //! Update the voice server URL
         bool updateVoiceServerUrl(const QString &url);
 
@@ -3,8 +3,6 @@
 
 #include "core/afv/connection/clientconnection.h"
 
-#include <QNetworkDatagram>
-
 #include "config/buildconfig.h"
 #include "misc/logmessage.h"
 
@@ -143,8 +141,14 @@ namespace swift::core::afv::connection
     {
         while (m_udpSocket->hasPendingDatagrams())
         {
-            const QNetworkDatagram datagram = m_udpSocket->receiveDatagram();
-            this->processMessage(datagram.data());
+            // the buffer keeps its capacity, so reading a datagram does not allocate
+            const qint64 size = m_udpSocket->pendingDatagramSize();
+            if (size < 0) { break; }
+            m_datagram.resize(size);
+            const qint64 read = m_udpSocket->readDatagram(m_datagram.data(), size);
+            if (read < 0) { continue; }
+            m_datagram.resize(read);
+            this->processMessage(m_datagram);
         }
     }
 
@@ -156,19 +160,15 @@ namespace swift::core::afv::connection
             return;
         }
 
-        CryptoDtoSerializer::Deserializer deserializer =
-            CryptoDtoSerializer::deserialize(*m_connection.m_voiceCryptoChannel, messageDdata, loopback);
-
-        if (deserializer.m_dtoNameBuffer == AudioRxOnTransceiversDto::getShortDtoName())
+        m_receiveCrypto.deserialize(*m_connection.m_voiceCryptoChannel, messageDdata, loopback);
+        const QByteArray &dtoName = m_receiveCrypto.getDtoName();
+        if (dtoName == AudioRxOnTransceiversDto::getShortDtoName())
         {
-            // qDebug() << "Received audio data";
-            const auto audioOnTransceiverDto = deserializer.getDto<AudioRxOnTransceiversDto>();
-            if (m_connection.isReceivingAudio() && m_connection.isConnected())
-            {
-                emit audioReceived(audioOnTransceiverDto);
-            }
+            // decoded into the same DTO for all packets, the receiver is connected directly
+            if (!m_receiveCrypto.getDto(m_audioRx)) { return; }
+            if (m_connection.isReceivingAudio() && m_connection.isConnected()) { emit audioReceived(m_audioRx); }
         }
-        else if (deserializer.m_dtoNameBuffer == HeartbeatAckDto::getShortDtoName())
+        else if (dtoName == HeartbeatAckDto::getShortDtoName())
         {
             m_connection.setTsHeartbeatToNow();
             if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -179,7 +179,7 @@ namespace swift::core::afv::connection
         else
         {
             CLogMessage(this).warning(u"Received unknown data: %1 %2")
-                << QString(deserializer.m_dtoNameBuffer) << deserializer.m_dataLength;
+                << QString(dtoName) << m_receiveCrypto.getDtoLength();
         }
     }
 
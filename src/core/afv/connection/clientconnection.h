@@ -14,6 +14,7 @@
 
 #include "core/afv/connection/apiserverconnection.h"
 #include "core/afv/connection/clientconnectiondata.h"
+#include "core/afv/crypto/cryptodtocontext.h"
 #include "core/afv/crypto/cryptodtoserializer.h"
 #include "core/afv/dto.h"
 #include "misc/verify.h"
@@ -60,6 +61,7 @@ namespace swift::core::afv::connection
         //! @}
 
         //! Send voice DTO to server
+        //! \remark not threadsafe, calls have to be serialized by the caller
         template <typename T>
         void sendToVoiceServer(const T &dto)
         {
@@ -69,9 +71,10 @@ namespace swift::core::afv::connection
                 return;
             }
             const QUrl voiceServerUrl("udp://" + m_connection.getTokens().VoiceServer.addressIpV4);
-            const QByteArray dataBytes = crypto::CryptoDtoSerializer::serialize(
+            const QByteArrayView packet = m_transmitCrypto.serialize(
                 *m_connection.m_voiceCryptoChannel, crypto::CryptoDtoMode::AEAD_ChaCha20Poly1305, dto);
-            m_udpSocket->writeDatagram(dataBytes, QHostAddress(voiceServerUrl.host()),
+            if (packet.isEmpty()) { return; }
+            m_udpSocket->writeDatagram(packet.data(), packet.size(), QHostAddress(voiceServerUrl.host()),
                                        static_cast<quint16>(voiceServerUrl.port()));
         }
 
@@ -109,6 +112,7 @@ namespace swift::core::afv::connection
 
     signals:
         //! Audio has been received
+        //! \remark the DTO is reused for the next packet, it has to be processed in a direct connection
         void audioReceived(const AudioRxOnTransceiversDto &dto);
 
     private:
@@ -135,6 +139,12 @@ namespace swift::core::afv::connection
 
         // Properties
         bool m_receiveAudioDto = true;
+
+        // Buffers reused for all packets
+        QByteArray m_datagram;
+        AudioRxOnTransceiversDto m_audioRx;
+        crypto::CCryptoDtoContext m_receiveCrypto;
+        crypto::CCryptoDtoContext m_transmitCrypto;
     };
 } // namespace swift::core::afv::connection
 
@@ -12,11 +12,12 @@
 
 #include "core/afv/crypto/cryptodtomode.h"
 #include "core/afv/dto.h"
+#include "core/swiftcoreexport.h"
 
 namespace swift::core::afv::crypto
 {
     //! Crypto channel
-    class CCryptoDtoChannel
+    class SWIFT_CORE_EXPORT CCryptoDtoChannel
     {
     public:
         //! Ctor
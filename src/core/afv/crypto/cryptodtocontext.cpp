@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "core/afv/crypto/cryptodtocontext.h"
+
+#include <array>
+#include <cstring>
+
+#include "sodium.h"
+
+namespace swift::core::afv::crypto
+{
+    namespace
+    {
+        using Nonce = std::array<unsigned char, crypto_aead_chacha20poly1305_IETF_NPUBBYTES>;
+
+        //! Nonce of a packet, a zero id followed by the sequence
+        Nonce nonceForSequence(uint64_t sequence)
+        {
+            Nonce nonce {};
+            static_assert(sizeof(uint32_t) + sizeof(sequence) == crypto_aead_chacha20poly1305_IETF_NPUBBYTES);
+            std::memcpy(nonce.data() + sizeof(uint32_t), &sequence, sizeof(sequence));
+            return nonce;
+        }
+
+        //! Read a length prefix
+        quint16 readLength(const char *data)
+        {
+            quint16 length = 0;
+            std::memcpy(&length, data, sizeof(length));
+            return length;
+        }
+
+        //! Write a length prefix
+        char *writeLength(char *data, quint16 length)
+        {
+            std::memcpy(data, &length, sizeof(length));
+            return data + sizeof(length);
+        }
+    } // namespace
+
+    CCryptoDtoContext::CCryptoDtoContext()
+        : m_headerBuffer(256), m_dtoBuffer(MaxPacketSize), m_zone(4096)
+    {
+        m_packet.reserve(MaxPacketSize);
+        m_payload.reserve(MaxPacketSize);
+        m_dtoName.reserve(32);
+    }
+
+    QByteArrayView CCryptoDtoContext::seal(CCryptoDtoChannel &channel, CryptoDtoMode mode,
+                                           const QByteArray &transmitKey, uint sequenceToSend,
+                                           const QByteArray &dtoShortName)
+    {
+        if (mode != CryptoDtoMode::AEAD_ChaCha20Poly1305) { return {}; }
+        Q_ASSERT_X(transmitKey.size() == crypto_aead_chacha20poly1305_IETF_KEYBYTES, Q_FUNC_INFO, "");
+
+        const QString channelTag = channel.getChannelTag();
+        if (channelTag != m_channelTag)
+        {
+            m_channelTag = channelTag;
+            m_transmitHeader.ChannelTag = channelTag.toStdString();
+        }
+        m_transmitHeader.Sequence = sequenceToSend;
+        m_transmitHeader.Mode = mode;
+        const char *headerData = m_headerBuffer.data();
+        m_headerBuffer.clear();
+        msgpack::pack(m_headerBuffer, m_transmitHeader);
+        if (m_headerBuffer.data() != headerData) { m_growths++; }
+
+        // [header length][header] is the associated data, [name length][name][DTO length][DTO] is encrypted in place
+        const auto headerLength = static_cast<quint16>(m_headerBuffer.size());
+        const auto dtoNameLength = static_cast<quint16>(dtoShortName.size());
+        const auto dtoLength = static_cast<quint16>(m_dtoBuffer.size());
+        const qsizetype adLength = sizeof(headerLength) + headerLength;
+        const qsizetype plainLength = sizeof(dtoNameLength) + dtoNameLength + sizeof(dtoLength) + dtoLength;
+        this->resize(m_packet, adLength + plainLength + crypto_aead_chacha20poly1305_ietf_ABYTES);
+
+        char *out = writeLength(m_packet.data(), headerLength);
+        std::memcpy(out, m_headerBuffer.data(), headerLength);
+        unsigned char *plain = reinterpret_cast<unsigned char *>(out + headerLength);
+        out = writeLength(out + headerLength, dtoNameLength);
+        std::memcpy(out, dtoShortName.constData(), dtoNameLength);
+        out = writeLength(out + dtoNameLength, dtoLength);
+        std::memcpy(out, m_dtoBuffer.data(), dtoLength);
+
+        const Nonce nonce = nonceForSequence(m_transmitHeader.Sequence);
+        const int result = crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            plain, plain + plainLength, nullptr, plain, static_cast<unsigned long long>(plainLength),
+            reinterpret_cast<const unsigned char *>(m_packet.constData()), static_cast<unsigned long long>(adLength),
+            nullptr, nonce.data(), reinterpret_cast<const unsigned char *>(transmitKey.constData()));
+        if (result != 0) { return {}; }
+        return QByteArrayView(m_packet);
+    }
+
+    bool CCryptoDtoContext::deserialize(CCryptoDtoChannel &channel, QByteArrayView packet, bool loopback)
+    {
+        m_verified = false;
+        m_dtoName.resize(0);
+        m_dtoData = {};
+
+        // received data, so all lengths are checked against the packet
+        if (packet.size() < 2) { return false; }
+        const quint16 headerLength = readLength(packet.data());
+        const qsizetype adLength = sizeof(headerLength) + headerLength;
+        const qsizetype cipherLength = packet.size() - adLength - crypto_aead_chacha20poly1305_ietf_ABYTES;
+        if (cipherLength < 2 * static_cast<qsizetype>(sizeof(quint16))) { return false; }
+
+        try
+        {
+            m_zone.clear();
+            std::size_t offset = 0;
+            const msgpack::object header = msgpack::unpack(m_zone, packet.data() + sizeof(headerLength), headerLength,
+                                                           offset, &CCryptoDtoContext::referencePayload);
+            header.convert(m_receiveHeader);
+        }
+        catch (const msgpack::type_error &) { return false; }
+        catch (const msgpack::unpack_error &) { return false; }
+        if (m_receiveHeader.Mode != CryptoDtoMode::AEAD_ChaCha20Poly1305) { return false; }
+
+        const QByteArray key = loopback ? channel.getTransmitKey(CryptoDtoMode::AEAD_ChaCha20Poly1305) :
+                                          channel.getReceiveKey(CryptoDtoMode::AEAD_ChaCha20Poly1305);
+        Q_ASSERT_X(key.size() == crypto_aead_chacha20poly1305_IETF_KEYBYTES, Q_FUNC_INFO, "");
+
+        this->resize(m_payload, cipherLength);
+        const auto *cipher = reinterpret_cast<const unsigned char *>(packet.data() + adLength);
+        const Nonce nonce = nonceForSequence(m_receiveHeader.Sequence);
+        const int result = crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            reinterpret_cast<unsigned char *>(m_payload.data()), nullptr, cipher,
+            static_cast<unsigned long long>(cipherLength), cipher + cipherLength,
+            reinterpret_cast<const unsigned char *>(packet.data()), static_cast<unsigned long long>(adLength),
+            nonce.data(), reinterpret_cast<const unsigned char *>(key.constData()));
+        if (result != 0) { return false; }
+
+        const char *payload = m_payload.constData();
+        const quint16 dtoNameLength = readLength(payload);
+        if (sizeof(quint16) * 2 + dtoNameLength > static_cast<std::size_t>(cipherLength)) { return false; }
+        const quint16 dtoLength = readLength(payload + sizeof(quint16) + dtoNameLength);
+        if (sizeof(quint16) * 2 + dtoNameLength + dtoLength > static_cast<std::size_t>(cipherLength)) { return false; }
+
+        m_dtoName.resize(dtoNameLength);
+        std::memcpy(m_dtoName.data(), payload + sizeof(quint16), dtoNameLength);
+        m_dtoData = QByteArrayView(payload + sizeof(quint16) * 2 + dtoNameLength, dtoLength);
+        m_verified = true;
+        return true;
+    }
+
+    void CCryptoDtoContext::resize(QByteArray &buffer, qsizetype size)
+    {
+        if (buffer.capacity() < size) { m_growths++; }
+        buffer.resize(size);
+    }
+
+    bool CCryptoDtoContext::referencePayload(msgpack::type::object_type type, std::size_t length, void *userData)
+    {
+        Q_UNUSED(type)
+        Q_UNUSED(length)
+        Q_UNUSED(userData)
+        return true;
+    }
+} // namespace swift::core::afv::crypto
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_CORE_AFV_CRYPTO_CRYPTODTOCONTEXT_H
+#define SWIFT_CORE_AFV_CRYPTO_CRYPTODTOCONTEXT_H
+
+#include <cstddef>
+#include <string>
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+
+#include "msgpack.hpp"
+
+#include "core/afv/crypto/cryptodtochannel.h"
+#include "core/afv/crypto/cryptodtoheaderdto.h"
+#include "core/afv/crypto/cryptodtomode.h"
+#include "core/swiftcoreexport.h"
+
+namespace swift::core::afv::crypto
+{
+    /*!
+     * Serializes and deserializes crypto DTOs with buffers reused for all packets.
+     *
+     * Same wire format as CryptoDtoSerializer, but the packets are packed, encrypted and decrypted in buffers owned
+     * by the context. They are sized for the largest packet, so steady voice traffic does not allocate.
+     * \remark one context per thread, packets and DTO data are only valid until the next call
+     */
+    class SWIFT_CORE_EXPORT CCryptoDtoContext
+    {
+    public:
+        static constexpr int MaxPacketSize = 1500; //!< largest packet expected, about a UDP datagram on ethernet
+
+        //! Ctor
+        CCryptoDtoContext();
+
+        //! @{
+        //! Not copyable
+        CCryptoDtoContext(const CCryptoDtoContext &) = delete;
+        CCryptoDtoContext &operator=(const CCryptoDtoContext &) = delete;
+        //! @}
+
+        //! Serialize and encrypt a DTO
+        //! \return the packet, empty if it could not be encrypted, valid until the next serialize
+        template <typename T>
+        QByteArrayView serialize(CCryptoDtoChannel &channel, CryptoDtoMode mode, const T &dto)
+        {
+            uint sequenceToSend = 0;
+            const QByteArray transmitKey = channel.getTransmitKey(mode, sequenceToSend);
+            const char *data = m_dtoBuffer.data();
+            m_dtoBuffer.clear();
+            msgpack::pack(m_dtoBuffer, dto);
+            if (m_dtoBuffer.data() != data) { m_growths++; }
+            return this->seal(channel, mode, transmitKey, sequenceToSend, T::getShortDtoName());
+        }
+
+        //! Decrypt a packet, the DTO is then read by getDto
+        //! \return true if the packet could be verified
+        bool deserialize(CCryptoDtoChannel &channel, QByteArrayView packet, bool loopback);
+
+        //! Packet verified?
+        bool isVerified() const { return m_verified; }
+
+        //! Short name of the DTO received
+        const QByteArray &getDtoName() const { return m_dtoName; }
+
+        //! Length of the DTO received
+        int getDtoLength() const { return static_cast<int>(m_dtoData.size()); }
+
+        //! Decode the DTO received into an existing DTO, so its containers are reused
+        //! \remark strings and binary data are read directly from the payload, not copied while decoding
+        template <typename T>
+        bool getDto(T &dto)
+        {
+            if (!m_verified) { return false; }
+            if (m_dtoName != T::getDtoName() && m_dtoName != T::getShortDtoName()) { return false; }
+            try
+            {
+                m_zone.clear();
+                std::size_t offset = 0;
+                const msgpack::object object =
+                    msgpack::unpack(m_zone, m_dtoData.data(), static_cast<std::size_t>(m_dtoData.size()), offset,
+                                    &CCryptoDtoContext::referencePayload);
+                object.convert(dto);
+            }
+            catch (const msgpack::type_error &) { return false; }
+            catch (const msgpack::unpack_error &) { return false; }
+            return true;
+        }
+
+        //! How often a buffer had to grow beyond its preallocated size
+        int getGrowthCount() const { return m_growths; }
+
+    private:
+        //! Pack header, name and DTO into the packet and encrypt it in place
+        QByteArrayView seal(CCryptoDtoChannel &channel, CryptoDtoMode mode, const QByteArray &transmitKey,
+                            uint sequenceToSend, const QByteArray &dtoShortName);
+
+        //! Resize a buffer, counts the growths beyond the capacity
+        void resize(QByteArray &buffer, qsizetype size);
+
+        //! Reference strings and binary data instead of copying them, see msgpack::unpack_reference_func
+        static bool referencePayload(msgpack::type::object_type type, std::size_t length, void *userData);
+
+        // transmit
+        msgpack::sbuffer m_headerBuffer;
+        msgpack::sbuffer m_dtoBuffer;
+        CryptoDtoHeaderDto m_transmitHeader {};
+        QString m_channelTag; //!< tag of m_transmitHeader, only converted when changed
+        QByteArray m_packet;
+
+        // receive
+        CryptoDtoHeaderDto m_receiveHeader {};
+        QByteArray m_payload;
+        QByteArray m_dtoName;
+        QByteArrayView m_dtoData; //!< in m_payload
+        msgpack::zone m_zone;
+        bool m_verified = false;
+
+        int m_growths = 0;
+    };
+} // namespace swift::core::afv::crypto
+
+#endif // SWIFT_CORE_AFV_CRYPTO_CRYPTODTOCONTEXT_H
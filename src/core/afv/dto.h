@@ -7,6 +7,7 @@
 #define SWIFT_CORE_AFV_DTO_H
 
 #include <QByteArray>
+#include <QByteArrayView>
 #include <QJsonObject>
 #include <QString>
 #include <QUuid>
@@ -181,8 +182,8 @@ namespace swift::core::afv
     {
         //! @{
         //! Name
-        static QByteArray getDtoName() { return "HeartbeatDto"; }
-        static QByteArray getShortDtoName() { return "H"; }
+        static QByteArray getDtoName() { return QByteArrayLiteral("HeartbeatDto"); }
+        static QByteArray getShortDtoName() { return QByteArrayLiteral("H"); }
         //! @}
 
         std::string callsign; //!< callsign
@@ -194,8 +195,8 @@ namespace swift::core::afv
     {
         //! @{
         //! Name
-        static QByteArray getDtoName() { return "HeartbeatAckDto"; }
-        static QByteArray getShortDtoName() { return "HA"; }
+        static QByteArray getDtoName() { return QByteArrayLiteral("HeartbeatAckDto"); }
+        static QByteArray getShortDtoName() { return QByteArrayLiteral("HA"); }
         //! @}
 
         MSGPACK_DEFINE()
@@ -236,8 +237,8 @@ namespace swift::core::afv
     {
         //! @{
         //! Names
-        static QByteArray getDtoName() { return "AudioTxOnTransceiversDto"; }
-        static QByteArray getShortDtoName() { return "AT"; }
+        static QByteArray getDtoName() { return QByteArrayLiteral("AudioTxOnTransceiversDto"); }
+        static QByteArray getShortDtoName() { return QByteArrayLiteral("AT"); }
         //! @}
 
         //! @{
@@ -256,8 +257,8 @@ namespace swift::core::afv
     {
         //! @{
         //! Names
-        static QByteArray getDtoName() { return "AudioRxOnTransceiversDto"; }
-        static QByteArray getShortDtoName() { return "AR"; }
+        static QByteArray getDtoName() { return QByteArrayLiteral("AudioRxOnTransceiversDto"); }
+        static QByteArray getShortDtoName() { return QByteArrayLiteral("AR"); }
         //! @}
 
         //! @{
@@ -272,11 +273,12 @@ namespace swift::core::afv
     };
 
     //! Audio DTO
+    //! \remark the audio is not copied, it is only valid while the DTO is passed to the sample providers
     struct IAudioDto
     {
         QString callsign; //!< Callsign that audio originates from
         uint sequenceCounter; //!< Receiver optionally uses this in reordering algorithm/gap detection
-        QByteArray audio; //!< Opus compressed audio
+        QByteArrayView audio; //!< Opus compressed audio
         bool lastPacket; //!< Used to indicate to receiver that the sender has stopped sending
     };
 } // namespace swift::core::afv
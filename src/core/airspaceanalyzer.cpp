@@ -34,7 +34,8 @@ namespace swift::core
     CAirspaceAnalyzer::CAirspaceAnalyzer(IOwnAircraftProvider *ownAircraftProvider, CFSDClient *fsdClient,
                                          CAirspaceMonitor *airspaceMonitorParent)
         : CContinuousWorker(airspaceMonitorParent, "CAirspaceAnalyzer"), COwnAircraftAware(ownAircraftProvider),
-          CRemoteAircraftAware(airspaceMonitorParent), m_updateTimer(this, "CAirspaceAnalyzer")
+          CRemoteAircraftAware(airspaceMonitorParent), m_updateTimer(this, "CAirspaceAnalyzer"),
+          m_airspaceMonitor(airspaceMonitorParent)
     {
         Q_ASSERT_X(fsdClient, Q_FUNC_INFO, "Network object required to connect");
 
@@ -116,7 +117,7 @@ namespace swift::core
     {
         const CCallsign cs = situation.getCallsign();
         Q_ASSERT_X(!cs.isEmpty(), Q_FUNC_INFO, "No callsign in situaton");
-        m_aircraftCallsignTimestamps[cs] = QDateTime::currentMSecsSinceEpoch();
+        m_aircraftCallsigns.touch(CCallsignHandle::intern(cs), cs);
     }
 
     void CAirspaceAnalyzer::watchdogTouchAtcCallsign(const CCallsign &callsign, const CFrequency &frequency,
@@ -125,7 +126,7 @@ namespace swift::core
         Q_UNUSED(frequency)
         Q_UNUSED(position)
         Q_UNUSED(range)
-        m_atcCallsignTimestamps[callsign] = QDateTime::currentMSecsSinceEpoch();
+        m_atcCallsigns.touch(CCallsignHandle::intern(callsign), callsign);
     }
 
     void CAirspaceAnalyzer::onConnectionStatusChanged(CConnectionStatus oldStatus, CConnectionStatus newStatus)
@@ -148,8 +149,8 @@ namespace swift::core
 
     void CAirspaceAnalyzer::clear()
     {
-        m_aircraftCallsignTimestamps.clear();
-        m_atcCallsignTimestamps.clear();
+        m_aircraftCallsigns.clear();
+        m_atcCallsigns.clear();
 
         QWriteLocker l(&m_lockSnapshot);
         m_latestAircraftSnapshot = CAirspaceAircraftSnapshot();
@@ -157,12 +158,14 @@ namespace swift::core
 
     void CAirspaceAnalyzer::watchdogRemoveAircraftCallsign(const CCallsign &callsign)
     {
-        m_aircraftCallsignTimestamps.remove(callsign);
+        const CCallsignHandle handle = CCallsignHandle::find(callsign);
+        if (!handle.isNull()) { m_aircraftCallsigns.remove(handle); }
     }
 
     void CAirspaceAnalyzer::watchdogRemoveAtcCallsign(const CCallsign &callsign)
     {
-        m_atcCallsignTimestamps.remove(callsign);
+        const CCallsignHandle handle = CCallsignHandle::find(callsign);
+        if (!handle.isNull()) { m_atcCallsigns.remove(handle); }
     }
 
     void CAirspaceAnalyzer::watchdogCheckTimeouts()
@@ -181,44 +184,29 @@ namespace swift::core
         if (m_doNotRunAgainBefore > currentTimeMsEpoch) { return; }
         m_doNotRunAgainBefore = -1;
 
-        // checks
-        const std::chrono::milliseconds aircraftTimeoutMs = m_timeoutAircraft;
-        const std::chrono::milliseconds atcTimeoutMs = m_timeoutAtc;
-        const qint64 timeoutAircraftEpochMs = currentTimeMsEpoch - aircraftTimeoutMs.count();
-        const qint64 timeoutAtcEpochMs = currentTimeMsEpoch - atcTimeoutMs.count();
-        const bool enabled = m_enabledWatchdog;
+        // checks, a touch in between two checks counts as touch at the previous check
+        m_aircraftCallsigns.advance();
+        m_atcCallsigns.advance();
+        if (!m_enabledWatchdog) { return; } // nothing expires, untouched callsigns expire once re-enabled
 
-        const QList<CCallsign> callsignsAircraft = m_aircraftCallsignTimestamps.keys();
-        for (const CCallsign &callsign : callsignsAircraft) // clazy:exclude=container-anti-pattern,range-loop
-        {
-            if (!enabled)
-            {
-                m_aircraftCallsignTimestamps[callsign] = timeoutAircraftEpochMs + 1000;
-            } // fake value so it can be re-enabled
-            const qint64 tsv = m_aircraftCallsignTimestamps.value(callsign);
-            if (tsv > timeoutAircraftEpochMs) { continue; }
-            CLogMessage(this).debug() << QStringLiteral("Aircraft '%1' timed out after %2ms")
+        m_aircraftCallsigns.expire([&](const CCallsign &callsign, qint64 idleTicks) {
+            CLogMessage(this).debug() << QStringLiteral("Aircraft '%1' timed out after ~%2ms")
                                              .arg(callsign.toQString())
-                                             .arg(currentTimeMsEpoch - tsv);
-            m_aircraftCallsignTimestamps.remove(callsign);
+                                             .arg(idleTicks * updateInterval.count());
             emit this->timeoutAircraft(callsign);
-        }
-
-        const QList<CCallsign> callsignsAtc = m_atcCallsignTimestamps.keys();
-        for (const CCallsign &callsign : callsignsAtc) // clazy:exclude=container-anti-pattern,range-loop
-        {
-            if (!enabled)
-            {
-                m_aircraftCallsignTimestamps[callsign] = timeoutAtcEpochMs + 1000;
-            } // fake value so it can be re-enabled
-            const qint64 tsv = m_atcCallsignTimestamps.value(callsign);
-            if (tsv > timeoutAtcEpochMs) { continue; }
-            CLogMessage(this).debug() << QStringLiteral("ATC '%1' timed out after %2ms")
+        });
+        m_atcCallsigns.expire([&](const CCallsign &callsign, qint64 idleTicks) {
+            CLogMessage(this).debug() << QStringLiteral("ATC '%1' timed out after ~%2ms")
                                              .arg(callsign.toQString())
-                                             .arg(currentTimeMsEpoch - tsv);
-            m_atcCallsignTimestamps.remove(callsign);
+                                             .arg(idleTicks * updateInterval.count());
             emit this->timeoutAtc(callsign);
-        }
+        });
+    }
+
+    qint64 CAirspaceAnalyzer::watchdogTimeoutTicks(std::chrono::milliseconds timeout)
+    {
+        // at least the timeout, at most one check interval more
+        return (timeout.count() + updateInterval.count() - 1) / updateInterval.count();
     }
 
     void CAirspaceAnalyzer::analyzeAirspace()
@@ -241,8 +229,9 @@ namespace swift::core
         // remark for simulation snapshot is used when there are restrictions
         // nevertheless we calculate all the time as the snapshot could be used in other scenarios
 
-        CSimulatedAircraftList aircraftInRange(this->getAircraftInRange()); // thread safe copy from provider
-        CAirspaceAircraftSnapshot snapshot(aircraftInRange, restricted, enabled, maxAircraft, maxRenderedDistance);
+        // built from the index the provider keeps up to date, no copy of the aircraft
+        CAirspaceAircraftSnapshot snapshot =
+            m_airspaceMonitor->getAirspaceAircraftSnapshot(restricted, enabled, maxAircraft, maxRenderedDistance);
 
         // lock block
         {
@@ -16,6 +16,9 @@
 #include "core/fsd/fsdclient.h"
 #include "core/swiftcoreexport.h"
 #include "misc/aviation/atcstation.h"
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignhandle.h"
+#include "misc/expiryqueue.h"
 #include "misc/geo/coordinategeodetic.h"
 #include "misc/network/connectionstatus.h"
 #include "misc/pq/frequency.h"
@@ -30,7 +33,6 @@
 namespace swift::misc::aviation
 {
     class CAircraftSituation;
-    class CCallsign;
     class CTransponder;
 } // namespace swift::misc::aviation
 
@@ -55,8 +57,10 @@ namespace swift::core
         Q_OBJECT
 
     public:
-        //! List of callsigns and their last activity
-        using CCallsignTimestampSet = QHash<swift::misc::aviation::CCallsign, qint64>;
+        //! Callsigns which time out if not touched, one tick per watchdog check
+        //! \remark keyed by handle, the callsign as touched is kept for the timeout signals
+        using CCallsignExpiryQueue =
+            swift::misc::CExpiryQueue<swift::misc::aviation::CCallsignHandle, swift::misc::aviation::CCallsign>;
 
         //! Constructor
         CAirspaceAnalyzer(swift::misc::simulation::IOwnAircraftProvider *ownAircraftProvider,
@@ -136,20 +140,24 @@ namespace swift::core
         //! Check for time outs
         void watchdogCheckTimeouts();
 
+        //! Timeout as number of watchdog checks
+        static qint64 watchdogTimeoutTicks(std::chrono::milliseconds timeout);
+
         //! Analyze the airspace
         void analyzeAirspace();
 
         // watchdog
-        CCallsignTimestampSet m_aircraftCallsignTimestamps; //!< for watchdog (pilots)
-        CCallsignTimestampSet m_atcCallsignTimestamps; //!< for watchdog (ATC)
         std::chrono::seconds m_timeoutAircraft { 15 }; //!< Timeout value for watchdog functionality
         std::chrono::seconds m_timeoutAtc { 50 }; //!< Timeout value for watchdog functionality
+        CCallsignExpiryQueue m_aircraftCallsigns { watchdogTimeoutTicks(m_timeoutAircraft) }; //!< watchdog (pilots)
+        CCallsignExpiryQueue m_atcCallsigns { watchdogTimeoutTicks(m_timeoutAtc) }; //!< watchdog (ATC)
         qint64 m_lastWatchdogCallMsSinceEpoch; //!< when last called
         qint64 m_doNotRunAgainBefore = -1; //!< do not run again before, also used to detect debugging
         std::atomic_bool m_enabledWatchdog { true }; //!< watchdog enabled
         misc::CThreadedTimer m_updateTimer; //!< Thread safe timer for update timeout
 
         // snapshot
+        CAirspaceMonitor *m_airspaceMonitor = nullptr; //!< parent, provides the aircraft snapshot
         swift::misc::simulation::CAirspaceAircraftSnapshot m_latestAircraftSnapshot;
         bool m_simulatorRenderedAircraftRestricted = false;
         bool m_simulatorRenderingEnabled = true;
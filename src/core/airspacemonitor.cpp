@@ -61,6 +61,7 @@ namespace swift::core
           m_fsdClient(fsdClient), m_analyzer(new CAirspaceAnalyzer(ownAircraftProvider, m_fsdClient, this))
     {
         this->setObjectName("CAirspaceMonitor");
+        this->updateMaxChords();
         this->enableReverseLookupMessages(sApp->isDeveloperFlagSet() || CBuildConfig::isLocalDeveloperDebugBuild() ?
                                               RevLogEnabled :
                                               RevLogEnabledSimplified);
@@ -205,6 +206,15 @@ namespace swift::core
         return m_atcStationsOnline;
     }
 
+    CAtcStationList CAirspaceMonitor::getClosestAtcStationsOnline(int number, const ICoordinateGeodetic &position) const
+    {
+        if (!m_atcStationsOnline.isIndexedBy(m_atcStationsIndex))
+        {
+            m_atcStationsIndex = m_atcStationsOnline.createSpatialIndex();
+        }
+        return m_atcStationsOnline.findClosest(number, position, m_atcStationsIndex);
+    }
+
     CUserList CAirspaceMonitor::getUsers() const
     {
         CUserList users;
@@ -429,6 +439,7 @@ namespace swift::core
         CLogMessage(this).info(u"Set airspace max. range to %1NM") << rIntNM;
         m_maxDistanceNM = rIntNM;
         m_maxDistanceNMHysteresis = qRound(rIntNM * 1.1);
+        this->updateMaxChords();
     }
 
     void CAirspaceMonitor::onRealNameReplyReceived(const CCallsign &callsign, const QString &realname)
@@ -495,6 +506,7 @@ namespace swift::core
     void CAirspaceMonitor::removeAllOnlineAtcStations()
     {
         m_atcStationsOnline.clear();
+        m_atcStationsIndex = {};
         m_queryAtis.clear();
     }
 
@@ -512,7 +524,7 @@ namespace swift::core
     {
         if (callsign.isEmpty()) { return; }
         m_flightPlanCache.remove(callsign);
-        m_readiness.remove(callsign);
+        m_readiness.remove(CCallsignHandle::find(callsign));
         this->removeReverseLookupMessages(callsign);
     }
 
@@ -538,7 +550,7 @@ namespace swift::core
     CAirspaceMonitor::Readiness &CAirspaceMonitor::addMatchingReadinessFlag(const CCallsign &callsign,
                                                                             CAirspaceMonitor::MatchingReadinessFlag mrf)
     {
-        Readiness &readiness = m_readiness[callsign].addFlag(mrf);
+        Readiness &readiness = m_readiness[CCallsignHandle::intern(callsign)].addFlag(mrf);
         return readiness;
     }
 
@@ -625,7 +637,7 @@ namespace swift::core
                 callsign, "Ignoring this aircraft, not found in range list, disconnected, or no callsign",
                 CAirspaceMonitor::getLogCategories(), CStatusMessage::SeverityWarning);
             this->addReverseLookupMessage(callsign, m);
-            m_readiness.remove(callsign);
+            m_readiness.remove(CCallsignHandle::find(callsign));
         }
     }
 
@@ -634,7 +646,7 @@ namespace swift::core
         if (callsign.isEmpty() || !this->isAircraftInRange(callsign)) { return; }
 
         // set flag and init ts
-        Readiness &readiness = m_readiness[callsign];
+        Readiness &readiness = m_readiness[CCallsignHandle::intern(callsign)];
         if (readiness.wasMatchingSent()) { return; }
         if (readiness.wasVerified())
         {
@@ -1130,7 +1142,7 @@ namespace swift::core
                 if (!readyForModelMatching) { return; }
                 const CCallsign cs = ac.getCallsign();
 
-                m_readiness.remove(cs); // cleanup
+                m_readiness.remove(CCallsignHandle::find(cs)); // cleanup
                 const MatchingReadinessFlag ready = ReceivedAll;
                 myself->sendReadyForModelMatching(cs, ready); // airspace monitor adding all aicraft
             });
@@ -1149,14 +1161,23 @@ namespace swift::core
     {
         if (situation.isNull()) { return false; }
         if (m_maxDistanceNM < 0) { return true; }
-        const int distanceNM =
-            this->getOwnAircraft().calculateGreatCircleDistance(situation).valueInteger(CLengthUnit::NM());
-        if (distanceNM > m_maxDistanceNMHysteresis)
+        const CAircraftSituation ownSituation = this->getOwnAircraftSituation();
+        if (ownSituation.isNull()) { return true; }
+
+        // chord length of the normal vectors, same metric as the spatial index, no trigonometry per situation
+        const double chord = CGeoSpatialIndex::chord(ownSituation.normalVectorDouble(), situation.normalVectorDouble());
+        if (chord > m_maxChordHysteresis)
         {
             this->removeAircraft(situation.getCallsign());
             return false;
         }
-        return distanceNM <= m_maxDistanceNM;
+        return chord <= m_maxChord;
+    }
+
+    void CAirspaceMonitor::updateMaxChords()
+    {
+        m_maxChord = CGeoSpatialIndex::rangeToChord(CLength(m_maxDistanceNM, CLengthUnit::NM()));
+        m_maxChordHysteresis = CGeoSpatialIndex::rangeToChord(CLength(m_maxDistanceNMHysteresis, CLengthUnit::NM()));
     }
 
     bool CAirspaceMonitor::recallFsInnPacket(const CCallsign &callsign)
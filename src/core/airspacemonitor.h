@@ -20,9 +20,11 @@
 #include "misc/aviation/aircraftsituationlist.h"
 #include "misc/aviation/atcstation.h"
 #include "misc/aviation/atcstationlist.h"
+#include "misc/aviation/callsignhandle.h"
 #include "misc/aviation/callsignset.h"
 #include "misc/aviation/flightplan.h"
 #include "misc/geo/coordinategeodetic.h"
+#include "misc/geo/geospatialindex.h"
 #include "misc/identifier.h"
 #include "misc/network/clientprovider.h"
 #include "misc/network/connectionstatus.h"
@@ -105,6 +107,11 @@ namespace swift::core
         //! Recalculate distance to own aircraft
         misc::aviation::CAtcStationList getAtcStationsOnlineRecalculated();
 
+        //! The n online ATC stations closest to the position, closest first
+        //! \remark uses a spatial index of the stations, rebuilt when they changed
+        misc::aviation::CAtcStationList
+        getClosestAtcStationsOnline(int number, const misc::geo::ICoordinateGeodetic &position) const;
+
         //! Returns the closest ATC station operating on the given frequency, if any
         misc::aviation::CAtcStation getAtcStationForComUnit(const misc::aviation::CComSystem &comSystem) const;
 
@@ -266,10 +273,11 @@ namespace swift::core
         };
 
         swift::misc::aviation::CAtcStationList m_atcStationsOnline; //!< online ATC stations
+        mutable swift::misc::geo::CGeoSpatialIndex m_atcStationsIndex; //!< index of m_atcStationsOnline, on demand
         QHash<swift::misc::aviation::CCallsign, FsInnPacket> m_tempFsInnPackets; //!< unhandled FsInn packets
         QHash<swift::misc::aviation::CCallsign, swift::misc::aviation::CFlightPlan>
             m_flightPlanCache; //!< flight plan information retrieved from network and cached
-        QHash<swift::misc::aviation::CCallsign, Readiness> m_readiness; //!< readiness
+        swift::misc::aviation::CCallsignHandleMap<Readiness> m_readiness; //!< readiness
         swift::misc::CSettingReadOnly<swift::misc::simulation::settings::TModelMatching> m_matchingSettings {
             this
         }; //!< settings
@@ -280,6 +288,8 @@ namespace swift::core
         CAirspaceAnalyzer *m_analyzer = nullptr; //!< owned analyzer
         int m_maxDistanceNM = 125; //!< position range / FSD range
         int m_maxDistanceNMHysteresis = qRound(1.1 * m_maxDistanceNM);
+        double m_maxChord = -1; //!< m_maxDistanceNM as chord length of the normal vectors
+        double m_maxChordHysteresis = -1; //!< m_maxDistanceNMHysteresis as chord length of the normal vectors
         int m_foundInNonMovingAircraft = 0;
         int m_foundInElevationsOnGnd = 0;
 
@@ -388,6 +398,9 @@ namespace swift::core
         //! Handle max.range
         bool handleMaxRange(const swift::misc::aviation::CAircraftSituation &situation);
 
+        //! Max.range as chord lengths, compared in handleMaxRange
+        void updateMaxChords();
+
         //! Call CAirspaceMonitor::onCustomFSInnPacketReceived with stored packet
         bool recallFsInnPacket(const swift::misc::aviation::CCallsign &callsign);
 
@@ -84,6 +84,7 @@ namespace swift::core::context
             ".vol", ".volume", // output volume
             ".mute", // mute
             ".unmute", // unmute
+            ".jitter", // jitter buffer statistics
         });
         parser.parse(commandLine);
         if (!parser.isKnownCommand()) { return false; }
@@ -98,6 +99,12 @@ namespace swift::core::context
             this->setOutputMute(false);
             return true;
         }
+        else if (parser.matchesCommand(".jitter"))
+        {
+            if (!m_voiceClient) { return false; }
+            CLogMessage(this).info(u"Voice receive: %1") << m_voiceClient->getJitterBufferStatistics().toQString();
+            return true;
+        }
         else if (parser.commandStartsWith("vol") && parser.countParts() > 1)
         {
             const int v = parser.toInt(1);
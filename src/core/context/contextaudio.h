@@ -244,6 +244,7 @@ namespace swift::core
                 swift::misc::CSimpleCommandParser::registerCommand({ ".mute", "mute audio" });
                 swift::misc::CSimpleCommandParser::registerCommand({ ".unmute", "unmute audio" });
                 swift::misc::CSimpleCommandParser::registerCommand({ ".vol volume", "volume 0..100" });
+                swift::misc::CSimpleCommandParser::registerCommand({ ".jitter", "voice receive statistics" });
             }
 
             // -------- parts which can run in core and GUI, referring to local voice client ------------
@@ -258,6 +259,7 @@ namespace swift::core
             //! .mute                          mute             swift::core::context::CContextAudioBase
             //! .unmute                        unmute           swift::core::context::CContextAudioBase
             //! .vol .volume   volume 0..100   set volume       swift::core::context::CContextAudioBase
+            //! .jitter                        voice receive    swift::core::context::CContextAudioBase
             //! </pre>
             bool parseCommandLine(const QString &commandLine, const swift::misc::CIdentifier &originator) override;
             //! \endcond
@@ -17,6 +17,7 @@
 #include "core/corefacadeconfig.h"
 #include "core/swiftcoreexport.h"
 #include "misc/aviation/aircraftpartslist.h"
+#include "misc/aviation/aircraftsituationlist.h"
 #include "misc/aviation/airporticaocode.h"
 #include "misc/aviation/atcstation.h"
 #include "misc/aviation/atcstationlist.h"
@@ -193,6 +194,15 @@ namespace swift::core::context
         //! Aircraft count
         virtual int getAircraftInRangeCount() const = 0;
 
+        //! Revision of the latest aircraft situations
+        //! \sa getLatestAircraftSituationsSince
+        virtual qint64 getLatestAircraftSituationsRevision() const = 0;
+
+        //! Latest situation of the aircraft which moved after the given revision, all for a negative revision
+        //! \remark lightweight position feed for displays, removed aircraft are signalled by removedAircraft
+        virtual swift::misc::aviation::CAircraftSituationList
+        getLatestAircraftSituationsSince(qint64 revision) const = 0;
+
         //! Aircraft in range
         virtual bool isAircraftInRange(const swift::misc::aviation::CCallsign &callsign) const = 0;
 
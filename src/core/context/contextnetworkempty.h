@@ -79,6 +79,21 @@ namespace swift::core::context
             return 0;
         }
 
+        //! \copydoc IContextNetwork::getLatestAircraftSituationsRevision
+        qint64 getLatestAircraftSituationsRevision() const override
+        {
+            logEmptyContextWarning(Q_FUNC_INFO);
+            return 0;
+        }
+
+        //! \copydoc IContextNetwork::getLatestAircraftSituationsSince
+        swift::misc::aviation::CAircraftSituationList getLatestAircraftSituationsSince(qint64 revision) const override
+        {
+            Q_UNUSED(revision)
+            logEmptyContextWarning(Q_FUNC_INFO);
+            return {};
+        }
+
         //! \copydoc IContextNetwork::isAircraftInRange
         bool isAircraftInRange(const swift::misc::aviation::CCallsign &callsign) const override
         {
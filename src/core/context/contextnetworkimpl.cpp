@@ -887,11 +887,16 @@ namespace swift::core::context
         return stations;
     }
 
+    QByteArray CContextNetwork::getAtcStationsOnlineBlob(bool recalculateDistance, bool compress) const
+    {
+        return CDBusBlob::toBlob(this->getAtcStationsOnline(recalculateDistance), compress);
+    }
+
     CAtcStationList CContextNetwork::getClosestAtcStationsOnline(int number) const
     {
         if (!this->getIContextOwnAircraft()) { return {}; }
         const CAircraftSituation ownSituation = this->getIContextOwnAircraft()->getOwnAircraftSituation();
-        const CAtcStationList stations = m_airspace->getAtcStationsOnline().findClosest(number, ownSituation);
+        const CAtcStationList stations = m_airspace->getClosestAtcStationsOnline(number, ownSituation);
         return stations;
     }
 
@@ -901,6 +906,11 @@ namespace swift::core::context
         return m_airspace->getAircraftInRange();
     }
 
+    QByteArray CContextNetwork::getAircraftInRangeBlob(bool compress) const
+    {
+        return CDBusBlob::toBlob(this->getAircraftInRange(), compress);
+    }
+
     CCallsignSet CContextNetwork::getAircraftInRangeCallsigns() const
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -913,6 +923,16 @@ namespace swift::core::context
         return m_airspace->getAircraftInRangeCount();
     }
 
+    qint64 CContextNetwork::getLatestAircraftSituationsRevision() const
+    {
+        return m_airspace->latestRemoteAircraftSituationsRevision();
+    }
+
+    CAircraftSituationList CContextNetwork::getLatestAircraftSituationsSince(qint64 revision) const
+    {
+        return m_airspace->latestRemoteAircraftSituationsSince(revision);
+    }
+
     bool CContextNetwork::isAircraftInRange(const CCallsign &callsign) const
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -1028,6 +1048,54 @@ namespace swift::core::context
         return m_airspace->partsLastModified(callsign);
     }
 
+    CAircraftSituationList CContextNetwork::remoteAircraftSituations(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return {}; }
+        return m_airspace->remoteAircraftSituations(handle);
+    }
+
+    int CContextNetwork::remoteAircraftSituationsCount(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return 0; }
+        return m_airspace->remoteAircraftSituationsCount(handle);
+    }
+
+    CAircraftPartsList CContextNetwork::remoteAircraftParts(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return {}; }
+        return m_airspace->remoteAircraftParts(handle);
+    }
+
+    int CContextNetwork::remoteAircraftPartsCount(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return 0; }
+        return m_airspace->remoteAircraftPartsCount(handle);
+    }
+
+    CAircraftSituationChangeList CContextNetwork::remoteAircraftSituationChanges(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return {}; }
+        return m_airspace->remoteAircraftSituationChanges(handle);
+    }
+
+    int CContextNetwork::remoteAircraftSituationChangesCount(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return 0; }
+        return m_airspace->remoteAircraftSituationChangesCount(handle);
+    }
+
+    qint64 CContextNetwork::situationsLastModified(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return -1; }
+        return m_airspace->situationsLastModified(handle);
+    }
+
+    qint64 CContextNetwork::partsLastModified(CCallsignHandle handle) const
+    {
+        if (!this->canUseAirspaceMonitor()) { return -1; }
+        return m_airspace->partsLastModified(handle);
+    }
+
     QString CContextNetwork::getNetworkStatistics(bool reset, const QString &separator)
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
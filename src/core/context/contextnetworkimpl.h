@@ -25,6 +25,7 @@
 #include "misc/aviation/atcstationlist.h"
 #include "misc/aviation/callsignset.h"
 #include "misc/aviation/flightplan.h"
+#include "misc/dbusblob.h"
 #include "misc/digestsignal.h"
 #include "misc/identifier.h"
 #include "misc/network/clientlist.h"
@@ -230,12 +231,22 @@ namespace swift::core
             //! \copydoc swift::core::context::IContextNetwork::getAircraftInRange
             swift::misc::simulation::CSimulatedAircraftList getAircraftInRange() const override;
 
+            //! getAircraftInRange as swift::misc::CDBusBlob, for proxies in distributed mode
+            QByteArray getAircraftInRangeBlob(bool compress) const;
+
             //! \copydoc swift::core::context::IContextNetwork::getAircraftInRangeCallsigns
             swift::misc::aviation::CCallsignSet getAircraftInRangeCallsigns() const override;
 
             //! \copydoc swift::core::context::IContextNetwork::getAircraftInRangeCount
             int getAircraftInRangeCount() const override;
 
+            //! \copydoc swift::core::context::IContextNetwork::getLatestAircraftSituationsRevision
+            qint64 getLatestAircraftSituationsRevision() const override;
+
+            //! \copydoc swift::core::context::IContextNetwork::getLatestAircraftSituationsSince
+            swift::misc::aviation::CAircraftSituationList
+            getLatestAircraftSituationsSince(qint64 revision) const override;
+
             //! \copydoc swift::core::context::IContextNetwork::isAircraftInRange
             bool isAircraftInRange(const swift::misc::aviation::CCallsign &callsign) const override;
 
@@ -289,6 +300,21 @@ namespace swift::core
             //! \copydoc swift::misc::simulation::IRemoteAircraftProvider::partsLastModified
             qint64 partsLastModified(const swift::misc::aviation::CCallsign &callsign) const override;
 
+            //! @{
+            //! Per callsign data by callsign handle, \sa swift::misc::simulation::IRemoteAircraftProvider
+            swift::misc::aviation::CAircraftSituationList
+            remoteAircraftSituations(swift::misc::aviation::CCallsignHandle handle) const override;
+            int remoteAircraftSituationsCount(swift::misc::aviation::CCallsignHandle handle) const override;
+            swift::misc::aviation::CAircraftPartsList
+            remoteAircraftParts(swift::misc::aviation::CCallsignHandle handle) const override;
+            int remoteAircraftPartsCount(swift::misc::aviation::CCallsignHandle handle) const override;
+            swift::misc::aviation::CAircraftSituationChangeList
+            remoteAircraftSituationChanges(swift::misc::aviation::CCallsignHandle handle) const override;
+            int remoteAircraftSituationChangesCount(swift::misc::aviation::CCallsignHandle handle) const override;
+            qint64 situationsLastModified(swift::misc::aviation::CCallsignHandle handle) const override;
+            qint64 partsLastModified(swift::misc::aviation::CCallsignHandle handle) const override;
+            //! @}
+
             //! \copydoc swift::core::context::IContextNetwork::getNetworkStatistics
             QString getNetworkStatistics(bool reset, const QString &separator) override;
 
@@ -358,6 +384,12 @@ namespace swift::core
             //! \copydoc swift::core::context::IContextNetwork::getAtcStationsOnline
             swift::misc::aviation::CAtcStationList getAtcStationsOnline(bool recalculateDistance) const override;
 
+            //! getAtcStationsOnline as swift::misc::CDBusBlob, for proxies in distributed mode
+            QByteArray getAtcStationsOnlineBlob(bool recalculateDistance, bool compress) const;
+
+            //! \copydoc swift::misc::CDBusBlob::Version
+            int getBlobMarshallingVersion() const { return swift::misc::CDBusBlob::Version; }
+
             //! \copydoc swift::core::context::IContextNetwork::getClosestAtcStationsOnline
             swift::misc::aviation::CAtcStationList getClosestAtcStationsOnline(int number) const override;
 
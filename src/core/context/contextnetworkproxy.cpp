@@ -28,6 +28,7 @@ namespace swift::core::context
     {
         m_dBusInterface = new CGenericDBusInterface(serviceName, IContextNetwork::ObjectPath(),
                                                     IContextNetwork::InterfaceName(), connection, this);
+        m_dBusInterface->setBlobMarshalling(true); // aircraft and ATC lists get large on busy events
         this->relaySignals(serviceName, connection);
     }
 
@@ -102,7 +103,7 @@ namespace swift::core::context
 
     CAtcStationList CContextNetworkProxy::getAtcStationsOnline(bool recalculateDistance) const
     {
-        return m_dBusInterface->callDBusRet<swift::misc::aviation::CAtcStationList>(
+        return m_dBusInterface->callDBusRetBlob<swift::misc::aviation::CAtcStationList>(
             QLatin1String("getAtcStationsOnline"), recalculateDistance);
     }
 
@@ -114,7 +115,7 @@ namespace swift::core::context
 
     CSimulatedAircraftList CContextNetworkProxy::getAircraftInRange() const
     {
-        return m_dBusInterface->callDBusRet<swift::misc::simulation::CSimulatedAircraftList>(
+        return m_dBusInterface->callDBusRetBlob<swift::misc::simulation::CSimulatedAircraftList>(
             QLatin1String("getAircraftInRange"));
     }
 
@@ -129,6 +130,17 @@ namespace swift::core::context
         return m_dBusInterface->callDBusRet<int>(QLatin1String("getAircraftInRangeCount"));
     }
 
+    qint64 CContextNetworkProxy::getLatestAircraftSituationsRevision() const
+    {
+        return m_dBusInterface->callDBusRet<qint64>(QLatin1String("getLatestAircraftSituationsRevision"));
+    }
+
+    CAircraftSituationList CContextNetworkProxy::getLatestAircraftSituationsSince(qint64 revision) const
+    {
+        return m_dBusInterface->callDBusRet<swift::misc::aviation::CAircraftSituationList>(
+            QLatin1String("getLatestAircraftSituationsSince"), revision);
+    }
+
     bool CContextNetworkProxy::isAircraftInRange(const CCallsign &callsign) const
     {
         return m_dBusInterface->callDBusRet<bool>(QLatin1String("isAircraftInRange"), callsign);
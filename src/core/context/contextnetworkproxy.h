@@ -87,6 +87,13 @@ namespace swift::core
             //! \copydoc swift::core::context::IContextNetwork::getAircraftInRangeCount
             int getAircraftInRangeCount() const override;
 
+            //! \copydoc swift::core::context::IContextNetwork::getLatestAircraftSituationsRevision
+            qint64 getLatestAircraftSituationsRevision() const override;
+
+            //! \copydoc swift::core::context::IContextNetwork::getLatestAircraftSituationsSince
+            swift::misc::aviation::CAircraftSituationList
+            getLatestAircraftSituationsSince(qint64 revision) const override;
+
             //! \copydoc swift::core::context::IContextNetwork::isAircraftInRange
             bool isAircraftInRange(const swift::misc::aviation::CCallsign &callsign) const override;
 
@@ -11,6 +11,7 @@
 #include <QtGlobal>
 
 #include "config/buildconfig.h"
+#include "core/airspacemonitor.h"
 #include "core/application.h"
 #include "core/context/contextapplication.h"
 #include "core/context/contextnetwork.h"
@@ -21,9 +22,11 @@
 #include "core/db/databaseutils.h"
 #include "core/pluginmanagersimulator.h"
 #include "core/simulator.h"
+#include "core/webdataservices.h"
 #include "misc/aviation/callsign.h"
 #include "misc/dbusserver.h"
 #include "misc/logcategories.h"
+#include "misc/loghistory.h"
 #include "misc/loghandler.h"
 #include "misc/logmessage.h"
 #include "misc/mixin/mixincompare.h"
@@ -35,6 +38,7 @@
 #include "misc/statusmessage.h"
 #include "misc/threadutils.h"
 #include "misc/verify.h"
+#include "misc/worker.h"
 
 using namespace swift::config;
 using namespace swift::core::db;
@@ -92,6 +96,10 @@ namespace swift::core::context
         m_validator->start(QThread::LowestPriority);
         using namespace std::chrono_literals;
         m_validator->startUpdating(60s);
+
+        connect(&m_memoryFootprintTimer, &QTimer::timeout, this, &CContextSimulator::logMemoryFootprint);
+        m_memoryFootprintTimer.setObjectName(this->objectName() + "::memoryFootprintTimer");
+        m_memoryFootprintTimer.start(MemoryFootprintLogIntervalMs);
     }
 
     // For validation we need simulator directory and model directory
@@ -219,6 +227,11 @@ namespace swift::core::context
         return CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance().getCachedModels(simulator);
     }
 
+    QByteArray CContextSimulator::getModelSetBlob(bool compress) const
+    {
+        return CDBusBlob::toBlob(this->getModelSet(), compress);
+    }
+
     CSimulatorInfo CContextSimulator::getModelSetLoaderSimulator() const
     {
         if (isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -325,6 +338,11 @@ namespace swift::core::context
         return m_aircraftMatcher.getDisabledModelsForMatching();
     }
 
+    QByteArray CContextSimulator::getDisabledModelsForMatchingBlob(bool compress) const
+    {
+        return CDBusBlob::toBlob(this->getDisabledModelsForMatching(), compress);
+    }
+
     void CContextSimulator::restoreDisabledModels()
     {
         if (isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -359,6 +377,11 @@ namespace swift::core::context
         return this->getModelSet().findModelsStartingWith(modelString);
     }
 
+    QByteArray CContextSimulator::getModelSetModelsStartingWithBlob(const QString &modelString, bool compress) const
+    {
+        return CDBusBlob::toBlob(this->getModelSetModelsStartingWith(modelString), compress);
+    }
+
     CInterpolationAndRenderingSetupGlobal CContextSimulator::getInterpolationAndRenderingSetupGlobal() const
     {
         if (isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -508,8 +531,8 @@ namespace swift::core::context
         Q_ASSERT(c);
 
         // log from context to simulator
-        c = connect(CLogHandler::instance(), &CLogHandler::localMessageLogged, this,
-                    &CContextSimulator::relayStatusMessageToSimulator);
+        c = CLogHandler::instance()->connectLocalMessageListener(
+            this, &CContextSimulator::relayStatusMessageToSimulator, this->getRelayedMessageSeverity());
         Q_ASSERT(c);
         c = connect(CLogHandler::instance(), &CLogHandler::remoteMessageLogged, this,
                     &CContextSimulator::relayStatusMessageToSimulator);
@@ -629,6 +652,7 @@ namespace swift::core::context
             {
                 // disconnect signals and delete
                 simulator->disconnect(this);
+                CLogHandler::instance()->disconnect(this); // connected again when the next plugin is loaded
                 simulator->unload();
                 simulator->deleteLater();
                 emit this->simulatorPluginChanged(CSimulatorPluginInfo());
@@ -898,6 +922,20 @@ namespace swift::core::context
         }
     }
 
+    CStatusMessage::StatusSeverity CContextSimulator::getRelayedMessageSeverity() const
+    {
+        const CSimulatorMessagesSettings simMsg = m_messageSettings.getThreadLocal();
+        const bool relay = simMsg.isRelayGloballyEnabled() && simMsg.isRelayTechnicalMessages();
+
+        // errors are rare, so also registering for them if nothing is relayed costs nothing
+        return relay ? simMsg.getTechnicalLogSeverity() : CStatusMessage::SeverityError;
+    }
+
+    void CContextSimulator::updateRelayedMessageSeverity()
+    {
+        CLogHandler::instance()->setLocalMessageListenerSeverity(this, this->getRelayedMessageSeverity());
+    }
+
     void CContextSimulator::changeEnabledSimulators()
     {
         CSimulatorPluginInfo currentPluginInfo = m_simulatorPlugin.first;
@@ -1007,7 +1045,8 @@ namespace swift::core::context
         if (commandLine.isEmpty()) { return false; }
         CSimpleCommandParser parser({
             ".plugin", ".drv", ".driver", // forwarded to driver
-            ".ris" // rendering interpolator setup
+            ".ris", // rendering interpolator setup
+            ".mem" // memory footprint
         });
         parser.parse(commandLine);
         if (!parser.isKnownCommand()) { return false; }
@@ -1024,6 +1063,11 @@ namespace swift::core::context
             CLogMessage(this, CLogCategories::cmdLine()).info(u"Setup is: '%1'") << rs.toQString(true);
             return true;
         }
+        if (parser.matchesCommand("mem"))
+        {
+            this->logMemoryFootprintEstimate();
+            return true;
+        }
         if (parser.matchesCommand("plugin") || parser.matchesCommand("drv") || parser.matchesCommand("driver"))
         {
             if (!m_simulatorPlugin.second) { return false; }
@@ -1032,6 +1076,81 @@ namespace swift::core::context
         return false;
     }
 
+    CMemoryFootprint CContextSimulator::getMemoryFootprint() const
+    {
+        CMemoryFootprint footprint;
+        const CContextNetwork *network = this->getRuntime() ? this->getRuntime()->getCContextNetwork() : nullptr;
+        if (network && network->airspace()) { network->airspace()->addMemoryFootprint(footprint); }
+
+        footprint.addCount("model set", m_aircraftMatcher.getModelSetCount());
+        if (sApp && sApp->hasWebDataServices())
+        {
+            footprint.addCount("DB models", sApp->getWebDataServices()->getModelsCount());
+        }
+        footprint.addCount("matching statistics", m_aircraftMatcher.getCurrentStatistics().sizeInt());
+        int matchingMessages = 0;
+        for (const CStatusMessageList &messages : m_matchingMessages) { matchingMessages += messages.sizeInt(); }
+        footprint.addCount("matching messages", matchingMessages);
+
+        if (m_simulatorPlugin.second) { m_simulatorPlugin.second->interpolationLogger().addMemoryFootprint(footprint); }
+
+        const CLogHistory *logHistory = this->getRuntime() ? this->getRuntime()->getLogHistory() : nullptr;
+        if (logHistory) { footprint.add("log history", logHistory->getBytes(), logHistory->getElementCount()); }
+        return footprint;
+    }
+
+    void CContextSimulator::logMemoryFootprintEstimate()
+    {
+        // the data are copied here, implicitly shared, and estimated in a worker thread
+        QList<CMemoryFootprint::Estimator> estimators;
+        const CContextNetwork *network = this->getRuntime() ? this->getRuntime()->getCContextNetwork() : nullptr;
+        if (network && network->airspace())
+        {
+            estimators.push_back(network->airspace()->getMemoryFootprintEstimator());
+        }
+
+        const CAircraftModelList modelSet = m_aircraftMatcher.getModelSet();
+        const CAircraftModelList dbModels =
+            sApp && sApp->hasWebDataServices() ? sApp->getWebDataServices()->getModels() : CAircraftModelList();
+        const CMatchingStatistics statistics = m_aircraftMatcher.getCurrentStatistics();
+        const QMap<CCallsign, CStatusMessageList> matchingMessages = m_matchingMessages;
+        estimators.push_back([=](CMemoryFootprint &footprint) {
+            footprint.add("model set", deepSize(modelSet), modelSet.sizeInt());
+            footprint.add("DB models", deepSize(dbModels), dbModels.sizeInt());
+            footprint.add("matching statistics", deepSize(statistics), statistics.sizeInt());
+            int messages = 0;
+            for (const CStatusMessageList &list : matchingMessages) { messages += list.sizeInt(); }
+            footprint.add("matching messages", deepSize(matchingMessages), messages);
+        });
+
+        if (m_simulatorPlugin.second)
+        {
+            estimators.push_back(m_simulatorPlugin.second->interpolationLogger().getMemoryFootprintEstimator());
+        }
+
+        const CLogHistory *logHistory = this->getRuntime() ? this->getRuntime()->getLogHistory() : nullptr;
+        if (logHistory)
+        {
+            const qint64 bytes = logHistory->getBytes();
+            const int elements = logHistory->getElementCount();
+            estimators.push_back([=](CMemoryFootprint &footprint) { footprint.add("log history", bytes, elements); });
+        }
+
+        CWorker *worker = CWorker::fromTask(this, "MemoryFootprint", [estimators]() {
+            CMemoryFootprint footprint;
+            for (const CMemoryFootprint::Estimator &estimator : estimators) { estimator(footprint); }
+            return footprint.toQString(true);
+        });
+        worker->thenWithResult<QString>(this, [this](const QString &report) {
+            CLogMessage(this, CLogCategories::cmdLine()).info(u"Memory footprint:\n%1") << report;
+        });
+    }
+
+    void CContextSimulator::logMemoryFootprint()
+    {
+        CLogMessage(this).info(u"Memory footprint: %1") << this->getMemoryFootprint().toQString();
+    }
+
     QPointer<ISimulator> CContextSimulator::simulator() const
     {
         if (!this->isSimulatorAvailable() || !m_simulatorPlugin.second) { return nullptr; }
@@ -9,6 +9,7 @@
 #include <QPair>
 #include <QPointer>
 #include <QString>
+#include <QTimer>
 
 #include "core/aircraftmatcher.h"
 #include "core/application/applicationsettings.h"
@@ -17,7 +18,9 @@
 #include "core/simulator.h"
 #include "core/swiftcoreexport.h"
 #include "misc/aviation/airportlist.h"
+#include "misc/dbusblob.h"
 #include "misc/identifier.h"
+#include "misc/memoryfootprint.h"
 #include "misc/network/connectionstatus.h"
 #include "misc/network/textmessagelist.h"
 #include "misc/pixmap.h"
@@ -132,6 +135,9 @@ namespace swift::core
             //! \copydoc swift::core::context::IContextSimulator::getDisabledModelsForMatching
             swift::misc::simulation::CAircraftModelList getDisabledModelsForMatching() const override;
 
+            //! getDisabledModelsForMatching as swift::misc::CDBusBlob, for proxies in distributed mode
+            QByteArray getDisabledModelsForMatchingBlob(bool compress) const;
+
             //! \copydoc swift::core::context::IContextSimulator::restoreDisabledModels
             void restoreDisabledModels() override;
 
@@ -145,6 +151,9 @@ namespace swift::core
             swift::misc::simulation::CAircraftModelList
             getModelSetModelsStartingWith(const QString &modelString) const override;
 
+            //! getModelSetModelsStartingWith as swift::misc::CDBusBlob, for proxies in distributed mode
+            QByteArray getModelSetModelsStartingWithBlob(const QString &modelString, bool compress) const;
+
             //! \copydoc swift::core::context::IContextSimulator::getInterpolationAndRenderingSetupGlobal
             swift::misc::simulation::CInterpolationAndRenderingSetupGlobal
             getInterpolationAndRenderingSetupGlobal() const override;
@@ -223,6 +232,12 @@ namespace swift::core
             //! \copydoc swift::core::context::IContextSimulator::getModelSet
             swift::misc::simulation::CAircraftModelList getModelSet() const override;
 
+            //! getModelSet as swift::misc::CDBusBlob, for proxies in distributed mode
+            QByteArray getModelSetBlob(bool compress) const;
+
+            //! \copydoc swift::misc::CDBusBlob::Version
+            int getBlobMarshallingVersion() const { return swift::misc::CDBusBlob::Version; }
+
             //! \copydoc swift::core::context::IContextSimulator::getModelSetCount
             int getModelSetCount() const override;
 
@@ -233,6 +248,7 @@ namespace swift::core
             //! .ris show         show interpolation setup in console
             //! .ris debug on|off interpolation/rendering setup, debug messages
             //! .ris parts on|off interpolation/rendering setup, aircraft parts
+            //! .mem              memory footprint of aircraft, models and logs
             //! </pre>
             //! \copydoc IContextSimulator::parseCommandLine
             bool parseCommandLine(const QString &commandLine, const swift::misc::CIdentifier &originator) override;
@@ -251,6 +267,9 @@ namespace swift::core
             //! Simulator available?
             bool hasSimulator() const { return this->simulator(); }
 
+            //! Number of remote aircraft data, models, matching messages and logs, cheap enough for periodic logging
+            swift::misc::CMemoryFootprint getMemoryFootprint() const;
+
             //! Register dot commands
             static void registerHelp()
             {
@@ -261,6 +280,8 @@ namespace swift::core
                     { ".ris debug on|off", "rendering/interpolation debug messages (global setup)" });
                 swift::misc::CSimpleCommandParser::registerCommand(
                     { ".ris parts on|off", "aircraft parts (global setup)" });
+                swift::misc::CSimpleCommandParser::registerCommand(
+                    { ".mem", "memory footprint of aircraft, models and logs" });
             }
 
         protected:
@@ -273,6 +294,7 @@ namespace swift::core
         private:
             static constexpr int MatchingLogMaxModelSetSize = 250; //!< default value for switching matching log on
             static constexpr int MaxModelAddedFailoverTrials = 3; //!< if model cannot be added, try again max <n> times
+            static constexpr int MemoryFootprintLogIntervalMs = 10 * 60 * 1000; //!< memory footprint in log
 
             //  ------------ slots connected with network or other contexts ---------
 
@@ -342,6 +364,12 @@ namespace swift::core
             //! Relay status message to simulator under consideration of settings
             void relayStatusMessageToSimulator(const swift::misc::CStatusMessage &message);
 
+            //! Minimum severity of the messages relayed to the simulator
+            swift::misc::CStatusMessage::StatusSeverity getRelayedMessageSeverity() const;
+
+            //! Tell the log handler which messages are relayed, so others need not be formatted
+            void updateRelayedMessageSeverity();
+
             //! Handle a change in enabled simulators
             void changeEnabledSimulators();
 
@@ -380,6 +408,12 @@ namespace swift::core
             //! Init and set validator
             void setValidator(const swift::misc::simulation::CSimulatorInfo &simulator);
 
+            //! Write the memory footprint to the log
+            void logMemoryFootprint();
+
+            //! Estimate the memory in a worker thread and write the report to the log
+            void logMemoryFootprintEstimate();
+
             QPair<swift::misc::simulation::CSimulatorPluginInfo, QPointer<ISimulator>>
                 m_simulatorPlugin; //!< Currently loaded simulator plugin
             QMap<swift::misc::aviation::CCallsign, swift::misc::CStatusMessageList>
@@ -396,6 +430,7 @@ namespace swift::core
             QString m_networkSessionId; //!< Network session of CServer::getServerSessionId, if not connected empty (for
                                         //!< statistics, ..)
             swift::misc::simulation::CBackgroundValidation *m_validator = nullptr;
+            QTimer m_memoryFootprintTimer; //!< periodic memory footprint in log
 
             // settings
             swift::misc::CSettingReadOnly<application::TEnabledSimulators> m_enabledSimulators {
@@ -413,7 +448,7 @@ namespace swift::core
             swift::misc::CSetting<swift::misc::simulation::settings::TInterpolationAndRenderingSetupGlobal>
                 m_renderSettings { this }; //!< rendering/interpolation settings (all simulators)
             swift::misc::CSettingReadOnly<swift::misc::simulation::settings::TSimulatorMessages> m_messageSettings {
-                this
+                this, &CContextSimulator::updateRelayedMessageSeverity
             }; //!< settings for messages (all simulators)
         };
     } // namespace context
@@ -29,6 +29,7 @@ namespace swift::core::context
     {
         this->m_dBusInterface = new swift::misc::CGenericDBusInterface(
             serviceName, IContextSimulator::ObjectPath(), IContextSimulator::InterfaceName(), connection, this);
+        m_dBusInterface->setBlobMarshalling(true); // model sets have thousands of models
         this->relaySignals(serviceName, connection);
     }
 
@@ -138,7 +139,7 @@ namespace swift::core::context
 
     CAircraftModelList CContextSimulatorProxy::getModelSet() const
     {
-        return m_dBusInterface->callDBusRet<CAircraftModelList>(QLatin1String("getModelSet"));
+        return m_dBusInterface->callDBusRetBlob<CAircraftModelList>(QLatin1String("getModelSet"));
     }
 
     CSimulatorInfo CContextSimulatorProxy::simulatorsWithInitializedModelSet() const
@@ -183,8 +184,8 @@ namespace swift::core::context
 
     CAircraftModelList CContextSimulatorProxy::getModelSetModelsStartingWith(const QString &modelString) const
     {
-        return m_dBusInterface->callDBusRet<CAircraftModelList>(QLatin1String("getModelSetModelsStartingWith"),
-                                                                modelString);
+        return m_dBusInterface->callDBusRetBlob<CAircraftModelList>(QLatin1String("getModelSetModelsStartingWith"),
+                                                                    modelString);
     }
 
     int CContextSimulatorProxy::getModelSetCount() const
@@ -209,7 +210,7 @@ namespace swift::core::context
 
     CAircraftModelList CContextSimulatorProxy::getDisabledModelsForMatching() const
     {
-        return m_dBusInterface->callDBusRet<CAircraftModelList>(QLatin1String("getDisabledModelsForMatching"));
+        return m_dBusInterface->callDBusRetBlob<CAircraftModelList>(QLatin1String("getDisabledModelsForMatching"));
     }
 
     bool CContextSimulatorProxy::triggerModelSetValidation(const CSimulatorInfo &simulator)
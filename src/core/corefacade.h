@@ -159,6 +159,9 @@ namespace swift::core
         //! \remarks only applicable for local object
         const context::CContextSimulator *getCContextSimulator() const;
 
+        //! Log history, nullptr if not kept in this process
+        const swift::misc::CLogHistory *getLogHistory() const { return m_logHistory; }
+
         //! DBus address if any
         QString getDBusAddress() const;
 
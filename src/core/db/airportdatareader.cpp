@@ -16,6 +16,8 @@
 
 using namespace swift::misc;
 using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
 using namespace swift::misc::network;
 using namespace swift::misc::db;
 
@@ -41,6 +43,27 @@ namespace swift::core::db
 
     int CAirportDataReader::getAirportsCount() const { return this->getAirports().size(); }
 
+    CAirportList CAirportDataReader::getAirportsInRange(const ICoordinateGeodetic &position,
+                                                        const CLength &range) const
+    {
+        const CAirportList airports = this->getAirports();
+        return airports.findWithinRange(position, range, this->getAirportsIndex(airports));
+    }
+
+    CAirport CAirportDataReader::getClosestAirportWithinRange(const ICoordinateGeodetic &position,
+                                                              const CLength &range) const
+    {
+        const CAirportList airports = this->getAirports();
+        return airports.findClosestWithinRange(position, range, this->getAirportsIndex(airports));
+    }
+
+    CGeoSpatialIndex CAirportDataReader::getAirportsIndex(const CAirportList &airports) const
+    {
+        QMutexLocker lock(&m_airportsIndexMutex);
+        if (!airports.isIndexedBy(m_airportsIndex)) { m_airportsIndex = airports.createSpatialIndex(); }
+        return m_airportsIndex;
+    }
+
     bool CAirportDataReader::readFromJsonFilesInBackground(const QString &dir, CEntityFlags::Entity whatToRead,
                                                            bool overrideNewerOnly)
     {
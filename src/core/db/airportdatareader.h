@@ -8,12 +8,14 @@
 
 #include <atomic>
 
+#include <QMutex>
 #include <QNetworkAccessManager>
 
 #include "core/data/dbcaches.h"
 #include "core/db/databasereader.h"
 #include "core/swiftcoreexport.h"
 #include "misc/aviation/airportlist.h"
+#include "misc/geo/geospatialindex.h"
 #include "misc/network/entityflags.h"
 
 namespace swift::core::db
@@ -43,6 +45,18 @@ namespace swift::core::db
         //! \threadsafe
         int getAirportsCount() const;
 
+        //! Airports within range of the position, e.g. near own aircraft
+        //! \threadsafe
+        swift::misc::aviation::CAirportList
+        getAirportsInRange(const swift::misc::geo::ICoordinateGeodetic &position,
+                           const swift::misc::physical_quantities::CLength &range) const;
+
+        //! Closest airport within range of the position (or default)
+        //! \threadsafe
+        swift::misc::aviation::CAirport
+        getClosestAirportWithinRange(const swift::misc::geo::ICoordinateGeodetic &position,
+                                     const swift::misc::physical_quantities::CLength &range) const;
+
         // data read from local data
         swift::misc::CStatusMessageList readFromJsonFiles(const QString &dir,
                                                           swift::misc::network::CEntityFlags::Entity whatToRead,
@@ -72,6 +86,8 @@ namespace swift::core::db
             this, &CAirportDataReader::airportCacheChanged
         }; //!< cache file
         std::atomic_bool m_syncedAirportCache { false }; //!< already synchronized?
+        mutable swift::misc::geo::CGeoSpatialIndex m_airportsIndex; //!< index of the cached airports, on demand
+        mutable QMutex m_airportsIndexMutex; //!< guards m_airportsIndex
 
         //! Reader URL (we read from where?) used to detect changes of location
         swift::misc::CData<swift::core::data::TDbModelReaderBaseUrl> m_readerUrlCache {
@@ -88,6 +104,10 @@ namespace swift::core::db
         //! Airport cache changed
         void airportCacheChanged();
 
+        //! Spatial index of the airports, rebuilt when they changed
+        //! \threadsafe
+        swift::misc::geo::CGeoSpatialIndex getAirportsIndex(const swift::misc::aviation::CAirportList &airports) const;
+
         //! Base url cache changed
         void baseUrlCacheChanged();
 
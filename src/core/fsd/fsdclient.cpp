@@ -5,6 +5,7 @@
 
 #include <QHostAddress>
 #include <QMetaEnum>
+#include <QMetaMethod>
 #include <QNetworkReply>
 #include <QStringView>
 
@@ -788,8 +789,8 @@ namespace swift::core::fsd
         if (m_printToConsole) { qDebug() << "FSD Sent=>" << bufferEncoded; }
         if (!m_unitTestMode) { m_socket->write(bufferEncoded); }
 
-        // remove CR/LF and emit
-        emitRawFsdMessage(message.trimmed(), true);
+        // CR/LF removed when emitted
+        emitRawFsdMessage(message, true);
     }
 
     void CFSDClient::sendQueuedMessage()
@@ -2040,36 +2041,27 @@ namespace swift::core::fsd
 
     void CFSDClient::fsdMessageSettingsChanged()
     {
-        if (m_rawFsdMessageLogFile.isOpen()) { m_rawFsdMessageLogFile.close(); }
+        if (m_rawFsdCapture) { m_rawFsdCapture->stop(); }
         const CRawFsdMessageSettings setting = m_fsdMessageSetting.get();
         m_rawFsdMessagesEnabled = setting.areRawFsdMessagesEnabled();
 
         if (setting.getFileWriteMode() == CRawFsdMessageSettings::None || setting.getFileDir().isEmpty()) { return; }
-        if (setting.getFileWriteMode() == CRawFsdMessageSettings::Truncate)
+        QString filename("rawfsdmessages");
+        if (setting.getFileWriteMode() == CRawFsdMessageSettings::Timestamped)
         {
-            const QString filePath = CFileUtils::appendFilePaths(setting.getFileDir(), "rawfsdmessages.log");
-            m_rawFsdMessageLogFile.setFileName(filePath);
-            const bool res = m_rawFsdMessageLogFile.open(QIODevice::Text | QIODevice::WriteOnly);
-            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
-        }
-        else if (setting.getFileWriteMode() == CRawFsdMessageSettings::Append)
-        {
-            const QString filePath = CFileUtils::appendFilePaths(setting.getFileDir(), "rawfsdmessages.log");
-            m_rawFsdMessageLogFile.setFileName(filePath);
-            const bool res = m_rawFsdMessageLogFile.open(QIODevice::Text | QIODevice::WriteOnly | QIODevice::Append);
-            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
-        }
-        else if (setting.getFileWriteMode() == CRawFsdMessageSettings::Timestamped)
-        {
-            QString filename("rawfsdmessages");
             filename += QLatin1String("_");
             filename += QDateTime::currentDateTime().toString(QStringLiteral("yyMMddhhmmss"));
-            filename += QLatin1String(".log");
-            const QString filePath = CFileUtils::appendFilePaths(setting.getFileDir(), filename);
-            m_rawFsdMessageLogFile.setFileName(filePath);
-            const bool res = m_rawFsdMessageLogFile.open(QIODevice::Text | QIODevice::WriteOnly);
-            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
         }
+        filename += QLatin1String(".") % QLatin1String(CRawFsdCapture::FileExtension);
+
+        // binary capture, written in the background, see CRawFsdCapture::convertToText
+        if (!m_rawFsdCapture) { m_rawFsdCapture = std::make_unique<CRawFsdCapture>(); }
+        const QString filePath = CFileUtils::appendFilePaths(setting.getFileDir(), filename);
+        const bool append = setting.getFileWriteMode() == CRawFsdMessageSettings::Append;
+        QString error;
+        const bool res = m_rawFsdCapture->start(filePath, append, error);
+        SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
+        if (!res) { CLogMessage(this).warning(u"Cannot write raw FSD messages to '%1': %2") << filePath << error; }
     }
 
     swift::misc::aviation::CCallsignSet CFSDClient::getInterimPositionReceivers() const
@@ -2294,28 +2286,33 @@ namespace swift::core::fsd
         else { handleUnknownPacket(line); }
     }
 
-    void CFSDClient::emitRawFsdMessage(const QString &fsdMessage, bool isSent)
+    void CFSDClient::emitRawFsdMessage(QStringView fsdMessage, bool isSent)
     {
         if (!m_unitTestMode && !m_rawFsdMessagesEnabled) { return; }
-        QString fsdMessageFiltered(fsdMessage);
-        if (m_filterPasswordFromLogin)
-        {
-            if (fsdMessageFiltered.startsWith("#AP"))
-            {
-                thread_local const QRegularExpression re(R"(^(#AP\w+:SERVER:\d+:)[^:]+(:\d+:\d+:\d+:.+)$)");
-                fsdMessageFiltered.replace(re, "\\1<password>\\2");
-                m_filterPasswordFromLogin = false;
-            }
-        }
 
-        const QString prefix = isSent ? "FSD Sent=>" : "FSD Recv=>";
-        CRawFsdMessage rawMessage(prefix + fsdMessageFiltered);
-        rawMessage.setCurrentUtcTime();
-        if (m_rawFsdMessageLogFile.isOpen())
+        // called for every message, so without a receiver or file this has to be cheap
+        static const QMetaMethod signal = QMetaMethod::fromSignal(&CFSDClient::rawFsdMessage);
+        const bool connected = this->isSignalConnected(signal);
+        const bool capturing = m_rawFsdCapture && m_rawFsdCapture->isRunning();
+        if (!connected && !capturing) { return; }
+
+        QString fsdMessageFiltered;
+        fsdMessage = fsdMessage.trimmed();
+        if (m_filterPasswordFromLogin && fsdMessage.startsWith(u"#AP"))
         {
-            QTextStream stream(&m_rawFsdMessageLogFile);
-            stream << rawMessage.toQString().trimmed() << Qt::endl;
+            thread_local const QRegularExpression re(R"(^(#AP\w+:SERVER:\d+:)[^:]+(:\d+:\d+:\d+:.+)$)");
+            fsdMessageFiltered = fsdMessage.toString().replace(re, "\\1<password>\\2");
+            fsdMessage = fsdMessageFiltered;
+            m_filterPasswordFromLogin = false;
         }
+
+        const qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+        if (capturing) { m_rawFsdCapture->record(nowMs, isSent, fsdMessage); }
+        if (!connected) { return; }
+
+        const QLatin1String prefix = isSent ? QLatin1String("FSD Sent=>") : QLatin1String("FSD Recv=>");
+        CRawFsdMessage rawMessage(prefix % fsdMessage);
+        rawMessage.setMSecsSinceEpoch(nowMs);
         emit rawFsdMessage(rawMessage);
     }
 
@@ -8,6 +8,7 @@
 
 #include "core/fsd/enums.h"
 #include "core/fsd/messagebase.h"
+#include "core/fsd/rawfsdcapture.h"
 #include "core/swiftcoreexport.h"
 #include "core/vatsim/vatsimsettings.h"
 #include "misc/aviation/aircrafticaocode.h"
@@ -528,7 +529,8 @@ namespace swift::core::fsd
         void fsdMessageSettingsChanged();
 
         //! Emit raw FSD message (mostly for debugging)
-        void emitRawFsdMessage(const QString &fsdMessage, bool isSent);
+        //! \remark nothing is done unless the signal is connected or messages are written to file
+        void emitRawFsdMessage(QStringView fsdMessage, bool isSent);
 
         //! Save the statistics
         bool saveNetworkStatistics(const QString &server);
@@ -623,7 +625,7 @@ namespace swift::core::fsd
         swift::misc::CSettingReadOnly<swift::core::vatsim::TRawFsdMessageSetting> m_fsdMessageSetting {
             this, &CFSDClient::fsdMessageSettingsChanged
         };
-        QFile m_rawFsdMessageLogFile;
+        std::unique_ptr<CRawFsdCapture> m_rawFsdCapture; //!< only while writing to file
         std::atomic_bool m_rawFsdMessagesEnabled { false };
         std::atomic_bool m_filterPasswordFromLogin { false };
 
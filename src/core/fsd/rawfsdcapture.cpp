@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "core/fsd/rawfsdcapture.h"
+
+#include <cstring>
+
+#include <QDateTime>
+#include <QFile>
+#include <QStringBuilder>
+#include <QThread>
+#include <QTimeZone>
+#include <QtEndian>
+
+#include "misc/batchfilewriter.h"
+#include "misc/logmessage.h"
+
+using namespace swift::misc;
+
+namespace swift::core::fsd
+{
+    namespace
+    {
+        const QByteArray &magic()
+        {
+            static const QByteArray m("SWFSDCAP");
+            return m;
+        }
+
+        constexpr char Version = 1;
+        constexpr int HeaderSize = 8 + 1 + 8;
+
+        //! File header
+        QByteArray header(qint64 startMs)
+        {
+            QByteArray h = magic();
+            h.append(Version);
+            char start[8];
+            qToLittleEndian(startMs, start);
+            h.append(start, sizeof(start));
+            return h;
+        }
+
+        //! Parse the messages of a capture, the visitor gets timestamp, sent, position and size of each message
+        //! \return end of the last complete message, -1 if not a capture
+        template <typename Visitor>
+        qsizetype parseCapture(const QByteArray &data, Visitor visitor)
+        {
+            if (data.size() < HeaderSize || !data.startsWith(magic()) || data.at(magic().size()) != Version)
+            {
+                return -1;
+            }
+
+            qint64 timestampMs = qFromLittleEndian<qint64>(data.constData() + magic().size() + 1);
+            qsizetype pos = HeaderSize;
+            while (pos < data.size())
+            {
+                qsizetype next = pos;
+                quint64 deltaMs = 0;
+                quint64 sizeAndSent = 0;
+                if (!readVarint(data, next, deltaMs) || !readVarint(data, next, sizeAndSent) ||
+                    static_cast<quint64>(data.size() - next) < (sizeAndSent >> 1))
+                {
+                    // incomplete last message
+                    break;
+                }
+                timestampMs += static_cast<qint64>(deltaMs);
+                const auto size = static_cast<qsizetype>(sizeAndSent >> 1);
+                visitor(timestampMs, (sizeAndSent & 1) != 0, next, size);
+                pos = next + size;
+            }
+            return pos;
+        }
+    } // namespace
+
+    /*!
+     * Writer thread of CRawFsdCapture
+     */
+    class CRawFsdCaptureWriter : public CBatchFileWriter
+    {
+    public:
+        //! Constructor
+        CRawFsdCaptureWriter(CRawFsdCapture &capture, qint64 previousMs)
+            : CBatchFileWriter("CRawFsdCaptureWriter", 64 * 1024), m_capture(capture), m_previousMs(previousMs)
+        {}
+
+        //! Destructor
+        ~CRawFsdCaptureWriter() override { stop(); }
+
+    protected:
+        //! Encode all recorded messages
+        void fillBatch(QByteArray &batch) override
+        {
+            const std::vector<char> &buffer = m_capture.m_buffer;
+            const auto capacity = static_cast<quint64>(buffer.size());
+            quint64 read = m_capture.m_read.load(std::memory_order_relaxed);
+            const quint64 write = m_capture.m_write.load(std::memory_order_acquire);
+            while (read < write)
+            {
+                const quint64 offset = read % capacity;
+                const quint64 contiguous = capacity - offset;
+                if (contiguous < sizeof(CRawFsdCapture::Slot))
+                {
+                    read += contiguous;
+                    continue;
+                }
+
+                CRawFsdCapture::Slot slot;
+                std::memcpy(&slot, buffer.data() + offset, sizeof(slot));
+                if (slot.size == CRawFsdCapture::Padding)
+                {
+                    read += contiguous;
+                    continue;
+                }
+
+                // clock steps backwards are recorded as 0ms
+                appendVarint(batch, static_cast<quint64>(qMax(0LL, slot.timestampMs - m_previousMs)));
+                m_previousMs = qMax(m_previousMs, slot.timestampMs);
+                appendVarint(batch, (static_cast<quint64>(slot.size) << 1) | (slot.sent ? 1 : 0));
+                batch.append(buffer.data() + offset + sizeof(slot), slot.size);
+                read += static_cast<quint64>(CRawFsdCapture::slotSize(slot.size));
+            }
+            m_capture.m_read.store(read, std::memory_order_release);
+        }
+
+        //! Report dropped messages
+        void batchWritten() override
+        {
+            const qint64 dropped = m_capture.m_dropped;
+            if (dropped <= m_reportedDropped) { return; }
+            CLogMessage(static_cast<CRawFsdCapture *>(nullptr))
+                    .warning(u"Raw FSD capture overloaded, %1 messages dropped")
+                << (dropped - m_reportedDropped);
+            m_reportedDropped = dropped;
+        }
+
+    private:
+        CRawFsdCapture &m_capture;
+        qint64 m_previousMs = 0;
+        qint64 m_reportedDropped = 0;
+    };
+
+    CRawFsdCapture::CRawFsdCapture(int bufferBytes)
+    {
+        // at least 2 of the longest messages, a multiple of the slot alignment
+        const qsizetype minBytes = 2 * slotSize(m_encoder.requiredSpace(MaxMessageChars));
+        const qsizetype bytes = qMax<qsizetype>(bufferBytes, minBytes);
+        m_buffer.resize(static_cast<std::size_t>((bytes + SlotAlignment - 1) / SlotAlignment * SlotAlignment));
+    }
+
+    CRawFsdCapture::~CRawFsdCapture() { this->stop(); }
+
+    qsizetype CRawFsdCapture::slotSize(qsizetype messageBytes)
+    {
+        const qsizetype size = static_cast<qsizetype>(sizeof(Slot)) + messageBytes;
+        return (size + SlotAlignment - 1) / SlotAlignment * SlotAlignment;
+    }
+
+    bool CRawFsdCapture::start(const QString &fileName, bool append, QString &errorMessage)
+    {
+        this->stop();
+
+        // appending continues with the timestamp of the last message, files without messages are started again
+        qint64 previousMs = QDateTime::currentMSecsSinceEpoch();
+        bool continueFile = false;
+        if (append && QFile::exists(fileName))
+        {
+            QFile file(fileName);
+            if (!file.open(QIODevice::ReadWrite))
+            {
+                errorMessage = file.errorString();
+                return false;
+            }
+
+            // the file is mapped and the messages are skipped, not copied
+            const qint64 fileSize = file.size();
+            uchar *mapped = fileSize > 0 ? file.map(0, fileSize) : nullptr;
+            const QByteArray data = mapped ? QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), fileSize) :
+                                             file.readAll();
+            const qsizetype end = parseCapture(data, [&](qint64 timestampMs, bool, qsizetype, qsizetype) {
+                previousMs = timestampMs;
+                continueFile = true;
+            });
+            if (mapped) { file.unmap(mapped); }
+            if (end < 0)
+            {
+                errorMessage = u"Not a raw FSD capture: " % fileName;
+                return false;
+            }
+
+            // a partially written message is cut off, otherwise the appended messages could not be read
+            if (continueFile && end < fileSize && !file.resize(end))
+            {
+                errorMessage = file.errorString();
+                return false;
+            }
+        }
+
+        auto writer = std::make_unique<CRawFsdCaptureWriter>(*this, previousMs);
+        writer->file().setFileName(fileName);
+        const QIODevice::OpenMode mode = continueFile ? QIODevice::WriteOnly | QIODevice::Append :
+                                                        QIODevice::WriteOnly | QIODevice::Truncate;
+        if (!writer->file().open(mode))
+        {
+            errorMessage = writer->file().errorString();
+            return false;
+        }
+        if (!continueFile) { writer->file().write(header(previousMs)); }
+
+        m_read = m_write.load();
+        m_writer = std::move(writer);
+        m_writer->start(QThread::LowPriority);
+        return true;
+    }
+
+    void CRawFsdCapture::stop()
+    {
+        if (!m_writer) { return; }
+        m_writer->stop();
+        m_writer.reset();
+    }
+
+    bool CRawFsdCapture::isRunning() const { return static_cast<bool>(m_writer); }
+
+    void CRawFsdCapture::record(qint64 timestampMs, bool sent, QStringView message)
+    {
+        if (!m_writer) { return; }
+        const QStringView clipped = message.left(MaxMessageChars);
+        const auto capacity = static_cast<quint64>(m_buffer.size());
+        const auto needed = static_cast<quint64>(slotSize(m_encoder.requiredSpace(clipped.size())));
+        quint64 write = m_write.load(std::memory_order_relaxed);
+        const quint64 used = write - m_read.load(std::memory_order_acquire);
+        quint64 offset = write % capacity;
+
+        // a slot is never split, the rest of the buffer is skipped if too small
+        const quint64 skip = capacity - offset < needed ? capacity - offset : 0;
+        if (capacity - used < skip + needed)
+        {
+            m_dropped++;
+            m_writer->wakeUp();
+            return;
+        }
+        if (skip > 0)
+        {
+            if (skip >= sizeof(Slot))
+            {
+                const Slot padding { 0, Padding, 0 };
+                std::memcpy(m_buffer.data() + offset, &padding, sizeof(padding));
+            }
+            write += skip;
+            offset = 0;
+        }
+
+        char *data = m_buffer.data() + offset + sizeof(Slot);
+        const char *end = m_encoder.appendToBuffer(data, clipped);
+        const Slot slot { timestampMs, static_cast<quint32>(end - data), sent ? 1U : 0U };
+        std::memcpy(m_buffer.data() + offset, &slot, sizeof(slot));
+        write += static_cast<quint64>(slotSize(slot.size));
+        m_write.store(write, std::memory_order_release);
+        m_recorded++;
+
+        // the writer wakes up periodically, bursts are written right away
+        if (used + needed >= capacity / 4) { m_writer->wakeUp(); }
+    }
+
+    bool CRawFsdCapture::isCaptureFile(const QString &fileName)
+    {
+        QFile file(fileName);
+        return file.open(QIODevice::ReadOnly) && file.read(magic().size()) == magic();
+    }
+
+    bool CRawFsdCapture::readCapture(const QString &fileName, QVector<Record> &records, QString &errorMessage)
+    {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            errorMessage = file.errorString();
+            return false;
+        }
+        const QByteArray data = file.readAll();
+        const qsizetype end = parseCapture(data, [&](qint64 timestampMs, bool sent, qsizetype pos, qsizetype size) {
+            records.push_back({ timestampMs, sent, data.mid(pos, size) });
+        });
+        if (end < 0)
+        {
+            errorMessage = u"Not a raw FSD capture: " % fileName;
+            return false;
+        }
+
+        // the writer was interrupted, everything before is fine
+        if (end < data.size()) { errorMessage = u"Truncated raw FSD capture: " % fileName; }
+        return true;
+    }
+
+    QString CRawFsdCapture::toText(const Record &record)
+    {
+        const QLatin1String direction = record.sent ? QLatin1String(" FSD Sent=>") : QLatin1String(" FSD Recv=>");
+        return QDateTime::fromMSecsSinceEpoch(record.timestampMs, QTimeZone::UTC).toString("hh:mm:ss.zzz") %
+               direction % QString::fromUtf8(record.message);
+    }
+
+    bool CRawFsdCapture::convertToText(const QString &captureFileName, const QString &textFileName,
+                                       QString &errorMessage)
+    {
+        QVector<Record> records;
+        if (!readCapture(captureFileName, records, errorMessage)) { return false; }
+
+        QFile file(textFileName);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+        {
+            errorMessage = file.errorString();
+            return false;
+        }
+        for (const Record &record : std::as_const(records)) { file.write((toText(record) % u'\n').toUtf8()); }
+        return true;
+    }
+} // namespace swift::core::fsd
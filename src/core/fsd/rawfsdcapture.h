@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_CORE_FSD_RAWFSDCAPTURE_H
+#define SWIFT_CORE_FSD_RAWFSDCAPTURE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringEncoder>
+#include <QStringView>
+#include <QVector>
+
+#include "core/swiftcoreexport.h"
+
+namespace swift::core::fsd
+{
+    class CRawFsdCaptureWriter;
+
+    /*!
+     * Records raw FSD messages into a compact binary capture file.
+     *
+     * Messages are copied into a preallocated lock-free ring buffer and written by a background thread, so recording
+     * neither allocates nor waits for the disk. If the writer cannot keep up, messages are dropped and counted.
+     *
+     * File format, all integers little endian:
+     * - header: magic "SWFSDCAP", version (1 byte), start time in ms since epoch (8 bytes)
+     * - per message: ms since the previous message (varint), (UTF-8 length << 1 | sent) (varint), UTF-8 message
+     */
+    class SWIFT_CORE_EXPORT CRawFsdCapture
+    {
+    public:
+        //! Message read from a capture
+        struct Record
+        {
+            qint64 timestampMs = 0; //!< ms since epoch
+            bool sent = false; //!< sent or received
+            QByteArray message; //!< UTF-8, without line break
+        };
+
+        static constexpr int DefaultBufferBytes = 1024 * 1024; //!< ring buffer size
+        static constexpr int MaxMessageChars = 4096; //!< longer messages are truncated
+        static constexpr char FileExtension[] = "fsdcapture"; //!< file extension of captures
+
+        //! Constructor
+        explicit CRawFsdCapture(int bufferBytes = DefaultBufferBytes);
+
+        //! Destructor, writes all recorded messages
+        ~CRawFsdCapture();
+
+        //! @{
+        //! Not copyable
+        CRawFsdCapture(const CRawFsdCapture &) = delete;
+        CRawFsdCapture &operator=(const CRawFsdCapture &) = delete;
+        //! @}
+
+        //! Start writing to the file, which is truncated or appended
+        //! \remark appending only continues files written by this class, a partially written last message is cut off
+        bool start(const QString &fileName, bool append, QString &errorMessage);
+
+        //! Write all recorded messages and close the file
+        void stop();
+
+        //! Writing?
+        bool isRunning() const;
+
+        //! Record a message, dropped if the buffer is full
+        //! \remark only to be called by one thread at a time, not allocating
+        void record(qint64 timestampMs, bool sent, QStringView message);
+
+        //! Messages recorded so far
+        //! \threadsafe
+        qint64 getRecordedCount() const { return m_recorded; }
+
+        //! Messages dropped so far, because the writer could not keep up
+        //! \threadsafe
+        qint64 getDroppedCount() const { return m_dropped; }
+
+        //! Is this a capture file?
+        static bool isCaptureFile(const QString &fileName);
+
+        //! Read all messages of a capture
+        static bool readCapture(const QString &fileName, QVector<Record> &records, QString &errorMessage);
+
+        //! Message as written to text logs, "hh:mm:ss.zzz FSD Sent=>message" in UTC
+        static QString toText(const Record &record);
+
+        //! Convert a capture into a text log, as written by the raw FSD message logging
+        static bool convertToText(const QString &captureFileName, const QString &textFileName, QString &errorMessage);
+
+    private:
+        friend class CRawFsdCaptureWriter;
+
+        //! Message in the ring buffer, followed by the UTF-8 message and aligned to 8 bytes
+        struct Slot
+        {
+            qint64 timestampMs; //!< ms since epoch
+            quint32 size; //!< UTF-8 bytes, Padding if the rest of the buffer is unused
+            quint32 sent; //!< sent or received
+        };
+
+        static constexpr quint32 Padding = 0xffffffff; //!< marks the unused end of the buffer
+        static constexpr int SlotAlignment = 8; //!< slots start at multiples
+
+        //! Size of a slot including its message
+        static qsizetype slotSize(qsizetype messageBytes);
+
+        std::vector<char> m_buffer; //!< ring buffer, allocated once
+        alignas(64) std::atomic<quint64> m_write { 0 }; //!< written by the recording thread only
+        alignas(64) std::atomic<quint64> m_read { 0 }; //!< written by the writer thread only
+        QStringEncoder m_encoder { QStringEncoder::Utf8, QStringEncoder::Flag::Stateless };
+        std::atomic<qint64> m_recorded { 0 };
+        std::atomic<qint64> m_dropped { 0 };
+        std::unique_ptr<CRawFsdCaptureWriter> m_writer;
+    };
+} // namespace swift::core::fsd
+
+#endif // SWIFT_CORE_FSD_RAWFSDCAPTURE_H
@@ -13,6 +13,7 @@
 #include <QString>
 #include <QStringBuilder>
 #include <QThread>
+#include <QTimer>
 #include <QUrl>
 #include <Qt>
 #include <QtGlobal>
@@ -133,6 +134,8 @@ namespace swift::core
         this->resetLastSentValues(); // clear all last sent values
         m_updateRemoteAircraftInProgress = false;
 
+        m_elevationRequests.clear();
+
         this->clearInterpolationSetupsPerCallsign();
         this->resetAircraftStatistics();
     }
@@ -177,8 +180,7 @@ namespace swift::core
     void ISimulator::clearData(const CCallsign &callsign)
     {
         m_statsPhysicallyRemovedAircraft++;
-        m_lastSentParts.remove(callsign);
-        m_lastSentSituations.remove(callsign);
+        this->resetLastSentValues(callsign);
         m_loopbackSituations.clear();
         this->removeInterpolationSetupPerCallsign(callsign);
     }
@@ -251,32 +253,89 @@ namespace swift::core
     }
 
     bool ISimulator::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign)
+    {
+        if (this->isShuttingDown()) { return false; }
+        if (reference.isNull() || callsign.isEmpty()) { return false; }
+
+        // close aircraft and aircraft on ground first, the reference is a situation for most requests
+        const auto *situation = dynamic_cast<const CAircraftSituation *>(&reference);
+        const bool onGround = situation && situation->isOnGround();
+        const double rank = CElevationRequestScheduler::rank(this->getDistanceToOwnAircraft(reference), onGround);
+        m_elevationRequests.enqueue(reference, callsign, rank, QDateTime::currentMSecsSinceEpoch());
+        this->dispatchElevationRequests();
+
+        // a probe the driver could not send is dropped, also if the driver can not probe at all
+        return m_elevationRequests.isWaiting(callsign);
+    }
+
+    bool ISimulator::requestElevationProbe(const ICoordinateGeodetic &reference, const CCallsign &callsign)
     {
         Q_UNUSED(reference)
         Q_UNUSED(callsign)
         return false;
     }
 
+    void ISimulator::dispatchElevationRequests()
+    {
+        if (this->isShuttingDown()) { return; }
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        m_elevationRequests.expire(now);
+        const QVector<CElevationRequestScheduler::Probe> probes = m_elevationRequests.takeProbes(now);
+        for (const CElevationRequestScheduler::Probe &probe : probes)
+        {
+            if (!this->requestElevationProbe(probe.position, probe.callsign))
+            {
+                m_elevationRequests.failed(probe.callsign);
+            }
+        }
+
+        // without update runs (e.g. no aircraft rendered) the remaining requests would wait for the next request
+        if (m_elevationDispatchScheduled || m_elevationRequests.getQueuedCount() < 1) { return; }
+        m_elevationDispatchScheduled = true;
+        QPointer<ISimulator> myself(this);
+        QTimer::singleShot(CElevationRequestScheduler::MaxFrameMs, this, [=] {
+            if (!myself) { return; }
+            m_elevationDispatchScheduled = false;
+            this->dispatchElevationRequests();
+        });
+    }
+
+    void ISimulator::ignoreElevationProbe(const CCallsign &callsign)
+    {
+        m_elevationRequests.failed(callsign);
+        this->dispatchElevationRequests();
+    }
+
     void ISimulator::callbackReceivedRequestedElevation(const CElevationPlane &plane, const CCallsign &callsign,
                                                         bool isWater)
     {
         if (this->isShuttingDown()) { return; }
+
+        // all callsigns coalesced into this probe, none if expired or not sent by the scheduler
+        CCallsignSet waiting = m_elevationRequests.completed(callsign, QDateTime::currentMSecsSinceEpoch());
+        this->dispatchElevationRequests(); // a slot is free now
         if (plane.isNull()) { return; } // this happens if requested for a coordinate where scenery is not available
+        if (waiting.isEmpty()) { waiting.insert(callsign); }
 
-        // Update in remote aircraft for given callsign
+        // Update in remote aircraft for given callsigns
         // this will trigger also a position update, new interpolant etc.
-        bool updatedForOnGroundPosition = false;
-        const int updated = CRemoteAircraftAware::updateAircraftGroundElevation(
-            callsign, plane, CAircraftSituation::FromProvider, &updatedForOnGroundPosition);
+        bool likelyOnGroundElevation = false;
+        for (const CCallsign &cs : std::as_const(waiting))
+        {
+            bool updatedForOnGroundPosition = false;
+            const int updated = CRemoteAircraftAware::updateAircraftGroundElevation(
+                cs, plane, CAircraftSituation::FromProvider, &updatedForOnGroundPosition);
+            likelyOnGroundElevation = likelyOnGroundElevation || (updated > 0 && updatedForOnGroundPosition);
+            if (cs != callsign) { this->removePendingElevationRequest(cs); }
+        }
 
         // update in simulator and cache
-        const bool likelyOnGroundElevation = updated > 0 && updatedForOnGroundPosition;
         ISimulationEnvironmentProvider::rememberGroundElevation(callsign, likelyOnGroundElevation,
                                                                 plane); // in simulator
 
         // signal we have received the elevation
         // used by log display
-        emit this->receivedRequestedElevation(plane, callsign);
+        for (const CCallsign &cs : std::as_const(waiting)) { emit this->receivedRequestedElevation(plane, cs); }
         Q_UNUSED(isWater)
     }
 
@@ -292,6 +351,9 @@ namespace swift::core
         m_statsUpdateAircraftLimited = 0;
         m_statsLastUpdateAircraftRequestedMs = 0;
         m_statsUpdateAircraftRequestedDeltaMs = 0;
+        m_statsUpdatePhaseNs.fill(0);
+        for (CLatencyHistogram &histogram : m_statsUpdatePhases) { histogram.reset(); }
+        m_elevationRequests.resetStatistics();
         ISimulationEnvironmentProvider::resetSimulationEnvironmentStatistics();
     }
 
@@ -458,6 +520,19 @@ namespace swift::core
             return false;
         }
 
+        if (part1.startsWith("stats"))
+        {
+            if (parser.matchesPart(2, "reset"))
+            {
+                this->resetAircraftStatistics();
+                CLogMessage(this).info(u"Reset remote aircraft update statistics");
+                return true;
+            }
+            CLogMessage(this).info(u"Remote aircraft update latencies:\n%1") << this->getStatisticsUpdateLatencies();
+            CLogMessage(this).info(u"Elevation requests:\n%1") << this->getStatisticsElevationRequests();
+            return true;
+        }
+
         if (part1.startsWith("limit"))
         {
             const int perSecond = parser.toInt(2, -1);
@@ -527,7 +602,7 @@ namespace swift::core
         CSimpleCommandParser::registerCommand({ ".drv logint off", "no log information for interpolator" });
         CSimpleCommandParser::registerCommand({ ".drv logint write", "write interpolator log to file" });
         CSimpleCommandParser::registerCommand({ ".drv logint clear", "clear current log" });
-        CSimpleCommandParser::registerCommand({ ".drv logint max number", "max. number of entries logged" });
+        CSimpleCommandParser::registerCommand({ ".drv logint max number", "max. number of entries per log file" });
         CSimpleCommandParser::registerCommand({ ".drv pos callsign", "show position for callsign" });
         CSimpleCommandParser::registerCommand(
             { ".drv spline|linear callsign", "set spline/linear interpolator for one/all callsign(s)" });
@@ -536,6 +611,8 @@ namespace swift::core
         CSimpleCommandParser::registerCommand({ ".drv aircraft readd all", "add again (re-add) all aircraft" });
         CSimpleCommandParser::registerCommand(
             { ".drv aircraft rm callsign", "remove a given callsign from simulator" });
+        CSimpleCommandParser::registerCommand({ ".drv stats", "show update and elevation request latencies" });
+        CSimpleCommandParser::registerCommand({ ".drv stats reset", "reset the update statistics" });
 
         if (CBuildConfig::isCompiledWithFsuipcSupport())
         {
@@ -554,46 +631,45 @@ namespace swift::core
         return s.join(", ");
     }
 
-    bool ISimulator::isEqualLastSent(const CAircraftSituation &compare) const
+    bool ISimulator::isEqualLastSent(const CAircraftSituation &compare, CCallsignHandle handle) const
     {
-        Q_ASSERT_X(compare.hasCallsign(), Q_FUNC_INFO, "Need callsign");
-        if (!m_lastSentSituations.contains(compare.getCallsign())) { return false; }
         if (compare.isNull()) { return false; }
-        return compare.equalPbhVectorAltitudeElevation(m_lastSentSituations.value(compare.getCallsign()));
-        // return compare.equalPbhVectorAltitude(m_lastSentSituations.value(compare.getCallsign()));
+        const CAircraftSituation *lastSent = m_lastSentSituations.find(handle);
+        if (!lastSent) { return false; }
+        return compare.equalPbhVectorAltitudeElevation(*lastSent);
+        // return compare.equalPbhVectorAltitude(*lastSent);
     }
 
-    bool ISimulator::isEqualLastSent(const CAircraftParts &compare, const CCallsign &callsign) const
+    bool ISimulator::isEqualLastSent(const CAircraftParts &compare, CCallsignHandle handle) const
     {
-        if (callsign.isEmpty()) { return false; }
-        if (!m_lastSentParts.contains(callsign)) { return false; }
-        return compare.equalValues(m_lastSentParts.value(callsign));
+        const CAircraftParts *lastSent = m_lastSentParts.find(handle);
+        if (!lastSent) { return false; }
+        return compare.equalValues(*lastSent);
     }
 
-    void ISimulator::rememberLastSent(const CAircraftSituation &sent)
+    void ISimulator::rememberLastSent(const CAircraftSituation &sent, CCallsignHandle handle)
     {
         // normally we should never end up without callsign, but it has happened in real world scenarios
         // https://discordapp.com/channels/539048679160676382/568904623151382546/575712119513677826
-        const bool hasCs = sent.hasCallsign();
+        const bool hasCs = !handle.isNull();
         SWIFT_VERIFY_X(hasCs, Q_FUNC_INFO, "Need callsign");
         if (!hasCs) { return; }
-        m_lastSentSituations.insert(sent.getCallsign(), sent);
+        m_lastSentSituations.insert(handle, sent);
     }
 
-    void ISimulator::rememberLastSent(const CAircraftParts &sent, const CCallsign &callsign)
+    void ISimulator::rememberLastSent(const CAircraftParts &sent, CCallsignHandle handle)
     {
         // normally we should never end up without callsign, but it has happened in real world scenarios
         // https://discordapp.com/channels/539048679160676382/568904623151382546/575712119513677826
-        SWIFT_VERIFY_X(!callsign.isEmpty(), Q_FUNC_INFO, "Need callsign");
-        if (callsign.isEmpty()) { return; }
-        m_lastSentParts.insert(callsign, sent);
+        SWIFT_VERIFY_X(!handle.isNull(), Q_FUNC_INFO, "Need callsign");
+        if (handle.isNull()) { return; }
+        m_lastSentParts.insert(handle, sent);
     }
 
     CAircraftSituationList ISimulator::getLastSentCanLikelySkipNearGroundInterpolation() const
     {
-        const QList<CAircraftSituation> situations = m_lastSentSituations.values();
         CAircraftSituationList skipped;
-        for (const CAircraftSituation &s : situations)
+        for (const CAircraftSituation &s : m_lastSentSituations.values())
         {
             if (s.canLikelySkipNearGroundInterpolation()) { skipped.push_back(s); }
         }
@@ -780,10 +856,11 @@ namespace swift::core
         if (callsign.isEmpty()) { return; }
         if (elevation.hasMSLGeodeticHeight())
         {
+            // at least 3 elevations per aircraft, even better as not all are requesting elevations
+            // on ground elevations are taxiways and runways, those grow with the traffic on busy airports
             const int aircraftCount = this->getAircraftInRangeCount();
-            this->setMaxElevationsRemembered(
-                aircraftCount *
-                3); // at least 3 elevations per aircraft, even better as not all are requesting elevations
+            this->setMaxElevationsRemembered(aircraftCount * 3);
+            this->setMaxElevationsRememberedOnGround(qMax(DefaultMaxElevationsGnd, aircraftCount * 20));
             this->rememberGroundElevation(callsign, likelyOnGroundElevation, elevation);
         }
 
@@ -939,8 +1016,9 @@ namespace swift::core
 
     void ISimulator::resetLastSentValues(const CCallsign &callsign)
     {
-        m_lastSentParts.remove(callsign);
-        m_lastSentSituations.remove(callsign);
+        const CCallsignHandle handle = CCallsignHandle::find(callsign);
+        m_lastSentParts.remove(handle);
+        m_lastSentSituations.remove(handle);
     }
 
     void ISimulator::unload()
@@ -1032,10 +1110,58 @@ namespace swift::core
         return m % addDetails.arg(details);
     }
 
+    const QString &ISimulator::updatePhaseToString(UpdatePhase phase)
+    {
+        static const QString setup("setup");
+        static const QString interpolation("interpolation");
+        static const QString parts("parts");
+        static const QString send("send");
+        static const QString total("total");
+        static const QString unknown("unknown");
+        switch (phase)
+        {
+        case UpdatePhaseSetup: return setup;
+        case UpdatePhaseInterpolation: return interpolation;
+        case UpdatePhaseParts: return parts;
+        case UpdatePhaseSend: return send;
+        case UpdatePhaseTotal: return total;
+        default: break;
+        }
+        return unknown;
+    }
+
+    QString ISimulator::getStatisticsUpdateLatencies() const
+    {
+        QStringList lines;
+        for (int phase = 0; phase < UpdatePhaseCount; phase++)
+        {
+            const CLatencyHistogram &histogram = m_statsUpdatePhases[static_cast<size_t>(phase)];
+            lines.push_back(updatePhaseToString(static_cast<UpdatePhase>(phase)) % u": " % histogram.toQString());
+        }
+        return lines.join('\n');
+    }
+
+    void ISimulator::startUpdateRemoteAircraftAndStatistics()
+    {
+        m_updateRemoteAircraftInProgress = true;
+        m_statsUpdatePhaseNs.fill(0);
+        m_statsUpdateAircraftTimer.start();
+    }
+
     void ISimulator::finishUpdateRemoteAircraftAndSetStatistics(qint64 startTime, bool limited)
     {
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
         const qint64 dt = now - startTime;
+        if (m_statsUpdateAircraftTimer.isValid())
+        {
+            // monotonic and sub-ms, the ms values above are kept for the existing displays
+            m_statsUpdatePhaseNs[UpdatePhaseTotal] = m_statsUpdateAircraftTimer.nsecsElapsed();
+            m_statsUpdateAircraftTimer.invalidate();
+            for (size_t phase = 0; phase < m_statsUpdatePhases.size(); phase++)
+            {
+                m_statsUpdatePhases[phase].record(m_statsUpdatePhaseNs[phase]);
+            }
+        }
         m_statsCurrentUpdateTimeMs = dt;
         m_statsUpdateAircraftTimeTotalMs += dt;
         m_statsUpdateAircraftRuns++;
@@ -1052,6 +1178,10 @@ namespace swift::core
             m_statsUpdateAircraftRequestedDeltaMs = startTime - m_statsLastUpdateAircraftRequestedMs;
         }
         if (limited) { m_statsUpdateAircraftLimited++; }
+
+        // probes are sent between the frames, a limited number per frame
+        m_elevationRequests.beginFrame(now);
+        this->dispatchElevationRequests();
     }
 
     void ISimulator::onOwnModelChanged(const CAircraftModel &newModel)
@@ -6,8 +6,10 @@
 #ifndef SWIFT_CORE_SIMULATOR_H
 #define SWIFT_CORE_SIMULATOR_H
 
+#include <array>
 #include <atomic>
 
+#include <QElapsedTimer>
 #include <QFlags>
 #include <QObject>
 #include <QString>
@@ -16,10 +18,12 @@
 #include "core/application.h"
 #include "core/swiftcoreexport.h"
 #include "misc/aviation/airportlist.h"
+#include "misc/aviation/callsignhandle.h"
 #include "misc/aviation/callsignset.h"
 #include "misc/geo/elevationplane.h"
 #include "misc/identifiable.h"
 #include "misc/identifier.h"
+#include "misc/latencyhistogram.h"
 #include "misc/network/clientprovider.h"
 #include "misc/pixmap.h"
 #include "misc/pq/length.h"
@@ -27,6 +31,7 @@
 #include "misc/simplecommandparser.h"
 #include "misc/simulation/aircraftmodellist.h"
 #include "misc/simulation/autopublishdata.h"
+#include "misc/simulation/elevationrequestscheduler.h"
 #include "misc/simulation/interpolation/interpolationrenderingsetup.h"
 #include "misc/simulation/interpolation/interpolationsetupprovider.h"
 #include "misc/simulation/interpolation/interpolatormulti.h"
@@ -74,6 +79,20 @@ namespace swift::core
         Q_DECLARE_FLAGS(SimulatorStatus, SimulatorStatusFlag)
         Q_FLAG(SimulatorStatus)
 
+        //! Phases of updating the remote aircraft, timed per update run
+        enum UpdatePhase
+        {
+            UpdatePhaseSetup, //!< setup lookup
+            UpdatePhaseInterpolation, //!< situation and parts interpolation
+            UpdatePhaseParts, //!< parts comparison and conversion
+            UpdatePhaseSend, //!< sending to the simulator (IPC)
+            UpdatePhaseTotal, //!< the whole update run
+            UpdatePhaseCount //!< number of phases
+        };
+
+        //! Name of the phase
+        static const QString &updatePhaseToString(UpdatePhase phase);
+
         //! Log categories
         static const QStringList &getLogCategories();
 
@@ -230,10 +249,12 @@ namespace swift::core
         }
 
         //! \copydoc swift::misc::simulation::ISimulationEnvironmentProvider::requestElevation
-        //! \remark needs to be overridden if the concrete driver supports such an option
+        //! \remark queued and sent by ISimulator::dispatchElevationRequests, drivers implement
+        //!         ISimulator::requestElevationProbe
+        //! \return false if the request was dropped, e.g. the driver could not send the probe
         //! \sa ISimulator::callbackReceivedRequestedElevation
         bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                              const swift::misc::aviation::CCallsign &callsign) override;
+                              const swift::misc::aviation::CCallsign &callsign) final;
 
         //! \copydoc swift::misc::simulation::ISimulationEnvironmentProvider::requestElevation
         bool requestElevation(const swift::misc::aviation::CAircraftSituation &situation)
@@ -272,6 +293,8 @@ namespace swift::core
         //! .drv aircraft readd callsign      re-add (add again) aircraft             swift::core::ISimulator
         //! .drv aircraft readd all           re-add all aircraft                     swift::core::ISimulator
         //! .drv aircraft rm callsign         remove aircraft                         swift::core::ISimulator
+        //! .drv stats                        show update and elevation latencies     swift::core::ISimulator
+        //! .drv stats reset                  reset the update statistics             swift::core::ISimulator
         //! .drv fsuipc   on|off              enable/disable FSUIPC (if applicable)
         //! swift::simplugin::fscommon::CSimulatorFsCommon
         //! </pre>
@@ -319,6 +342,18 @@ namespace swift::core
         //! Time between two update requests
         qint64 getStatisticsAircraftUpdatedRequestedDeltaMs() const { return m_statsUpdateAircraftRequestedDeltaMs; }
 
+        //! Latency histogram of an update phase, nanoseconds per update run
+        const swift::misc::CLatencyHistogram &getStatisticsUpdateLatency(UpdatePhase phase) const
+        {
+            return m_statsUpdatePhases[static_cast<size_t>(phase)];
+        }
+
+        //! Percentiles of all update phases, one line per phase
+        QString getStatisticsUpdateLatencies() const;
+
+        //! Queued and outstanding elevation probes, coalesced requests and latencies
+        QString getStatisticsElevationRequests() const { return m_elevationRequests.getStatistics(); }
+
         //! The traced loopback situations
         swift::misc::aviation::CAircraftSituationList
         getLoopbackSituations(const swift::misc::aviation::CCallsign &callsign) const;
@@ -428,6 +463,18 @@ namespace swift::core
         //! Remove remote aircraft from simulator
         virtual int physicallyRemoveMultipleRemoteAircraft(const swift::misc::aviation::CCallsignSet &callsigns);
 
+        //! Send an elevation probe to the simulator, the answer is expected in
+        //! ISimulator::callbackReceivedRequestedElevation for the same callsign
+        //! \remark needs to be overridden if the concrete driver supports such an option
+        virtual bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                           const swift::misc::aviation::CCallsign &callsign);
+
+        //! Send the queued elevation probes, as many as the per frame and outstanding limits allow
+        void dispatchElevationRequests();
+
+        //! The answer of an elevation probe is not used, frees its slot
+        void ignoreElevationProbe(const swift::misc::aviation::CCallsign &callsign);
+
         //! Clear all aircraft related data, but do not physically remove the aircraft
         virtual void clearAllRemoteAircraftData();
 
@@ -495,18 +542,21 @@ namespace swift::core
         void safeKillTimer();
 
         //! Equal to last sent situation
-        bool isEqualLastSent(const swift::misc::aviation::CAircraftSituation &compare) const;
+        //! \remark handle as resolved by the aircraft's interpolator, so the update loop does not look it up
+        bool isEqualLastSent(const swift::misc::aviation::CAircraftSituation &compare,
+                             swift::misc::aviation::CCallsignHandle handle) const;
 
-        //! Equal to last sent situation
+        //! Equal to last sent parts
         bool isEqualLastSent(const swift::misc::aviation::CAircraftParts &compare,
-                             const swift::misc::aviation::CCallsign &callsign) const;
+                             swift::misc::aviation::CCallsignHandle handle) const;
 
         //! Remember as last sent
-        void rememberLastSent(const swift::misc::aviation::CAircraftSituation &sent);
+        void rememberLastSent(const swift::misc::aviation::CAircraftSituation &sent,
+                              swift::misc::aviation::CCallsignHandle handle);
 
         //! Remember as last sent
         void rememberLastSent(const swift::misc::aviation::CAircraftParts &sent,
-                              const swift::misc::aviation::CCallsign &callsign);
+                              swift::misc::aviation::CCallsignHandle handle);
 
         //! Last sent situations
         swift::misc::aviation::CAircraftSituationList getLastSentCanLikelySkipNearGroundInterpolation() const;
@@ -531,6 +581,17 @@ namespace swift::core
                                               const swift::misc::simulation::CInterpolationStatus &status,
                                               const QString &details = {}) const;
 
+        //! Mark update as in progress and start timing it
+        void startUpdateRemoteAircraftAndStatistics();
+
+        //! Add the time since the timer was (re)started to the phase and restart the timer
+        //! \remark the time is summed up per phase and recorded when the update run is finished
+        void addUpdatePhaseTime(UpdatePhase phase, QElapsedTimer &timer)
+        {
+            m_statsUpdatePhaseNs[static_cast<size_t>(phase)] += timer.nsecsElapsed();
+            timer.start();
+        }
+
         //! Update stats and flags
         void finishUpdateRemoteAircraftAndSetStatistics(qint64 startTime, bool limited = false);
 
@@ -574,6 +635,9 @@ namespace swift::core
         qint64 m_lastRecordedGndElevationMs = 0; //!< when gnd.elevation was last modified
         qint64 m_statsLastUpdateAircraftRequestedMs = 0; //!< when was the last aircraft update requested
         qint64 m_statsUpdateAircraftRequestedDeltaMs = 0; //!< delta time between 2 aircraft updates
+        QElapsedTimer m_statsUpdateAircraftTimer; //!< monotonic timer of the current update run
+        std::array<qint64, UpdatePhaseCount> m_statsUpdatePhaseNs {}; //!< phase times of the current update run
+        std::array<swift::misc::CLatencyHistogram, UpdatePhaseCount> m_statsUpdatePhases; //!< phase times per run
 
         swift::misc::aviation::CAltitude m_pseudoElevation {
             swift::misc::aviation::CAltitude::null()
@@ -581,9 +645,10 @@ namespace swift::core
         swift::misc::simulation::CSimulatorInternals m_simulatorInternals; //!< setup read from the sim
         swift::misc::simulation::CInterpolationLogger m_interpolationLogger; //!< log.interpolation
         swift::misc::simulation::CAutoPublishData m_autoPublishing; //!< for the DB
-        swift::misc::aviation::CAircraftSituationPerCallsign
-            m_lastSentSituations; //!< last situations sent to simulator
-        swift::misc::aviation::CAircraftPartsPerCallsign m_lastSentParts; //!< last parts sent to simulator
+        swift::misc::aviation::CCallsignHandleMap<swift::misc::aviation::CAircraftSituation>
+            m_lastSentSituations; //!< last situations sent to simulator, checked per aircraft and update
+        swift::misc::aviation::CCallsignHandleMap<swift::misc::aviation::CAircraftParts>
+            m_lastSentParts; //!< last parts sent to simulator
 
         // some optional functionality which can be used by the simulators as needed
         swift::misc::simulation::CSimulatedAircraftList
@@ -618,6 +683,10 @@ namespace swift::core
         int m_statsPhysicallyAddedAircraft = 0; //!< statistics, how many aircraft added
         int m_statsPhysicallyRemovedAircraft = 0; //!< statistics, how many aircraft removed
 
+        // elevation probes
+        swift::misc::simulation::CElevationRequestScheduler m_elevationRequests; //!< queued and outstanding probes
+        bool m_elevationDispatchScheduled = false; //!< dispatch without update runs scheduled
+
         // misc.
         bool m_networkConnected = false; //!< flight network connected
         bool m_test = false; //!< test mode?
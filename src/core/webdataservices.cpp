@@ -43,6 +43,8 @@ using namespace swift::misc::db;
 using namespace swift::misc::simulation;
 using namespace swift::misc::network;
 using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
 using namespace swift::misc::weather;
 
 namespace swift::core
@@ -823,6 +825,19 @@ namespace swift::core
         return 0;
     }
 
+    CAirportList CWebDataServices::getAirportsInRange(const ICoordinateGeodetic &position, const CLength &range) const
+    {
+        if (m_airportDataReader) { return m_airportDataReader->getAirportsInRange(position, range); }
+        return {};
+    }
+
+    CAirport CWebDataServices::getClosestAirportWithinRange(const ICoordinateGeodetic &position,
+                                                            const CLength &range) const
+    {
+        if (m_airportDataReader) { return m_airportDataReader->getClosestAirportWithinRange(position, range); }
+        return {};
+    }
+
     CAirport CWebDataServices::getAirportForIcaoDesignator(const QString &icao) const
     {
         if (m_airportDataReader) { return m_airportDataReader->getAirportForIcaoDesignator(icao); }
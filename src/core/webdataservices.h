@@ -365,6 +365,18 @@ namespace swift::core
         //! \threadsafe
         int getAirportsCount() const;
 
+        //! Get airports within range of the position
+        //! \threadsafe
+        swift::misc::aviation::CAirportList
+        getAirportsInRange(const swift::misc::geo::ICoordinateGeodetic &position,
+                           const swift::misc::physical_quantities::CLength &range) const;
+
+        //! Get the closest airport within range of the position
+        //! \threadsafe
+        swift::misc::aviation::CAirport
+        getClosestAirportWithinRange(const swift::misc::geo::ICoordinateGeodetic &position,
+                                     const swift::misc::physical_quantities::CLength &range) const;
+
         //! Get airport for ICAO designator
         //! \threadsafe
         swift::misc::aviation::CAirport getAirportForIcaoDesignator(const QString &icao) const;
@@ -113,9 +113,8 @@ namespace swift::gui::components
     {
         this->setSimulator(simulator);
         if (onlyIfNotEmpty && this->getOwnModelsCount() > 0) { return false; }
-        const IAircraftModelLoader::LoadMode mode =
-            onlyIfNotEmpty ? IAircraftModelLoader::InBackgroundNoCache : IAircraftModelLoader::LoadInBackground;
-        this->requestSimulatorModels(simulator, mode);
+        // only files changed since the last load are parsed, the forced reload parses everything
+        this->requestSimulatorModels(simulator, IAircraftModelLoader::InBackgroundIncremental);
         return true;
     }
 
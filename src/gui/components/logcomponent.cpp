@@ -5,6 +5,7 @@
 
 #include <QAction>
 #include <QMenu>
+#include <QPushButton>
 #include <QTabWidget>
 #include <Qt>
 #include <QtGlobal>
@@ -52,12 +53,17 @@ namespace swift::gui::components
         connect(&m_history, &CLogHistoryReplica::elementAdded, this,
                 [this](const CStatusMessage &message) { ui->comp_StatusMessages->appendStatusMessageToList(message); });
         connect(&m_history, &CLogHistoryReplica::elementsReplaced, this, [this](const CStatusMessageList &messages) {
+            // the replaced list also contains the messages already shown
+            clearMessages();
             ui->comp_StatusMessages->appendStatusMessagesToList(messages);
+            ui->pb_LoadOlder->setEnabled(m_history.hasOlderValues());
         });
         connect(ui->comp_StatusMessages, &CStatusMessagesDetail::filterChanged, this, [this](const CVariant &filter) {
             clearMessages();
             m_history.setFilter(filter.to<CLogPattern>());
         });
+        connect(ui->pb_LoadOlder, &QPushButton::clicked, this, &CLogComponent::loadOlderMessages);
+        ui->pb_LoadOlder->setEnabled(false);
         m_history.setFilter(CLogPattern().withSeverityAtOrAbove(CStatusMessage::SeverityInfo));
         m_history.initialize(sApp->getDataLinkDBus());
     }
@@ -91,6 +97,13 @@ namespace swift::gui::components
         ui->comp_StatusMessages->setSorting(propertyIndex, order);
     }
 
+    void CLogComponent::loadOlderMessages()
+    {
+        // enabled again when the older page has been received and there are even older messages
+        ui->pb_LoadOlder->setEnabled(false);
+        m_history.requestOlderValues();
+    }
+
     void CLogComponent::clear() { ui->comp_StatusMessages->clear(); }
 
     void CLogComponent::clearMessages() { ui->comp_StatusMessages->clear(); }
@@ -90,6 +90,9 @@ namespace swift::gui::components
         void requestAttention();
 
     private:
+        //! Request the page of messages before the oldest one shown
+        void loadOlderMessages();
+
         QScopedPointer<Ui::CLogComponent> ui;
         swift::misc::CLogHistoryReplica m_history;
     };
@@ -12,13 +12,14 @@
 #include "core/context/contextownaircraft.h"
 #include "gui/guiapplication.h"
 #include "gui/infoarea.h"
-#include "misc/simulation/simulatedaircraft.h"
+#include "misc/aviation/aircraftsituation.h"
 
 using namespace swift::misc;
 using namespace swift::misc::aviation;
 using namespace swift::misc::simulation;
 using namespace swift::misc::geo;
 using namespace swift::misc::physical_quantities;
+using namespace swift::core::context;
 using namespace swift::gui::views;
 
 namespace swift::gui::components
@@ -46,15 +47,23 @@ namespace swift::gui::components
         connect(ui->cb_RadarRange, qOverload<int>(&QComboBox::currentIndexChanged), this,
                 &CRadarComponent::changeRangeFromUserSelection);
         connect(ui->sb_FontSize, qOverload<int>(&QSpinBox::valueChanged), this, &CRadarComponent::updateFont);
-        connect(ui->cb_Callsign, &QCheckBox::toggled, this, &CRadarComponent::refreshTargets);
-        connect(ui->cb_Heading, &QCheckBox::toggled, this, &CRadarComponent::refreshTargets);
-        connect(ui->cb_Altitude, &QCheckBox::toggled, this, &CRadarComponent::refreshTargets);
-        connect(ui->cb_GroundSpeed, &QCheckBox::toggled, this, &CRadarComponent::refreshTargets);
+        connect(ui->cb_Callsign, &QCheckBox::toggled, this, &CRadarComponent::updateTagFields);
+        connect(ui->cb_Heading, &QCheckBox::toggled, this, &CRadarComponent::updateTagFields);
+        connect(ui->cb_Altitude, &QCheckBox::toggled, this, &CRadarComponent::updateTagFields);
+        connect(ui->cb_GroundSpeed, &QCheckBox::toggled, this, &CRadarComponent::updateTagFields);
         connect(ui->cb_Grid, &QCheckBox::toggled, this, &CRadarComponent::toggleGrid);
 
+        if (sGui && sGui->getIContextNetwork())
+        {
+            connect(sGui->getIContextNetwork(), &IContextNetwork::removedAircraft, this,
+                    &CRadarComponent::onRemovedAircraft, Qt::QueuedConnection);
+        }
+
         prepareScene();
+        updateTagFields();
 
-        m_updateTimer.start(5000);
+        // updates are incremental, so they can be frequent
+        m_updateTimer.start(1000);
         m_headingTimer.start(50);
     }
 
@@ -77,7 +86,8 @@ namespace swift::gui::components
         m_scene.addItem(&m_microGraticule);
         m_scene.addItem(&m_radials);
         m_scene.addItem(&m_radarTargets);
-        m_radarTargetPen.setCosmetic(true);
+        m_scene.setItemIndexMethod(QGraphicsScene::NoIndex); // targets move all the time
+        m_radarTargets.setTagFont(m_tagFont);
         addCenter();
         addGraticules();
         addRadials();
@@ -136,74 +146,57 @@ namespace swift::gui::components
     void CRadarComponent::refreshTargets()
     {
         if (!sGui || sGui->isShuttingDown()) { return; }
+        if (!sGui->getIContextNetwork() || !sGui->getIContextNetwork()->isConnected())
+        {
+            m_radarTargets.clear();
+            m_situationsRevision = -1;
+            return;
+        }
+        if (!isVisibleWidget()) { return; }
 
-        qDeleteAll(m_radarTargets.childItems());
+        // only situations changed since the last refresh, targets not changed are left alone
+        // the revision never decreases, removed aircraft (also on clearing the airspace) are signaled
+        const qint64 revision = sGui->getIContextNetwork()->getLatestAircraftSituationsRevision();
+        if (revision != m_situationsRevision)
+        {
+            const CAircraftSituationList situations =
+                sGui->getIContextNetwork()->getLatestAircraftSituationsSince(m_situationsRevision);
+            m_radarTargets.updateTargets(situations);
+            m_situationsRevision = revision;
+        }
 
-        if (sGui->getIContextNetwork() && sGui->getIContextNetwork()->isConnected())
+        // safety net for missed removal signals
+        if (++m_refreshCount % 10 == 0)
         {
-            if (isVisibleWidget())
-            {
-                const CSimulatedAircraftList aircraft = sGui->getIContextNetwork()->getAircraftInRange();
-                for (const CSimulatedAircraft &sa : aircraft)
-                {
-                    const double distanceNM = sa.getRelativeDistance().value(CLengthUnit::NM());
-                    const double bearingRad = sa.getRelativeBearing().value(CAngleUnit::rad());
-                    const int groundSpeedKts = sa.getGroundSpeed().valueInteger(CSpeedUnit::kts());
-
-                    QPointF position(polarPoint(distanceNM, bearingRad));
-
-                    auto *dot = new QGraphicsEllipseItem(-2.0, -2.0, 4.0, 4.0, &m_radarTargets);
-                    dot->setPos(position);
-                    dot->setPen(m_radarTargetPen);
-                    dot->setBrush(m_radarTargetPen.color());
-                    dot->setFlags(QGraphicsItem::ItemIgnoresTransformations);
-
-                    auto *tag = new QGraphicsTextItem(&m_radarTargets);
-                    QString tagText;
-                    if (ui->cb_Callsign->isChecked()) { tagText += sa.getCallsignAsString() % u"\n"; }
-                    if (ui->cb_Altitude->isChecked())
-                    {
-                        int flightLeveL = sa.getAltitude().valueInteger(CLengthUnit::ft()) / 100;
-                        tagText += u"FL" % QStringLiteral("%1").arg(flightLeveL, 3, 10, QChar('0'));
-                    }
-                    if (ui->cb_GroundSpeed->isChecked())
-                    {
-                        if (!tagText.isEmpty()) tagText += QStringLiteral(" ");
-                        tagText += QString::number(groundSpeedKts) % u" kt";
-                    }
-
-                    tag->setPlainText(tagText);
-                    tag->setFont(m_tagFont);
-                    tag->setPos(position);
-                    tag->setDefaultTextColor(Qt::green);
-                    tag->setFlags(QGraphicsItem::ItemIgnoresTransformations);
-
-                    if (ui->cb_Heading->isChecked() && groundSpeedKts > 3.0)
-                    {
-                        const double headingRad = sa.getHeading().value(CAngleUnit::rad());
-                        QPen pen(Qt::green, 1);
-                        pen.setCosmetic(true);
-                        auto *li =
-                            new QGraphicsLineItem(QLineF({ 0.0, 0.0 }, polarPoint(5.0, headingRad)), &m_radarTargets);
-                        li->setPos(position);
-                        li->setPen(pen);
-                    }
-                }
-            }
+            m_radarTargets.removeTargetsExcept(sGui->getIContextNetwork()->getAircraftInRangeCallsigns());
         }
     }
 
+    void CRadarComponent::onRemovedAircraft(const CCallsign &callsign) { m_radarTargets.removeTarget(callsign); }
+
+    void CRadarComponent::updateTagFields()
+    {
+        CRadarTargets::TagFields fields = CRadarTargets::NoTag;
+        fields.setFlag(CRadarTargets::Callsign, ui->cb_Callsign->isChecked());
+        fields.setFlag(CRadarTargets::Altitude, ui->cb_Altitude->isChecked());
+        fields.setFlag(CRadarTargets::GroundSpeed, ui->cb_GroundSpeed->isChecked());
+        fields.setFlag(CRadarTargets::HeadingLine, ui->cb_Heading->isChecked());
+        m_radarTargets.setTagFields(fields);
+    }
+
     void CRadarComponent::rotateView()
     {
         if (sGui->getIContextOwnAircraft())
         {
             if (isVisibleWidget())
             {
+                const CAircraftSituation ownSituation = sGui->getIContextOwnAircraft()->getOwnAircraftSituation();
+                m_radarTargets.setOwnPosition(ownSituation);
+
                 int headingDegree = 0;
                 if (!ui->cb_LockNorth->isChecked())
                 {
-                    headingDegree = sGui->getIContextOwnAircraft()->getOwnAircraftSituation().getHeading().valueInteger(
-                        CAngleUnit::deg());
+                    headingDegree = ownSituation.getHeading().valueInteger(CAngleUnit::deg());
                 }
 
                 if (m_rotatenAngle != headingDegree)
@@ -257,7 +250,7 @@ namespace swift::gui::components
     void CRadarComponent::updateFont(int pointSize)
     {
         m_tagFont.setPointSize(pointSize);
-        this->refreshTargets();
+        m_radarTargets.setTagFont(m_tagFont);
     }
 
     void CRadarComponent::onInfoAreaTabBarChanged(int index)
@@ -15,6 +15,7 @@
 #include "core/actionbind.h"
 #include "gui/enablefordockwidgetinfoarea.h"
 #include "gui/swiftguiexport.h"
+#include "gui/views/radartargets.h"
 #include "misc/input/actionhotkeydefs.h"
 
 namespace Ui
@@ -44,9 +45,16 @@ namespace swift::gui::components
         void addGraticules();
         void addRadials();
 
+        //! Apply the situations changed since the last refresh
         void refreshTargets();
         void rotateView();
 
+        //! Aircraft removed from the airspace
+        void onRemovedAircraft(const swift::misc::aviation::CCallsign &callsign);
+
+        //! Shown tag fields from the check boxes
+        void updateTagFields();
+
         void toggleGrid(bool checked);
 
         void fitInView();
@@ -61,17 +69,18 @@ namespace swift::gui::components
 
         QScopedPointer<Ui::CRadarComponent> ui;
         QGraphicsScene m_scene;
-        QGraphicsItemGroup m_radarTargets;
+        views::CRadarTargets m_radarTargets;
         QGraphicsItemGroup m_center;
         QGraphicsItemGroup m_macroGraticule;
         QGraphicsItemGroup m_microGraticule;
         QGraphicsItemGroup m_radials;
 
-        QPen m_radarTargetPen = { Qt::green, 1 };
         qreal m_rangeNM = 10.0;
         int m_rotatenAngle = 0;
         QTimer m_updateTimer;
         QTimer m_headingTimer;
+        qint64 m_situationsRevision = -1; //!< revision of the shown situations, -1 for a full refresh
+        int m_refreshCount = 0; //!< to reconcile the targets from time to time
 
         QFont m_tagFont;
 
@@ -250,6 +250,11 @@ namespace swift::gui::models
         this->updateContainerMaybeAsync(currentModels);
     }
 
+    QString CAircraftModelListModel::diffKey(const CAircraftModel &model) const
+    {
+        return model.getModelString().toUpper(); // model strings are unique case insensitive
+    }
+
     QVariant CAircraftModelListModel::data(const QModelIndex &index, int role) const
     {
         if (role == Qt::BackgroundRole)
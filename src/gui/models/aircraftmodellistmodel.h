@@ -88,6 +88,11 @@ namespace swift::gui::models
         //! \copydoc swift::gui::models::CListModelBaseNonTemplate::isOrderable
         bool isOrderable() const override { return true; }
 
+    protected:
+        //! \copydoc swift::gui::models::CListModelBase::diffKey
+        //! \remark model string, as also models not loaded from the DB have one
+        QString diffKey(const swift::misc::simulation::CAircraftModel &model) const override;
+
     private:
         AircraftModelMode m_mode = NotSet; //!< current mode
         bool m_highlightModels = false; //!< highlight if in m_highlightStrings
@@ -103,6 +103,7 @@ namespace swift::gui::models
         CColumn copy(column);
         copy.setTranslationContext(m_translationContext);
         m_columns.push_back(copy);
+        m_revision++;
     }
 
     void CColumns::addColumnIncognito(const CColumn &column)
@@ -226,14 +226,25 @@ namespace swift::gui::models
         const CColumn &at(int columnNumber) const { return m_columns.at(columnNumber); }
 
         //! Clear
-        void clear() { m_columns.clear(); }
+        void clear()
+        {
+            m_columns.clear();
+            m_revision++;
+        }
 
         //! @{
         //! Set columns
-        void setColumns(const QList<CColumn> &columns) { m_columns = columns; }
-        void setColumns(const CColumns &columns) { m_columns = columns.m_columns; }
+        void setColumns(const QList<CColumn> &columns)
+        {
+            m_columns = columns;
+            m_revision++;
+        }
+        void setColumns(const CColumns &columns) { this->setColumns(columns.m_columns); }
         //! @}
 
+        //! Changes whenever columns are added or replaced, e.g. to invalidate cached values
+        int getRevision() const { return m_revision; }
+
         //! Columns
         const QList<CColumn> &columns() const { return m_columns; }
 
@@ -255,6 +266,7 @@ namespace swift::gui::models
     private:
         QList<CColumn> m_columns; //!< all columns
         QString m_translationContext; //!< for future usage
+        int m_revision = 0; //!< \sa getRevision
     };
 } // namespace swift::gui::models
 
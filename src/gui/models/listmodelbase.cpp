@@ -6,9 +6,16 @@
 
 #include "gui/models/listmodelbase.h"
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
 #include <QJsonDocument>
 #include <QList>
 #include <QMimeData>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
 
 #include "gui/guiutility.h"
 #include "gui/models/allmodelcontainers.h"
@@ -20,10 +27,58 @@ using namespace swift::misc::aviation;
 
 namespace swift::gui::models
 {
+    namespace Private
+    {
+        //! Sort, large ranges in chunks on the global thread pool which are merged then
+        //! \remark chunks not taken by the pool are sorted by the calling thread, so this never waits for a pool
+        template <class Compare>
+        void parallelSort(QVector<int> &values, Compare compare)
+        {
+            constexpr int MinChunkSize = 8192;
+            const int chunks = qBound(1, static_cast<int>(values.size()) / MinChunkSize, QThread::idealThreadCount());
+            if (chunks < 2)
+            {
+                std::sort(values.begin(), values.end(), compare);
+                return;
+            }
+
+            QVector<int> bounds;
+            for (int chunk = 0; chunk <= chunks; chunk++) { bounds.push_back(values.size() * chunk / chunks); }
+            QSemaphore sorted;
+            for (int chunk = 1; chunk < chunks; chunk++)
+            {
+                const auto sortChunk = [&, chunk] {
+                    std::sort(values.begin() + bounds[chunk], values.begin() + bounds[chunk + 1], compare);
+                    sorted.release();
+                };
+                if (!QThreadPool::globalInstance()->tryStart(sortChunk)) { sortChunk(); }
+            }
+            std::sort(values.begin(), values.begin() + bounds[1], compare);
+            sorted.acquire(chunks - 1);
+
+            for (int width = 1; width < chunks; width *= 2)
+            {
+                for (int chunk = 0; chunk + width < chunks; chunk += 2 * width)
+                {
+                    std::inplace_merge(values.begin() + bounds[chunk], values.begin() + bounds[chunk + width],
+                                       values.begin() + bounds[qMin(chunk + 2 * width, chunks)], compare);
+                }
+            }
+        }
+    } // namespace Private
+
     template <typename T, bool UseCompare>
     CListModelBase<T, UseCompare>::CListModelBase(const QString &translationContext, QObject *parent)
         : CListModelBaseNonTemplate(translationContext, parent)
-    {}
+    {
+        // rows change their position, cached display values are gone
+        const auto invalidate = [this] { this->invalidateDisplayValues(); };
+        connect(this, &QAbstractItemModel::modelReset, this, invalidate);
+        connect(this, &QAbstractItemModel::layoutChanged, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsInserted, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsRemoved, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsMoved, this, invalidate);
+    }
 
     template <typename T, bool UseCompare>
     int CListModelBase<T, UseCompare>::rowCount(const QModelIndex &parentIndex) const
@@ -92,6 +147,21 @@ namespace swift::gui::models
         // index, upfront checking
         const int row = index.row();
         const int col = index.column();
+
+        // display values are formatted once, and then kept until the row changes
+        const bool cached = role == Qt::DisplayRole;
+        const quint64 cacheKey = (static_cast<quint64>(row) << 32) | static_cast<quint32>(col);
+        if (cached)
+        {
+            if (m_displayValuesColumnsRevision != m_columns.getRevision())
+            {
+                m_displayValues.clear();
+                m_displayValuesColumnsRevision = m_columns.getRevision();
+            }
+            const auto it = m_displayValues.constFind(cacheKey);
+            if (it != m_displayValues.constEnd() && it->formatter == formatter) { return it->value; }
+        }
+
         const CPropertyIndex propertyIndex = this->columnToPropertyIndex(col);
         const int propertyIndexFront = propertyIndex.frontCasted<int>();
 
@@ -104,8 +174,33 @@ namespace swift::gui::models
         }
 
         // Formatted data
-        const ObjectType obj = this->containerOrFilteredContainer()[row];
-        return formatter->data(role, obj.propertyByIndex(propertyIndex)).getQVariant();
+        const ObjectType &obj = this->containerOrFilteredContainer()[row];
+        const QVariant value = formatter->data(role, obj.propertyByIndex(propertyIndex)).getQVariant();
+        if (cached)
+        {
+            // bounded, the cells shown are cached again soon
+            if (m_displayValues.size() >= MaxDisplayValues) { m_displayValues.clear(); }
+            m_displayValues.insert(cacheKey, { formatter, value });
+        }
+        return value;
+    }
+
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::invalidateDisplayValues(int firstRow, int lastRow)
+    {
+        if (m_displayValues.isEmpty()) { return; }
+        if (firstRow < 0 || lastRow < firstRow || (lastRow - firstRow) * m_columns.size() > m_displayValues.size())
+        {
+            m_displayValues.clear();
+            return;
+        }
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int col = 0; col < m_columns.size(); col++)
+            {
+                m_displayValues.remove((static_cast<quint64>(row) << 32) | static_cast<quint32>(col));
+            }
+        }
     }
 
     template <typename T, bool UseCompare>
@@ -147,6 +242,7 @@ namespace swift::gui::models
         const int row = index.row();
         if (row < 0 || row >= this->container().size()) { return false; }
         m_container[row] = obj;
+        this->invalidateDisplayValues(row, row);
         return true;
     }
 
@@ -157,30 +253,170 @@ namespace swift::gui::models
 
         // Keep sorting out of begin/end reset model
         ContainerType sortedContainer;
-        ContainerType selection;
-        if (m_selectionModel) { selection = m_selectionModel->selectedObjects(); }
-        const int oldSize = m_container.size();
         const bool performSort = sort && container.size() > 1 && this->hasValidSortColumn();
         if (performSort)
         {
             const int sortColumn = this->getSortColumn();
             sortedContainer = this->sortContainerByColumn(container, sortColumn, m_sortOrder);
         }
+        const ContainerType &newContainer = performSort ? sortedContainer : container;
+
+        // Only signal the changed rows if possible, views keep their scroll position and selection
+        const bool usePrecomputedDiff = isSameData(m_precomputedDiffShown, m_container) &&
+                                        isSameData(m_precomputedDiffContainer, newContainer);
+        const CListModelDiff precomputedDiff = m_precomputedDiff;
+        m_precomputedDiffShown.clear();
+        m_precomputedDiffContainer.clear();
+        m_precomputedDiff = {};
+
+        if (this->hasFilter())
+        {
+            const ContainerType newContainerFiltered = m_filter->filter(newContainer);
+            const CListModelDiff diff = this->diffContainer(m_containerFiltered, newContainerFiltered);
+            if (diff.isValid())
+            {
+                m_container = newContainer;
+                this->applyDiff(m_containerFiltered, newContainerFiltered, diff);
+                return m_container.size();
+            }
+        }
+        else
+        {
+            const CListModelDiff diff =
+                usePrecomputedDiff ? precomputedDiff : this->diffContainer(m_container, newContainer);
+            if (diff.isValid())
+            {
+                this->applyDiff(m_container, newContainer, diff);
+                return m_container.size();
+            }
+        }
+
+        ContainerType selection;
+        if (m_selectionModel) { selection = m_selectionModel->selectedObjects(); }
 
         this->beginResetModel();
-        m_container = performSort ? sortedContainer : container;
+        m_container = newContainer;
         this->updateFilteredContainer(); // use sorted container for filtered if applicable
         this->endResetModel();
 
         // reselect if implemented in specialized view
         if (!selection.isEmpty()) { m_selectionModel->selectObjects(selection); }
 
-        const int newSize = m_container.size();
-        Q_UNUSED(oldSize)
-
         // I have to update even with same size because I cannot tell what/if data are changed
         this->emitModelDataChanged();
-        return newSize;
+        return m_container.size();
+    }
+
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::applyDiff(ContainerType &shown, const ContainerType &newShown,
+                                                  const CListModelDiff &diff)
+    {
+        m_applyingDiff = true;
+
+        // removed rows, from the bottom so the rows above keep their position
+        const QVector<QPair<int, int>> removed = CListModelDiff::toRanges(diff.getRemovedRows());
+        for (auto it = removed.crbegin(); it != removed.crend(); ++it)
+        {
+            this->beginRemoveRows(QModelIndex(), it->first, it->second);
+            shown.erase(shown.begin() + it->first, shown.begin() + it->second + 1);
+            this->endRemoveRows();
+        }
+
+        // kept rows into their new order, like a sort
+        if (diff.isReordered())
+        {
+            const QVector<int> &keptNewRows = diff.getKeptNewRows();
+            QVector<int> order(keptNewRows.size()); // kept row at each position
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](int a, int b) { return keptNewRows[a] < keptNewRows[b]; });
+            QVector<int> position(order.size()); // position of each kept row
+            for (int p = 0; p < order.size(); p++) { position[order[p]] = p; }
+
+            emit this->layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+            ContainerType reordered;
+            for (const int row : std::as_const(order)) { reordered.push_back(shown[row]); }
+            shown = reordered;
+            const QModelIndexList from = this->persistentIndexList();
+            QModelIndexList to;
+            to.reserve(from.size());
+            for (const QModelIndex &index : from) { to.push_back(this->index(position[index.row()], index.column())); }
+            this->changePersistentIndexList(from, to);
+            emit this->layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+        }
+
+        // inserted rows, from the top so all rows above are already at their new position
+        for (const QPair<int, int> &range : CListModelDiff::toRanges(diff.getInsertedRows()))
+        {
+            this->beginInsertRows(QModelIndex(), range.first, range.second);
+            for (int row = range.first; row <= range.second; row++)
+            {
+                shown.insert(shown.begin() + row, newShown[row]);
+            }
+            this->endInsertRows();
+        }
+
+        // changed values of kept rows
+        shown = newShown;
+        const int lastColumn = this->columnCount() - 1;
+        for (const QPair<int, int> &range : CListModelDiff::toRanges(diff.getChangedRows()))
+        {
+            emit this->dataChanged(this->index(range.first, 0), this->index(range.second, lastColumn));
+        }
+
+        m_applyingDiff = false;
+        if (diff.hasChanges()) { this->emitModelDataChanged(); }
+    }
+
+    template <typename T, bool UseCompare>
+    CListModelDiff CListModelBase<T, UseCompare>::diffContainer(const ContainerType &shown,
+                                                                const ContainerType &container) const
+    {
+        if (m_modelDestroyed || shown.isEmpty() || container.isEmpty()) { return {}; }
+        if (this->diffKey(container.front()).isEmpty()) { return {}; } // no keys, avoid the effort
+
+        QStringList oldKeys;
+        oldKeys.reserve(shown.size());
+        for (const ObjectType &object : shown) { oldKeys.push_back(this->diffKey(object)); }
+        QStringList newKeys;
+        newKeys.reserve(container.size());
+        for (const ObjectType &object : container) { newKeys.push_back(this->diffKey(object)); }
+
+        CListModelDiff diff = CListModelDiff::fromKeys(oldKeys, newKeys);
+        if (!diff.isValid()) { return diff; }
+
+        QVector<int> changedRows;
+        const QVector<int> &keptOldRows = diff.getKeptOldRows();
+        const QVector<int> &keptNewRows = diff.getKeptNewRows();
+        for (int i = 0; i < keptOldRows.size(); i++)
+        {
+            if (shown[keptOldRows[i]] != container[keptNewRows[i]]) { changedRows.push_back(keptNewRows[i]); }
+        }
+        std::sort(changedRows.begin(), changedRows.end());
+        diff.setChangedRows(changedRows);
+        return diff;
+    }
+
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::setPrecomputedDiff(const ContainerType &shown, const ContainerType &container,
+                                                           const CListModelDiff &diff)
+    {
+        m_precomputedDiffShown = shown;
+        m_precomputedDiffContainer = container;
+        m_precomputedDiff = diff;
+    }
+
+    template <typename T, bool UseCompare>
+    QString CListModelBase<T, UseCompare>::diffKey(const ObjectType &object) const
+    {
+        Q_UNUSED(object)
+        return {};
+    }
+
+    template <typename T, bool UseCompare>
+    bool CListModelBase<T, UseCompare>::isSameData(const ContainerType &c1, const ContainerType &c2)
+    {
+        if (c1.size() != c2.size()) { return false; }
+        return c1.isEmpty() || &*c1.cbegin() == &*c2.cbegin();
     }
 
     template <typename T, bool UseCompare>
@@ -208,11 +444,17 @@ namespace swift::gui::models
         if (m_modelDestroyed) { return nullptr; }
         const auto sortColumn = this->getSortColumn();
         const auto sortOrder = this->getSortOrder();
-        CWorker *worker = CWorker::fromTask(this, "ModelSort", [this, container, sortColumn, sortOrder]() {
-            return this->sortContainerByColumn(container, sortColumn, sortOrder);
+        // the diff to the shown rows is also computed in the background, used if they are still shown
+        const ContainerType shown = this->hasFilter() ? ContainerType() : m_container;
+        const auto diff = std::make_shared<CListModelDiff>();
+        CWorker *worker = CWorker::fromTask(this, "ModelSort", [this, container, sortColumn, sortOrder, shown, diff]() {
+            const ContainerType sortedContainer = this->sortContainerByColumn(container, sortColumn, sortOrder);
+            *diff = this->diffContainer(shown, sortedContainer);
+            return sortedContainer;
         });
-        worker->thenWithResult<ContainerType>(this, [this](const ContainerType &sortedContainer) {
+        worker->thenWithResult<ContainerType>(this, [this, shown, diff](const ContainerType &sortedContainer) {
             if (m_modelDestroyed) { return; }
+            this->setPrecomputedDiff(shown, sortedContainer, *diff);
             this->update(sortedContainer, false);
         });
         worker->then(this, &CListModelBase::asyncUpdateFinished);
@@ -444,9 +686,9 @@ namespace swift::gui::models
                                                       const QVector<int> &roles)
     {
         // underlying base class changed
-        Q_UNUSED(topLeft)
-        Q_UNUSED(bottomRight)
         Q_UNUSED(roles)
+        this->invalidateDisplayValues(topLeft.row(), bottomRight.row());
+        if (m_applyingDiff) { return; } // signaled once the diff is applied
         this->emitModelDataChanged();
     }
 
@@ -528,15 +770,64 @@ namespace swift::gui::models
             return container; // at release build do nothing
         }
 
-        // sort the values
-        const auto tieBreakersCopy =
+        // sort keys are extracted once per object, not per comparison
+        CPropertyIndexList indexes =
             m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
-        const std::integral_constant<bool, UseCompare> marker {};
-        const auto p = [=](const ObjectType &a, const ObjectType &b) -> bool {
-            return Private::compareForModelSort<ObjectType>(a, b, order, propertyIndex, tieBreakersCopy, marker);
-        };
+        indexes.push_front(propertyIndex);
+        const QVector<ObjectType> objects = container.toVector();
+        QVector<int> rows(objects.size());
+        std::iota(rows.begin(), rows.end(), 0);
+        const auto ordered = [order](int c) { return order == Qt::AscendingOrder ? c < 0 : c > 0; };
+
+        if constexpr (UseCompare)
+        {
+            // typed keys if the values are strings or numbers, otherwise the objects compare
+            QVector<QVector<Private::SortKey>> keys(indexes.size());
+            for (int level = 0; level < indexes.size(); level++)
+            {
+                keys[level].reserve(objects.size());
+                for (const ObjectType &object : objects)
+                {
+                    keys[level].push_back(Private::SortKey::fromVariant(object.propertyByIndex(indexes[level])));
+                }
+            }
+            Private::parallelSort(rows, [&](int a, int b) {
+                for (int level = 0; level < keys.size(); level++)
+                {
+                    int c = 0;
+                    if (!Private::SortKey::compare(keys[level][a], keys[level][b], c))
+                    {
+                        c = objects[a].comparePropertyByIndex(indexes[level], objects[b]);
+                    }
+                    if (c != 0) { return ordered(c); }
+                }
+                return a < b; // equal objects keep their order
+            });
+        }
+        else
+        {
+            QVector<QVector<CVariant>> keys(indexes.size());
+            for (int level = 0; level < indexes.size(); level++)
+            {
+                keys[level].reserve(objects.size());
+                for (const ObjectType &object : objects)
+                {
+                    keys[level].push_back(object.propertyByIndex(indexes[level]));
+                }
+            }
+            Private::parallelSort(rows, [&](int a, int b) {
+                for (int level = 0; level < keys.size(); level++)
+                {
+                    const int c = compare(keys[level][a], keys[level][b]);
+                    if (c != 0) { return ordered(c); }
+                }
+                return a < b; // equal objects keep their order
+            });
+        }
 
-        return container.sorted(p);
+        ContainerType sorted;
+        for (const int row : std::as_const(rows)) { sorted.push_back(objects[row]); }
+        return sorted;
     }
 
     template <typename T, bool UseCompare>
@@ -8,8 +8,11 @@
 
 #include <memory>
 
+#include <QDateTime>
+#include <QHash>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QMetaType>
 #include <QModelIndex>
 #include <QModelIndexList>
 #include <QString>
@@ -17,6 +20,7 @@
 #include <QVector>
 
 #include "gui/models/listmodelbasenontemplate.h"
+#include "gui/models/listmodeldiff.h"
 #include "gui/models/modelfilter.h"
 #include "gui/models/selectionmodel.h"
 
@@ -103,6 +107,7 @@ namespace swift::gui::models
         //! Update by new container
         //! \return int size after update
         //! \remarks a sorting is performed only if a valid sort column is set
+        //! \remarks if the objects have a diffKey, only the changed rows are signaled instead of a model reset
         virtual int update(const ContainerType &container, bool sort = true);
 
         //! Asynchronous update
@@ -142,6 +147,15 @@ namespace swift::gui::models
         //! \threadsafe under normal conditions thread safe as long as the column metadata are not changed
         ContainerType sortContainerByColumn(const ContainerType &container, int column, Qt::SortOrder order) const;
 
+        //! Rows removed, inserted, moved and changed from shown to container, matched by diffKey
+        //! \threadsafe as long as diffKey is, meant to be used before update in a background thread
+        //! \sa setPrecomputedDiff
+        CListModelDiff diffContainer(const ContainerType &shown, const ContainerType &container) const;
+
+        //! Diff computed before for the next update with exactly this container, used if nothing has changed since
+        //! \sa diffContainer
+        void setPrecomputedDiff(const ContainerType &shown, const ContainerType &container, const CListModelDiff &diff);
+
         //! Similar to ContainerType::push_back
         virtual void push_back(const ObjectType &object);
 
@@ -203,6 +217,11 @@ namespace swift::gui::models
         void onChangedDigest() override;
         //! @}
 
+        //! Key identifying an object across updates, empty if there is no unique key
+        //! \remark models without key are reset by update
+        //! \threadsafe called from the background thread of asynchronous updates
+        virtual QString diffKey(const ObjectType &object) const;
+
         //! Update filtered container
         void updateFilteredContainer();
 
@@ -213,44 +232,91 @@ namespace swift::gui::models
         ContainerType m_containerFiltered; //!< cache for filtered container data
         std::unique_ptr<IModelFilter<ContainerType>> m_filter; //!< used filter
         ISelectionModel<ContainerType> *m_selectionModel = nullptr; //!< selection model
+
+    private:
+        //! Signal the changes of a diff while turning the shown container into newShown
+        void applyDiff(ContainerType &shown, const ContainerType &newShown, const CListModelDiff &diff);
+
+        //! Same container data, without comparing the elements
+        static bool isSameData(const ContainerType &c1, const ContainerType &c2);
+
+        //! Formatted value of a cell
+        struct DisplayValue
+        {
+            const CDefaultFormatter *formatter = nullptr; //!< formatter used, changes e.g. in incognito mode
+            QVariant value; //!< formatted value
+        };
+
+        static constexpr int MaxDisplayValues = 10000; //!< bound of the cache, about 10 screens of cells
+
+        //! Forget cached display values of the given rows, or of all rows
+        void invalidateDisplayValues(int firstRow = -1, int lastRow = -1);
+
+        mutable QHash<quint64, DisplayValue> m_displayValues; //!< by row and column
+        mutable int m_displayValuesColumnsRevision = -1; //!< columns the display values are formatted for
+        ContainerType m_precomputedDiffShown; //!< shown rows the precomputed diff starts from
+        ContainerType m_precomputedDiffContainer; //!< container the precomputed diff leads to
+        CListModelDiff m_precomputedDiff; //!< diff computed in a background thread
+        bool m_applyingDiff = false; //!< signals of a diff are in progress
     };
 
     namespace Private
     {
-        //! Sort with compare function
-        template <class ObjectType>
-        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order,
-                                 const swift::misc::CPropertyIndex &index,
-                                 const swift::misc::CPropertyIndexList &tieBreakers, std::true_type)
+        //! Value of a sort column, extracted once per object instead of per comparison
+        struct SortKey
         {
-            const int c = a.comparePropertyByIndex(index, b);
-            if (c == 0)
+            //! Kind of value
+            enum Kind
+            {
+                Other, //!< compared by the objects
+                Number, //!< numbers, booleans and timestamps
+                String //!< compared case insensitive, as the objects do
+            };
+
+            Kind kind = Other; //!< kind of value
+            double number = 0.0; //!< value if number
+            QString string; //!< value if string
+
+            //! Typed key of a property value
+            static SortKey fromVariant(const swift::misc::CVariant &variant)
             {
-                if (!tieBreakers.isEmpty())
+                SortKey key;
+                const QVariant &value = variant.getQVariant();
+                switch (value.typeId())
                 {
-                    return compareForModelSort<ObjectType>(a, b, order, tieBreakers.front(),
-                                                           tieBreakers.copyFrontRemoved(), std::true_type());
+                case QMetaType::QString:
+                    key.kind = String;
+                    key.string = value.toString();
+                    break;
+                case QMetaType::Bool:
+                case QMetaType::Int:
+                case QMetaType::UInt:
+                case QMetaType::LongLong:
+                case QMetaType::ULongLong:
+                case QMetaType::Float:
+                case QMetaType::Double:
+                    key.kind = Number;
+                    key.number = value.toDouble();
+                    break;
+                case QMetaType::QDateTime:
+                    key.kind = Number;
+                    key.number = static_cast<double>(value.toDateTime().toMSecsSinceEpoch());
+                    break;
+                default: break;
                 }
-                return false;
+                return key;
             }
-            return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0);
-        }
 
-        //! Sort without compare function
-        template <typename ObjectType>
-        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order,
-                                 const swift::misc::CPropertyIndex &index,
-                                 const swift::misc::CPropertyIndexList &tieBreakers, std::false_type)
-        {
-            const swift::misc::CVariant aQv = a.propertyByIndex(index);
-            const swift::misc::CVariant bQv = b.propertyByIndex(index);
-            if (!tieBreakers.isEmpty() && aQv == bQv)
+            //! Compare as values
+            //! \return false if the keys cannot be compared as values
+            static bool compare(const SortKey &a, const SortKey &b, int &result)
             {
-                return compareForModelSort<ObjectType>(a, b, order, tieBreakers.front(), tieBreakers.copyFrontRemoved(),
-                                                       std::false_type());
+                if (a.kind != b.kind || a.kind == Other) { return false; }
+                if (a.kind == Number) { result = a.number < b.number ? -1 : (b.number < a.number ? 1 : 0); }
+                else { result = a.string.compare(b.string, Qt::CaseInsensitive); }
+                return true;
             }
-            return (order == Qt::AscendingOrder) ? (aQv < bQv) : (bQv < aQv);
-        }
+        };
     } // namespace Private
 } // namespace swift::gui::models
 
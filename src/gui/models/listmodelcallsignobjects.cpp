@@ -46,6 +46,12 @@ namespace swift::gui::models
         return m_highlightCallsigns.contains(callsignForIndex(index));
     }
 
+    template <typename T, bool UseCompare>
+    QString CListModelCallsignObjects<T, UseCompare>::diffKey(const ObjectType &object) const
+    {
+        return object.getCallsign().asString();
+    }
+
     // see here for the reason of thess forward instantiations
     // https://isocpp.org/wiki/faq/templates#separate-template-fn-defn-from-decl
     template class CListModelCallsignObjects<swift::misc::aviation::CAtcStationList, true>;
@@ -65,6 +65,9 @@ namespace swift::gui::models
         //! Constructor
         CListModelCallsignObjects(const QString &translationContext, QObject *parent = nullptr);
 
+        //! \copydoc swift::gui::models::CListModelBase::diffKey
+        QString diffKey(const ObjectType &object) const override;
+
     private:
         swift::misc::aviation::CCallsignSet m_highlightCallsigns; //!< callsigns to be highlighted
         QColor m_highlightColor = Qt::green;
@@ -69,6 +69,12 @@ namespace swift::gui::models
         return m_highlightKeys.contains(dbKeyForIndex(index));
     }
 
+    template <typename T, typename K, bool UseCompare>
+    QString CListModelDbObjects<T, K, UseCompare>::diffKey(const ObjectType &object) const
+    {
+        return object.hasValidDbKey() ? object.getDbKeyAsString() : QString();
+    }
+
     template <typename T, typename K, bool UseCompare>
     COrderableListModelDbObjects<T, K, UseCompare>::COrderableListModelDbObjects(const QString &translationContext,
                                                                                  QObject *parent)
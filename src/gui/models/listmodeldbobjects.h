@@ -68,6 +68,9 @@ namespace swift::gui::models
         //! Constructor
         CListModelDbObjects(const QString &translationContext, QObject *parent = nullptr);
 
+        //! \copydoc swift::gui::models::CListModelBase::diffKey
+        QString diffKey(const ObjectType &object) const override;
+
     private:
         QList<KeyType> m_highlightKeys; //!< keys to be highlighted
         QColor m_highlightColor = Qt::green;
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "gui/models/listmodeldiff.h"
+
+#include <QHash>
+
+namespace swift::gui::models
+{
+    namespace
+    {
+        //! Row by key, false if a key is empty or not unique
+        bool rowsByKey(const QStringList &keys, QHash<QString, int> &rows)
+        {
+            rows.reserve(keys.size());
+            for (int row = 0; row < keys.size(); row++)
+            {
+                const QString &key = keys.at(row);
+                if (key.isEmpty() || rows.contains(key)) { return false; }
+                rows.insert(key, row);
+            }
+            return true;
+        }
+    } // namespace
+
+    CListModelDiff CListModelDiff::fromKeys(const QStringList &oldKeys, const QStringList &newKeys)
+    {
+        // nothing to keep, a reset is as good
+        if (oldKeys.isEmpty() || newKeys.isEmpty()) { return {}; }
+
+        QHash<QString, int> oldRows;
+        QHash<QString, int> newRows;
+        if (!rowsByKey(oldKeys, oldRows) || !rowsByKey(newKeys, newRows)) { return {}; }
+
+        CListModelDiff diff;
+        int previousNewRow = -1;
+        for (int oldRow = 0; oldRow < oldKeys.size(); oldRow++)
+        {
+            const int newRow = newRows.value(oldKeys.at(oldRow), -1);
+            if (newRow < 0)
+            {
+                diff.m_removedRows.push_back(oldRow);
+                continue;
+            }
+            diff.m_keptOldRows.push_back(oldRow);
+            diff.m_keptNewRows.push_back(newRow);
+            if (newRow < previousNewRow) { diff.m_reordered = true; }
+            previousNewRow = newRow;
+        }
+        for (int newRow = 0; newRow < newKeys.size(); newRow++)
+        {
+            if (!oldRows.contains(newKeys.at(newRow))) { diff.m_insertedRows.push_back(newRow); }
+        }
+
+        // mostly other rows, signaling all of them is more expensive than a reset
+        diff.m_valid = diff.m_removedRows.size() + diff.m_insertedRows.size() <= diff.m_keptOldRows.size();
+        return diff;
+    }
+
+    QVector<QPair<int, int>> CListModelDiff::toRanges(const QVector<int> &rows)
+    {
+        QVector<QPair<int, int>> ranges;
+        for (const int row : rows)
+        {
+            if (!ranges.isEmpty() && ranges.last().second + 1 == row) { ranges.last().second = row; }
+            else { ranges.push_back({ row, row }); }
+        }
+        return ranges;
+    }
+} // namespace swift::gui::models
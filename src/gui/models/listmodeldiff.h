@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_GUI_MODELS_LISTMODELDIFF_H
+#define SWIFT_GUI_MODELS_LISTMODELDIFF_H
+
+#include <QPair>
+#include <QStringList>
+#include <QVector>
+
+#include "gui/swiftguiexport.h"
+
+namespace swift::gui::models
+{
+    /*!
+     * Rows removed, inserted, moved and changed between the shown rows of a list model and a new container.
+     *
+     * Rows are matched by a unique key, like callsign or DB key, so a model can signal the changes instead of
+     * resetting. Computing the diff does not touch the model and can be done in a background thread.
+     */
+    class SWIFT_GUI_EXPORT CListModelDiff
+    {
+    public:
+        //! Default constructor, invalid diff
+        CListModelDiff() = default;
+
+        //! Diff by the keys of the shown and the new rows
+        //! \remark invalid if a key is empty or not unique, or if most rows are replaced and a reset is cheaper
+        static CListModelDiff fromKeys(const QStringList &oldKeys, const QStringList &newKeys);
+
+        //! Can the model be updated by this diff, otherwise it has to be reset
+        bool isValid() const { return m_valid; }
+
+        //! Any rows removed, inserted, moved or changed?
+        bool hasChanges() const
+        {
+            return !m_removedRows.isEmpty() || !m_insertedRows.isEmpty() || m_reordered || !m_changedRows.isEmpty();
+        }
+
+        //! Old rows removed, ascending
+        const QVector<int> &getRemovedRows() const { return m_removedRows; }
+
+        //! New rows inserted, ascending
+        const QVector<int> &getInsertedRows() const { return m_insertedRows; }
+
+        //! Old rows kept, ascending
+        const QVector<int> &getKeptOldRows() const { return m_keptOldRows; }
+
+        //! New rows of the kept rows, in the order of getKeptOldRows
+        const QVector<int> &getKeptNewRows() const { return m_keptNewRows; }
+
+        //! Do kept rows change their order?
+        bool isReordered() const { return m_reordered; }
+
+        //! Kept rows whose values have changed, as new rows ascending
+        const QVector<int> &getChangedRows() const { return m_changedRows; }
+
+        //! Set the kept rows whose values have changed
+        void setChangedRows(const QVector<int> &newRows) { m_changedRows = newRows; }
+
+        //! Ascending rows as ranges of consecutive rows (first, last)
+        static QVector<QPair<int, int>> toRanges(const QVector<int> &rows);
+
+    private:
+        bool m_valid = false;
+        bool m_reordered = false;
+        QVector<int> m_removedRows;
+        QVector<int> m_insertedRows;
+        QVector<int> m_keptOldRows;
+        QVector<int> m_keptNewRows;
+        QVector<int> m_changedRows;
+    };
+} // namespace swift::gui::models
+
+#endif // SWIFT_GUI_MODELS_LISTMODELDIFF_H
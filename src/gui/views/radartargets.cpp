@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "gui/views/radartargets.h"
+
+#include <cmath>
+
+#include <QFontMetricsF>
+#include <QGraphicsItemGroup>
+#include <QGraphicsLineItem>
+#include <QLineF>
+#include <QPainter>
+#include <QPen>
+#include <QStaticText>
+#include <QStringBuilder>
+#include <QtMath>
+
+#include "misc/pq/units.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+
+namespace swift::gui::views
+{
+    /*!
+     * Dot and tag of a radar target, drawn in device coordinates
+     */
+    class CRadarTargetMarker : public QGraphicsItem
+    {
+    public:
+        //! Constructor
+        CRadarTargetMarker(const QColor &color, QGraphicsItem *parent) : QGraphicsItem(parent), m_color(color)
+        {
+            setFlags(QGraphicsItem::ItemIgnoresTransformations);
+            m_firstLine.setTextFormat(Qt::PlainText);
+            m_secondLine.setTextFormat(Qt::PlainText);
+        }
+
+        //! Set the tag, the layout is kept until the text changes
+        void setTag(const QString &firstLine, const QString &secondLine, const QFont &font)
+        {
+            if (m_font == font && m_firstLine.text() == firstLine && m_secondLine.text() == secondLine) { return; }
+            prepareGeometryChange();
+            m_font = font;
+            m_firstLine.setText(firstLine);
+            m_firstLine.prepare(QTransform(), font);
+            m_secondLine.setText(secondLine);
+            m_secondLine.prepare(QTransform(), font);
+            m_lineHeight = QFontMetricsF(font).lineSpacing();
+            m_bounds = QRectF(-DotRadius, -DotRadius, 2 * DotRadius, 2 * DotRadius);
+            if (!firstLine.isEmpty()) { m_bounds |= QRectF(TagOffset, m_firstLine.size()); }
+            if (!secondLine.isEmpty())
+            {
+                m_bounds |= QRectF(TagOffset + QPointF(0, m_lineHeight), m_secondLine.size());
+            }
+        }
+
+        //! \copydoc QGraphicsItem::boundingRect
+        QRectF boundingRect() const override { return m_bounds; }
+
+        //! \copydoc QGraphicsItem::paint
+        void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override
+        {
+            Q_UNUSED(option)
+            Q_UNUSED(widget)
+            painter->setPen(m_color);
+            painter->setBrush(m_color);
+            painter->drawEllipse(QPointF(0, 0), DotRadius, DotRadius);
+            if (m_firstLine.text().isEmpty() && m_secondLine.text().isEmpty()) { return; }
+            painter->setFont(m_font);
+            painter->drawStaticText(TagOffset, m_firstLine);
+            painter->drawStaticText(TagOffset + QPointF(0, m_lineHeight), m_secondLine);
+        }
+
+    private:
+        static constexpr qreal DotRadius = 2.0;
+        static constexpr QPointF TagOffset { 4.0, 4.0 };
+
+        QColor m_color;
+        QFont m_font;
+        QStaticText m_firstLine;
+        QStaticText m_secondLine;
+        qreal m_lineHeight = 0.0;
+        QRectF m_bounds { -DotRadius, -DotRadius, 2 * DotRadius, 2 * DotRadius };
+    };
+
+    CRadarTargets::CRadarTargets(QGraphicsItem *parent) : QGraphicsItem(parent)
+    {
+        setFlags(QGraphicsItem::ItemHasNoContents);
+    }
+
+    CRadarTargets::~CRadarTargets() = default; // targets are child items
+
+    void CRadarTargets::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+    {
+        Q_UNUSED(painter)
+        Q_UNUSED(option)
+        Q_UNUSED(widget)
+    }
+
+    QPointF CRadarTargets::project(double latitudeDeg, double longitudeDeg) const
+    {
+        double deltaLongitudeDeg = longitudeDeg - m_referenceLongitudeDeg;
+        if (deltaLongitudeDeg > 180.0) { deltaLongitudeDeg -= 360.0; }
+        else if (deltaLongitudeDeg < -180.0) { deltaLongitudeDeg += 360.0; }
+        return { deltaLongitudeDeg * m_referenceLongitudeScale * 60.0,
+                 -(latitudeDeg - m_referenceLatitudeDeg) * 60.0 };
+    }
+
+    void CRadarTargets::setOwnPosition(const ICoordinateGeodetic &position)
+    {
+        if (position.isNull()) { return; }
+        const double latitudeDeg = position.latitude().value(CAngleUnit::deg());
+        const double longitudeDeg = position.longitude().value(CAngleUnit::deg());
+        if (!m_hasReference || QLineF(QPointF(), project(latitudeDeg, longitudeDeg)).length() > ReprojectDistanceNM)
+        {
+            m_hasReference = true;
+            m_referenceLatitudeDeg = latitudeDeg;
+            m_referenceLongitudeDeg = longitudeDeg;
+            m_referenceLongitudeScale = std::cos(qDegreesToRadians(latitudeDeg));
+            this->reproject();
+        }
+        const QPointF offset = -project(latitudeDeg, longitudeDeg);
+        if (offset != pos()) { setPos(offset); }
+    }
+
+    void CRadarTargets::reproject()
+    {
+        for (const Target &target : std::as_const(m_targets))
+        {
+            target.group->setPos(project(target.latitudeDeg, target.longitudeDeg));
+        }
+    }
+
+    int CRadarTargets::updateTargets(const CAircraftSituationList &situations)
+    {
+        int changed = 0;
+        for (const CAircraftSituation &situation : situations)
+        {
+            const CCallsign &callsign = situation.getCallsign();
+            if (callsign.isEmpty() || situation.isPositionNull()) { continue; }
+            const double latitudeDeg = situation.latitude().value(CAngleUnit::deg());
+            const double longitudeDeg = situation.longitude().value(CAngleUnit::deg());
+            const int flightLevel = situation.getAltitude().valueInteger(CLengthUnit::ft()) / 100;
+            const int groundSpeedKts = situation.getGroundSpeed().valueInteger(CSpeedUnit::kts());
+            const int headingDeg = situation.getHeading().valueInteger(CAngleUnit::deg());
+
+            auto it = m_targets.find(callsign);
+            const bool added = it == m_targets.end();
+            if (added)
+            {
+                Target target;
+                target.group = new QGraphicsItemGroup(this);
+                target.marker = new CRadarTargetMarker(m_color, target.group);
+                it = m_targets.insert(callsign, target);
+            }
+
+            Target &target = it.value();
+            const bool moved = added || target.latitudeDeg != latitudeDeg || target.longitudeDeg != longitudeDeg;
+            if (moved)
+            {
+                target.latitudeDeg = latitudeDeg;
+                target.longitudeDeg = longitudeDeg;
+                target.group->setPos(project(latitudeDeg, longitudeDeg));
+            }
+
+            const bool tagChanged = target.flightLevel != flightLevel || target.groundSpeedKts != groundSpeedKts ||
+                                    target.headingDeg != headingDeg;
+            if (tagChanged)
+            {
+                target.flightLevel = flightLevel;
+                target.groundSpeedKts = groundSpeedKts;
+                target.headingDeg = headingDeg;
+                this->updateTag(callsign, target);
+            }
+            if (moved || tagChanged) { changed++; }
+        }
+        return changed;
+    }
+
+    void CRadarTargets::updateTag(const CCallsign &callsign, Target &target)
+    {
+        const QString firstLine = m_fields.testFlag(Callsign) ? callsign.asString() : QString();
+        QString secondLine;
+        if (m_fields.testFlag(Altitude))
+        {
+            secondLine = u"FL" % QStringLiteral("%1").arg(target.flightLevel, 3, 10, QChar('0'));
+        }
+        if (m_fields.testFlag(GroundSpeed))
+        {
+            if (!secondLine.isEmpty()) { secondLine += u' '; }
+            secondLine += QString::number(target.groundSpeedKts) % u" kt";
+        }
+        target.marker->setTag(firstLine, secondLine, m_font);
+
+        const bool showHeading = m_fields.testFlag(HeadingLine) && target.groundSpeedKts > 3;
+        if (showHeading && !target.headingLine)
+        {
+            QPen pen(m_color, 1);
+            pen.setCosmetic(true);
+            target.headingLine = new QGraphicsLineItem(target.group);
+            target.headingLine->setPen(pen);
+        }
+        if (target.headingLine)
+        {
+            // same conversion as the radar component: north is -y, east is +x
+            const double headingRad = qDegreesToRadians(static_cast<double>(target.headingDeg));
+            target.headingLine->setLine(
+                QLineF(0.0, 0.0, HeadingLineNM * std::sin(headingRad), -HeadingLineNM * std::cos(headingRad)));
+            target.headingLine->setVisible(showHeading);
+        }
+    }
+
+    bool CRadarTargets::removeTarget(const CCallsign &callsign)
+    {
+        const auto it = m_targets.find(callsign);
+        if (it == m_targets.end()) { return false; }
+        delete it->group;
+        m_targets.erase(it);
+        return true;
+    }
+
+    int CRadarTargets::removeTargetsExcept(const CCallsignSet &callsigns)
+    {
+        int removed = 0;
+        for (auto it = m_targets.begin(); it != m_targets.end();)
+        {
+            if (callsigns.contains(it.key()))
+            {
+                ++it;
+                continue;
+            }
+            delete it->group;
+            it = m_targets.erase(it);
+            removed++;
+        }
+        return removed;
+    }
+
+    void CRadarTargets::clear()
+    {
+        for (const Target &target : std::as_const(m_targets)) { delete target.group; }
+        m_targets.clear();
+    }
+
+    QPointF CRadarTargets::targetPosition(const CCallsign &callsign) const
+    {
+        const auto it = m_targets.constFind(callsign);
+        if (it == m_targets.constEnd()) { return {}; }
+        return it->group->pos() + pos();
+    }
+
+    void CRadarTargets::setTagFields(TagFields fields)
+    {
+        if (m_fields == fields) { return; }
+        m_fields = fields;
+        for (auto it = m_targets.begin(); it != m_targets.end(); ++it) { this->updateTag(it.key(), it.value()); }
+    }
+
+    void CRadarTargets::setTagFont(const QFont &font)
+    {
+        if (m_font == font) { return; }
+        m_font = font;
+        for (auto it = m_targets.begin(); it != m_targets.end(); ++it) { this->updateTag(it.key(), it.value()); }
+    }
+} // namespace swift::gui::views
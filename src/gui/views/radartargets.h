@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_GUI_VIEWS_RADARTARGETS_H
+#define SWIFT_GUI_VIEWS_RADARTARGETS_H
+
+#include <QColor>
+#include <QFont>
+#include <QGraphicsItem>
+#include <QHash>
+#include <QPointF>
+
+#include "gui/swiftguiexport.h"
+#include "misc/aviation/aircraftsituationlist.h"
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignset.h"
+#include "misc/geo/coordinategeodetic.h"
+
+class QGraphicsItemGroup;
+class QGraphicsLineItem;
+
+namespace swift::gui::views
+{
+    class CRadarTargetMarker;
+
+    /*!
+     * Aircraft shown in a radar view, one item group per callsign which is kept and updated in place.
+     *
+     * Targets are placed in a plane around a reference point (1 unit = 1 NM, north up), the layer itself is moved so
+     * the own aircraft is at the origin. Moving the own aircraft therefore moves one item only, and updating targets
+     * touches the moved or changed targets only. Tag texts are laid out once and kept until they change.
+     * \remark positions are projected equirectangular, accurate enough within radar ranges
+     */
+    class SWIFT_GUI_EXPORT CRadarTargets : public QGraphicsItem
+    {
+    public:
+        //! Parts of the target shown
+        enum TagField
+        {
+            NoTag = 0,
+            Callsign = 1 << 0, //!< callsign in the first tag line
+            Altitude = 1 << 1, //!< flight level
+            GroundSpeed = 1 << 2, //!< ground speed in kts
+            HeadingLine = 1 << 3, //!< 5 NM line in heading direction, if moving
+            AllFields = Callsign | Altitude | GroundSpeed | HeadingLine
+        };
+        Q_DECLARE_FLAGS(TagFields, TagField)
+
+        //! Constructor
+        explicit CRadarTargets(QGraphicsItem *parent = nullptr);
+
+        //! Destructor
+        ~CRadarTargets() override;
+
+        //! Position of the own aircraft, the center of the radar
+        void setOwnPosition(const swift::misc::geo::ICoordinateGeodetic &position);
+
+        //! Add or update targets
+        //! \return number of targets added or changed
+        int updateTargets(const swift::misc::aviation::CAircraftSituationList &situations);
+
+        //! Remove a target
+        bool removeTarget(const swift::misc::aviation::CCallsign &callsign);
+
+        //! Remove all targets but the given ones
+        //! \return number of targets removed
+        int removeTargetsExcept(const swift::misc::aviation::CCallsignSet &callsigns);
+
+        //! Remove all targets
+        void clear();
+
+        //! Number of targets
+        int size() const { return static_cast<int>(m_targets.size()); }
+
+        //! Target for callsign?
+        bool contains(const swift::misc::aviation::CCallsign &callsign) const { return m_targets.contains(callsign); }
+
+        //! Position of a target relative to the own aircraft in NM, north is -y
+        QPointF targetPosition(const swift::misc::aviation::CCallsign &callsign) const;
+
+        //! @{
+        //! Shown parts, changing them updates all targets
+        void setTagFields(TagFields fields);
+        TagFields getTagFields() const { return m_fields; }
+        //! @}
+
+        //! Font of the tags, changing it updates all targets
+        void setTagFont(const QFont &font);
+
+        //! \copydoc QGraphicsItem::boundingRect
+        QRectF boundingRect() const override { return {}; }
+
+        //! \copydoc QGraphicsItem::paint
+        void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+
+    private:
+        //! Items of a target and the values they show
+        struct Target
+        {
+            QGraphicsItemGroup *group = nullptr; //!< owns marker and heading line
+            CRadarTargetMarker *marker = nullptr; //!< dot and tag
+            QGraphicsLineItem *headingLine = nullptr; //!< created when needed
+            double latitudeDeg = 0.0; //!< position
+            double longitudeDeg = 0.0; //!< position
+            int flightLevel = -1; //!< shown flight level
+            int groundSpeedKts = -1; //!< shown ground speed
+            int headingDeg = -1; //!< shown heading
+        };
+
+        static constexpr double ReprojectDistanceNM = 60.0; //!< new reference when the own aircraft moved that far
+        static constexpr double HeadingLineNM = 5.0; //!< length of the heading line
+
+        //! Position in the plane around the reference
+        QPointF project(double latitudeDeg, double longitudeDeg) const;
+
+        //! Update tag text and heading line from the values of the target
+        void updateTag(const swift::misc::aviation::CCallsign &callsign, Target &target);
+
+        //! Place all targets again, the reference has changed
+        void reproject();
+
+        QHash<swift::misc::aviation::CCallsign, Target> m_targets;
+        TagFields m_fields = AllFields;
+        QFont m_font;
+        QColor m_color = Qt::green;
+        bool m_hasReference = false;
+        double m_referenceLatitudeDeg = 0.0;
+        double m_referenceLongitudeDeg = 0.0;
+        double m_referenceLongitudeScale = 1.0; //!< cos(latitude) of the reference
+    };
+} // namespace swift::gui::views
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(swift::gui::views::CRadarTargets::TagFields)
+
+#endif // SWIFT_GUI_VIEWS_RADARTARGETS_H
@@ -3,6 +3,8 @@
 
 #include "gui/views/viewbase.h"
 
+#include <memory>
+
 #include <QApplication>
 #include <QClipboard>
 #include <QFileDialog>
@@ -103,12 +105,21 @@ namespace swift::gui::views
         const auto sortColumn = model->getSortColumn();
         const auto sortOrder = model->getSortOrder();
         this->showLoadIndicator(container.size());
-        CWorker *worker = CWorker::fromTask(this, "ViewSort", [model, container, sortColumn, sortOrder]() {
-            return model->sortContainerByColumn(container, sortColumn, sortOrder);
-        });
-        worker->thenWithResult<ContainerType>(this, [this, resize](const ContainerType &sortedContainer) {
-            this->updateContainer(sortedContainer, false, resize);
-        });
+
+        // the diff to the shown rows is also computed in the background, used if they are still shown
+        const ContainerType shown = model->hasFilter() ? ContainerType() : model->container();
+        const auto diff = std::make_shared<CListModelDiff>();
+        CWorker *worker =
+            CWorker::fromTask(this, "ViewSort", [model, container, sortColumn, sortOrder, shown, diff]() {
+                const ContainerType sortedContainer = model->sortContainerByColumn(container, sortColumn, sortOrder);
+                *diff = model->diffContainer(shown, sortedContainer);
+                return sortedContainer;
+            });
+        worker->thenWithResult<ContainerType>(
+            this, [this, model, resize, shown, diff](const ContainerType &sortedContainer) {
+                model->setPrecomputedDiff(shown, sortedContainer, *diff);
+                this->updateContainer(sortedContainer, false, resize);
+            });
         worker->then(this, &CViewBase::asyncUpdateFinished);
         return worker;
     }
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/aviation/callsignhandle.h"
+
+#include <QHash>
+#include <QReadWriteLock>
+
+namespace swift::misc::aviation
+{
+    namespace
+    {
+        //! Process wide table of interned callsigns
+        struct CallsignTable
+        {
+            QReadWriteLock lock;
+            QHash<QString, quint32> ids; //!< callsign string -> handle id
+            std::vector<QString> strings { QString() }; //!< handle id -> callsign string, 0 is the null handle
+        };
+
+        CallsignTable &table()
+        {
+            static CallsignTable t;
+            return t;
+        }
+    } // namespace
+
+    CCallsignHandle CCallsignHandle::intern(const CCallsign &callsign)
+    {
+        if (callsign.isEmpty()) { return {}; }
+        const CCallsignHandle found = find(callsign);
+        if (!found.isNull()) { return found; }
+
+        CallsignTable &t = table();
+        QWriteLocker l(&t.lock);
+        const auto it = t.ids.constFind(callsign.asString()); // interned meanwhile?
+        if (it != t.ids.constEnd()) { return CCallsignHandle(it.value()); }
+        const auto id = static_cast<quint32>(t.strings.size());
+        t.strings.push_back(callsign.asString());
+        t.ids.insert(callsign.asString(), id);
+        return CCallsignHandle(id);
+    }
+
+    CCallsignHandle CCallsignHandle::find(const CCallsign &callsign)
+    {
+        if (callsign.isEmpty()) { return {}; }
+        CallsignTable &t = table();
+        QReadLocker l(&t.lock);
+        return CCallsignHandle(t.ids.value(callsign.asString(), 0));
+    }
+
+    int CCallsignHandle::internedCount()
+    {
+        CallsignTable &t = table();
+        QReadLocker l(&t.lock);
+        return static_cast<int>(t.ids.size());
+    }
+
+    QString CCallsignHandle::asString() const
+    {
+        if (this->isNull()) { return {}; }
+        CallsignTable &t = table();
+        QReadLocker l(&t.lock);
+        return m_id < t.strings.size() ? t.strings[m_id] : QString();
+    }
+} // namespace swift::misc::aviation
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_AVIATION_CALLSIGNHANDLE_H
+#define SWIFT_MISC_AVIATION_CALLSIGNHANDLE_H
+
+#include <utility>
+#include <vector>
+
+#include <QList>
+#include <QString>
+#include <QtGlobal>
+
+#include "misc/aviation/callsign.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::aviation
+{
+    /*!
+     * Small integer standing for a callsign, valid for the lifetime of the process.
+     *
+     * Callsigns are interned in a process wide table, equal callsigns get the same handle. Resolving the callsign
+     * once and using the handle for all per callsign containers avoids hashing and comparing the strings for each of
+     * them. Handles are never released, the table grows with the number of distinct callsigns seen in a session.
+     * \remark handles are not values to be stored or sent anywhere, they differ between processes
+     */
+    class SWIFT_MISC_EXPORT CCallsignHandle
+    {
+    public:
+        //! Null handle, standing for the empty callsign
+        CCallsignHandle() = default;
+
+        //! Handle of the callsign, interned if seen first, null for empty callsigns
+        //! \threadsafe
+        static CCallsignHandle intern(const CCallsign &callsign);
+
+        //! Handle of the callsign, null if never interned
+        //! \remark use for lookups, so unknown callsigns do not grow the table
+        //! \threadsafe
+        static CCallsignHandle find(const CCallsign &callsign);
+
+        //! Number of interned callsigns
+        //! \threadsafe
+        static int internedCount();
+
+        //! Null?
+        bool isNull() const { return m_id == 0; }
+
+        //! Number of the handle, 1..internedCount()
+        quint32 id() const { return m_id; }
+
+        //! Callsign string (normalized)
+        //! \threadsafe
+        QString asString() const;
+
+        //! Callsign
+        //! \threadsafe
+        CCallsign toCallsign() const { return CCallsign(this->asString()); }
+
+        //! @{
+        //! Compare
+        friend bool operator==(CCallsignHandle a, CCallsignHandle b) { return a.m_id == b.m_id; }
+        friend bool operator!=(CCallsignHandle a, CCallsignHandle b) { return a.m_id != b.m_id; }
+        //! @}
+
+        //! qHash overload, for using handles in QHash/QSet
+        friend size_t qHash(CCallsignHandle handle, size_t seed = 0) { return ::qHash(handle.m_id, seed); }
+
+    private:
+        explicit CCallsignHandle(quint32 id) : m_id(id) {}
+
+        quint32 m_id = 0;
+    };
+
+    /*!
+     * Map from callsign handles to values, stored flat.
+     *
+     * Lookups are an array access by the handle id, values are stored contiguously in insertion order until removed.
+     * Removing moves the last value into the gap. Not thread safe, guard like a QHash.
+     * \remark the index array grows up to the largest handle inserted, 4 bytes per handle
+     */
+    template <class T>
+    class CCallsignHandleMap
+    {
+    public:
+        //! Contains a value for the handle?
+        bool contains(CCallsignHandle handle) const { return this->indexOf(handle) >= 0; }
+
+        //! Value for the handle, or nullptr
+        const T *find(CCallsignHandle handle) const
+        {
+            const int i = this->indexOf(handle);
+            return i < 0 ? nullptr : &m_values[static_cast<std::size_t>(i)];
+        }
+
+        //! Value for the handle, or nullptr
+        T *find(CCallsignHandle handle)
+        {
+            const int i = this->indexOf(handle);
+            return i < 0 ? nullptr : &m_values[static_cast<std::size_t>(i)];
+        }
+
+        //! Value for the handle, or the default value
+        T value(CCallsignHandle handle, const T &defaultValue = T()) const
+        {
+            const T *v = this->find(handle);
+            return v ? *v : defaultValue;
+        }
+
+        //! Value for the handle, a default constructed value is inserted if none
+        T &operator[](CCallsignHandle handle)
+        {
+            Q_ASSERT_X(!handle.isNull(), Q_FUNC_INFO, "null handle");
+            if (T *v = this->find(handle)) { return *v; }
+            if (m_indexes.size() <= handle.id()) { m_indexes.resize(handle.id() + 1, -1); }
+            m_indexes[handle.id()] = static_cast<int>(m_values.size());
+            m_keys.push_back(handle);
+            m_values.emplace_back();
+            return m_values.back();
+        }
+
+        //! Insert or replace the value for the handle
+        void insert(CCallsignHandle handle, const T &value) { (*this)[handle] = value; }
+
+        //! Remove the value for the handle
+        //! \return true if there was a value
+        bool remove(CCallsignHandle handle)
+        {
+            const int i = this->indexOf(handle);
+            if (i < 0) { return false; }
+            const auto last = static_cast<int>(m_values.size()) - 1;
+            if (i != last)
+            {
+                m_values[static_cast<std::size_t>(i)] = std::move(m_values.back());
+                m_keys[static_cast<std::size_t>(i)] = m_keys.back();
+                m_indexes[m_keys[static_cast<std::size_t>(i)].id()] = i;
+            }
+            m_values.pop_back();
+            m_keys.pop_back();
+            m_indexes[handle.id()] = -1;
+            return true;
+        }
+
+        //! Remove all values
+        void clear()
+        {
+            m_indexes.clear();
+            m_keys.clear();
+            m_values.clear();
+        }
+
+        //! Number of values
+        int size() const { return static_cast<int>(m_values.size()); }
+
+        //! Empty?
+        bool isEmpty() const { return m_values.empty(); }
+
+        //! Handles, in the same order as values()
+        const std::vector<CCallsignHandle> &keys() const { return m_keys; }
+
+        //! All values, in the same order as keys()
+        const std::vector<T> &values() const { return m_values; }
+
+        //! All values as list
+        QList<T> valueList() const { return QList<T>(m_values.begin(), m_values.end()); }
+
+    private:
+        int indexOf(CCallsignHandle handle) const
+        {
+            return handle.id() < m_indexes.size() ? m_indexes[handle.id()] : -1;
+        }
+
+        std::vector<int> m_indexes; //!< handle id -> index in m_keys/m_values, -1 if none
+        std::vector<CCallsignHandle> m_keys;
+        std::vector<T> m_values;
+    };
+} // namespace swift::misc::aviation
+
+#endif // SWIFT_MISC_AVIATION_CALLSIGNHANDLE_H
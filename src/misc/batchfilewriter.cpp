@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/batchfilewriter.h"
+
+#include <QMutexLocker>
+
+namespace swift::misc
+{
+    void appendVarint(QByteArray &out, quint64 value)
+    {
+        while (value >= 0x80)
+        {
+            out.append(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.append(static_cast<char>(value));
+    }
+
+    bool readVarint(const QByteArray &in, qsizetype &pos, quint64 &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && pos < in.size(); shift += 7)
+        {
+            const auto byte = static_cast<quint8>(in.at(pos++));
+            value |= static_cast<quint64>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) { return true; }
+        }
+        return false;
+    }
+
+    CBatchFileWriter::CBatchFileWriter(const QString &name, qsizetype reserveBytes)
+    {
+        this->setObjectName(name);
+        m_batch.reserve(reserveBytes);
+    }
+
+    CBatchFileWriter::~CBatchFileWriter()
+    {
+        Q_ASSERT_X(!this->isRunning(), Q_FUNC_INFO, "derived class has to stop the thread");
+    }
+
+    void CBatchFileWriter::wakeUp()
+    {
+        if (!m_wakeUpPending.exchange(true)) { m_wakeUp.release(); }
+    }
+
+    void CBatchFileWriter::flush()
+    {
+        QMutexLocker l(&m_flushLock);
+        const quint64 request = ++m_flushRequests;
+        this->wakeUp();
+        while (m_flushed < request && this->isRunning()) { m_flushedCondition.wait(&m_flushLock, FlushIntervalMs); }
+    }
+
+    void CBatchFileWriter::stop()
+    {
+        if (!this->isRunning()) { return; }
+        m_stopping = true;
+        m_wakeUp.release();
+        this->wait();
+    }
+
+    void CBatchFileWriter::run()
+    {
+        while (!m_stopping)
+        {
+            m_wakeUp.tryAcquire(1, FlushIntervalMs);
+            m_wakeUpPending = false;
+            this->writeBatch();
+        }
+        this->writeBatch();
+        m_file.close();
+    }
+
+    void CBatchFileWriter::writeBatch()
+    {
+        quint64 requests = 0;
+        {
+            QMutexLocker l(&m_flushLock);
+            requests = m_flushRequests;
+        }
+
+        this->fillBatch(m_batch);
+        if (!m_batch.isEmpty())
+        {
+            m_file.write(m_batch);
+            m_file.flush();
+            m_batch.resize(0); // keeps the capacity, clear() would free it
+        }
+        this->batchWritten();
+
+        QMutexLocker l(&m_flushLock);
+        m_flushed = requests;
+        m_flushedCondition.wakeAll();
+    }
+} // namespace swift::misc
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_BATCHFILEWRITER_H
+#define SWIFT_MISC_BATCHFILEWRITER_H
+
+#include <atomic>
+
+#include <QByteArray>
+#include <QFile>
+#include <QMutex>
+#include <QSemaphore>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+#include <QtGlobal>
+
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc
+{
+    //! Append an unsigned LEB128 varint
+    SWIFT_MISC_EXPORT void appendVarint(QByteArray &out, quint64 value);
+
+    //! Read an unsigned LEB128 varint at pos, false if truncated
+    SWIFT_MISC_EXPORT bool readVarint(const QByteArray &in, qsizetype &pos, quint64 &value);
+
+    /*!
+     * Thread writing binary records to a file in batches.
+     *
+     * The thread wakes up periodically or on request, collects the records by fillBatch and writes them with one
+     * call. The batch buffer is allocated once. Derived classes have to call stop() in their destructor.
+     */
+    class SWIFT_MISC_EXPORT CBatchFileWriter : public QThread
+    {
+    public:
+        //! Constructor
+        //! \param name thread name
+        //! \param reserveBytes initial capacity of the batch
+        explicit CBatchFileWriter(const QString &name, qsizetype reserveBytes = 0);
+
+        //! Destructor
+        ~CBatchFileWriter() override;
+
+        //! File written, opened before start()
+        QFile &file() { return m_file; }
+
+        //! Write soon, e.g. because many records are pending
+        //! \threadsafe
+        void wakeUp();
+
+        //! Wait until all records pending now are written
+        //! \threadsafe
+        void flush();
+
+        //! Write all pending records and close the file
+        void stop();
+
+    protected:
+        //! Append the records to be written to the empty batch, called by the writer thread
+        //! \remark swapping the batch with a buffer of the same capacity is fine
+        virtual void fillBatch(QByteArray &batch) = 0;
+
+        //! Called by the writer thread after each batch, e.g. to report dropped records
+        virtual void batchWritten() {}
+
+        //! \copydoc QThread::run
+        void run() override;
+
+    private:
+        static constexpr int FlushIntervalMs = 250; //!< periodic write/flush
+
+        //! Write all pending records
+        void writeBatch();
+
+        QFile m_file;
+        QByteArray m_batch; //!< allocated once
+        QSemaphore m_wakeUp;
+        std::atomic_bool m_wakeUpPending { false };
+        std::atomic_bool m_stopping { false };
+        QMutex m_flushLock;
+        QWaitCondition m_flushedCondition;
+        quint64 m_flushRequests = 0; //!< guarded by m_flushLock
+        quint64 m_flushed = 0; //!< guarded by m_flushLock
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_BATCHFILEWRITER_H
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/dbusblob.h"
+
+namespace swift::misc
+{
+    QByteArray CDBusBlob::compressed(const QByteArray &blob)
+    {
+        // fast compression level, the blobs are mostly sent to a local process
+        QByteArray result = qCompress(reinterpret_cast<const uchar *>(blob.constData()) + 1, blob.size() - 1, 1);
+        result.prepend(static_cast<char>(Version | CompressedFlag));
+        return result;
+    }
+
+    QByteArray CDBusBlob::payload(const QByteArray &blob)
+    {
+        if (blob.size() < 2) { return {}; }
+        const auto header = static_cast<quint8>(blob.front());
+        if ((header & ~CompressedFlag) != Version) { return {}; }
+        if (header & CompressedFlag)
+        {
+            return qUncompress(reinterpret_cast<const uchar *>(blob.constData()) + 1, blob.size() - 1);
+        }
+        return QByteArray::fromRawData(blob.constData() + 1, blob.size() - 1);
+    }
+} // namespace swift::misc
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_DBUSBLOB_H
+#define SWIFT_MISC_DBUSBLOB_H
+
+#include <utility>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc
+{
+    /*!
+     * Compact binary encoding of large values, carried over DBus as a single byte array (signature "ay").
+     *
+     * Marshalling lists of thousands of value objects field by field into nested DBus structures is slow.
+     * Instead, the value is streamed by its QDataStream operators (mixin::DataStreamByMetaClass) and prefixed
+     * with a header byte for the format version and compression.
+     * \sa CGenericDBusInterface::callDBusRetBlob
+     */
+    class SWIFT_MISC_EXPORT CDBusBlob
+    {
+    public:
+        CDBusBlob() = delete;
+
+        //! Format version, 0 means blobs are not supported
+        static constexpr int Version = 1;
+
+        //! If compression is requested, only payloads larger than this are compressed
+        static constexpr int CompressThresholdBytes = 64 * 1024;
+
+        //! Encode a value
+        template <class T>
+        static QByteArray toBlob(const T &value, bool compress)
+        {
+            QByteArray blob;
+            {
+                QDataStream stream(&blob, QIODevice::WriteOnly);
+                stream.setVersion(StreamVersion);
+                stream << static_cast<quint8>(Version) << value;
+            }
+            if (compress && blob.size() > CompressThresholdBytes) { return compressed(blob); }
+            return blob;
+        }
+
+        //! Decode a value
+        //! \return false if the blob is invalid, value is unchanged then
+        template <class T>
+        static bool fromBlob(const QByteArray &blob, T &value)
+        {
+            const QByteArray data = payload(blob);
+            if (data.isEmpty()) { return false; }
+
+            T decoded;
+            QDataStream stream(data);
+            stream.setVersion(StreamVersion);
+            stream >> decoded;
+            if (stream.status() != QDataStream::Ok) { return false; }
+            value = std::move(decoded);
+            return true;
+        }
+
+    private:
+        static constexpr QDataStream::Version StreamVersion = QDataStream::Qt_6_0; //!< same on both sides
+        static constexpr quint8 CompressedFlag = 0x80; //!< header bit
+
+        //! Compress an uncompressed blob
+        static QByteArray compressed(const QByteArray &blob);
+
+        //! Payload without header, uncompressed, empty if the blob is invalid
+        //! \remark for uncompressed blobs this refers to the data of the blob, which has to outlive the payload
+        static QByteArray payload(const QByteArray &blob);
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_DBUSBLOB_H
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_EXPIRYQUEUE_H
+#define SWIFT_MISC_EXPIRYQUEUE_H
+
+#include <iterator>
+#include <list>
+#include <utility>
+
+#include <QHash>
+#include <QtGlobal>
+
+namespace swift::misc
+{
+    /*!
+     * Keys which expire if not touched for a number of ticks.
+     *
+     * A value can be kept with each key and is passed on when the key expires, e.g. the full object behind a
+     * compact key. By default the key itself is the value.
+     * Time is counted in ticks advanced by the owner, e.g. by a timer checking for timeouts, so touching a key
+     * needs no clock. The keys are kept in a list ordered by their last touch: a touch moves the key to the end
+     * (once per tick), and expiring only looks at the front, so the work is proportional to the keys which expire.
+     * \remark not threadsafe
+     */
+    template <typename Key, typename Value = Key>
+    class CExpiryQueue
+    {
+    public:
+        //! Constructor
+        //! \param timeoutTicks key expires once it was not touched for more than this number of ticks
+        explicit CExpiryQueue(qint64 timeoutTicks) : m_timeoutTicks(timeoutTicks) {}
+
+        //! Set the timeout, also applies to the keys already queued
+        void setTimeoutTicks(qint64 timeoutTicks) { m_timeoutTicks = timeoutTicks; }
+
+        //! Timeout in ticks
+        qint64 getTimeoutTicks() const { return m_timeoutTicks; }
+
+        //! Add the key or reset its timeout, O(1)
+        void touch(const Key &key) { this->touch(key, key); }
+
+        //! Add the key or reset its timeout, O(1)
+        //! \remark the value is replaced once per tick at most
+        void touch(const Key &key, const Value &value)
+        {
+            const auto it = m_index.constFind(key);
+            if (it == m_index.constEnd())
+            {
+                m_entries.push_back({ key, value, m_currentTick });
+                m_index.insert(key, std::prev(m_entries.end()));
+                return;
+            }
+            const EntryIterator entry = it.value();
+            if (entry->tick == m_currentTick) { return; } // already at the end
+            entry->value = value;
+            entry->tick = m_currentTick;
+            m_entries.splice(m_entries.end(), m_entries, entry);
+        }
+
+        //! Remove the key without expiring it
+        bool remove(const Key &key)
+        {
+            const auto it = m_index.constFind(key);
+            if (it == m_index.constEnd()) { return false; }
+            m_entries.erase(it.value());
+            m_index.erase(it);
+            return true;
+        }
+
+        //! Contains key?
+        bool contains(const Key &key) const { return m_index.contains(key); }
+
+        //! Number of keys
+        int size() const { return static_cast<int>(m_index.size()); }
+
+        //! Remove all keys
+        void clear()
+        {
+            m_entries.clear();
+            m_index.clear();
+        }
+
+        //! Next tick
+        qint64 advance() { return ++m_currentTick; }
+
+        //! Current tick
+        qint64 getCurrentTick() const { return m_currentTick; }
+
+        //! Remove the expired keys and call expired(value, idleTicks) for each of them, oldest first
+        //! \return number of expired keys
+        template <typename F>
+        int expire(F &&expired)
+        {
+            int count = 0;
+            while (!m_entries.empty() && m_currentTick - m_entries.front().tick > m_timeoutTicks)
+            {
+                const Entry entry = std::move(m_entries.front());
+                m_index.remove(entry.key);
+                m_entries.pop_front();
+                expired(entry.value, m_currentTick - entry.tick);
+                count++;
+            }
+            return count;
+        }
+
+    private:
+        struct Entry
+        {
+            Key key;
+            Value value; //!< as of the last touch moving the key
+            qint64 tick = 0; //!< last touch
+        };
+        using EntryIterator = typename std::list<Entry>::iterator;
+
+        qint64 m_timeoutTicks = 0;
+        qint64 m_currentTick = 0;
+        std::list<Entry> m_entries; //!< ordered by last touch
+        QHash<Key, EntryIterator> m_index;
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_EXPIRYQUEUE_H
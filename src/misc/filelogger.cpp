@@ -3,16 +3,27 @@
 
 #include "misc/filelogger.h"
 
+#include <atomic>
+
 #include <QCoreApplication>
 #include <QDateTime>
+#include <QDeadlineTimer>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
 #include <QIODevice>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSemaphore>
 #include <QString>
 #include <QStringBuilder>
+#include <QSysInfo>
+#include <QThread>
+#include <QWaitCondition>
 #include <QtGlobal>
 
 #include "config/buildconfig.h"
+#include "misc/mpscqueue.h"
 #include "misc/swiftdirectories.h"
 #include "misc/verify.h"
 
@@ -27,63 +38,315 @@ namespace swift::misc
         return applicationName;
     }
 
-    //! Get log file name
-    QString logFileName()
+    //! New log file name
+    QString newLogFileName()
     {
-        static const QString fileName = applicationName() % QLatin1String("_") %
-                                        QDateTime::currentDateTimeUtc().toString(QStringLiteral("yyMMddhhmmss")) %
-                                        QLatin1String("_") % QString::number(QCoreApplication::applicationPid()) %
-                                        QLatin1String(".log");
+        return applicationName() % QLatin1String("_") %
+               QDateTime::currentDateTimeUtc().toString(QStringLiteral("yyMMddhhmmss")) % QLatin1String("_") %
+               QString::number(QCoreApplication::applicationPid()) % QLatin1String(".log");
+    }
+
+    //! Name of the file currently written, changes when the file is rotated
+    //! @{
+    Q_GLOBAL_STATIC(QMutex, g_logFileNameMutex)
+    QString &currentLogFileName()
+    {
+        static QString fileName = newLogFileName();
         return fileName;
     }
+    //! @}
+
+    /*!
+     * Writer thread of CFileLogger
+     */
+    class CFileLogWriter : public QThread
+    {
+    public:
+        //! Constructor
+        explicit CFileLogWriter(int queueCapacity) : m_queue(queueCapacity) { setObjectName("CFileLogWriter"); }
+
+        //! Destructor
+        ~CFileLogWriter() override { stop(); }
+
+        //! Queue a message
+        //! \threadsafe
+        void enqueue(const CStatusMessage &message)
+        {
+            if (m_stopping) { return; }
+            if (!m_queue.tryPush({ QDateTime::currentMSecsSinceEpoch(), message }))
+            {
+                m_dropped++;
+                m_droppedTotal++;
+                return;
+            }
+
+            // the writer wakes up periodically, but errors and bursts are written right away
+            const bool error = message.getSeverity() >= CStatusMessage::SeverityError;
+            const bool urgent = error || m_queue.size() >= m_queue.capacity() / 4;
+            if (urgent && !m_wakeUpPending.exchange(true)) { m_wakeUp.release(); }
+
+            // a crash may be ahead, so errors are in the file before the caller continues
+            if (error) { this->waitForWritten(); }
+        }
+
+        //! Write all queued messages and close the file
+        //! \threadsafe
+        void stop()
+        {
+            if (!isRunning()) { return; }
+            m_stopping = true;
+            m_wakeUp.release();
+            wait();
+        }
+
+        //! \copydoc CFileLogger::setRotation
+        void setRotation(qint64 maxFileSize, qint64 maxFileAgeSecs)
+        {
+            m_maxFileSize = maxFileSize;
+            m_maxFileAgeSecs = maxFileAgeSecs;
+        }
+
+        //! \copydoc CFileLogger::getDroppedMessageCount
+        qint64 getDroppedMessageCount() const { return m_droppedTotal; }
+
+    protected:
+        //! \copydoc QThread::run
+        void run() override
+        {
+            this->openFile(nullptr);
+            while (!m_stopping)
+            {
+                m_wakeUp.tryAcquire(1, FlushIntervalMs);
+                m_wakeUpPending = false;
+                this->writeBatchAndNotify();
+            }
+            this->writeBatchAndNotify();
+            this->writeToFile(QStringLiteral("Logging stops.\n"));
+            m_file.close();
+        }
+
+    private:
+        //! Queued message
+        struct QueuedMessage
+        {
+            qint64 timestampMs = 0; //!< when the message was queued
+            CStatusMessage message; //!< message
+        };
+
+        static constexpr int FlushIntervalMs = 250; //!< periodic write/flush
+        static constexpr int MaxErrorWaitMs = 100; //!< max. time the caller waits for an error to be written
+        static constexpr int MaxBatchSize = 1000; //!< messages per write, rotation is checked in between
+
+        //! Open a new file, the previous one (if any) is closed
+        void openFile(const QString *previousFileName)
+        {
+            QString fileName = newLogFileName();
+            if (previousFileName)
+            {
+                // rotating within the same second, or the name is taken otherwise
+                const QString baseName = fileName.chopped(4); // ".log"
+                for (int n = 2; fileName == *previousFileName ||
+                                QFile::exists(CSwiftDirectories::logDirectory() % '/' % fileName);
+                     n++)
+                {
+                    fileName = baseName % u'_' % QString::number(n) % u".log";
+                }
+            }
+            {
+                QMutexLocker lock(g_logFileNameMutex());
+                if (previousFileName) { currentLogFileName() = fileName; }
+                else { fileName = currentLogFileName(); }
+            }
+
+            if (m_file.isOpen())
+            {
+                this->writeToFile(u"Logging continues in " % fileName % u'\n');
+                m_file.close();
+            }
+
+            m_file.setFileName(CSwiftDirectories::logDirectory() % '/' % fileName);
+            const bool res = m_file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text);
+            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
+            m_fileOpenedMs = QDateTime::currentMSecsSinceEpoch();
+            m_previousCategories.clear();
+            this->writeHeaderToFile();
+            if (previousFileName) { this->writeToFile(u"Continued from " % *previousFileName % u'\n'); }
+            m_file.flush();
+        }
+
+        //! Rotate if size or age is exceeded
+        void rotateIfNeeded()
+        {
+            const qint64 maxSize = m_maxFileSize;
+            const qint64 maxAgeSecs = m_maxFileAgeSecs;
+            const bool tooBig = maxSize > 0 && m_file.size() >= maxSize;
+            const bool tooOld =
+                maxAgeSecs > 0 && QDateTime::currentMSecsSinceEpoch() - m_fileOpenedMs >= maxAgeSecs * 1000;
+            if (!tooBig && !tooOld) { return; }
+            const QString previous = QFileInfo(m_file.fileName()).fileName();
+            this->openFile(&previous);
+        }
+
+        //! Wait until the messages queued so far are written and flushed, or the wait times out
+        //! \threadsafe
+        void waitForWritten()
+        {
+            if (m_stopping || !isRunning() || QThread::currentThread() == this) { return; }
+            QMutexLocker lock(&m_batchesMutex);
+
+            // a batch started after this point also writes the messages queued before
+            const qint64 batch = m_batchesStarted + 1;
+            const QDeadlineTimer deadline(MaxErrorWaitMs);
+            while (m_batchesWritten < batch)
+            {
+                if (!m_batchWritten.wait(&m_batchesMutex, deadline)) { return; }
+            }
+        }
+
+        //! Write all queued messages, and notify those waiting for them
+        void writeBatchAndNotify()
+        {
+            QMutexLocker lock(&m_batchesMutex);
+            const qint64 batch = ++m_batchesStarted;
+            lock.unlock();
 
-    CFileLogger::CFileLogger(QObject *parent) : QObject(parent), m_logFile(this)
+            this->writeBatch();
+
+            lock.relock();
+            m_batchesWritten = batch;
+            lock.unlock();
+            m_batchWritten.wakeAll();
+        }
+
+        //! Write all queued messages
+        void writeBatch()
+        {
+            QueuedMessage queued;
+            QString batch;
+            int count = 0;
+            while (m_queue.tryPop(queued))
+            {
+                this->appendMessage(batch, queued);
+                if (++count < MaxBatchSize) { continue; }
+                this->writeToFile(batch);
+                batch.clear();
+                count = 0;
+                this->rotateIfNeeded();
+            }
+
+            const qint64 dropped = m_dropped.exchange(0);
+            if (dropped > 0)
+            {
+                batch += QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss ")) %
+                         QStringLiteral("warning: log writer overloaded, %1 messages dropped\n").arg(dropped);
+            }
+            if (!batch.isEmpty()) { this->writeToFile(batch); }
+            m_file.flush();
+            this->rotateIfNeeded();
+        }
+
+        //! Format a message
+        void appendMessage(QString &batch, const QueuedMessage &queued)
+        {
+            const CStatusMessage &statusMessage = queued.message;
+            const QString categories = statusMessage.getCategoriesAsString();
+            if (categories != m_previousCategories)
+            {
+                batch += u"\n[" % categories % u"]\n";
+                m_previousCategories = categories;
+            }
+            batch += QDateTime::fromMSecsSinceEpoch(queued.timestampMs).toString(QStringLiteral("hh:mm:ss ")) %
+                     statusMessage.getSeverityAsString() % u": " % statusMessage.getMessage() % u'\n';
+        }
+
+        //! Header at the beginning of each file
+        void writeHeaderToFile()
+        {
+            QString header;
+            header += u"This is " % applicationName() % u" version " % CBuildConfig::getVersionString() %
+                      u" running on " % QSysInfo::prettyProductName() % u' ' % QSysInfo::currentCpuArchitecture() %
+                      u'\n';
+            header += u"Built from revision " % CBuildConfig::gitHeadSha1() % u" on " %
+                      CBuildConfig::buildDateAndTime() % u'\n';
+            header += QStringLiteral("Built with Qt " QT_VERSION_STR " and running with Qt ") % qVersion() % u' ' %
+                      QSysInfo::buildAbi() % u'\n';
+            header += QStringLiteral("Application started.\n");
+            this->writeToFile(header);
+        }
+
+        //! Write to file
+        void writeToFile(const QString &content)
+        {
+            if (m_file.isOpen()) { m_file.write(content.toUtf8()); }
+        }
+
+        CMpscQueue<QueuedMessage> m_queue;
+        QSemaphore m_wakeUp;
+        std::atomic_bool m_wakeUpPending { false };
+        std::atomic_bool m_stopping { false };
+        std::atomic<qint64> m_dropped { 0 }; //!< dropped since the last summary
+        QMutex m_batchesMutex; //!< for the batch counters
+        QWaitCondition m_batchWritten; //!< a batch has been written and flushed
+        qint64 m_batchesStarted = 0; //!< batches the writer started, guarded by m_batchesMutex
+        qint64 m_batchesWritten = 0; //!< last batch written and flushed, guarded by m_batchesMutex
+        std::atomic<qint64> m_droppedTotal { 0 }; //!< dropped in total
+        std::atomic<qint64> m_maxFileSize { CFileLogger::DefaultMaxFileSize };
+        std::atomic<qint64> m_maxFileAgeSecs { CFileLogger::DefaultMaxFileAgeSecs };
+
+        // only used by the writer thread
+        QFile m_file;
+        qint64 m_fileOpenedMs = 0;
+        QString m_previousCategories;
+    };
+
+    CFileLogger::CFileLogger(QObject *parent)
+        : QObject(parent), m_writer(std::make_unique<CFileLogWriter>(DefaultQueueCapacity))
     {
         Q_ASSERT(!applicationName().isEmpty());
         QDir::root().mkpath(CSwiftDirectories::logDirectory());
         removeOldLogFiles();
-        m_logFile.setFileName(getLogFilePath());
-        const bool res = m_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text);
-        SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open log file");
-        m_stream.setDevice(&m_logFile);
-        m_stream.setEncoding(QStringConverter::Utf8);
-        writeHeaderToFile();
+        m_writer->start(QThread::LowPriority);
+        changeLogPattern(m_logPattern);
     }
 
     CFileLogger::~CFileLogger() { this->close(); }
 
     void CFileLogger::close()
     {
-        if (m_logFile.isOpen())
-        {
-            disconnect(this); // disconnect from log handler
-            writeContentToFile(QStringLiteral("Logging stops."));
-            m_logFile.close();
-        }
+        m_logSubscriber.unsubscribe(); // disconnect from log handler
+        m_writer->stop();
     }
 
-    QString CFileLogger::getLogFileName() { return logFileName(); }
+    qint64 CFileLogger::getDroppedMessageCount() const { return m_writer->getDroppedMessageCount(); }
+
+    QString CFileLogger::getLogFileName()
+    {
+        QMutexLocker lock(g_logFileNameMutex());
+        return currentLogFileName();
+    }
+
+    void CFileLogger::changeLogPattern(const CLogPattern &pattern)
+    {
+        // a subscription, unlike a connection to all messages, lets the log handler skip messages nobody receives
+        m_logPattern = pattern;
+        m_logSubscriber.changeSubscription(pattern);
+    }
+
+    void CFileLogger::setRotation(qint64 maxFileSize, qint64 maxFileAgeSecs)
+    {
+        m_writer->setRotation(maxFileSize, maxFileAgeSecs);
+    }
 
     void CFileLogger::writeStatusMessageToFile(const swift::misc::CStatusMessage &statusMessage)
     {
         if (statusMessage.isEmpty()) { return; }
-        if (!m_logFile.isOpen()) { return; }
         if (!m_logPattern.match(statusMessage)) { return; }
-        const QString categories = statusMessage.getCategoriesAsString();
-        if (categories != m_previousCategories)
-        {
-            writeContentToFile(u"\n[" % categories % u']');
-            m_previousCategories = categories;
-        }
-        const QString finalContent(QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss ")) %
-                                   statusMessage.getSeverityAsString() % u": " % statusMessage.getMessage());
-
-        writeContentToFile(finalContent);
+        m_writer->enqueue(statusMessage);
     }
 
     QString CFileLogger::getLogFilePath()
     {
-        QString filePath = CSwiftDirectories::logDirectory() % '/' % logFileName();
+        QString filePath = CSwiftDirectories::logDirectory() % '/' % getLogFileName();
         return filePath;
     }
 
@@ -99,23 +362,4 @@ namespace swift::misc
             if (logFileInfo.lastModified().daysTo(now) > 7) { dir.remove(logFileInfo.fileName()); }
         }
     }
-
-    void CFileLogger::writeHeaderToFile()
-    {
-        m_stream << "This is " << applicationName();
-        m_stream << " version " << CBuildConfig::getVersionString();
-        m_stream << " running on " << QSysInfo::prettyProductName();
-        m_stream << " " << QSysInfo::currentCpuArchitecture() << Qt::endl;
-
-        m_stream << "Built from revision " << CBuildConfig::gitHeadSha1();
-        m_stream << " on " << CBuildConfig::buildDateAndTime() << Qt::endl;
-
-        m_stream << "Built with Qt " << QT_VERSION_STR;
-        m_stream << " and running with Qt " << qVersion();
-        m_stream << " " << QSysInfo::buildAbi() << Qt::endl;
-
-        m_stream << "Application started." << Qt::endl;
-    }
-
-    void CFileLogger::writeContentToFile(const QString &content) { m_stream << content << Qt::endl; }
 } // namespace swift::misc
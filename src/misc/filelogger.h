@@ -6,18 +6,25 @@
 #ifndef SWIFT_MISC_FILELOGGER_H
 #define SWIFT_MISC_FILELOGGER_H
 
-#include <QFile>
+#include <memory>
+
 #include <QObject>
 #include <QString>
-#include <QTextStream>
 
+#include "misc/loghandler.h"
 #include "misc/logpattern.h"
 #include "misc/statusmessage.h"
 #include "misc/swiftmiscexport.h"
 
 namespace swift::misc
 {
+    class CFileLogWriter;
+
     //! Class to write log messages to file
+    //! \details Messages are queued and written in batches by a dedicated writer thread, so the threads emitting
+    //!          messages do not wait for the disk. Only errors are written and flushed before the emitting thread
+    //!          continues (waiting 100ms at most), as a crash may follow. If the writer cannot keep up, messages are
+    //!          dropped and the number of dropped messages is written to the file.
     class SWIFT_MISC_EXPORT CFileLogger : public QObject
     {
         Q_OBJECT
@@ -31,31 +38,47 @@ namespace swift::misc
         ~CFileLogger() override;
 
         //! Change the log pattern. Default is to log all messages.
-        void changeLogPattern(const CLogPattern &pattern) { m_logPattern = pattern; }
+        //! \remark the logger subscribes to local and relayed messages matching the pattern
+        void changeLogPattern(const CLogPattern &pattern);
+
+        //! Start a new file once the current one reaches the size (bytes) or age (seconds), 0 disables the limit
+        //! \threadsafe
+        void setRotation(qint64 maxFileSize, qint64 maxFileAgeSecs);
 
         //! Close file
         void close();
 
+        //! Messages dropped so far because the writer could not keep up
+        //! \threadsafe
+        qint64 getDroppedMessageCount() const;
+
         //! Get the log file name
+        //! \remark changes when the file is rotated
         static QString getLogFileName();
 
         //! Get the log file path (including its name)
         static QString getLogFilePath();
 
+        //! Default max. number of queued messages
+        static constexpr int DefaultQueueCapacity = 10000;
+
+        //! Default max. file size before rotation
+        static constexpr qint64 DefaultMaxFileSize = 50 * 1024 * 1024;
+
+        //! Default max. file age before rotation
+        static constexpr qint64 DefaultMaxFileAgeSecs = 24 * 3600;
+
     public slots:
         //! Write single status message to file
+        //! \threadsafe only queues the message
         void writeStatusMessageToFile(const swift::misc::CStatusMessage &statusMessage);
 
     private:
         void removeOldLogFiles();
-        void writeHeaderToFile();
-        void writeContentToFile(const QString &content);
 
         CLogPattern m_logPattern;
-        QFile m_logFile;
-        QString m_fileName;
-        QTextStream m_stream;
-        QString m_previousCategories;
+        CLogSubscriber m_logSubscriber { this, &CFileLogger::writeStatusMessageToFile };
+        std::unique_ptr<CFileLogWriter> m_writer;
     };
 } // namespace swift::misc
 
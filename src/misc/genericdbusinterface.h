@@ -6,13 +6,19 @@
 #ifndef SWIFT_MISC_GENERICDBUSINTERFACE_H
 #define SWIFT_MISC_GENERICDBUSINTERFACE_H
 
+#include <atomic>
+
 #include <QDBusAbstractInterface>
+#include <QDBusError>
 #include <QDBusPendingCall>
 #include <QDBusPendingReply>
+#include <QDBusServiceWatcher>
+#include <QDateTime>
 #include <QMetaMethod>
 #include <QObject>
 #include <QSharedPointer>
 
+#include "misc/dbusblob.h"
 #include "misc/logmessage.h"
 #include "misc/promise.h"
 
@@ -89,6 +95,69 @@ namespace swift::misc
             return pr;
         }
 
+        //! Call DBus with synchronous return value, transferred as CDBusBlob if enabled and supported by the server
+        //! \remark the server provides a slot \c \<method\>Blob with the same arguments plus a bool for compression
+        //! \remark falls back to callDBusRet if the blob cannot be received
+        template <typename Ret, typename... Args>
+        Ret callDBusRetBlob(QLatin1String method, Args &&...args)
+        {
+            if (this->isBlobMarshallingSupported())
+            {
+                const QList<QVariant> argumentList { QVariant::fromValue(args)...,
+                                                     QVariant::fromValue(m_blobCompression.load()) };
+                QDBusPendingReply<QByteArray> pr =
+                    this->asyncCallWithArgumentList(QString(method) + u"Blob", argumentList);
+                pr.waitForFinished();
+                Ret value;
+                if (!pr.isError() && CDBusBlob::fromBlob(pr.value(), value)) { return value; }
+                CLogMessage(this).debug(u"CGenericDBusInterface::callDBusRetBlob(%1) failed: %2")
+                    << method << (pr.isError() ? pr.error().message() : QStringLiteral("invalid blob"));
+            }
+            return this->callDBusRet<Ret>(method, std::forward<Args>(args)...);
+        }
+
+        //! Enable blob marshalling for callDBusRetBlob, compression only pays off for remote connections
+        //! \remark the server is asked again for its blob version, also whenever it registers on the bus again
+        void setBlobMarshalling(bool enabled, bool compress = false)
+        {
+            m_blobEnabled = enabled;
+            m_blobCompression = compress;
+            this->resetBlobVersion();
+            if (enabled && !m_serviceWatcher && !this->service().isEmpty())
+            {
+                // a restarted server may be another version
+                m_serviceWatcher = new QDBusServiceWatcher(this->service(), this->connection(),
+                                                           QDBusServiceWatcher::WatchForRegistration, this);
+                connect(m_serviceWatcher, &QDBusServiceWatcher::serviceRegistered, this,
+                        [this] { this->resetBlobVersion(); });
+            }
+        }
+
+        //! Blob marshalling enabled and supported by the server?
+        //! \remark the server is asked once per connection, older servers do not provide getBlobMarshallingVersion
+        //! \remark if the server does not answer, the version is still unknown and asked again later
+        bool isBlobMarshallingSupported()
+        {
+            if (!m_blobEnabled) { return false; }
+            int version = m_blobVersion;
+            if (version < 0)
+            {
+                if (QDateTime::currentMSecsSinceEpoch() < m_blobVersionRetryMs) { return false; }
+                QDBusPendingReply<int> pr = this->asyncCall(QStringLiteral("getBlobMarshallingVersion"));
+                pr.waitForFinished();
+                if (pr.isError())
+                {
+                    // old servers, until reconnected; otherwise timeout or busy server, try again later
+                    if (pr.error().type() == QDBusError::UnknownMethod) { m_blobVersion = 0; }
+                    else { m_blobVersionRetryMs = QDateTime::currentMSecsSinceEpoch() + BlobVersionRetryMs; }
+                    return false;
+                }
+                version = pr.value();
+                m_blobVersion = version;
+            }
+            return version == CDBusBlob::Version;
+        }
+
         //! Call DBus with asynchronous return value
         //! Callback can be any callable object taking a single argument of type QDBusPendingCallWatcher*.
         template <typename Func, typename... Args>
@@ -119,6 +188,22 @@ namespace swift::misc
             auto watchers = this->findChildren<QDBusPendingCallWatcher *>(QString(), Qt::FindDirectChildrenOnly);
             for (auto w : watchers) { delete w; }
         }
+
+    private:
+        static constexpr qint64 BlobVersionRetryMs = 30000; //!< ask for the blob version again if unanswered
+
+        //! Blob version of the server is unknown
+        void resetBlobVersion()
+        {
+            m_blobVersion = -1;
+            m_blobVersionRetryMs = 0;
+        }
+
+        std::atomic_bool m_blobEnabled { false };
+        std::atomic_bool m_blobCompression { false };
+        std::atomic_int m_blobVersion { -1 }; //!< blob version of the server, -1 if not yet known
+        std::atomic<qint64> m_blobVersionRetryMs { 0 }; //!< not asking for the version before this time
+        QDBusServiceWatcher *m_serviceWatcher = nullptr; //!< resets the blob version if the server re-registers
     };
 } // namespace swift::misc
 
@@ -6,12 +6,14 @@
 #ifndef SWIFT_MISC_GEO_GEOOBJECTLIST_H
 #define SWIFT_MISC_GEO_GEOOBJECTLIST_H
 
+#include <memory>
 #include <tuple>
 
 #include <QList>
 
 #include "misc/aviation/altitude.h"
 #include "misc/geo/coordinategeodetic.h"
+#include "misc/geo/geospatialindex.h"
 #include "misc/pq/length.h"
 #include "misc/sequence.h"
 #include "misc/swiftmiscexport.h"
@@ -211,6 +213,87 @@ namespace swift::misc::geo
             return closest;
         }
 
+        //! Spatial index of this list
+        //! \remark for large lists queried many times, the index has to be rebuilt when the list changes
+        CGeoSpatialIndex createSpatialIndex() const
+        {
+            if (this->container().isEmpty()) { return {}; }
+            QVector<CGeoSpatialIndex::Vector> vectors;
+            vectors.reserve(this->container().size());
+            for (const OBJ &obj : this->container()) { vectors.push_back(obj.normalVectorDouble()); }
+
+            // shallow copy, shares the data with this list until one of them is modified
+            auto source = std::make_shared<const CONTAINER>(this->container());
+            const void *identity = &source->front();
+            return CGeoSpatialIndex(vectors, std::move(source), identity);
+        }
+
+        //! Index built from this list, and the list unchanged since?
+        bool isIndexedBy(const CGeoSpatialIndex &index) const
+        {
+            return !this->container().isEmpty() && index.size() == this->container().size() &&
+                   index.isIndexOf(&this->container().front());
+        }
+
+        //! \copydoc findWithinRange
+        //! \param index spatial index of this list, same result as without index
+        CONTAINER findWithinRange(const ICoordinateGeodetic &coordinate, const physical_quantities::CLength &range,
+                                  const CGeoSpatialIndex &index) const
+        {
+            if (!this->isIndexedBy(index) || range.isNull()) { return this->findWithinRange(coordinate, range); }
+            CONTAINER within;
+            for (int position : this->findCandidatesWithinRange(coordinate, range, index))
+            {
+                const OBJ &obj = this->container()[position];
+                if (calculateGreatCircleDistance(obj, coordinate) <= range) { within.push_back(obj); }
+            }
+            return within;
+        }
+
+        //! \copydoc findClosest
+        //! \param index spatial index of this list
+        CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate, const CGeoSpatialIndex &index) const
+        {
+            if (!this->isIndexedBy(index)) { return this->findClosest(number, coordinate); }
+            CONTAINER closest;
+            for (int position : index.findClosest(number, coordinate.normalVectorDouble()))
+            {
+                closest.push_back(this->container()[position]);
+            }
+            return closest;
+        }
+
+        //! \copydoc findClosestWithinRange
+        //! \param index spatial index of this list, same result as without index
+        OBJ findClosestWithinRange(const ICoordinateGeodetic &coordinate, const physical_quantities::CLength &range,
+                                   const CGeoSpatialIndex &index) const
+        {
+            if (!this->isIndexedBy(index) || range.isNull()) { return this->findClosestWithinRange(coordinate, range); }
+
+            // the closest one by the index, then all objects about as close to pick the same one as the linear search
+            const std::array<double, 3> vector = coordinate.normalVectorDouble();
+            const double maxChord = CGeoSpatialIndex::withTolerance(CGeoSpatialIndex::rangeToChord(range));
+            const int nearest = index.findClosest(vector, maxChord);
+            if (nearest < 0) { return OBJ(); }
+            const double nearestChord =
+                CGeoSpatialIndex::chord(this->container()[nearest].normalVectorDouble(), vector);
+
+            OBJ closest;
+            physical_quantities::CLength distance = physical_quantities::CLength::null();
+            for (int position : index.findWithinChord(vector, CGeoSpatialIndex::withTolerance(nearestChord)))
+            {
+                const OBJ &obj = this->container()[position];
+                const physical_quantities::CLength d = coordinate.calculateGreatCircleDistance(obj);
+                if (d > range) { continue; }
+                if (distance.isNull() || distance > d)
+                {
+                    distance = d;
+                    closest = obj;
+                }
+            }
+            return closest;
+        }
+
         //! Sort by distance
         void sortByEuclideanDistanceSquared(const ICoordinateGeodetic &coordinate)
         {
@@ -232,6 +315,15 @@ namespace swift::misc::geo
         //! Constructor
         IGeoObjectList() {} // NOLINT(modernize-use-equals-default)
 
+        //! Candidates within range, checked with the tolerance of the single precision distance calculations
+        QVector<int> findCandidatesWithinRange(const ICoordinateGeodetic &coordinate,
+                                               const physical_quantities::CLength &range,
+                                               const CGeoSpatialIndex &index) const
+        {
+            return index.findWithinChord(coordinate.normalVectorDouble(),
+                                         CGeoSpatialIndex::withTolerance(CGeoSpatialIndex::rangeToChord(range)));
+        }
+
         //! Container
         const CONTAINER &container() const { return static_cast<const CONTAINER &>(*this); }
 
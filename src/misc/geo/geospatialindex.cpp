@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/geo/geospatialindex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "misc/pq/units.h"
+
+using namespace swift::misc::physical_quantities;
+
+namespace swift::misc::geo
+{
+    CGeoSpatialIndex::CGeoSpatialIndex(const QVector<Vector> &normalVectors, std::shared_ptr<const void> source,
+                                       const void *identity)
+        : m_source(std::move(source)), m_identity(identity)
+    {
+        m_nodes.reserve(normalVectors.size());
+        for (int i = 0; i < normalVectors.size(); i++) { m_nodes.push_back({ normalVectors[i], i }); }
+        this->build(0, m_nodes.size(), 0);
+    }
+
+    void CGeoSpatialIndex::build(int begin, int end, int axis)
+    {
+        if (end - begin < 2) { return; }
+        const int middle = begin + (end - begin) / 2;
+        std::nth_element(m_nodes.begin() + begin, m_nodes.begin() + middle, m_nodes.begin() + end,
+                         [axis](const Node &a, const Node &b) { return a.vector[axis] < b.vector[axis]; });
+        const int next = (axis + 1) % 3;
+        this->build(begin, middle, next);
+        this->build(middle + 1, end, next);
+    }
+
+    QVector<int> CGeoSpatialIndex::findWithinChord(const Vector &vector, double maxChord) const
+    {
+        QVector<int> result;
+        if (maxChord < 0) { return result; }
+        this->findWithinChord(0, m_nodes.size(), 0, vector, maxChord * maxChord, result);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    void CGeoSpatialIndex::findWithinChord(int begin, int end, int axis, const Vector &vector, double maxChord2,
+                                           QVector<int> &result) const
+    {
+        if (begin >= end) { return; }
+        const int middle = begin + (end - begin) / 2;
+        const Node &node = m_nodes[middle];
+        const double c = chord(node.vector, vector);
+        if (c * c <= maxChord2) { result.push_back(node.position); }
+
+        const double d = vector[axis] - node.vector[axis];
+        const int next = (axis + 1) % 3;
+        if (d <= 0 || d * d <= maxChord2) { this->findWithinChord(begin, middle, next, vector, maxChord2, result); }
+        if (d >= 0 || d * d <= maxChord2) { this->findWithinChord(middle + 1, end, next, vector, maxChord2, result); }
+    }
+
+    QVector<int> CGeoSpatialIndex::findClosest(int number, const Vector &vector) const
+    {
+        QVector<int> result;
+        if (number < 1 || m_nodes.isEmpty()) { return result; }
+
+        // max. heap of the closest so far, the farthest of them on top
+        QVector<std::pair<double, int>> heap;
+        heap.reserve(std::min<qsizetype>(number, m_nodes.size()) + 1);
+        this->findClosest(0, m_nodes.size(), 0, vector, number, heap);
+
+        std::sort_heap(heap.begin(), heap.end());
+        result.reserve(heap.size());
+        for (const auto &[chord2, position] : heap) { result.push_back(position); }
+        return result;
+    }
+
+    int CGeoSpatialIndex::findClosest(const Vector &vector, double maxChord) const
+    {
+        if (maxChord < 0) { return -1; }
+        QVector<std::pair<double, int>> heap;
+        this->findClosest(0, m_nodes.size(), 0, vector, 1, heap);
+        if (heap.isEmpty() || heap.front().first > maxChord * maxChord) { return -1; }
+        return heap.front().second;
+    }
+
+    void CGeoSpatialIndex::findClosest(int begin, int end, int axis, const Vector &vector, int number,
+                                       QVector<std::pair<double, int>> &heap) const
+    {
+        if (begin >= end) { return; }
+        const int middle = begin + (end - begin) / 2;
+        const Node &node = m_nodes[middle];
+        const double c = chord(node.vector, vector);
+        const std::pair<double, int> candidate(c * c, node.position);
+        if (heap.size() < number)
+        {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (candidate < heap.front())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end());
+        }
+
+        // near side first, the far side only if it can contain something closer than the farthest so far
+        const double d = vector[axis] - node.vector[axis];
+        const int next = (axis + 1) % 3;
+        const int nearBegin = d <= 0 ? begin : middle + 1;
+        const int nearEnd = d <= 0 ? middle : end;
+        const int farBegin = d <= 0 ? middle + 1 : begin;
+        const int farEnd = d <= 0 ? end : middle;
+        this->findClosest(nearBegin, nearEnd, next, vector, number, heap);
+        if (heap.size() < number || d * d < heap.front().first)
+        {
+            this->findClosest(farBegin, farEnd, next, vector, number, heap);
+        }
+    }
+
+    double CGeoSpatialIndex::rangeToChord(const CLength &range)
+    {
+        if (range.isNull()) { return -1; }
+        constexpr double earthRadiusMeters = 6371000.8;
+        const double angle = range.value(CLengthUnit::m()) / earthRadiusMeters;
+        if (angle < 0) { return -1; }
+        if (angle >= M_PI) { return 2; }
+        return 2 * std::sin(angle / 2);
+    }
+
+    double CGeoSpatialIndex::chord(const Vector &v1, const Vector &v2)
+    {
+        const double dx = v1[0] - v2[0];
+        const double dy = v1[1] - v2[1];
+        const double dz = v1[2] - v2[2];
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+} // namespace swift::misc::geo
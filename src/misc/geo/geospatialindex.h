@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_GEO_GEOSPATIALINDEX_H
+#define SWIFT_MISC_GEO_GEOSPATIALINDEX_H
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include <QVector>
+
+#include "misc/pq/length.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::geo
+{
+    /*!
+     * k-d tree on the normal vectors of the objects of a geo list.
+     *
+     * Built once for a list which is queried many times, e.g. all airports. Distances are chord lengths
+     * on the unit sphere, they grow monotonically with the great circle distance.
+     * Results are positions in the list the index was built from, the index has to be rebuilt when the list changes.
+     * The index keeps the data of that list alive and remembers its address: a list modified afterwards detaches
+     * from the shared data, so it no longer matches the identity and queries fall back to the linear search.
+     * \sa IGeoObjectList::createSpatialIndex
+     */
+    class SWIFT_MISC_EXPORT CGeoSpatialIndex
+    {
+    public:
+        //! Normal vector
+        using Vector = std::array<double, 3>;
+
+        //! Default constructor, empty index
+        CGeoSpatialIndex() = default;
+
+        //! Constructor
+        //! \param normalVectors of the indexed objects
+        //! \param source the indexed data, kept alive so its address cannot be reused by another list
+        //! \param identity address of the first indexed object
+        CGeoSpatialIndex(const QVector<Vector> &normalVectors, std::shared_ptr<const void> source,
+                         const void *identity);
+
+        //! Number of indexed objects
+        int size() const { return m_nodes.size(); }
+
+        //! Empty index?
+        bool isEmpty() const { return m_nodes.isEmpty(); }
+
+        //! Built from the data at this address?
+        bool isIndexOf(const void *identity) const { return m_identity && m_identity == identity; }
+
+        //! Positions of all objects within the chord length, ascending
+        QVector<int> findWithinChord(const Vector &vector, double maxChord) const;
+
+        //! Positions of the n closest objects, closest first
+        QVector<int> findClosest(int number, const Vector &vector) const;
+
+        //! Position of the closest object within the chord length, -1 if there is none
+        int findClosest(const Vector &vector, double maxChord) const;
+
+        //! Chord length on the unit sphere for a great circle distance
+        static double rangeToChord(const physical_quantities::CLength &range);
+
+        //! Chord length between two normal vectors
+        static double chord(const Vector &v1, const Vector &v2);
+
+        //! Chord length with a tolerance covering the single precision distance calculations of ICoordinateGeodetic
+        static double withTolerance(double chord) { return chord * (1.0 + 1e-5) + 1e-5; }
+
+    private:
+        //! Tree node
+        struct Node
+        {
+            Vector vector; //!< normal vector
+            int position; //!< in the indexed list
+        };
+
+        //! Build the subtree [begin, end), the median is its root
+        void build(int begin, int end, int axis);
+
+        //! @{
+        //! Recursive queries on the subtree [begin, end)
+        void findWithinChord(int begin, int end, int axis, const Vector &vector, double maxChord2,
+                             QVector<int> &result) const;
+        void findClosest(int begin, int end, int axis, const Vector &vector, int number,
+                         QVector<std::pair<double, int>> &heap) const;
+        //! @}
+
+        QVector<Node> m_nodes; //!< implicit tree, the root of each subtree is its middle element
+        std::shared_ptr<const void> m_source; //!< indexed data
+        const void *m_identity = nullptr; //!< address of the first indexed object
+    };
+} // namespace swift::misc::geo
+
+#endif // SWIFT_MISC_GEO_GEOSPATIALINDEX_H
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/latencyhistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtAlgorithms>
+
+namespace swift::misc
+{
+    void CLatencyHistogram::record(qint64 ns)
+    {
+        if (ns < 0) { ns = 0; }
+        m_buckets[static_cast<size_t>(bucketIndex(static_cast<quint64>(ns)))]++;
+        m_minNs = m_count > 0 ? std::min(m_minNs, ns) : ns;
+        m_maxNs = std::max(m_maxNs, ns);
+        m_totalNs += ns;
+        m_count++;
+    }
+
+    void CLatencyHistogram::reset() { *this = CLatencyHistogram(); }
+
+    qint64 CLatencyHistogram::getPercentileNs(double percent) const
+    {
+        if (m_count < 1) { return 0; }
+        const double p = qBound(0.0, percent, 100.0);
+        const qint64 rank = std::max<qint64>(1, static_cast<qint64>(std::ceil(p / 100.0 * m_count)));
+        qint64 seen = 0;
+        for (int i = 0; i < BucketCount; i++)
+        {
+            seen += m_buckets[static_cast<size_t>(i)];
+            if (seen >= rank) { return std::clamp(bucketUpperBound(i), m_minNs, m_maxNs); }
+        }
+        return m_maxNs;
+    }
+
+    QString CLatencyHistogram::toQString() const
+    {
+        return QStringLiteral("n=%1 p50=%2 p90=%3 p99=%4 p99.9=%5 max=%6")
+            .arg(m_count)
+            .arg(formatNs(getPercentileNs(50)), formatNs(getPercentileNs(90)), formatNs(getPercentileNs(99)),
+                 formatNs(getPercentileNs(99.9)), formatNs(m_maxNs));
+    }
+
+    QString CLatencyHistogram::formatNs(qint64 ns)
+    {
+        if (ns < 1000) { return QString::number(ns) + QStringLiteral("ns"); }
+        if (ns < 1000000) { return QString::number(ns / 1.0e3, 'f', 2) + QStringLiteral("us"); }
+        if (ns < 1000000000) { return QString::number(ns / 1.0e6, 'f', 2) + QStringLiteral("ms"); }
+        return QString::number(ns / 1.0e9, 'f', 2) + QStringLiteral("s");
+    }
+
+    int CLatencyHistogram::bucketIndex(quint64 ns)
+    {
+        if (ns < static_cast<quint64>(SubBuckets)) { return static_cast<int>(ns); }
+
+        // keep the SubBucketBits most significant bits, the shift selects the power of two range
+        const int msb = 63 - static_cast<int>(qCountLeadingZeroBits(ns));
+        const int shift = msb - (SubBucketBits - 1);
+        const int index = SubBuckets + (shift - 1) * HalfSubBuckets + static_cast<int>(ns >> shift) - HalfSubBuckets;
+        return std::min(index, BucketCount - 1);
+    }
+
+    qint64 CLatencyHistogram::bucketUpperBound(int index)
+    {
+        if (index < SubBuckets) { return index; }
+        const int shift = (index - SubBuckets) / HalfSubBuckets + 1;
+        const qint64 mantissa = (index - SubBuckets) % HalfSubBuckets + HalfSubBuckets;
+        return ((mantissa + 1) << shift) - 1;
+    }
+} // namespace swift::misc
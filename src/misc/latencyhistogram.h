@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_LATENCYHISTOGRAM_H
+#define SWIFT_MISC_LATENCYHISTOGRAM_H
+
+#include <array>
+
+#include <QString>
+#include <QtGlobal>
+
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc
+{
+    /*!
+     * Histogram of durations in nanoseconds, with percentiles.
+     *
+     * Log-linear buckets as in HDR histograms: each power of two range is split into 16 buckets, so a value is
+     * known with an error of at most ~6% from 1ns up to ~18min. Recording is O(1) and never allocates,
+     * larger values are counted in the last bucket.
+     * \remark not threadsafe, meant to be used by the thread measuring
+     */
+    class SWIFT_MISC_EXPORT CLatencyHistogram
+    {
+    public:
+        //! Add a duration
+        void record(qint64 ns);
+
+        //! Remove all values
+        void reset();
+
+        //! Number of recorded values
+        qint64 getCount() const { return m_count; }
+
+        //! Min. recorded value, 0 if empty
+        qint64 getMinNs() const { return m_count > 0 ? m_minNs : 0; }
+
+        //! Max. recorded value, 0 if empty
+        qint64 getMaxNs() const { return m_maxNs; }
+
+        //! Mean value, 0 if empty
+        double getMeanNs() const { return m_count > 0 ? static_cast<double>(m_totalNs) / m_count : 0.0; }
+
+        //! Value at or below which the given percentage [0..100] of values are, 0 if empty
+        //! \remark the upper end of the bucket, but never above the max. value recorded
+        qint64 getPercentileNs(double percent) const;
+
+        //! Like "n=123 p50=0.21ms p90=0.35ms p99=1.20ms p99.9=2.10ms max=2.31ms"
+        QString toQString() const;
+
+        //! Human readable duration with a unit fitting its magnitude
+        static QString formatNs(qint64 ns);
+
+    private:
+        static constexpr int SubBucketBits = 5;
+        static constexpr int SubBuckets = 1 << SubBucketBits; //!< values below are counted exactly
+        static constexpr int HalfSubBuckets = SubBuckets / 2;
+        static constexpr int MaxValueBits = 40; //!< ~18min
+        static constexpr int BucketCount = SubBuckets + (MaxValueBits - SubBucketBits + 1) * HalfSubBuckets;
+
+        //! Bucket of a value
+        static int bucketIndex(quint64 ns);
+
+        //! Highest value counted in a bucket
+        static qint64 bucketUpperBound(int index);
+
+        std::array<qint64, BucketCount> m_buckets {};
+        qint64 m_count = 0;
+        qint64 m_totalNs = 0;
+        qint64 m_minNs = 0;
+        qint64 m_maxNs = 0;
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_LATENCYHISTOGRAM_H
@@ -33,6 +33,10 @@ namespace swift::misc
 {
     Q_GLOBAL_STATIC(CLogHandler, g_handler)
 
+    // message counters, not part of the handler as messages can be suppressed before it exists
+    static std::atomic<qint64> g_suppressedMessages { 0 };
+    static std::atomic<qint64> g_deliveredMessages { 0 };
+
     CLogHandler *CLogHandler::instance()
     {
         Q_ASSERT(!g_handler.isDestroyed());
@@ -84,6 +88,7 @@ namespace swift::misc
         if (skipIfAlreadyInstalled && m_oldHandler) { return; }
         Q_ASSERT_X(!m_oldHandler, Q_FUNC_INFO, "Re-installing the log handler should be avoided");
         m_oldHandler = qInstallMessageHandler(messageHandler);
+        updateInterest();
     }
 
     CLogHandler::CLogHandler()
@@ -106,6 +111,7 @@ namespace swift::misc
         {
             auto *handler = new CLogPatternHandler(this, pattern);
             topologicallySortedInsert(m_patternHandlers, PatternPair(pattern, handler), comparator);
+            m_handlersCache.clear();
             return handler;
         }
         else { return (*it).second; }
@@ -118,11 +124,21 @@ namespace swift::misc
 
     QList<CLogPatternHandler *> CLogHandler::handlersForMessage(const CStatusMessage &message) const
     {
+        // the same few category sets are logged over and over, so matching all patterns once per set is enough
+        const CLogCategoryList &categories = message.getCategories();
+        size_t hash = 0;
+        for (const CLogCategory &category : categories) { hash = qHash(category, hash); }
+        const auto key = std::make_pair(static_cast<int>(message.getSeverity()), hash);
+        const auto cached = m_handlersCache.constFind(key);
+        if (cached != m_handlersCache.constEnd() && cached->categories == categories) { return cached->handlers; }
+
         QList<CLogPatternHandler *> m_handlers;
         for (const auto &pair : m_patternHandlers)
         {
             if (pair.first.match(message)) { m_handlers.push_back(pair.second); }
         }
+        if (m_handlersCache.size() >= 1000) { m_handlersCache.clear(); } // bound memory for generated categories
+        m_handlersCache.insert(key, { categories, m_handlers });
         return m_handlers;
     }
 
@@ -179,11 +195,15 @@ namespace swift::misc
 
             logMessage(copy);
             emit localMessageLogged(copy);
+            emit localListenerMessageLogged(copy);
+            g_deliveredMessages++;
             return;
         }
 
         logMessage(statusMessage);
         emit localMessageLogged(statusMessage);
+        emit localListenerMessageLogged(statusMessage);
+        g_deliveredMessages++;
     }
 
     void CLogHandler::logRemoteMessage(const CStatusMessage &statusMessage)
@@ -197,6 +217,7 @@ namespace swift::misc
         Q_ASSERT_X(m_oldHandler, Q_FUNC_INFO, "Install the log handler before using it");
         Q_ASSERT_X(thread() == QThread::currentThread(), Q_FUNC_INFO, "Wrong thread");
         m_enableFallThrough = enable;
+        updateInterest();
     }
 
     void CLogHandler::logMessage(const CStatusMessage &statusMessage)
@@ -224,6 +245,8 @@ namespace swift::misc
         {
             it->second->deleteLater();
             m_patternHandlers.erase(it);
+            m_handlersCache.clear();
+            invalidateInterest();
         }
     }
 
@@ -240,6 +263,121 @@ namespace swift::misc
         return result;
     }
 
+    bool CLogHandler::isInterestedIn(CStatusMessage::StatusSeverity severity, const CLogCategoryList &categories)
+    {
+        // do not create the handler from here, and do not use it during shutdown
+        if (!g_handler.exists() || g_handler.isDestroyed()) { return true; }
+
+        const auto interest = g_handler->m_interest.read();
+        if (interest->everything) { return true; }
+        if (!(interest->severities & (1 << severity))) { return false; }
+        return std::any_of(interest->patterns.cbegin(), interest->patterns.cend(),
+                           [&](const CLogPattern &pattern) { return pattern.match(severity, categories); });
+    }
+
+    void CLogHandler::addLocalMessageListener(const QMetaObject::Connection &connection, const QObject *receiver,
+                                              CStatusMessage::StatusSeverity minimum)
+    {
+        if (thread() != QThread::currentThread())
+        {
+            QMetaObject::invokeMethod(this, [this, connection, receiver, minimum] {
+                this->addLocalMessageListener(connection, receiver, minimum);
+            });
+            return;
+        }
+        if (!connection) { return; } // disconnected meanwhile
+        m_localListeners.push_back({ connection, receiver, minimum });
+        connect(receiver, &QObject::destroyed, this, &CLogHandler::invalidateInterest);
+        invalidateInterest();
+    }
+
+    void CLogHandler::setLocalMessageListenerSeverity(const QObject *receiver, CStatusMessage::StatusSeverity minimum)
+    {
+        if (thread() != QThread::currentThread())
+        {
+            QMetaObject::invokeMethod(this, [this, minimum, self = QPointer<const QObject>(receiver)] {
+                if (self) { this->setLocalMessageListenerSeverity(self.data(), minimum); }
+            });
+            return;
+        }
+
+        // a disconnected listener may have had the same address
+        m_localListeners.removeIf([](const LocalListener &listener) { return !listener.connection; });
+        for (LocalListener &listener : m_localListeners)
+        {
+            if (listener.receiver == receiver) { listener.minimum = minimum; }
+        }
+        invalidateInterest();
+    }
+
+    void CLogHandler::countSuppressedMessage() { g_suppressedMessages++; }
+
+    qint64 CLogHandler::getSuppressedMessageCount() { return g_suppressedMessages; }
+
+    qint64 CLogHandler::getDeliveredMessageCount() { return g_deliveredMessages; }
+
+    void CLogHandler::connectNotify(const QMetaMethod &signal)
+    {
+        if (signal == QMetaMethod::fromSignal(&CLogHandler::localMessageLogged)) { invalidateInterest(); }
+    }
+
+    void CLogHandler::disconnectNotify(const QMetaMethod &signal)
+    {
+        // invalid if all signals are disconnected from a receiver
+        if (!signal.isValid() || signal == QMetaMethod::fromSignal(&CLogHandler::localMessageLogged) ||
+            signal == QMetaMethod::fromSignal(&CLogHandler::localListenerMessageLogged))
+        {
+            invalidateInterest();
+        }
+    }
+
+    void CLogHandler::invalidateInterest()
+    {
+        // connections can be made from any thread, so be on the safe side until the interest is recomputed
+        m_interest.sharedWrite([](Interest &interest) { interest.everything = true; });
+        if (m_interestUpdateQueued.exchange(true)) { return; }
+        QMetaObject::invokeMethod(this, &CLogHandler::updateInterest, Qt::QueuedConnection);
+    }
+
+    void CLogHandler::updateInterest()
+    {
+        Q_ASSERT(thread() == QThread::currentThread());
+        m_interestUpdateQueued = false;
+
+        // without installed handler all messages go to the Qt handler
+        Interest interest;
+        interest.everything = !m_oldHandler || m_enableFallThrough;
+        if (!interest.everything)
+        {
+            // receivers of the plain signal did not tell what they need, they take everything
+            interest.everything = this->isSignalConnected(QMetaMethod::fromSignal(&CLogHandler::localMessageLogged));
+            m_localListeners.removeIf([](const LocalListener &listener) { return !listener.connection; });
+            for (const LocalListener &listener : std::as_const(m_localListeners))
+            {
+                interest.patterns.push_back(CLogPattern().withSeverityAtOrAbove(listener.minimum));
+            }
+        }
+        if (!interest.everything)
+        {
+            for (const auto &[pattern, handler] : std::as_const(m_patternHandlers))
+            {
+                const bool subscribed =
+                    handler->isSignalConnected(QMetaMethod::fromSignal(&CLogPatternHandler::messageLogged));
+                const bool console = !handler->m_inheritFallThrough && handler->m_enableFallThrough;
+                if (!subscribed && !console) { continue; }
+                interest.patterns.push_back(pattern);
+            }
+            for (const CLogPattern &pattern : std::as_const(interest.patterns))
+            {
+                for (const CStatusMessage::StatusSeverity severity : pattern.getSeverities())
+                {
+                    interest.severities |= 1 << severity;
+                }
+            }
+        }
+        m_interest.sharedWrite([&interest](Interest &current) { current = interest; });
+    }
+
     CLogPatternHandler::CLogPatternHandler(CLogHandler *parent, const CLogPattern &pattern)
         : QObject(parent), m_parent(parent), m_pattern(pattern)
     {
@@ -260,6 +398,7 @@ namespace swift::misc
                 if (m_isSubscribed) { emit m_parent->subscriptionAdded(m_pattern); }
                 else { emit m_parent->subscriptionRemoved(m_pattern); }
             }
+            m_parent->updateInterest();
 
             if (m_inheritFallThrough && !m_isSubscribed) { m_parent->removePatternHandler(this); }
         }
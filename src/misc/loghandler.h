@@ -20,7 +20,9 @@
 #include <QtGlobal>
 #include <QtMessageHandler>
 
+#include "misc/lockfree.h"
 #include "misc/logcategory.h"
+#include "misc/logcategorylist.h"
 #include "misc/logpattern.h"
 #include "misc/statusmessage.h"
 #include "misc/swiftmiscexport.h"
@@ -70,10 +72,48 @@ namespace swift::misc
         //! Returns all log patterns for which there are currently subscribed log pattern handlers.
         QList<CLogPattern> getAllSubscriptions() const;
 
+        //! Would a message with this severity and categories reach anybody (console, subscriptions, listeners)?
+        //! \details Cheap check against a precomputed snapshot, used to skip formatting messages nobody receives.
+        //!          Answers true if unsure, e.g. if the handler is not installed yet.
+        //! \threadsafe
+        static bool isInterestedIn(CStatusMessage::StatusSeverity severity, const CLogCategoryList &categories);
+
+        //! Connect a receiver of local messages which only needs messages at or above the severity.
+        //! \details Receivers connected to localMessageLogged directly count as interested in all messages.
+        //!          The registration ends with the connection, i.e. when it is disconnected or the receiver destroyed.
+        //! \threadsafe If not called from the main thread, the registration happens asynchronously.
+        template <typename Receiver, typename F>
+        QMetaObject::Connection connectLocalMessageListener(Receiver *receiver, F slot,
+                                                            CStatusMessage::StatusSeverity minimum)
+        {
+            const QMetaObject::Connection connection =
+                connect(this, &CLogHandler::localListenerMessageLogged, receiver, std::move(slot));
+            if (connection) { this->addLocalMessageListener(connection, receiver, minimum); }
+            return connection;
+        }
+
+        //! Change the severity of a receiver connected by connectLocalMessageListener.
+        //! \threadsafe If not called from the main thread, it will run asynchronously.
+        void setLocalMessageListenerSeverity(const QObject *receiver, CStatusMessage::StatusSeverity minimum);
+
+        //! \private Count a message which was not formatted because nobody was interested.
+        static void countSuppressedMessage();
+
+        //! Number of messages skipped because nobody was interested
+        //! \threadsafe
+        static qint64 getSuppressedMessageCount();
+
+        //! Number of local messages delivered to console, subscriptions and listeners
+        //! \threadsafe
+        static qint64 getDeliveredMessageCount();
+
     signals:
         //! Emitted when a message is logged in this process.
         void localMessageLogged(const swift::misc::CStatusMessage &message);
 
+        //! \private Emitted with localMessageLogged, for the receivers connected by connectLocalMessageListener.
+        void localListenerMessageLogged(const swift::misc::CStatusMessage &message);
+
         //! Emitted when a log message is relayed from a different process.
         void remoteMessageLogged(const swift::misc::CStatusMessage &message);
 
@@ -93,8 +133,31 @@ namespace swift::misc
         //! Enable or disable the default Qt handler.
         void enableConsoleOutput(bool enable);
 
+    protected:
+        //! \copydoc QObject::connectNotify
+        void connectNotify(const QMetaMethod &signal) override;
+
+        //! \copydoc QObject::disconnectNotify
+        void disconnectNotify(const QMetaMethod &signal) override;
+
     private:
         friend class CLogPatternHandler;
+
+        //! Who is interested in which messages, precomputed whenever subscriptions change
+        struct Interest
+        {
+            bool everything = true; //!< unknown receivers or console output, everything is of interest
+            int severities = 0; //!< bit mask of the severities matched by any pattern
+            QList<CLogPattern> patterns; //!< subscribed patterns and patterns with console output
+        };
+
+        //! Handlers matching a set of categories
+        struct CachedHandlers
+        {
+            CLogCategoryList categories; //!< categories, to detect hash collisions
+            QList<CLogPatternHandler *> handlers; //!< matching handlers
+        };
+
         void logMessage(const swift::misc::CStatusMessage &message);
         QtMessageHandler m_oldHandler = nullptr;
         bool m_enableFallThrough = true;
@@ -104,6 +167,34 @@ namespace swift::misc
         QList<CLogPatternHandler *> handlersForMessage(const CStatusMessage &message) const;
         void removePatternHandler(CLogPatternHandler *);
         QHash<CStatusMessage, std::pair<CTokenBucket, int>> m_tokenBuckets;
+
+        //! Assume everything is of interest until the interest is recomputed
+        //! \threadsafe
+        void invalidateInterest();
+
+        //! Recompute the interest snapshot
+        void updateInterest();
+
+        LockFree<Interest> m_interest;
+        std::atomic_bool m_interestUpdateQueued { false };
+
+        //! Receiver connected by connectLocalMessageListener
+        struct LocalListener
+        {
+            QMetaObject::Connection connection; //!< registered while connected
+            const QObject *receiver = nullptr; //!< only compared, valid while connected
+            CStatusMessage::StatusSeverity minimum = CStatusMessage::SeverityDebug; //!< messages needed
+        };
+
+        //! Register a connection made by connectLocalMessageListener
+        //! \threadsafe
+        void addLocalMessageListener(const QMetaObject::Connection &connection, const QObject *receiver,
+                                     CStatusMessage::StatusSeverity minimum);
+
+        QList<LocalListener> m_localListeners; //!< receivers with the minimum severity they need
+
+        //! Handlers by severity and hash of the categories, reset whenever a pattern handler is added or removed
+        mutable QHash<std::pair<int, size_t>, CachedHandlers> m_handlersCache;
     };
 
     /*!
@@ -128,6 +219,7 @@ namespace swift::misc
             m_inheritFallThrough = false;
             m_enableFallThrough = enable;
             m_subscriptionNeedsUpdate = true;
+            m_parent->invalidateInterest();
         }
 
         /*!
@@ -142,6 +234,7 @@ namespace swift::misc
             Q_ASSERT(thread() == QThread::currentThread());
             m_inheritFallThrough = true;
             m_subscriptionNeedsUpdate = true;
+            m_parent->invalidateInterest();
         }
 
     signals:
@@ -185,6 +278,7 @@ namespace swift::misc
             if (signal == QMetaMethod::fromSignal(&CLogPatternHandler::messageLogged))
             {
                 m_subscriptionNeedsUpdate = true;
+                m_parent->invalidateInterest();
             }
         }
 
@@ -194,6 +288,7 @@ namespace swift::misc
             if (signal == QMetaMethod::fromSignal(&CLogPatternHandler::messageLogged))
             {
                 m_subscriptionNeedsUpdate = true;
+                m_parent->invalidateInterest();
             }
         }
 
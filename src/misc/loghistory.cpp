@@ -5,19 +5,95 @@
 
 #include "misc/loghistory.h"
 
+#include <algorithm>
+
 #include "misc/loghandler.h"
 
 namespace swift::misc
 {
-    CLogHistory::CLogHistory(QObject *parent) : CListJournal(parent) {}
+    namespace
+    {
+        //! Remove sequences before firstSequence, and lists which became empty
+        template <typename Index>
+        void removeFromIndex(Index &index, qint64 firstSequence)
+        {
+            for (auto it = index.begin(); it != index.end();)
+            {
+                QList<qint64> &sequences = it.value();
+                sequences.erase(sequences.begin(), std::lower_bound(sequences.begin(), sequences.end(), firstSequence));
+                if (sequences.isEmpty()) { it = index.erase(it); }
+                else { ++it; }
+            }
+        }
+
+        //! Number of sequences for the keys
+        template <typename Index, typename Keys>
+        qsizetype countInIndex(const Index &index, const Keys &keys)
+        {
+            qsizetype count = 0;
+            for (const auto &key : keys) { count += index.value(key).size(); }
+            return count;
+        }
+
+        //! Ascending sequences for the keys, without duplicates
+        template <typename Index, typename Keys>
+        QList<qint64> sequencesInIndex(const Index &index, const Keys &keys)
+        {
+            QList<qint64> sequences;
+            for (const auto &key : keys) { sequences += index.value(key); }
+            std::sort(sequences.begin(), sequences.end());
+            sequences.erase(std::unique(sequences.begin(), sequences.end()), sequences.end());
+            return sequences;
+        }
+    } // namespace
+
+    CLogHistory::CLogHistory(QObject *parent) : CListJournal(parent)
+    {
+        this->setMaxElements(MaxMessages);
+        this->setMaxBytes(MaxBytes);
+    }
+
+    qint64 CLogHistory::onElementAdded(qint64 sequence, const CStatusMessage &message)
+    {
+        m_severityIndex[message.getSeverity()].push_back(sequence);
+        qint64 bytes = sizeof(CStatusMessage) + message.getMessage().size() * sizeof(QChar);
+        for (const CLogCategory &category : message.getCategories())
+        {
+            const QString categoryString = category.toQString();
+            QList<qint64> &sequences = m_categoryIndex[categoryString];
+            if (sequences.isEmpty() || sequences.back() != sequence) { sequences.push_back(sequence); }
+            bytes += sizeof(CLogCategory) + categoryString.size() * sizeof(QChar);
+        }
+        return bytes;
+    }
+
+    void CLogHistory::onElementsRemoved(qint64 firstSequence)
+    {
+        removeFromIndex(m_severityIndex, firstSequence);
+        removeFromIndex(m_categoryIndex, firstSequence);
+    }
+
+    bool CLogHistory::candidates(const CLogPattern &pattern, QList<qint64> &o_sequences) const
+    {
+        // the smaller selection is used, each candidate is checked against the pattern anyway
+        const QSet<QString> categories = pattern.getRequiredCategoryStrings();
+        const qsizetype bySeverity = countInIndex(m_severityIndex, pattern.getSeverities());
+        const qsizetype byCategory = categories.isEmpty() ? bySeverity : countInIndex(m_categoryIndex, categories);
+        if (qMin(bySeverity, byCategory) >= this->getElementCount()) { return false; } // checking all is cheaper
+
+        o_sequences = byCategory < bySeverity ? sequencesInIndex(m_categoryIndex, categories) :
+                                                sequencesInIndex(m_severityIndex, pattern.getSeverities());
+        return true;
+    }
 
     CLogHistorySource::CLogHistorySource(QObject *parent) : CListMutator(parent)
     {
-        connect(CLogHandler::instance(), &CLogHandler::localMessageLogged, this,
-                [this](auto &&...args) { this->addElement(args...); });
+        // the journal is bounded, so also debug messages are kept for log views filtering for them
+        CLogHandler::instance()->connectLocalMessageListener(
+            this, [this](const CStatusMessage &message) { this->addElement(message); }, CStatusMessage::SeverityDebug);
     }
 
-    CLogHistoryReplica::CLogHistoryReplica(QObject *parent) : CListObserver(parent) {}
+    CLogHistoryReplica::CLogHistoryReplica(QObject *parent) : CListObserver(parent) { this->setPageSize(PageSize); }
 
     void CLogHistoryReplica::onElementAdded(const CStatusMessage &msg) { emit elementAdded(msg); }
 
@@ -6,6 +6,8 @@
 #ifndef SWIFT_MISC_LOGHISTORY_H
 #define SWIFT_MISC_LOGHISTORY_H
 
+#include <QHash>
+#include <QList>
 #include <QObject>
 
 #include "misc/logpattern.h"
@@ -18,16 +20,29 @@
 namespace swift::misc
 {
     /*!
-     * Records all log messages to a list that persists for the lifetime of the application.
+     * Records log messages to a list that persists for the lifetime of the application.
+     * The oldest messages are removed when the list is full. Messages are indexed by severity and category,
+     * so replicas with a CLogPattern filter are served without checking every message.
      */
-    class SWIFT_MISC_EXPORT CLogHistory : public shared_state::CListJournal<CStatusMessageList>
+    class SWIFT_MISC_EXPORT CLogHistory : public shared_state::CListJournal<CStatusMessageList, CLogPattern>
     {
         Q_OBJECT
         SWIFT_SHARED_STATE_CHANNEL("swift.log.history")
 
     public:
+        static constexpr int MaxMessages = 20000; //!< messages kept
+        static constexpr qint64 MaxBytes = 16 * 1024 * 1024; //!< approximate memory of the messages kept
+
         //! Constructor.
         CLogHistory(QObject *parent = nullptr);
+
+    private:
+        qint64 onElementAdded(qint64 sequence, const CStatusMessage &message) final;
+        void onElementsRemoved(qint64 firstSequence) final;
+        bool candidates(const CLogPattern &pattern, QList<qint64> &o_sequences) const final;
+
+        QHash<CStatusMessage::StatusSeverity, QList<qint64>> m_severityIndex; //!< ascending sequences by severity
+        QHash<QString, QList<qint64>> m_categoryIndex; //!< ascending sequences by category
     };
 
     /*!
@@ -52,6 +67,8 @@ namespace swift::misc
         SWIFT_SHARED_STATE_CHANNEL("swift.log.history")
 
     public:
+        static constexpr int PageSize = 1000; //!< newest messages received initially, older ones on request
+
         //! Constructor.
         CLogHistoryReplica(QObject *parent = nullptr);
 
@@ -7,6 +7,8 @@
 
 #include <QLoggingCategory>
 
+#include "misc/loghandler.h"
+
 namespace swift::misc
 {
 
@@ -14,7 +16,17 @@ namespace swift::misc
 
     CLogMessage::operator CStatusMessage() { return { m_categories, m_severity, message() }; }
 
-    CLogMessage::~CLogMessage() { ostream(qtCategory()).noquote() << message(); }
+    CLogMessage::~CLogMessage()
+    {
+        // nobody would receive it, so skip formatting and the round trip through the Qt message handler
+        // (uncategorized messages get the Qt default category and are always passed on)
+        if (!m_categories.isEmpty() && !CLogHandler::isInterestedIn(m_severity, m_categories))
+        {
+            CLogHandler::countSuppressedMessage();
+            return;
+        }
+        ostream(qtCategory()).noquote() << message();
+    }
 
     QByteArray CLogMessage::qtCategory() const { return m_categories.toQString().toLatin1(); }
 
@@ -175,6 +175,11 @@ namespace swift::misc
     }
 
     bool CLogPattern::match(const CStatusMessage &message) const
+    {
+        return match(message.getSeverity(), message.getCategories());
+    }
+
+    bool CLogPattern::match(CStatusMessage::StatusSeverity severity, const CLogCategoryList &categories) const
     {
         if (!checkInvariants())
         {
@@ -182,29 +187,37 @@ namespace swift::misc
             return true;
         }
 
-        if (!m_severities.contains(message.getSeverity())) { return false; }
+        if (!m_severities.contains(severity)) { return false; }
 
         switch (m_strategy)
         {
         default:
         case Everything: return true;
-        case ExactMatch: return message.getCategories().contains(getString());
+        case ExactMatch: return categories.contains(getString());
         case AnyOf:
             return std::any_of(m_strings.begin(), m_strings.end(),
-                               [&](const QString &s) { return message.getCategories().contains(s); });
+                               [&](const QString &s) { return categories.contains(s); });
         case AllOf:
             return std::all_of(m_strings.begin(), m_strings.end(),
-                               [&](const QString &s) { return message.getCategories().contains(s); });
+                               [&](const QString &s) { return categories.contains(s); });
         case StartsWith:
-            return message.getCategories().containsBy(
-                [this](const CLogCategory &cat) { return cat.startsWith(getPrefix()); });
+            return categories.containsBy([this](const CLogCategory &cat) { return cat.startsWith(getPrefix()); });
         case EndsWith:
-            return message.getCategories().containsBy(
-                [this](const CLogCategory &cat) { return cat.endsWith(getSuffix()); });
+            return categories.containsBy([this](const CLogCategory &cat) { return cat.endsWith(getSuffix()); });
         case Contains:
-            return message.getCategories().containsBy(
-                [this](const CLogCategory &cat) { return cat.contains(getSubstring()); });
-        case Nothing: return message.getCategories().isEmpty();
+            return categories.containsBy([this](const CLogCategory &cat) { return cat.contains(getSubstring()); });
+        case Nothing: return categories.isEmpty();
+        }
+    }
+
+    QSet<QString> CLogPattern::getRequiredCategoryStrings() const
+    {
+        switch (m_strategy)
+        {
+        case ExactMatch:
+        case AnyOf:
+        case AllOf: return m_strings;
+        default: return {};
         }
     }
 
@@ -97,12 +97,21 @@ namespace swift::misc
         //! Returns true if the given message matches this pattern.
         bool match(const CStatusMessage &message) const;
 
+        //! Returns true if a message with the given severity and categories would match this pattern.
+        bool match(CStatusMessage::StatusSeverity severity, const CLogCategoryList &categories) const;
+
+        //! Severities matched by this pattern.
+        const QSet<CStatusMessage::StatusSeverity> &getSeverities() const { return m_severities; }
+
         //! This class acts as a SharedState filter when stored in a CVariant.
         bool matches(const CVariant &message) const { return match(message.to<CStatusMessage>()); }
 
         //! Technical category names matched by this pattern.
         QSet<QString> getCategoryStrings() const { return m_strings; }
 
+        //! Categories of which a matching message has at least one, empty if the pattern does not require any.
+        QSet<QString> getRequiredCategoryStrings() const;
+
         //! Returns true if this pattern is a proper subset of the other pattern.
         //! \see     https://en.wikipedia.org/wiki/Proper_subset
         //! \details Pattern A is a proper subset of pattern B iff pattern B would match every category which pattern A
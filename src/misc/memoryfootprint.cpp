@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/memoryfootprint.h"
+
+#include <QLocale>
+#include <QStringBuilder>
+
+namespace swift::misc
+{
+    void CMemoryFootprint::add(const QString &subsystem, qint64 bytes, int elements)
+    {
+        m_entries.push_back({ subsystem, bytes, elements });
+    }
+
+    qint64 CMemoryFootprint::getTotalBytes() const
+    {
+        qint64 total = 0;
+        for (const Entry &entry : m_entries)
+        {
+            if (entry.bytes > 0) { total += entry.bytes; }
+        }
+        return total;
+    }
+
+    QString CMemoryFootprint::toQString(bool multiline) const
+    {
+        QStringList parts;
+        bool estimated = false;
+        for (const Entry &entry : m_entries)
+        {
+            if (entry.bytes < 0)
+            {
+                parts.push_back(entry.subsystem % u": " % QString::number(entry.elements));
+                continue;
+            }
+            estimated = true;
+            QString part = entry.subsystem % u": " % formatBytes(entry.bytes);
+            if (entry.elements >= 0) { part += u" (" % QString::number(entry.elements) % u')'; }
+            parts.push_back(part);
+        }
+        if (estimated) { parts.push_back(u"total: " % formatBytes(this->getTotalBytes())); }
+        return parts.join(multiline ? QStringLiteral("\n") : QStringLiteral(", "));
+    }
+
+    QString CMemoryFootprint::formatBytes(qint64 bytes)
+    {
+        return QLocale::c().formattedDataSize(bytes, 1, QLocale::DataSizeTraditionalFormat);
+    }
+} // namespace swift::misc
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_MEMORYFOOTPRINT_H
+#define SWIFT_MISC_MEMORYFOOTPRINT_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QtGlobal>
+
+#include "misc/inheritancetraits.h"
+#include "misc/metaclass.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc
+{
+    class CEmpty;
+
+    namespace private_ns
+    {
+        //! \private Header of Qt's shared array data
+        constexpr qint64 QtArrayHeaderBytes = 2 * sizeof(void *);
+
+        //! \private Bookkeeping of a hash or map node, besides key and value
+        constexpr qint64 QtNodeOverheadBytes = 2 * sizeof(void *);
+
+        //! \private Range with element type
+        template <class T, class = void>
+        struct TIsRange : public std::false_type
+        {};
+        //! \private
+        template <class T>
+        struct TIsRange<T, std::void_t<typename T::value_type, decltype(std::declval<const T &>().begin()),
+                                       decltype(std::declval<const T &>().size())>> : public std::true_type
+        {};
+
+        //! \private Qt associative container with key() and value() iterators
+        template <class T, class = void>
+        struct TIsQtAssociative : public std::false_type
+        {};
+        //! \private
+        template <class T>
+        struct TIsQtAssociative<T, std::void_t<typename T::key_type, typename T::mapped_type,
+                                               decltype(std::declval<const T &>().cbegin().key())>> :
+            public std::true_type
+        {};
+    } // namespace private_ns
+
+    /*!
+     * Estimated heap memory owned by a value, not counting sizeof(value) itself.
+     *
+     * Strings and byte arrays count their capacity, containers their elements, value classes the members declared
+     * with SWIFT_METACLASS and their base classes. Implicitly shared data is counted for each owner, so the result is
+     * an upper bound for shared data. Types the estimate does not know (QVariant, pointers, ...) count 0.
+     */
+    template <class T>
+    qint64 heapSize(const T &value)
+    {
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) { return 0; }
+        else if constexpr (std::is_same_v<T, QString>)
+        {
+            if (value.isNull()) { return 0; }
+            return private_ns::QtArrayHeaderBytes + value.capacity() * static_cast<qint64>(sizeof(QChar));
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>)
+        {
+            if (value.isNull()) { return 0; }
+            return private_ns::QtArrayHeaderBytes + value.capacity();
+        }
+        else if constexpr (THasMetaClassV<T>)
+        {
+            using Base = TBaseOfT<T>;
+            qint64 bytes = 0;
+            if constexpr (!std::is_void_v<Base> && !std::is_same_v<Base, CEmpty>)
+            {
+                bytes += heapSize(static_cast<const Base &>(value));
+            }
+            introspect<T>().forEachMember([&](auto member) { bytes += heapSize(member.in(value)); });
+            return bytes;
+        }
+        else if constexpr (private_ns::TIsQtAssociative<T>::value)
+        {
+            using Key = typename T::key_type;
+            using Mapped = typename T::mapped_type;
+            constexpr qint64 nodeBytes = sizeof(Key) + sizeof(Mapped) + private_ns::QtNodeOverheadBytes;
+            qint64 bytes = value.isEmpty() ? 0 : private_ns::QtArrayHeaderBytes;
+            for (auto it = value.cbegin(); it != value.cend(); ++it)
+            {
+                bytes += nodeBytes + heapSize(it.key()) + heapSize(it.value());
+            }
+            return bytes;
+        }
+        else if constexpr (private_ns::TIsRange<T>::value)
+        {
+            using Element = typename T::value_type;
+            if (value.size() == 0) { return 0; }
+            qint64 bytes = private_ns::QtArrayHeaderBytes + static_cast<qint64>(value.size()) * sizeof(Element);
+            for (const Element &element : value) { bytes += heapSize(element); }
+            return bytes;
+        }
+        else { return 0; }
+    }
+
+    /*!
+     * Estimated memory of a value including its heap memory
+     * \sa heapSize
+     */
+    template <class T>
+    qint64 deepSize(const T &value)
+    {
+        return static_cast<qint64>(sizeof(T)) + heapSize(value);
+    }
+
+    /*!
+     * Memory used by subsystems, as collected for a report
+     */
+    class SWIFT_MISC_EXPORT CMemoryFootprint
+    {
+    public:
+        //! Memory of one subsystem
+        struct Entry
+        {
+            QString subsystem; //!< name
+            qint64 bytes = 0; //!< estimated bytes, -1 if not estimated
+            int elements = -1; //!< number of elements, -1 if not applicable
+        };
+
+        //! Adds entries to a footprint, working on copies of the data so it can run in any thread
+        using Estimator = std::function<void(CMemoryFootprint &)>;
+
+        //! Add a subsystem
+        void add(const QString &subsystem, qint64 bytes, int elements = -1);
+
+        //! Add a subsystem with its number of elements only, as estimating its bytes would be expensive
+        void addCount(const QString &subsystem, int elements) { this->add(subsystem, -1, elements); }
+
+        //! All subsystems in the order added
+        const QList<Entry> &getEntries() const { return m_entries; }
+
+        //! Sum of all subsystems with estimated bytes
+        qint64 getTotalBytes() const;
+
+        //! Report, one line or one line per subsystem
+        QString toQString(bool multiline = false) const;
+
+        //! Human readable size
+        static QString formatBytes(qint64 bytes);
+
+    private:
+        QList<Entry> m_entries;
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_MEMORYFOOTPRINT_H
@@ -273,9 +273,28 @@ namespace swift::misc
             {
                 return CMetaClassIntrospector<typename T::MetaClass>();
             }
+
+            //! True if T declares its own metaclass, not only inherits one
+            template <typename T>
+            constexpr static auto hasOwnMetaClass(int) -> decltype(sizeof(typename T::MetaClass::Class), bool())
+            {
+                return std::is_same_v<typename T::MetaClass::Class, T>;
+            }
+            template <typename T>
+            constexpr static bool hasOwnMetaClass(...)
+            {
+                return false;
+            }
         };
     } // namespace private_ns
 
+    /*!
+     * True if T declares a metaclass with SWIFT_METACLASS.
+     * \ingroup MetaClass
+     */
+    template <typename T>
+    inline constexpr bool THasMetaClassV = private_ns::CMetaClassAccessor::hasOwnMetaClass<T>(0);
+
     /*!
      * Obtain the CMetaClassIntrospector for the metaclass of T.
      * \return swift::misc::CMetaClassIntrospector
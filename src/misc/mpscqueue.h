@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_MPSCQUEUE_H
+#define SWIFT_MISC_MPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+#include <QtGlobal>
+
+// http://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
+
+namespace swift::misc
+{
+    /*!
+     * Bounded lock-free queue for many producer threads and one consumer thread.
+     *
+     * Producers never block: if the queue is full, tryPush fails and the caller decides what to do with the value.
+     * The queue never holds more than capacity values. A producer counts its value before pushing it, so tryPush can
+     * fail while other producers are still backing out of a full queue, and size() includes pushes in progress.
+     */
+    template <typename T>
+    class CMpscQueue
+    {
+    public:
+        //! Constructor
+        explicit CMpscQueue(int capacity) : m_capacity(qMax(1, capacity)) {}
+
+        //! Destructor, deletes values not consumed
+        ~CMpscQueue()
+        {
+            T value;
+            while (tryPop(value)) {}
+            delete m_tail;
+        }
+
+        //! @{
+        //! Not copyable
+        CMpscQueue(const CMpscQueue &) = delete;
+        CMpscQueue &operator=(const CMpscQueue &) = delete;
+        //! @}
+
+        //! Append a value, false if the queue is full
+        //! \threadsafe
+        bool tryPush(T value)
+        {
+            if (m_size.fetch_add(1, std::memory_order_relaxed) >= m_capacity)
+            {
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            Node *node = new Node(std::move(value));
+            Node *previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+            return true;
+        }
+
+        //! Take the oldest value, false if the queue is empty
+        //! \remark only to be called by the consumer thread
+        bool tryPop(T &value)
+        {
+            Node *next = m_tail->next.load(std::memory_order_acquire);
+            if (!next) { return false; }
+            value = std::move(next->value);
+            delete m_tail;
+            m_tail = next;
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        //! Approximate number of queued values
+        //! \threadsafe
+        int size() const { return m_size.load(std::memory_order_relaxed); }
+
+        //! Max. number of queued values
+        int capacity() const { return m_capacity; }
+
+    private:
+        struct Node
+        {
+            Node() = default;
+            explicit Node(T &&v) : value(std::move(v)) {}
+            std::atomic<Node *> next { nullptr };
+            T value {};
+        };
+
+        const int m_capacity;
+        std::atomic<int> m_size { 0 };
+        Node *m_tail = new Node; //!< consumer end, stub node
+        std::atomic<Node *> m_head { m_tail }; //!< producer end
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_MPSCQUEUE_H
@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_PQ_STATICQUANTITY_H
+#define SWIFT_MISC_PQ_STATICQUANTITY_H
+
+#include <cmath>
+#include <type_traits>
+
+#include "misc/pq/angle.h"
+#include "misc/pq/length.h"
+#include "misc/pq/speed.h"
+#include "misc/pq/time.h"
+#include "misc/pq/units.h"
+
+namespace swift::misc::physical_quantities
+{
+    /*!
+     * Units known at compile time, a static quantity is stored in the SI unit of its dimension
+     */
+    namespace static_units
+    {
+        //! @{
+        //! Dimension of a static quantity
+        struct LengthDimension
+        {};
+        struct AngleDimension
+        {};
+        struct SpeedDimension
+        {};
+        struct TimeDimension
+        {};
+        //! @}
+
+        //! Meter, SI unit of length
+        struct Meter
+        {
+            using Dimension = LengthDimension; //!< dimension
+            static constexpr double factor = 1.0; //!< to SI unit
+        };
+
+        //! Foot
+        struct Foot
+        {
+            using Dimension = LengthDimension; //!< dimension
+            static constexpr double factor = 0.3048; //!< to SI unit
+        };
+
+        //! Nautical mile
+        struct NauticalMile
+        {
+            using Dimension = LengthDimension; //!< dimension
+            static constexpr double factor = 1852.0; //!< to SI unit
+        };
+
+        //! Radian, SI unit of angle
+        struct Radian
+        {
+            using Dimension = AngleDimension; //!< dimension
+            static constexpr double factor = 1.0; //!< to SI unit
+        };
+
+        //! Degree
+        struct Degree
+        {
+            using Dimension = AngleDimension; //!< dimension
+            static constexpr double factor = 3.14159265358979323846 / 180.0; //!< to SI unit
+        };
+
+        //! Meter per second, SI unit of speed
+        struct MeterPerSecond
+        {
+            using Dimension = SpeedDimension; //!< dimension
+            static constexpr double factor = 1.0; //!< to SI unit
+        };
+
+        //! Knot
+        struct Knot
+        {
+            using Dimension = SpeedDimension; //!< dimension
+            static constexpr double factor = 1852.0 / 3600.0; //!< to SI unit
+        };
+
+        //! Feet per minute
+        struct FootPerMinute
+        {
+            using Dimension = SpeedDimension; //!< dimension
+            static constexpr double factor = 0.3048 / 60.0; //!< to SI unit
+        };
+
+        //! Second, SI unit of time
+        struct Second
+        {
+            using Dimension = TimeDimension; //!< dimension
+            static constexpr double factor = 1.0; //!< to SI unit
+        };
+
+        //! Millisecond
+        struct Millisecond
+        {
+            using Dimension = TimeDimension; //!< dimension
+            static constexpr double factor = 0.001; //!< to SI unit
+        };
+    } // namespace static_units
+
+    /*!
+     * Quantity whose unit is known at compile time, a plain double in the SI unit of the dimension.
+     *
+     * Arithmetic and unit conversions are inlined multiplications, without the unit lookups and conversion function
+     * calls of CPhysicalQuantity. Meant for hot paths, CLength, CAngle, CSpeed and CTime remain the types of APIs.
+     * \sa toStatic
+     * \sa toPhysicalQuantity
+     * \remark there is no null state, null physical quantities become 0
+     */
+    template <class Dimension>
+    class CStaticQuantity
+    {
+    public:
+        //! Zero
+        constexpr CStaticQuantity() = default;
+
+        //! Quantity from a value in the given unit
+        template <class Unit>
+        static constexpr CStaticQuantity from(double value)
+        {
+            static_assert(std::is_same_v<typename Unit::Dimension, Dimension>, "Unit of another dimension");
+            return CStaticQuantity(value * Unit::factor);
+        }
+
+        //! Quantity from a value in the SI unit
+        static constexpr CStaticQuantity fromSi(double value) { return CStaticQuantity(value); }
+
+        //! Value in the given unit
+        template <class Unit>
+        constexpr double in() const
+        {
+            static_assert(std::is_same_v<typename Unit::Dimension, Dimension>, "Unit of another dimension");
+            return m_si / Unit::factor;
+        }
+
+        //! Value in the SI unit
+        constexpr double si() const { return m_si; }
+
+        //! Absolute value
+        CStaticQuantity abs() const { return CStaticQuantity(std::abs(m_si)); }
+
+        //! @{
+        //! Arithmetic
+        constexpr CStaticQuantity &operator+=(CStaticQuantity other)
+        {
+            m_si += other.m_si;
+            return *this;
+        }
+        constexpr CStaticQuantity &operator-=(CStaticQuantity other)
+        {
+            m_si -= other.m_si;
+            return *this;
+        }
+        constexpr CStaticQuantity &operator*=(double factor)
+        {
+            m_si *= factor;
+            return *this;
+        }
+        constexpr CStaticQuantity &operator/=(double divisor)
+        {
+            m_si /= divisor;
+            return *this;
+        }
+        friend constexpr CStaticQuantity operator+(CStaticQuantity a, CStaticQuantity b) { return a += b; }
+        friend constexpr CStaticQuantity operator-(CStaticQuantity a, CStaticQuantity b) { return a -= b; }
+        friend constexpr CStaticQuantity operator-(CStaticQuantity a) { return CStaticQuantity(-a.m_si); }
+        friend constexpr CStaticQuantity operator*(CStaticQuantity a, double factor) { return a *= factor; }
+        friend constexpr CStaticQuantity operator*(double factor, CStaticQuantity a) { return a *= factor; }
+        friend constexpr CStaticQuantity operator/(CStaticQuantity a, double divisor) { return a /= divisor; }
+        friend constexpr double operator/(CStaticQuantity a, CStaticQuantity b) { return a.m_si / b.m_si; }
+        //! @}
+
+        //! @{
+        //! Comparison
+        friend constexpr bool operator==(CStaticQuantity a, CStaticQuantity b) { return a.m_si == b.m_si; }
+        friend constexpr bool operator!=(CStaticQuantity a, CStaticQuantity b) { return a.m_si != b.m_si; }
+        friend constexpr bool operator<(CStaticQuantity a, CStaticQuantity b) { return a.m_si < b.m_si; }
+        friend constexpr bool operator<=(CStaticQuantity a, CStaticQuantity b) { return a.m_si <= b.m_si; }
+        friend constexpr bool operator>(CStaticQuantity a, CStaticQuantity b) { return a.m_si > b.m_si; }
+        friend constexpr bool operator>=(CStaticQuantity a, CStaticQuantity b) { return a.m_si >= b.m_si; }
+        //! @}
+
+    private:
+        explicit constexpr CStaticQuantity(double si) : m_si(si) {}
+
+        double m_si = 0.0;
+    };
+
+    using CStaticLength = CStaticQuantity<static_units::LengthDimension>; //!< length in m
+    using CStaticAngle = CStaticQuantity<static_units::AngleDimension>; //!< angle in rad
+    using CStaticSpeed = CStaticQuantity<static_units::SpeedDimension>; //!< speed in m/s
+    using CStaticTime = CStaticQuantity<static_units::TimeDimension>; //!< time in s
+
+    //! @{
+    //! Quantities of different dimensions
+    constexpr CStaticSpeed operator/(CStaticLength length, CStaticTime time)
+    {
+        return CStaticSpeed::fromSi(length.si() / time.si());
+    }
+    constexpr CStaticLength operator*(CStaticSpeed speed, CStaticTime time)
+    {
+        return CStaticLength::fromSi(speed.si() * time.si());
+    }
+    constexpr CStaticLength operator*(CStaticTime time, CStaticSpeed speed) { return speed * time; }
+    //! @}
+
+    //! @{
+    //! Static quantity of a physical quantity, null becomes 0
+    //! \remark values in the default unit of the physical quantity are taken without conversion
+    inline CStaticLength toStatic(const CLength &length)
+    {
+        return CStaticLength::fromSi(length.value(CLengthUnit::m()));
+    }
+    inline CStaticAngle toStatic(const CAngle &angle)
+    {
+        return CStaticAngle::from<static_units::Degree>(angle.value(CAngleUnit::deg()));
+    }
+    inline CStaticSpeed toStatic(const CSpeed &speed) { return CStaticSpeed::fromSi(speed.value(CSpeedUnit::m_s())); }
+    inline CStaticTime toStatic(const CTime &time) { return CStaticTime::fromSi(time.value(CTimeUnit::s())); }
+    //! @}
+
+    //! @{
+    //! Physical quantity in its default unit
+    inline CLength toPhysicalQuantity(CStaticLength length) { return { length.si(), CLengthUnit::m() }; }
+    inline CAngle toPhysicalQuantity(CStaticAngle angle)
+    {
+        return { angle.in<static_units::Degree>(), CAngleUnit::deg() };
+    }
+    inline CSpeed toPhysicalQuantity(CStaticSpeed speed) { return { speed.si(), CSpeedUnit::m_s() }; }
+    inline CTime toPhysicalQuantity(CStaticTime time) { return { time.si(), CTimeUnit::s() }; }
+    //! @}
+} // namespace swift::misc::physical_quantities
+
+#endif // SWIFT_MISC_PQ_STATICQUANTITY_H
@@ -30,6 +30,7 @@
 #include "misc/propertyindexvariantmap.h"
 #include "misc/rgbcolor.h"
 #include "misc/sequence.h"
+#include "misc/sharedstate/listpage.h"
 #include "misc/sharedstate/passiveobserver.h"
 #include "misc/simulation/registermetadatasimulation.h"
 #include "misc/statusmessagelist.h"
@@ -93,6 +94,8 @@ namespace swift::misc
         weather::registerMetadata();
 
         shared_state::CAnyMatch::registerMetadata();
+        shared_state::CListPageRequest::registerMetadata();
+        shared_state::CListPage::registerMetadata();
 
         // needed by xswiftbus proxy class
         qDBusRegisterMetaType<CSequence<double>>();
@@ -5,6 +5,9 @@
 
 #include "misc/sharedstate/listjournal.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "misc/sharedstate/datalink.h"
 
 namespace swift::misc::shared_state
@@ -16,15 +19,102 @@ namespace swift::misc::shared_state
         m_observer->setEventSubscription(CVariant::from(CAnyMatch()));
     }
 
-    CVariant CGenericListJournal::handleRequest(const CVariant &filter)
+    void CGenericListJournal::setMaxElements(int maxElements)
+    {
+        m_maxElements = maxElements;
+        this->removeOldElements();
+    }
+
+    void CGenericListJournal::setMaxBytes(qint64 maxBytes)
+    {
+        m_maxBytes = maxBytes;
+        this->removeOldElements();
+    }
+
+    CListPage CGenericListJournal::page(const CListPageRequest &request) const
     {
-        CVariantList copy = m_value;
-        if (filter.isValid())
+        const CVariant &filter = request.getFilter();
+        const qint64 end = m_firstSequence + m_elements.size();
+        const qint64 before = request.getBeforeSequence() < 0 ? end : qMin(request.getBeforeSequence(), end);
+        const int maxCount = request.getMaxCount() < 0 ? std::numeric_limits<int>::max() : request.getMaxCount();
+
+        // newest first, one more than requested tells if the page is complete
+        QList<qint64> matches;
+        const auto add = [&](qint64 sequence) {
+            const CVariant &value = m_elements.at(sequence - m_firstSequence).value;
+            if (filter.isValid() && !filter.matches(value)) { return true; }
+            if (matches.size() == maxCount) { return false; }
+            matches.push_back(sequence);
+            return true;
+        };
+
+        bool complete = true;
+        QList<qint64> candidates;
+        if (filter.isValid() && genericCandidates(filter, candidates))
+        {
+            auto it = std::lower_bound(candidates.cbegin(), candidates.cend(), before);
+            while (it != candidates.cbegin() && *(it - 1) >= m_firstSequence)
+            {
+                if (!add(*--it))
+                {
+                    complete = false;
+                    break;
+                }
+            }
+        }
+        else
         {
-            copy.removeIf([&filter](const CVariant &v) { return !filter.matches(v); });
+            for (qint64 sequence = before - 1; sequence >= m_firstSequence; sequence--)
+            {
+                if (!add(sequence))
+                {
+                    complete = false;
+                    break;
+                }
+            }
         }
-        return CVariant::from(copy);
+
+        CVariantList values;
+        for (auto it = matches.crbegin(); it != matches.crend(); ++it)
+        {
+            values.push_back(m_elements.at(*it - m_firstSequence).value);
+        }
+        return { values, matches.isEmpty() ? -1 : matches.back(), complete };
+    }
+
+    CVariant CGenericListJournal::handleRequest(const CVariant &param)
+    {
+        // a plain filter requests all matching elements
+        if (param.canConvert<CListPageRequest>()) { return CVariant::from(page(param.to<CListPageRequest>())); }
+        return CVariant::from(page({ param, -1, -1 }).getValues());
+    }
+
+    void CGenericListJournal::handleEvent(const CVariant &param)
+    {
+        const qint64 sequence = m_firstSequence + m_elements.size();
+        const qint64 bytes = onGenericElementAdded(sequence, param);
+        m_elements.push_back({ param, bytes });
+        m_bytes += bytes;
+        this->removeOldElements();
     }
 
-    void CGenericListJournal::handleEvent(const CVariant &param) { m_value.push_back(param); }
+    void CGenericListJournal::removeOldElements()
+    {
+        const bool tooMany = m_maxElements >= 0 && m_elements.size() > m_maxElements;
+        const bool tooLarge = m_maxBytes >= 0 && m_bytes > m_maxBytes;
+        if (!tooMany && !tooLarge) { return; }
+
+        // some more are removed at once, so this and updating indexes happens rarely
+        const qsizetype keepElements = m_maxElements < 0 ? m_elements.size() : m_maxElements - m_maxElements / 16;
+        const qint64 keepBytes = m_maxBytes < 0 ? m_bytes : m_maxBytes - m_maxBytes / 16;
+        qsizetype removed = 0;
+        while (removed < m_elements.size() &&
+               (m_elements.size() - removed > keepElements || m_bytes > keepBytes))
+        {
+            m_bytes -= m_elements.at(removed++).bytes;
+        }
+        m_elements.remove(0, removed);
+        m_firstSequence += removed;
+        onGenericElementsRemoved(m_firstSequence);
+    }
 } // namespace swift::misc::shared_state
@@ -6,10 +6,12 @@
 #ifndef SWIFT_MISC_SHAREDSTATE_LISTJOURNAL_H
 #define SWIFT_MISC_SHAREDSTATE_LISTJOURNAL_H
 
+#include <QList>
 #include <QMutex>
 #include <QObject>
 
 #include "misc/sharedstate/activemutator.h"
+#include "misc/sharedstate/listpage.h"
 #include "misc/sharedstate/passiveobserver.h"
 #include "misc/swiftmiscexport.h"
 #include "misc/variantlist.h"
@@ -30,30 +32,113 @@ namespace swift::misc::shared_state
         //! Publish using the given transport mechanism.
         void initialize(IDataLink *);
 
+        //! @{
+        //! Maximum number of elements kept, -1 for no limit.
+        void setMaxElements(int maxElements);
+        int getMaxElements() const { return m_maxElements; }
+        //! @}
+
+        //! @{
+        //! Maximum approximate memory used by the elements, -1 for no limit.
+        void setMaxBytes(qint64 maxBytes);
+        qint64 getMaxBytes() const { return m_maxBytes; }
+        //! @}
+
+        //! Number of elements kept.
+        int getElementCount() const { return static_cast<int>(m_elements.size()); }
+
+        //! Approximate memory used by the elements kept.
+        qint64 getBytes() const { return m_bytes; }
+
+        //! Number of elements removed because a limit was reached.
+        qint64 getRemovedCount() const { return m_firstSequence; }
+
+        //! Elements matching the filter, at most maxCount of the newest ones older than beforeSequence.
+        CListPage page(const CListPageRequest &request) const;
+
     protected:
         //! Constructor.
         CGenericListJournal(QObject *parent) : QObject(parent) {}
 
+        //! Sequence number of the oldest element kept, sequence numbers increase by one per element added.
+        qint64 getFirstSequence() const { return m_firstSequence; }
+
     private:
-        CVariant handleRequest(const CVariant &filter);
+        //! Element and its approximate memory
+        struct Element
+        {
+            CVariant value; //!< element
+            qint64 bytes = 0; //!< approximate memory
+        };
+
+        CVariant handleRequest(const CVariant &param);
         void handleEvent(const CVariant &param);
 
+        //! Remove the oldest elements until the limits are met again.
+        void removeOldElements();
+
+        //! Called for each element added, returns its approximate memory.
+        virtual qint64 onGenericElementAdded(qint64 sequence, const CVariant &value) = 0;
+
+        //! Called after elements older than firstSequence were removed.
+        virtual void onGenericElementsRemoved(qint64 firstSequence) = 0;
+
+        //! Ascending sequence numbers of elements which can match the filter, false if all can.
+        virtual bool genericCandidates(const CVariant &filter, QList<qint64> &o_sequences) const = 0;
+
         QSharedPointer<CActiveMutator> m_mutator = CActiveMutator::create(this, &CGenericListJournal::handleRequest);
         QSharedPointer<CPassiveObserver> m_observer = CPassiveObserver::create(this, &CGenericListJournal::handleEvent);
-        CVariantList m_value;
+        QList<Element> m_elements;
+        qint64 m_firstSequence = 0; //!< sequence number of m_elements.front()
+        qint64 m_bytes = 0;
+        int m_maxElements = -1;
+        qint64 m_maxBytes = -1;
     };
 
     /*!
      * Base class for an object that shares state with a corresponding CListObserver subclass object.
      * \tparam T Datatype encapsulating the state to be shared.
+     * \tparam U Datatype describing a filter to apply to the list.
      * \ingroup shared_state
      */
-    template <typename T>
+    template <typename T, typename U = CAnyMatch>
     class CListJournal : public CGenericListJournal
     {
     protected:
         //! Constructor.
         CListJournal(QObject *parent) : CGenericListJournal(parent) {}
+
+        //! Called for each element added, e.g. to index it, returns its approximate memory.
+        virtual qint64 onElementAdded(qint64 sequence, const typename T::value_type &value)
+        {
+            Q_UNUSED(sequence)
+            Q_UNUSED(value)
+            return static_cast<qint64>(sizeof(typename T::value_type));
+        }
+
+        //! Called after elements older than firstSequence were removed.
+        virtual void onElementsRemoved(qint64 firstSequence) { Q_UNUSED(firstSequence) }
+
+        //! Ascending sequence numbers of elements which can match the filter, e.g. from an index.
+        //! \return false if all elements have to be checked
+        virtual bool candidates(const U &filter, QList<qint64> &o_sequences) const
+        {
+            Q_UNUSED(filter)
+            Q_UNUSED(o_sequences)
+            return false;
+        }
+
+    private:
+        qint64 onGenericElementAdded(qint64 sequence, const CVariant &value) final
+        {
+            return onElementAdded(sequence, value.to<typename T::value_type>());
+        }
+        void onGenericElementsRemoved(qint64 firstSequence) final { onElementsRemoved(firstSequence); }
+        bool genericCandidates(const CVariant &filter, QList<qint64> &o_sequences) const final
+        {
+            if (!filter.canConvert<U>()) { return false; }
+            return candidates(filter.to<U>(), o_sequences);
+        }
     };
 } // namespace swift::misc::shared_state
 
@@ -6,6 +6,7 @@
 #include "misc/sharedstate/listobserver.h"
 
 #include "misc/sharedstate/datalink.h"
+#include "misc/sharedstate/listpage.h"
 #include "misc/variantlist.h"
 
 namespace swift::misc::shared_state
@@ -25,14 +26,48 @@ namespace swift::misc::shared_state
 
     void CGenericListObserver::reconstruct()
     {
-        m_observer->requestAsync(m_observer->eventSubscription(), [this](const CVariant &list) {
+        // the journal filters and limits the values, so only the newest page is transmitted
+        const CListPageRequest request(m_observer->eventSubscription(), -1, m_pageSize);
+        m_observer->requestAsync(CVariant::from(request), [this](const CVariant &reply) {
+            const CListPage page = reply.to<CListPage>();
             QMutexLocker lock(&m_listMutex);
-            m_list = list.to<CVariantList>();
+            m_list = page.getValues();
+            m_firstSequence = page.getFirstSequence();
+            m_complete = page.isComplete();
             lock.unlock();
             onGenericElementsReplaced(allValues());
         });
     }
 
+    bool CGenericListObserver::requestOlderValues()
+    {
+        QMutexLocker lock(&m_listMutex);
+        if (m_complete || m_firstSequence < 0) { return false; }
+        const qint64 before = m_firstSequence;
+        lock.unlock();
+
+        const CListPageRequest request(m_observer->eventSubscription(), before, m_pageSize);
+        m_observer->requestAsync(CVariant::from(request), [this, before](const CVariant &reply) {
+            const CListPage page = reply.to<CListPage>();
+            QMutexLocker lock(&m_listMutex);
+            if (m_firstSequence != before) { return; } // list has been replaced meanwhile
+            CVariantList list = page.getValues();
+            list.push_back(m_list);
+            m_list = list;
+            m_firstSequence = page.getValues().isEmpty() ? m_firstSequence : page.getFirstSequence();
+            m_complete = page.isComplete();
+            lock.unlock();
+            onGenericElementsReplaced(allValues());
+        });
+        return true;
+    }
+
+    bool CGenericListObserver::hasOlderValues() const
+    {
+        QMutexLocker lock(&m_listMutex);
+        return !m_complete;
+    }
+
     CVariantList CGenericListObserver::allValues() const
     {
         QMutexLocker lock(&m_listMutex);
@@ -40,6 +40,16 @@ namespace swift::misc::shared_state
         //! Remove any old values that no longer match the filter.
         int cleanValues();
 
+        //! Number of newest values received when (re)connecting or changing the filter, -1 for all.
+        void setPageSize(int pageSize) { m_pageSize = pageSize; }
+
+        //! Request the page of values before the oldest value received, they are prepended to the list.
+        //! \return false if there are no older values
+        bool requestOlderValues();
+
+        //! Are there older values not received?
+        bool hasOlderValues() const;
+
     private:
         void reconstruct();
         void handleEvent(const CVariant &param);
@@ -50,6 +60,9 @@ namespace swift::misc::shared_state
         CDataLinkConnectionWatcher *m_watcher = nullptr;
         mutable QMutex m_listMutex;
         CVariantList m_list;
+        qint64 m_firstSequence = -1; //!< of the oldest value in the list, to request older values
+        bool m_complete = true; //!< no older values
+        int m_pageSize = -1;
     };
 
     /*!
@@ -79,6 +92,15 @@ namespace swift::misc::shared_state
         //! Get list value containing all elements matching the filter.
         T allValues() const { return CVariant::from(CGenericListObserver::allValues()).template to<T>(); }
 
+        //! \copydoc CGenericListObserver::setPageSize
+        void setPageSize(int pageSize) { CGenericListObserver::setPageSize(pageSize); }
+
+        //! \copydoc CGenericListObserver::requestOlderValues
+        bool requestOlderValues() { return CGenericListObserver::requestOlderValues(); }
+
+        //! \copydoc CGenericListObserver::hasOlderValues
+        bool hasOlderValues() const { return CGenericListObserver::hasOlderValues(); }
+
         //! Called when an element matching the filter is added to the list.
         virtual void onElementAdded(const typename T::value_type &value) = 0;
 
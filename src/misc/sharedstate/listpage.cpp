@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#include "misc/sharedstate/listpage.h"
+
+#include <QStringBuilder>
+
+SWIFT_DEFINE_VALUEOBJECT_MIXINS(swift::misc::shared_state, CListPageRequest)
+SWIFT_DEFINE_VALUEOBJECT_MIXINS(swift::misc::shared_state, CListPage)
+
+namespace swift::misc::shared_state
+{
+    QString CListPageRequest::convertToQString(bool i18n) const
+    {
+        return u"filter: " % m_filter.toQString(i18n) % u" before: " % QString::number(m_beforeSequence) %
+               u" max: " % QString::number(m_maxCount);
+    }
+
+    QString CListPage::convertToQString(bool i18n) const
+    {
+        Q_UNUSED(i18n)
+        return u"values: " % QString::number(m_values.size()) % u" first: " % QString::number(m_firstSequence) %
+               (m_complete ? QStringLiteral(" complete") : QString());
+    }
+} // namespace swift::misc::shared_state
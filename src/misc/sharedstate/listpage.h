@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SHAREDSTATE_LISTPAGE_H
+#define SWIFT_MISC_SHAREDSTATE_LISTPAGE_H
+
+#include "misc/metaclass.h"
+#include "misc/swiftmiscexport.h"
+#include "misc/valueobject.h"
+#include "misc/variant.h"
+#include "misc/variantlist.h"
+
+SWIFT_DECLARE_VALUEOBJECT_MIXINS(swift::misc::shared_state, CListPageRequest)
+SWIFT_DECLARE_VALUEOBJECT_MIXINS(swift::misc::shared_state, CListPage)
+
+namespace swift::misc::shared_state
+{
+    /*!
+     * Request for the newest elements of a CListJournal matching a filter, older than a given element.
+     * \ingroup shared_state
+     */
+    class SWIFT_MISC_EXPORT CListPageRequest : public CValueObject<CListPageRequest>
+    {
+    public:
+        //! Default constructor.
+        CListPageRequest() = default;
+
+        //! Constructor.
+        CListPageRequest(const CVariant &filter, qint64 beforeSequence, int maxCount)
+            : m_filter(filter), m_beforeSequence(beforeSequence), m_maxCount(maxCount)
+        {}
+
+        //! Filter the elements have to match, invalid to match all elements.
+        const CVariant &getFilter() const { return m_filter; }
+
+        //! Only elements older than this one, -1 for the newest elements.
+        qint64 getBeforeSequence() const { return m_beforeSequence; }
+
+        //! Maximum number of elements, -1 for all.
+        int getMaxCount() const { return m_maxCount; }
+
+        //! To string.
+        QString convertToQString(bool = false) const;
+
+    private:
+        CVariant m_filter;
+        qint64 m_beforeSequence = -1;
+        int m_maxCount = -1;
+
+        SWIFT_METACLASS(CListPageRequest, SWIFT_METAMEMBER(filter), SWIFT_METAMEMBER(beforeSequence),
+                        SWIFT_METAMEMBER(maxCount));
+    };
+
+    /*!
+     * Elements of a CListJournal replied to a CListPageRequest, oldest first.
+     * \ingroup shared_state
+     */
+    class SWIFT_MISC_EXPORT CListPage : public CValueObject<CListPage>
+    {
+    public:
+        //! Default constructor.
+        CListPage() = default;
+
+        //! Constructor.
+        CListPage(const CVariantList &values, qint64 firstSequence, bool complete)
+            : m_values(values), m_firstSequence(firstSequence), m_complete(complete)
+        {}
+
+        //! Matching elements, oldest first.
+        const CVariantList &getValues() const { return m_values; }
+
+        //! Sequence number of the first element, to request the page before, -1 if empty.
+        qint64 getFirstSequence() const { return m_firstSequence; }
+
+        //! True if the journal holds no older matching elements.
+        bool isComplete() const { return m_complete; }
+
+        //! To string.
+        QString convertToQString(bool = false) const;
+
+    private:
+        CVariantList m_values;
+        qint64 m_firstSequence = -1;
+        bool m_complete = true;
+
+        SWIFT_METACLASS(CListPage, SWIFT_METAMEMBER(values), SWIFT_METAMEMBER(firstSequence),
+                        SWIFT_METAMEMBER(complete));
+    };
+} // namespace swift::misc::shared_state
+
+Q_DECLARE_METATYPE(swift::misc::shared_state::CListPageRequest)
+Q_DECLARE_METATYPE(swift::misc::shared_state::CListPage)
+
+#endif // SWIFT_MISC_SHAREDSTATE_LISTPAGE_H
@@ -53,6 +53,7 @@ namespace swift::misc::simulation
         static const QString cacheFirst("cache first");
         static const QString cacheSkipped("cache skipped");
         static const QString cacheOnly("cacheOnly");
+        static const QString incremental("incremental from disk");
 
         switch (modeFlag)
         {
@@ -62,6 +63,7 @@ namespace swift::misc::simulation
         case CacheFirst: return cacheFirst;
         case CacheSkipped: return cacheSkipped;
         case CacheOnly: return cacheOnly;
+        case IncrementalFromDisk: return incremental;
         default: break;
         }
 
@@ -77,6 +79,8 @@ namespace swift::misc::simulation
         if (mode.testFlag(LoadInBackground)) { modes << enumToString(LoadInBackground); }
         if (mode.testFlag(CacheFirst)) { modes << enumToString(CacheFirst); }
         if (mode.testFlag(CacheSkipped)) { modes << enumToString(CacheSkipped); }
+        if (mode.testFlag(CacheOnly)) { modes << enumToString(CacheOnly); }
+        if (mode.testFlag(IncrementalFromDisk)) { modes << enumToString(IncrementalFromDisk); }
         return modes.join(", ");
     }
 
@@ -56,8 +56,10 @@ namespace swift::misc::simulation
             CacheFirst = 1 << 2, //!< always use cache (if it has data)
             CacheSkipped = 1 << 3, //!< ignore cache
             CacheOnly = 1 << 4, //!< only read cache, never load from disk
+            IncrementalFromDisk = 1 << 5, //!< load from disk, only parse files changed since the last load
             InBackgroundWithCache = LoadInBackground | CacheFirst, //!< Background, cached
-            InBackgroundNoCache = LoadInBackground | CacheSkipped //!< Background, not checking cache
+            InBackgroundNoCache = LoadInBackground | CacheSkipped, //!< Background, not checking cache
+            InBackgroundIncremental = LoadInBackground | CacheSkipped | IncrementalFromDisk //!< Background, changes only
         };
         Q_DECLARE_FLAGS(LoadMode, LoadModeFlag)
 
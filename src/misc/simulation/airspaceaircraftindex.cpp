@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/airspaceaircraftindex.h"
+
+#include <limits>
+
+#include "misc/pq/units.h"
+#include "misc/simulation/simulatedaircraft.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::physical_quantities;
+
+namespace swift::misc::simulation
+{
+    bool CAirspaceAircraftIndex::DistanceKey::operator<(const DistanceKey &other) const
+    {
+        if (distanceM != other.distanceM) { return distanceM < other.distanceM; }
+        if (rendered != other.rendered) { return rendered; }
+        return callsign.asString() < other.callsign.asString();
+    }
+
+    void CAirspaceAircraftIndex::update(const CSimulatedAircraft &aircraft)
+    {
+        const CLength distance = aircraft.getRelativeDistance();
+        Entry entry;
+        entry.distanceM = distance.isNull() ? std::numeric_limits<double>::max() : distance.value(CLengthUnit::m());
+        entry.enabled = aircraft.isEnabled();
+        entry.rendered = aircraft.isRendered();
+        entry.vtol = aircraft.isVtol();
+        this->replace(aircraft.getCallsign(), entry);
+    }
+
+    void CAirspaceAircraftIndex::updateDistance(const CCallsign &callsign, double distanceM)
+    {
+        const auto it = m_entries.constFind(callsign);
+        if (it == m_entries.constEnd() || it->distanceM == distanceM) { return; }
+        Entry entry = it.value();
+        entry.distanceM = distanceM;
+        this->replace(callsign, entry);
+    }
+
+    void CAirspaceAircraftIndex::updateEnabled(const CCallsign &callsign, bool enabled)
+    {
+        const auto it = m_entries.constFind(callsign);
+        if (it == m_entries.constEnd() || it->enabled == enabled) { return; }
+        Entry entry = it.value();
+        entry.enabled = enabled;
+        this->replace(callsign, entry);
+    }
+
+    void CAirspaceAircraftIndex::updateRendered(const CCallsign &callsign, bool rendered)
+    {
+        const auto it = m_entries.constFind(callsign);
+        if (it == m_entries.constEnd() || it->rendered == rendered) { return; }
+        Entry entry = it.value();
+        entry.rendered = rendered;
+        this->replace(callsign, entry);
+    }
+
+    void CAirspaceAircraftIndex::remove(const CCallsign &callsign)
+    {
+        const auto it = m_entries.constFind(callsign);
+        if (it == m_entries.constEnd()) { return; }
+        if (it->enabled) { m_enabledByDistance.erase(distanceKey(callsign, it.value())); }
+        m_entries.erase(it);
+    }
+
+    void CAirspaceAircraftIndex::clear()
+    {
+        m_entries.clear();
+        m_enabledByDistance.clear();
+    }
+
+    CCallsignSet CAirspaceAircraftIndex::getCallsigns() const
+    {
+        CCallsignSet callsigns;
+        for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) { callsigns.push_back(it.key()); }
+        return callsigns;
+    }
+
+    CCallsignSet CAirspaceAircraftIndex::getEnabledCallsigns() const
+    {
+        CCallsignSet callsigns;
+        for (const DistanceKey &key : m_enabledByDistance) { callsigns.push_back(key.callsign); }
+        return callsigns;
+    }
+
+    CCallsignSet CAirspaceAircraftIndex::getClosestEnabledCallsigns(int maxAircraft, double maxDistanceM) const
+    {
+        CCallsignSet callsigns;
+        int count = 0;
+        for (const DistanceKey &key : m_enabledByDistance)
+        {
+            if (count >= maxAircraft) { break; }
+            if (maxDistanceM >= 0 && key.distanceM >= maxDistanceM) { break; }
+            callsigns.push_back(key.callsign);
+            count++;
+        }
+        return callsigns;
+    }
+
+    bool CAirspaceAircraftIndex::isVtol(const CCallsign &callsign) const
+    {
+        const auto it = m_entries.constFind(callsign);
+        return it != m_entries.constEnd() && it->vtol;
+    }
+
+    void CAirspaceAircraftIndex::replace(const CCallsign &callsign, const Entry &entry)
+    {
+        const auto it = m_entries.find(callsign);
+        if (it != m_entries.end())
+        {
+            const Entry &old = it.value();
+            const bool sameKey = old.distanceM == entry.distanceM && old.rendered == entry.rendered;
+            if (old.enabled && (!entry.enabled || !sameKey))
+            {
+                // reuse the node, a distance update is the most frequent change
+                auto node = m_enabledByDistance.extract(distanceKey(callsign, old));
+                if (entry.enabled && !node.empty())
+                {
+                    node.value() = distanceKey(callsign, entry);
+                    m_enabledByDistance.insert(std::move(node));
+                }
+            }
+            else if (!old.enabled && entry.enabled) { m_enabledByDistance.insert(distanceKey(callsign, entry)); }
+            it.value() = entry;
+            return;
+        }
+
+        m_entries.insert(callsign, entry);
+        if (entry.enabled) { m_enabledByDistance.insert(distanceKey(callsign, entry)); }
+    }
+} // namespace swift::misc::simulation
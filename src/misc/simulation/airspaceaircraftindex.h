@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_AIRSPACEAIRCRAFTINDEX_H
+#define SWIFT_MISC_SIMULATION_AIRSPACEAIRCRAFTINDEX_H
+
+#include <set>
+
+#include <QHash>
+
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignset.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation
+{
+    class CSimulatedAircraft;
+
+    /*!
+     * What the airspace snapshot needs to know about the aircraft in range, kept up to date with each change.
+     *
+     * The enabled aircraft are additionally ordered by distance (rendered first, then callsign, as in
+     * CSimulatedAircraftList::sortByDistanceToReferencePositionRenderedCallsign), so the K closest enabled aircraft
+     * are found without sorting all of them. Updating a distance is O(log N).
+     * \remark not threadsafe, the owner is supposed to lock
+     * \sa CAirspaceAircraftSnapshot
+     */
+    class SWIFT_MISC_EXPORT CAirspaceAircraftIndex
+    {
+    public:
+        //! Add or update an aircraft
+        void update(const CSimulatedAircraft &aircraft);
+
+        //! Update distance
+        void updateDistance(const aviation::CCallsign &callsign, double distanceM);
+
+        //! Update enabled flag
+        void updateEnabled(const aviation::CCallsign &callsign, bool enabled);
+
+        //! Update rendered flag
+        void updateRendered(const aviation::CCallsign &callsign, bool rendered);
+
+        //! Remove an aircraft
+        void remove(const aviation::CCallsign &callsign);
+
+        //! Remove all
+        void clear();
+
+        //! Number of aircraft
+        int size() const { return static_cast<int>(m_entries.size()); }
+
+        //! All callsigns
+        aviation::CCallsignSet getCallsigns() const;
+
+        //! Callsigns of the enabled aircraft
+        aviation::CCallsignSet getEnabledCallsigns() const;
+
+        //! Up to maxAircraft closest enabled aircraft closer than maxDistanceM (<0 means no limit)
+        aviation::CCallsignSet getClosestEnabledCallsigns(int maxAircraft, double maxDistanceM) const;
+
+        //! Is the aircraft a VTOL aircraft?
+        bool isVtol(const aviation::CCallsign &callsign) const;
+
+    private:
+        //! Data per aircraft
+        struct Entry
+        {
+            double distanceM = 0; //!< relative distance, unknown distances go last
+            bool enabled = false; //!< enabled for rendering
+            bool rendered = false; //!< rendered in simulator
+            bool vtol = false; //!< VTOL aircraft
+        };
+
+        //! Key in the distance order
+        struct DistanceKey
+        {
+            double distanceM = 0; //!< relative distance
+            bool rendered = false; //!< rendered first
+            aviation::CCallsign callsign; //!< callsign
+
+            //! Order by distance, rendered, callsign
+            bool operator<(const DistanceKey &other) const;
+        };
+
+        //! Key of an entry
+        static DistanceKey distanceKey(const aviation::CCallsign &callsign, const Entry &entry)
+        {
+            return { entry.distanceM, entry.rendered, callsign };
+        }
+
+        //! Replace an entry, keeps the distance order up to date
+        void replace(const aviation::CCallsign &callsign, const Entry &entry);
+
+        QHash<aviation::CCallsign, Entry> m_entries;
+        std::set<DistanceKey> m_enabledByDistance;
+    };
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_AIRSPACEAIRCRAFTINDEX_H
@@ -3,10 +3,13 @@
 
 #include "misc/simulation/airspaceaircraftsnapshot.h"
 
+#include <utility>
+
 #include <QThread>
 
 #include "misc/aviation/callsign.h"
 #include "misc/pq/physicalquantity.h"
+#include "misc/simulation/airspaceaircraftindex.h"
 #include "misc/simulation/simulatedaircraft.h"
 
 using namespace swift::misc::aviation;
@@ -79,6 +82,45 @@ namespace swift::misc::simulation
         }
     }
 
+    CAirspaceAircraftSnapshot::CAirspaceAircraftSnapshot(const CAirspaceAircraftIndex &index, bool restricted,
+                                                         bool renderingEnabled, int maxAircraft,
+                                                         const CLength &maxRenderedDistance)
+        : m_timestampMsSinceEpoch(QDateTime::currentMSecsSinceEpoch()), m_restricted(restricted),
+          m_renderingEnabled(renderingEnabled), m_threadName(QThread::currentThread()->objectName())
+    {
+        if (index.size() < 1) { return; }
+
+        m_aircraftCallsignsByDistance = index.getCallsigns();
+        for (const CCallsign &cs : std::as_const(m_aircraftCallsignsByDistance))
+        {
+            if (index.isVtol(cs)) { m_vtolAircraftCallsignsByDistance.push_back(cs); }
+        }
+
+        // no rendering, this means all aircraft are disabled
+        if (restricted && !m_renderingEnabled)
+        {
+            m_disabledAircraftCallsignsByDistance = m_aircraftCallsignsByDistance;
+            return;
+        }
+
+        // restricted: only the closest enabled aircraft
+        if (restricted)
+        {
+            const double maxDistanceM =
+                maxRenderedDistance.isNull() ? -1.0 : maxRenderedDistance.value(CLengthUnit::m());
+            m_enabledAircraftCallsignsByDistance = index.getClosestEnabledCallsigns(maxAircraft, maxDistanceM);
+        }
+        else { m_enabledAircraftCallsignsByDistance = index.getEnabledCallsigns(); }
+        for (const CCallsign &cs : std::as_const(m_aircraftCallsignsByDistance))
+        {
+            if (!m_enabledAircraftCallsignsByDistance.contains(cs))
+            {
+                m_disabledAircraftCallsignsByDistance.push_back(cs);
+            }
+            else if (index.isVtol(cs)) { m_enabledVtolAircraftCallsignsByDistance.push_back(cs); }
+        }
+    }
+
     bool CAirspaceAircraftSnapshot::isValidSnapshot() const { return m_timestampMsSinceEpoch > 0; }
 
     void CAirspaceAircraftSnapshot::setRestrictionChanged(const CAirspaceAircraftSnapshot &snapshot)
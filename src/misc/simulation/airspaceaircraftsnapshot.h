@@ -24,6 +24,8 @@ SWIFT_DECLARE_VALUEOBJECT_MIXINS(swift::misc::simulation, CAirspaceAircraftSnaps
 
 namespace swift::misc::simulation
 {
+    class CAirspaceAircraftIndex;
+
     //! Current situation in the skies analyzed.
     class SWIFT_MISC_EXPORT CAirspaceAircraftSnapshot : public CValueObject<CAirspaceAircraftSnapshot>
     {
@@ -37,6 +39,11 @@ namespace swift::misc::simulation
                                   const swift::misc::physical_quantities::CLength &maxRenderedDistance = { 0,
                                                                                                            nullptr });
 
+        //! Constructor from the incrementally maintained index, does not need to copy or sort the aircraft
+        CAirspaceAircraftSnapshot(const CAirspaceAircraftIndex &index, bool restricted, bool renderingEnabled,
+                                  int maxAircraft,
+                                  const swift::misc::physical_quantities::CLength &maxRenderedDistance);
+
         //! Time when snapshot was taken
         const QDateTime getTimestamp() const { return QDateTime::fromMSecsSinceEpoch(m_timestampMsSinceEpoch); }
 
@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/elevationcache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <QMutexLocker>
+#include <QtMath>
+
+#include "misc/pq/units.h"
+
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+
+namespace swift::misc::simulation
+{
+    CElevationCache::CElevationCache(int capacity) : m_capacity(qMax(1, capacity)) {}
+
+    int CElevationCache::row(double latitudeDeg)
+    {
+        const int r = static_cast<int>(std::floor((latitudeDeg + 90.0) / CellSizeDeg));
+        return std::clamp(r, 0, static_cast<int>(180.0 / CellSizeDeg) - 1);
+    }
+
+    int CElevationCache::columnsInRow(int row)
+    {
+        // narrower rows towards the poles, so all cells have about the same width
+        const double centerLatitudeRad = qDegreesToRadians(-90.0 + (row + 0.5) * CellSizeDeg);
+        return qMax(1, static_cast<int>(360.0 * std::cos(centerLatitudeRad) / CellSizeDeg));
+    }
+
+    int CElevationCache::column(int row, double longitudeDeg)
+    {
+        const int columns = columnsInRow(row);
+        const int c = static_cast<int>(std::floor((longitudeDeg + 180.0) / 360.0 * columns));
+        return ((c % columns) + columns) % columns;
+    }
+
+    quint64 CElevationCache::cellKey(int row, int column)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(row)) << 32) | static_cast<quint32>(column);
+    }
+
+    quint64 CElevationCache::cellKey(const ICoordinateGeodetic &coordinate)
+    {
+        const int r = row(coordinate.latitude().value(CAngleUnit::deg()));
+        return cellKey(r, column(r, coordinate.longitude().value(CAngleUnit::deg())));
+    }
+
+    int CElevationCache::shardIndex(quint64 cellKey) { return static_cast<int>(qHash(cellKey) % NumberOfShards); }
+
+    const CElevationCache::Cell *CElevationCache::findCell(const Grid &grid, quint64 cellKey)
+    {
+        const std::shared_ptr<const Shard> &shard = grid.shards[shardIndex(cellKey)];
+        if (!shard) { return nullptr; }
+        const auto it = shard->constFind(cellKey);
+        return it == shard->constEnd() ? nullptr : it->get();
+    }
+
+    template <typename Visitor>
+    void CElevationCache::forEachEntry(const Grid &grid, Visitor visitor)
+    {
+        for (const std::shared_ptr<const Shard> &shard : grid.shards)
+        {
+            if (!shard) { continue; }
+            for (const auto &cell : *shard)
+            {
+                for (const EntryPtr &entry : *cell) { visitor(*entry); }
+            }
+        }
+    }
+
+    template <typename Visitor>
+    void CElevationCache::forEachCandidate(const Grid &grid, const ICoordinateGeodetic &reference,
+                                           const CLength &range, Visitor visitor)
+    {
+        if (grid.cells < 1 || reference.isNull() || range.isNull()) { return; }
+
+        // latitude/longitude box around the range, with some margin
+        constexpr double metersPerDeg = 6371000.8 * M_PI / 180.0;
+        const double latitudeDeg = reference.latitude().value(CAngleUnit::deg());
+        const double longitudeDeg = reference.longitude().value(CAngleUnit::deg());
+        const double deltaLatitudeDeg = 1.01 * range.value(CLengthUnit::m()) / metersPerDeg + 1e-9;
+        const double maxAbsLatitudeDeg = qAbs(latitudeDeg) + deltaLatitudeDeg;
+        const double deltaLongitudeDeg =
+            maxAbsLatitudeDeg >= 89.9 ? 360.0 : deltaLatitudeDeg / std::cos(qDegreesToRadians(maxAbsLatitudeDeg));
+        const int rowMin = row(latitudeDeg - deltaLatitudeDeg);
+        const int rowMax = row(latitudeDeg + deltaLatitudeDeg);
+
+        // for large ranges scanning all cells is cheaper than looking up the cells in the box
+        const double cellsInBox = (rowMax - rowMin + 1.0) * (deltaLongitudeDeg / CellSizeDeg + 2.0);
+        if (cellsInBox > grid.cells)
+        {
+            forEachEntry(grid, visitor);
+            return;
+        }
+
+        for (int r = rowMin; r <= rowMax; r++)
+        {
+            const int columns = columnsInRow(r);
+            int first = static_cast<int>(std::floor((longitudeDeg - deltaLongitudeDeg + 180.0) / 360.0 * columns));
+            int last = static_cast<int>(std::floor((longitudeDeg + deltaLongitudeDeg + 180.0) / 360.0 * columns));
+            if (last - first + 1 >= columns)
+            {
+                first = 0;
+                last = columns - 1;
+            }
+            for (int c = first; c <= last; c++)
+            {
+                const Cell *cell = findCell(grid, cellKey(r, ((c % columns) + columns) % columns));
+                if (!cell) { continue; }
+                for (const EntryPtr &entry : *cell) { visitor(*entry); }
+            }
+        }
+    }
+
+    template <typename Predicate>
+    int CElevationCache::removeIf(Grid &grid, Predicate predicate)
+    {
+        const auto matches = [&](const Cell &cell) {
+            return std::any_of(cell.cbegin(), cell.cend(), [&](const EntryPtr &e) { return predicate(*e); });
+        };
+
+        int removed = 0;
+        for (std::shared_ptr<const Shard> &shard : grid.shards)
+        {
+            if (!shard || std::none_of(shard->cbegin(), shard->cend(), [&](const auto &c) { return matches(*c); }))
+            {
+                continue;
+            }
+
+            // only shards with matching entries are copied
+            auto changed = std::make_shared<Shard>(*shard);
+            for (auto it = changed->begin(); it != changed->end();)
+            {
+                if (!matches(**it))
+                {
+                    ++it;
+                    continue;
+                }
+                auto kept = std::make_shared<Cell>();
+                for (const EntryPtr &entry : **it)
+                {
+                    if (predicate(*entry)) { removed++; }
+                    else { kept->push_back(entry); }
+                }
+                if (kept->isEmpty())
+                {
+                    it = changed->erase(it);
+                    grid.cells--;
+                }
+                else
+                {
+                    it.value() = std::move(kept);
+                    ++it;
+                }
+            }
+            shard = changed->isEmpty() ? nullptr : std::move(changed);
+        }
+        grid.size -= removed;
+        return removed;
+    }
+
+    int CElevationCache::evictIfNeeded(Grid &grid) const
+    {
+        const int capacity = m_capacity;
+        if (grid.size <= capacity) { return 0; }
+
+        // evict down to 90% of the capacity, so this does not happen for every insert
+        const int keep = capacity - capacity / 10;
+        QVector<quint64> ticks;
+        ticks.reserve(grid.size);
+        forEachEntry(grid,
+                     [&](const Entry &entry) { ticks.push_back(entry.lastUsed.load(std::memory_order_relaxed)); });
+        const int evict = ticks.size() - keep;
+        std::nth_element(ticks.begin(), ticks.begin() + (evict - 1), ticks.end());
+        const quint64 oldestKept = ticks[evict - 1] + 1;
+        return removeIf(grid, [&](const Entry &entry) {
+            return entry.lastUsed.load(std::memory_order_relaxed) < oldestKept;
+        });
+    }
+
+    void CElevationCache::setCapacity(int capacity)
+    {
+        QMutexLocker lock(&m_writeMutex);
+        m_capacity = qMax(1, capacity);
+        if (m_grid.read()->size <= m_capacity) { return; }
+        auto writer = m_grid.uniqueWrite();
+        m_evicted += this->evictIfNeeded(writer.get());
+    }
+
+    int CElevationCache::size() const { return m_grid.read()->size; }
+
+    void CElevationCache::insert(const ICoordinateGeodetic &elevation)
+    {
+        if (elevation.isNull()) { return; }
+        const quint64 key = cellKey(elevation);
+        const EntryPtr entry = std::make_shared<const Entry>(elevation, this->tick());
+
+        QMutexLocker lock(&m_writeMutex);
+        auto writer = m_grid.uniqueWrite();
+        Grid &grid = writer.get();
+        std::shared_ptr<const Shard> &shard = grid.shards[shardIndex(key)];
+        auto changedShard = shard ? std::make_shared<Shard>(*shard) : std::make_shared<Shard>();
+        std::shared_ptr<const Cell> &cell = (*changedShard)[key];
+        if (!cell) { grid.cells++; }
+        auto changedCell = cell ? std::make_shared<Cell>(*cell) : std::make_shared<Cell>();
+        changedCell->push_back(entry);
+        cell = std::move(changedCell);
+        shard = std::move(changedShard);
+        grid.size++;
+        m_evicted += this->evictIfNeeded(grid);
+    }
+
+    CCoordinateGeodetic CElevationCache::findClosestWithinRange(const ICoordinateGeodetic &reference,
+                                                                const CLength &range) const
+    {
+        const auto grid = m_grid.read();
+        const Entry *closest = nullptr;
+        CLength closestDistance = CLength::null();
+        forEachCandidate(grid.get(), reference, range, [&](const Entry &entry) {
+            const CLength d = calculateGreatCircleDistance(entry.coordinate, reference);
+            if (d > range) { return; }
+            if (closestDistance.isNull() || closestDistance > d)
+            {
+                closestDistance = d;
+                closest = &entry;
+            }
+        });
+        if (!closest) { return {}; }
+        closest->lastUsed.store(this->tick(), std::memory_order_relaxed);
+        return closest->coordinate;
+    }
+
+    CCoordinateGeodeticList CElevationCache::findWithinRange(const ICoordinateGeodetic &reference,
+                                                             const CLength &range) const
+    {
+        CCoordinateGeodeticList within;
+        forEachCandidate(m_grid.read().get(), reference, range, [&](const Entry &entry) {
+            if (calculateGreatCircleDistance(entry.coordinate, reference) <= range)
+            {
+                within.push_back(entry.coordinate);
+            }
+        });
+        return within;
+    }
+
+    CCoordinateGeodeticList CElevationCache::getElevations() const
+    {
+        const auto grid = m_grid.read();
+        QVector<std::pair<quint64, const Entry *>> entries;
+        entries.reserve(grid->size);
+        forEachEntry(grid.get(), [&](const Entry &entry) {
+            entries.push_back({ entry.lastUsed.load(std::memory_order_relaxed), &entry });
+        });
+        std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+        CCoordinateGeodeticList elevations;
+        for (const auto &entry : entries) { elevations.push_back(entry.second->coordinate); }
+        return elevations;
+    }
+
+    int CElevationCache::removeInsideRange(const ICoordinateGeodetic &reference, const CLength &range)
+    {
+        QMutexLocker lock(&m_writeMutex);
+        auto writer = m_grid.uniqueWrite();
+        return removeIf(writer.get(), [&](const Entry &entry) {
+            return calculateGreatCircleDistance(entry.coordinate, reference) <= range;
+        });
+    }
+
+    int CElevationCache::removeOutsideRange(const ICoordinateGeodetic &reference, const CLength &range)
+    {
+        QMutexLocker lock(&m_writeMutex);
+        auto writer = m_grid.uniqueWrite();
+        return removeIf(writer.get(), [&](const Entry &entry) {
+            return calculateGreatCircleDistance(entry.coordinate, reference) > range;
+        });
+    }
+
+    int CElevationCache::keepClosest(const ICoordinateGeodetic &reference, int number)
+    {
+        QMutexLocker lock(&m_writeMutex);
+        if (m_grid.read()->size <= number) { return 0; }
+
+        auto writer = m_grid.uniqueWrite();
+        Grid &grid = writer.get();
+        if (number < 1) { return removeIf(grid, [](const Entry &) { return true; }); }
+
+        QVector<double> distances;
+        distances.reserve(grid.size);
+        forEachEntry(grid, [&](const Entry &entry) {
+            distances.push_back(calculateEuclideanDistanceSquared(entry.coordinate, reference));
+        });
+        std::nth_element(distances.begin(), distances.begin() + (number - 1), distances.end());
+        const double maxDistance = distances[number - 1];
+        return removeIf(grid, [&](const Entry &entry) {
+            return calculateEuclideanDistanceSquared(entry.coordinate, reference) > maxDistance;
+        });
+    }
+
+    void CElevationCache::clear()
+    {
+        QMutexLocker lock(&m_writeMutex);
+        m_grid.uniqueWrite() = Grid();
+    }
+
+} // namespace swift::misc::simulation
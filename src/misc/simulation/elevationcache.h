@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_ELEVATIONCACHE_H
+#define SWIFT_MISC_SIMULATION_ELEVATIONCACHE_H
+
+#include <atomic>
+#include <memory>
+
+#include <QHash>
+#include <QMutex>
+#include <QVector>
+
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/geo/coordinategeodeticlist.h"
+#include "misc/lockfree.h"
+#include "misc/pq/length.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation
+{
+    /*!
+     * Cache of ground elevations, bucketed in a grid of cells about 200m in size.
+     *
+     * A lookup only checks the cells overlapping the range. Reads are lock free, they work on the grid as it was
+     * when the lookup started. Writes are serialized, the cells are spread over shards and a write copies only
+     * the shards containing the cells it changes.
+     * Beyond the capacity the least recently inserted or found elevations are evicted, in batches of 10%.
+     */
+    class SWIFT_MISC_EXPORT CElevationCache
+    {
+    public:
+        //! Constructor
+        explicit CElevationCache(int capacity);
+
+        //! @{
+        //! Not copyable
+        CElevationCache(const CElevationCache &) = delete;
+        CElevationCache &operator=(const CElevationCache &) = delete;
+        //! @}
+
+        //! Max. number of elevations
+        //! \threadsafe
+        int getCapacity() const { return m_capacity; }
+
+        //! Set max. number of elevations, evicts if needed
+        //! \threadsafe
+        void setCapacity(int capacity);
+
+        //! Number of elevations
+        //! \threadsafe
+        int size() const;
+
+        //! Add an elevation
+        //! \threadsafe
+        void insert(const geo::ICoordinateGeodetic &elevation);
+
+        //! Closest elevation within range, NULL if there is none, found elevations count as used
+        //! \threadsafe
+        geo::CCoordinateGeodetic findClosestWithinRange(const geo::ICoordinateGeodetic &reference,
+                                                        const physical_quantities::CLength &range) const;
+
+        //! All elevations within range
+        //! \threadsafe
+        geo::CCoordinateGeodeticList findWithinRange(const geo::ICoordinateGeodetic &reference,
+                                                     const physical_quantities::CLength &range) const;
+
+        //! All elevations, most recently used first
+        //! \threadsafe
+        geo::CCoordinateGeodeticList getElevations() const;
+
+        //! Remove elevations inside range
+        //! \threadsafe
+        int removeInsideRange(const geo::ICoordinateGeodetic &reference, const physical_quantities::CLength &range);
+
+        //! Remove elevations outside range
+        //! \threadsafe
+        int removeOutsideRange(const geo::ICoordinateGeodetic &reference, const physical_quantities::CLength &range);
+
+        //! Only keep the closest elevations
+        //! \threadsafe
+        int keepClosest(const geo::ICoordinateGeodetic &reference, int number);
+
+        //! Remove all elevations
+        //! \threadsafe
+        void clear();
+
+        //! Number of elevations evicted because the capacity was exceeded
+        //! \threadsafe
+        qint64 getEvictedCount() const { return m_evicted; }
+
+        //! Reset statistics
+        //! \threadsafe
+        void resetStatistics() { m_evicted = 0; }
+
+    private:
+        //! Cached elevation, shared by all versions of the grid
+        struct Entry
+        {
+            //! Constructor
+            Entry(const geo::ICoordinateGeodetic &elevation, quint64 tick) : coordinate(elevation), lastUsed(tick) {}
+
+            const geo::CCoordinateGeodetic coordinate; //!< elevation
+            mutable std::atomic<quint64> lastUsed; //!< tick of insert or last lookup, for LRU eviction
+        };
+
+        using EntryPtr = std::shared_ptr<const Entry>; //!< entry
+        using Cell = QVector<EntryPtr>; //!< all entries of a cell
+        using Shard = QHash<quint64, std::shared_ptr<const Cell>>; //!< non empty cells by key
+
+        static constexpr int NumberOfShards = 64; //!< a write copies the shard of the changed cell only
+
+        //! All cells
+        struct Grid
+        {
+            QVector<std::shared_ptr<const Shard>> shards =
+                QVector<std::shared_ptr<const Shard>>(NumberOfShards); //!< nullptr for an empty shard
+            int cells = 0; //!< number of non empty cells
+            int size = 0; //!< number of entries
+        };
+
+        static constexpr double CellSizeDeg = 0.002; //!< cell height, width is about the same distance
+
+        //! @{
+        //! Cell coordinates
+        static int row(double latitudeDeg);
+        static int columnsInRow(int row);
+        static int column(int row, double longitudeDeg);
+        static quint64 cellKey(int row, int column);
+        static quint64 cellKey(const geo::ICoordinateGeodetic &coordinate);
+        static int shardIndex(quint64 cellKey);
+        //! @}
+
+        //! Cell for key, nullptr if empty
+        static const Cell *findCell(const Grid &grid, quint64 cellKey);
+
+        //! Call visitor for all entries
+        template <typename Visitor>
+        static void forEachEntry(const Grid &grid, Visitor visitor);
+
+        //! Call visitor for all entries in the cells overlapping the range
+        template <typename Visitor>
+        static void forEachCandidate(const Grid &grid, const geo::ICoordinateGeodetic &reference,
+                                     const physical_quantities::CLength &range, Visitor visitor);
+
+        //! Remove all entries matching the predicate
+        //! \remark writer lock has to be held
+        template <typename Predicate>
+        static int removeIf(Grid &grid, Predicate predicate);
+
+        //! Evict the least recently used entries if the capacity is exceeded
+        //! \remark writer lock has to be held
+        int evictIfNeeded(Grid &grid) const;
+
+        //! Next tick
+        quint64 tick() const { return m_tick.fetch_add(1, std::memory_order_relaxed); }
+
+        LockFree<Grid> m_grid;
+        QMutex m_writeMutex; //!< one writer at a time
+        std::atomic_int m_capacity;
+        mutable std::atomic<quint64> m_tick { 1 };
+        std::atomic<qint64> m_evicted { 0 };
+    };
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_ELEVATIONCACHE_H
@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/elevationrequestscheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QMutexLocker>
+#include <QStringBuilder>
+#include <QtMath>
+
+#include "misc/pq/units.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+
+namespace swift::misc::simulation
+{
+    CElevationRequestScheduler::CElevationRequestScheduler(int maxOutstanding, int maxPerFrame)
+        : m_maxOutstanding(qMax(1, maxOutstanding)), m_maxPerFrame(qMax(1, maxPerFrame))
+    {}
+
+    double CElevationRequestScheduler::rank(const CLength &distanceToOwnAircraft, bool onGround)
+    {
+        // unknown distances last, but still in the order of their ground flag
+        const double distanceM = distanceToOwnAircraft.isNull() ? 1.0e9 : distanceToOwnAircraft.value(CLengthUnit::m());
+        return onGround ? distanceM / 4.0 : distanceM;
+    }
+
+    quint64 CElevationRequestScheduler::cellKey(const ICoordinateGeodetic &position)
+    {
+        const double latitudeDeg = position.latitude().value(CAngleUnit::deg());
+        const double longitudeDeg = position.longitude().value(CAngleUnit::deg());
+        const int row = static_cast<int>(std::floor((latitudeDeg + 90.0) / CellSizeDeg));
+
+        // narrower columns towards the poles, so all cells have about the same width
+        const double rowLatitudeRad = qDegreesToRadians(-90.0 + (row + 0.5) * CellSizeDeg);
+        const int columns = qMax(1, static_cast<int>(360.0 * std::cos(rowLatitudeRad) / CellSizeDeg));
+        const int column = static_cast<int>(std::floor((longitudeDeg + 180.0) / 360.0 * columns)) % columns;
+        return (static_cast<quint64>(static_cast<quint32>(row)) << 32) | static_cast<quint32>(column);
+    }
+
+    bool CElevationRequestScheduler::enqueue(const ICoordinateGeodetic &position, const CCallsign &callsign,
+                                             double rank, qint64 nowMs)
+    {
+        if (position.isNull() || callsign.isEmpty()) { return false; }
+        const quint64 cell = cellKey(position);
+
+        QMutexLocker lock(&m_mutex);
+        this->removeStaleWaiter(callsign, cell);
+        for (Outstanding &outstanding : m_outstanding)
+        {
+            if (outstanding.cell != cell) { continue; }
+            outstanding.waiters.insert(callsign);
+            m_coalesced++;
+            return false;
+        }
+        for (Queued &queued : m_queued)
+        {
+            if (queued.cell != cell) { continue; }
+            if (queued.waiters.contains(callsign)) { queued.probe.position = position; }
+            else { m_coalesced++; }
+            queued.waiters.insert(callsign);
+            queued.rank = qMin(queued.rank, rank);
+            return false;
+        }
+
+        Queued queued;
+        queued.probe = { position, callsign };
+        queued.waiters.insert(callsign);
+        queued.cell = cell;
+        queued.rank = rank;
+        queued.queuedMs = nowMs;
+        m_queued.push_back(std::move(queued));
+        return true;
+    }
+
+    void CElevationRequestScheduler::removeStaleWaiter(const CCallsign &callsign, quint64 cell)
+    {
+        for (int i = 0; i < m_queued.size(); i++)
+        {
+            Queued &queued = m_queued[i];
+            if (queued.cell == cell || !queued.waiters.contains(callsign)) { continue; }
+            queued.waiters.remove(callsign);
+            if (queued.waiters.isEmpty()) { m_queued.remove(i); }
+            else if (queued.probe.callsign == callsign) { queued.probe.callsign = *queued.waiters.begin(); }
+            return;
+        }
+    }
+
+    void CElevationRequestScheduler::beginFrame(qint64 nowMs)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_sentThisFrame = 0;
+        m_frameStartMs = nowMs;
+    }
+
+    QVector<CElevationRequestScheduler::Probe> CElevationRequestScheduler::takeProbes(qint64 nowMs)
+    {
+        QMutexLocker lock(&m_mutex);
+        if (nowMs - m_frameStartMs >= MaxFrameMs)
+        {
+            m_sentThisFrame = 0;
+            m_frameStartMs = nowMs;
+        }
+
+        QVector<Probe> probes;
+        const int outstanding = static_cast<int>(m_outstanding.size());
+        int available = qMin(m_maxPerFrame - m_sentThisFrame, m_maxOutstanding - outstanding);
+        if (available < 1 || m_queued.isEmpty()) { return probes; }
+
+        std::stable_sort(m_queued.begin(), m_queued.end(),
+                         [](const Queued &a, const Queued &b) { return a.rank < b.rank; });
+        for (int i = 0; i < m_queued.size() && available > 0;)
+        {
+            Queued &queued = m_queued[i];
+
+            // the answer is matched by callsign, so one probe per callsign at a time
+            if (m_outstanding.contains(queued.probe.callsign))
+            {
+                i++;
+                continue;
+            }
+
+            m_queueLatency.record(qMax(0LL, nowMs - queued.queuedMs) * 1000 * 1000);
+            m_outstanding.insert(queued.probe.callsign, { std::move(queued.waiters), queued.cell, nowMs });
+            probes.push_back(std::move(queued.probe));
+            m_queued.remove(i);
+            available--;
+        }
+        m_sentThisFrame += static_cast<int>(probes.size());
+        return probes;
+    }
+
+    CCallsignSet CElevationRequestScheduler::completed(const CCallsign &probeCallsign, qint64 nowMs)
+    {
+        QMutexLocker lock(&m_mutex);
+        const auto it = m_outstanding.find(probeCallsign);
+        if (it == m_outstanding.end()) { return {}; }
+        m_responseLatency.record(qMax(0LL, nowMs - it->sentMs) * 1000 * 1000);
+        CCallsignSet waiters = std::move(it->waiters);
+        m_outstanding.erase(it);
+        return waiters;
+    }
+
+    void CElevationRequestScheduler::failed(const CCallsign &probeCallsign)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_outstanding.remove(probeCallsign);
+    }
+
+    int CElevationRequestScheduler::expire(qint64 nowMs, qint64 timeoutMs)
+    {
+        QMutexLocker lock(&m_mutex);
+        int expired = 0;
+        for (auto it = m_outstanding.begin(); it != m_outstanding.end();)
+        {
+            if (nowMs - it->sentMs < timeoutMs)
+            {
+                ++it;
+                continue;
+            }
+            it = m_outstanding.erase(it);
+            expired++;
+        }
+        m_expired += expired;
+        return expired;
+    }
+
+    void CElevationRequestScheduler::clear()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_queued.clear();
+        m_outstanding.clear();
+        m_sentThisFrame = 0;
+    }
+
+    int CElevationRequestScheduler::getMaxOutstanding() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_maxOutstanding;
+    }
+
+    int CElevationRequestScheduler::getMaxPerFrame() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_maxPerFrame;
+    }
+
+    void CElevationRequestScheduler::setLimits(int maxOutstanding, int maxPerFrame)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_maxOutstanding = qMax(1, maxOutstanding);
+        m_maxPerFrame = qMax(1, maxPerFrame);
+    }
+
+    bool CElevationRequestScheduler::isWaiting(const CCallsign &callsign) const
+    {
+        QMutexLocker lock(&m_mutex);
+        for (const Queued &queued : m_queued)
+        {
+            if (queued.waiters.contains(callsign)) { return true; }
+        }
+        for (const Outstanding &outstanding : m_outstanding)
+        {
+            if (outstanding.waiters.contains(callsign)) { return true; }
+        }
+        return false;
+    }
+
+    int CElevationRequestScheduler::getQueuedCount() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return static_cast<int>(m_queued.size());
+    }
+
+    int CElevationRequestScheduler::getOutstandingCount() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return static_cast<int>(m_outstanding.size());
+    }
+
+    qint64 CElevationRequestScheduler::getCoalescedCount() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_coalesced;
+    }
+
+    qint64 CElevationRequestScheduler::getExpiredCount() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_expired;
+    }
+
+    CLatencyHistogram CElevationRequestScheduler::getQueueLatency() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_queueLatency;
+    }
+
+    CLatencyHistogram CElevationRequestScheduler::getResponseLatency() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_responseLatency;
+    }
+
+    void CElevationRequestScheduler::resetStatistics()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_coalesced = 0;
+        m_expired = 0;
+        m_queueLatency.reset();
+        m_responseLatency.reset();
+    }
+
+    QString CElevationRequestScheduler::getStatistics() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return u"queued: " % QString::number(m_queued.size()) % u" outstanding: " %
+               QString::number(m_outstanding.size()) % u" coalesced: " % QString::number(m_coalesced) %
+               u" expired: " % QString::number(m_expired) % u"\nqueue: " % m_queueLatency.toQString() %
+               u"\nresponse: " % m_responseLatency.toQString();
+    }
+} // namespace swift::misc::simulation
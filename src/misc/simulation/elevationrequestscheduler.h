@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_ELEVATIONREQUESTSCHEDULER_H
+#define SWIFT_MISC_SIMULATION_ELEVATIONREQUESTSCHEDULER_H
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignset.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/latencyhistogram.h"
+#include "misc/pq/length.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation
+{
+    /*!
+     * Queue of ground elevation requests waiting to be probed in the simulator.
+     *
+     * Requests for positions in the same cell (about 50m) are coalesced into one probe, the answer is handed to all
+     * callsigns waiting for it. Probes are sent in the order of their rank, and only as many per frame and in total
+     * as the simulator can answer without falling behind.
+     * \remark time is passed in by the caller, so the scheduler can be driven by tests
+     */
+    class SWIFT_MISC_EXPORT CElevationRequestScheduler
+    {
+    public:
+        //! Probe to be sent to the simulator
+        struct Probe
+        {
+            geo::CCoordinateGeodetic position; //!< position to be probed
+            aviation::CCallsign callsign; //!< the answer is expected for this callsign
+        };
+
+        static constexpr int DefaultMaxOutstanding = 8; //!< probes sent, but not yet answered
+        static constexpr int DefaultMaxPerFrame = 4; //!< probes sent per frame
+        static constexpr qint64 DefaultTimeoutMs = 5000; //!< probes not answered within are given up
+        static constexpr qint64 MaxFrameMs = 250; //!< without frames, a new frame budget is granted after this time
+
+        //! Constructor
+        explicit CElevationRequestScheduler(int maxOutstanding = DefaultMaxOutstanding,
+                                            int maxPerFrame = DefaultMaxPerFrame);
+
+        //! @{
+        //! Not copyable
+        CElevationRequestScheduler(const CElevationRequestScheduler &) = delete;
+        CElevationRequestScheduler &operator=(const CElevationRequestScheduler &) = delete;
+        //! @}
+
+        //! Rank of a request, lower ranks are probed first
+        //! \remark aircraft on ground count as 4 times closer, they need the elevation to be rendered correctly
+        static double rank(const physical_quantities::CLength &distanceToOwnAircraft, bool onGround);
+
+        //! Queue a request
+        //! \return false if coalesced with a request queued or outstanding for the same cell
+        //! \threadsafe
+        bool enqueue(const geo::ICoordinateGeodetic &position, const aviation::CCallsign &callsign, double rank,
+                     qint64 nowMs);
+
+        //! A new frame starts, resets the number of probes which can be sent per frame
+        //! \threadsafe
+        void beginFrame(qint64 nowMs);
+
+        //! Take the probes to be sent now, best rank first, they count as outstanding until answered
+        //! \threadsafe
+        QVector<Probe> takeProbes(qint64 nowMs);
+
+        //! A probe has been answered
+        //! \return all callsigns waiting for the answer, empty if the probe is unknown (e.g. expired)
+        //! \threadsafe
+        aviation::CCallsignSet completed(const aviation::CCallsign &probeCallsign, qint64 nowMs);
+
+        //! A probe could not be sent, the waiting callsigns have to request again
+        //! \threadsafe
+        void failed(const aviation::CCallsign &probeCallsign);
+
+        //! Give up outstanding probes older than the timeout, frees their slots
+        //! \return number of probes given up
+        //! \threadsafe
+        int expire(qint64 nowMs, qint64 timeoutMs = DefaultTimeoutMs);
+
+        //! Remove all queued and outstanding requests
+        //! \threadsafe
+        void clear();
+
+        //! @{
+        //! Limits
+        //! \threadsafe
+        int getMaxOutstanding() const;
+        int getMaxPerFrame() const;
+        void setLimits(int maxOutstanding, int maxPerFrame);
+        //! @}
+
+        //! Is the callsign waiting for a queued or outstanding probe?
+        //! \threadsafe
+        bool isWaiting(const aviation::CCallsign &callsign) const;
+
+        //! Number of queued probes
+        //! \threadsafe
+        int getQueuedCount() const;
+
+        //! Number of outstanding probes
+        //! \threadsafe
+        int getOutstandingCount() const;
+
+        //! Number of requests coalesced with another one
+        //! \threadsafe
+        qint64 getCoalescedCount() const;
+
+        //! Number of probes given up
+        //! \threadsafe
+        qint64 getExpiredCount() const;
+
+        //! Time from queueing a probe until it was sent
+        //! \threadsafe
+        CLatencyHistogram getQueueLatency() const;
+
+        //! Time from sending a probe until it was answered
+        //! \threadsafe
+        CLatencyHistogram getResponseLatency() const;
+
+        //! Reset statistics
+        //! \threadsafe
+        void resetStatistics();
+
+        //! Statistics as string
+        //! \threadsafe
+        QString getStatistics() const;
+
+        //! Cell of a position, requests in the same cell are coalesced
+        static quint64 cellKey(const geo::ICoordinateGeodetic &position);
+
+    private:
+        //! Probe waiting to be sent
+        struct Queued
+        {
+            Probe probe; //!< the probe
+            aviation::CCallsignSet waiters; //!< callsigns waiting for the answer, including the probe callsign
+            quint64 cell = 0; //!< cell of the position
+            double rank = 0.0; //!< best rank of the waiters
+            qint64 queuedMs = 0; //!< when the first request was queued
+        };
+
+        //! Probe sent
+        struct Outstanding
+        {
+            aviation::CCallsignSet waiters; //!< callsigns waiting for the answer, including the probe callsign
+            quint64 cell = 0; //!< cell of the position
+            qint64 sentMs = 0; //!< when sent
+        };
+
+        static constexpr double CellSizeDeg = 0.0005; //!< cell height, width is about the same distance
+
+        //! Remove a callsign waiting in another cell, its position has changed
+        //! \remark lock has to be held
+        void removeStaleWaiter(const aviation::CCallsign &callsign, quint64 cell);
+
+        mutable QMutex m_mutex;
+        int m_maxOutstanding;
+        int m_maxPerFrame;
+        int m_sentThisFrame = 0;
+        qint64 m_frameStartMs = 0;
+        QVector<Queued> m_queued; //!< small, probes leave the queue within a few frames
+        QHash<aviation::CCallsign, Outstanding> m_outstanding; //!< by probe callsign
+        qint64 m_coalesced = 0;
+        qint64 m_expired = 0;
+        CLatencyHistogram m_queueLatency;
+        CLatencyHistogram m_responseLatency;
+    };
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_ELEVATIONREQUESTSCHEDULER_H
@@ -3,9 +3,12 @@
 
 #include "misc/simulation/flightgear/aircraftmodelloaderflightgear.h"
 
-#include <QDirIterator>
+#include <QVector>
 
+#include "misc/fileutils.h"
 #include "misc/simulation/aircraftmodel.h"
+#include "misc/simulation/modeldirectoryscanner.h"
+
 namespace swift::misc::simulation::flightgear
 {
 
@@ -36,68 +39,61 @@ namespace swift::misc::simulation::flightgear
     CAircraftModelList CAircraftModelLoaderFlightgear::parseFlyableAirplanes(const QString &rootDirectory,
                                                                              const QStringList &excludeDirectories)
     {
-        Q_UNUSED(excludeDirectories);
         if (rootDirectory.isEmpty()) { return {}; }
-        CAircraftModelList installedModels;
 
-        QDir searchPath(rootDirectory);
-        searchPath.setNameFilters(QStringList() << "*-set.xml");
-        QDirIterator aircraftIt(searchPath, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
-
-        while (aircraftIt.hasNext())
-        {
-            aircraftIt.next();
-            if (CFileUtils::isExcludedDirectory(aircraftIt.fileInfo(), excludeDirectories, Qt::CaseInsensitive))
-            {
-                continue;
-            }
-            if (aircraftIt.filePath().contains("/AI/Aircraft")) { continue; }
-            CAircraftModel model;
-            QString modelName = aircraftIt.fileName();
-            modelName = modelName.remove("-set.xml");
-            model.setName(modelName);
-            model.setModelString(getModelString(aircraftIt.fileName(), false));
-            model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
-            model.setSimulator(CSimulatorInfo::fg());
-            model.setFileDetailsAndTimestamp(aircraftIt.fileInfo());
-            model.setModelMode(CAircraftModel::Exclude);
-            addUniqueModel(model, installedModels);
-        }
+        CModelDirectoryScanner scanner(m_cancelLoading);
+        scanner.setNameFilters(QStringList() << "*-set.xml");
+        scanner.setDirectoryFilter([&excludeDirectories](const QString &dir) {
+            if (dir.contains("/AI/Aircraft")) { return false; }
+            return !CFileUtils::isExcludedDirectory(dir, excludeDirectories, Qt::CaseInsensitive);
+        });
+
+        const QVector<CAircraftModel> models =
+            scanner.scan<CAircraftModel>(rootDirectory, [this](const QFileInfo &fileInfo) {
+                CAircraftModel model;
+                QString modelName = fileInfo.fileName();
+                modelName = modelName.remove("-set.xml");
+                model.setName(modelName);
+                model.setModelString(getModelString(fileInfo.fileName(), false));
+                model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
+                model.setSimulator(CSimulatorInfo::fg());
+                model.setFileDetailsAndTimestamp(fileInfo);
+                model.setModelMode(CAircraftModel::Exclude);
+                return model;
+            });
 
+        CAircraftModelList installedModels;
+        for (const CAircraftModel &model : models) { addUniqueModel(model, installedModels); }
         return installedModels;
     }
 
     CAircraftModelList CAircraftModelLoaderFlightgear::parseAIAirplanes(const QString &rootDirectory,
                                                                         const QStringList &excludeDirectories)
     {
-        Q_UNUSED(excludeDirectories);
         if (rootDirectory.isEmpty()) { return {}; }
 
-        CAircraftModelList installedModels;
-
-        QDir searchPath(rootDirectory);
-        searchPath.setNameFilters(QStringList() << "*.xml");
-        QDirIterator aircraftIt(searchPath, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
-
-        while (aircraftIt.hasNext())
-        {
-            aircraftIt.next();
-            if (CFileUtils::isExcludedDirectory(aircraftIt.fileInfo(), excludeDirectories, Qt::CaseInsensitive))
-            {
-                continue;
-            }
-            CAircraftModel model;
-            QString modelName = aircraftIt.fileName();
-            modelName = modelName.remove(".xml");
-            model.setName(modelName);
-            model.setModelString(getModelString(aircraftIt.filePath(), true));
-            model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
-            model.setSimulator(CSimulatorInfo::fg());
-            model.setFileDetailsAndTimestamp(aircraftIt.fileInfo());
-            model.setModelMode(CAircraftModel::Include);
-            addUniqueModel(model, installedModels);
-        }
+        CModelDirectoryScanner scanner(m_cancelLoading);
+        scanner.setNameFilters(QStringList() << "*.xml");
+        scanner.setDirectoryFilter([&excludeDirectories](const QString &dir) {
+            return !CFileUtils::isExcludedDirectory(dir, excludeDirectories, Qt::CaseInsensitive);
+        });
+
+        const QVector<CAircraftModel> models =
+            scanner.scan<CAircraftModel>(rootDirectory, [this](const QFileInfo &fileInfo) {
+                CAircraftModel model;
+                QString modelName = fileInfo.fileName();
+                modelName = modelName.remove(".xml");
+                model.setName(modelName);
+                model.setModelString(getModelString(fileInfo.filePath(), true));
+                model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
+                model.setSimulator(CSimulatorInfo::fg());
+                model.setFileDetailsAndTimestamp(fileInfo);
+                model.setModelMode(CAircraftModel::Include);
+                return model;
+            });
 
+        CAircraftModelList installedModels;
+        for (const CAircraftModel &model : models) { addUniqueModel(model, installedModels); }
         return installedModels;
     }
 
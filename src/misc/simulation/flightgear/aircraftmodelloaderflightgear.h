@@ -34,6 +34,7 @@ namespace swift::misc::simulation::flightgear
                                   const QStringList &modelDirectories) override;
 
     private:
+        //! \threadsafe
         QString getModelString(const QString &filePath, bool ai);
         CAircraftModelList parseFlyableAirplanes(const QString &rootDirectory, const QStringList &excludeDirectories);
         CAircraftModelList parseAIAirplanes(const QString &rootDirectory, const QStringList &excludeDirectories);
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/fscommon/aircraftcfgfingerprints.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include "misc/fileutils.h"
+#include "misc/simulation/simulatorinfo.h"
+#include "misc/swiftdirectories.h"
+
+namespace swift::misc::simulation::fscommon
+{
+    const CAircraftCfgFingerprintIndex::Fingerprint *
+    CAircraftCfgFingerprintIndex::find(const QString &fileName) const
+    {
+        const auto it = m_fingerprints.constFind(fileNameKey(fileName));
+        return it == m_fingerprints.constEnd() ? nullptr : &it.value();
+    }
+
+    bool CAircraftCfgFingerprintIndex::findUnchanged(const QFileInfo &fileInfo, CAircraftCfgEntriesList &entries) const
+    {
+        const Fingerprint *fp = this->find(fileInfo.absoluteFilePath());
+        if (!fp) { return false; }
+        if (fp->size != fileInfo.size()) { return false; }
+        if (fp->lastModifiedMs != fileInfo.lastModified().toMSecsSinceEpoch()) { return false; }
+        entries = fp->entries;
+        return true;
+    }
+
+    bool CAircraftCfgFingerprintIndex::findByHash(const QString &fileName, const QByteArray &hash,
+                                                  CAircraftCfgEntriesList &entries) const
+    {
+        const Fingerprint *fp = this->find(fileName);
+        if (!fp || hash.isEmpty() || fp->hash != hash) { return false; }
+        entries = fp->entries;
+        return true;
+    }
+
+    void CAircraftCfgFingerprintIndex::insert(const QString &fileName, const Fingerprint &fingerprint)
+    {
+        m_fingerprints.insert(fileNameKey(fileName), fingerprint);
+    }
+
+    void CAircraftCfgFingerprintIndex::clear()
+    {
+        m_fingerprints.clear();
+        m_reused = 0;
+        m_parsed = 0;
+    }
+
+    CAircraftCfgEntriesList CAircraftCfgFingerprintIndex::getAllEntries() const
+    {
+        CAircraftCfgEntriesList entries;
+        for (const Fingerprint &fp : m_fingerprints) { entries.push_back(fp.entries); }
+        return entries;
+    }
+
+    QJsonObject CAircraftCfgFingerprintIndex::toJson() const
+    {
+        QJsonArray files;
+        for (auto it = m_fingerprints.cbegin(); it != m_fingerprints.cend(); ++it)
+        {
+            const Fingerprint &fp = it.value();
+            QJsonObject file;
+            file.insert("file", it.key());
+            file.insert("size", fp.size);
+            file.insert("mtime", fp.lastModifiedMs);
+            file.insert("hash", QString::fromLatin1(fp.hash.toHex()));
+            file.insert("entries", fp.entries.toJson());
+            files.push_back(file);
+        }
+        QJsonObject json;
+        json.insert("files", files);
+        return json;
+    }
+
+    void CAircraftCfgFingerprintIndex::convertFromJson(const QJsonObject &json)
+    {
+        this->clear();
+        const QJsonArray files = json.value("files").toArray();
+        for (const QJsonValue &value : files)
+        {
+            const QJsonObject file = value.toObject();
+            const QString fileName = file.value("file").toString();
+            if (fileName.isEmpty()) { continue; }
+            Fingerprint fp;
+            fp.size = file.value("size").toInteger(-1);
+            fp.lastModifiedMs = file.value("mtime").toInteger(-1);
+            fp.hash = QByteArray::fromHex(file.value("hash").toString().toLatin1());
+            fp.entries.convertFromJson(file.value("entries").toObject());
+            m_fingerprints.insert(fileName, fp);
+        }
+    }
+
+    bool CAircraftCfgFingerprintIndex::loadFromFile(const QString &fileName)
+    {
+        this->clear();
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly)) { return false; }
+        const QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+        if (!doc.isObject()) { return false; }
+        this->convertFromJson(doc.object());
+        return true;
+    }
+
+    bool CAircraftCfgFingerprintIndex::saveToFile(const QString &fileName) const
+    {
+        if (fileName.isEmpty()) { return false; }
+        const QFileInfo fi(fileName);
+        if (!QDir().mkpath(fi.absolutePath())) { return false; }
+        return CFileUtils::writeByteArrayToFile(QJsonDocument(this->toJson()).toJson(QJsonDocument::Compact),
+                                                fileName);
+    }
+
+    QByteArray CAircraftCfgFingerprintIndex::contentHash(const QByteArray &content)
+    {
+        return QCryptographicHash::hash(content, QCryptographicHash::Md5);
+    }
+
+    QString CAircraftCfgFingerprintIndex::defaultIndexFileName(const CSimulatorInfo &simulator)
+    {
+        static const QString dir =
+            CFileUtils::appendFilePaths(CSwiftDirectories::normalizedApplicationDataDirectory(), "modelindex");
+        return CFileUtils::appendFilePaths(dir, "aircraftcfg_" + simulator.toQString().toLower() + ".json");
+    }
+
+    QString CAircraftCfgFingerprintIndex::fileNameKey(const QString &fileName)
+    {
+        return CFileUtils::isFileNameCaseSensitive() ? fileName : fileName.toLower();
+    }
+} // namespace swift::misc::simulation::fscommon
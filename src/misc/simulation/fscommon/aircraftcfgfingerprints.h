@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_FSCOMMON_AIRCRAFTCFGFINGERPRINTS_H
+#define SWIFT_MISC_SIMULATION_FSCOMMON_AIRCRAFTCFGFINGERPRINTS_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QString>
+
+#include "misc/simulation/fscommon/aircraftcfgentrieslist.h"
+#include "misc/swiftmiscexport.h"
+
+class QFileInfo;
+
+namespace swift::misc::simulation
+{
+    class CSimulatorInfo;
+
+    namespace fscommon
+    {
+        /*!
+         * Persistent index of the already parsed aircraft.cfg/sim.cfg files.
+         *
+         * For every file path the size, the modification time, a content hash and the parsed entries are kept.
+         * A reload only needs to re-parse files which have been added or changed, files not visited anymore
+         * are dropped when the index is rebuilt.
+         * \remark not threadsafe, an index is owned by one parsing run at a time
+         */
+        class SWIFT_MISC_EXPORT CAircraftCfgFingerprintIndex
+        {
+        public:
+            //! Fingerprint of a single file
+            struct Fingerprint
+            {
+                qint64 size = -1; //!< file size in bytes
+                qint64 lastModifiedMs = -1; //!< modification time, ms since epoch
+                QByteArray hash; //!< content hash
+                CAircraftCfgEntriesList entries; //!< entries parsed from the file
+            };
+
+            //! Default constructor
+            CAircraftCfgFingerprintIndex() = default;
+
+            //! Fingerprint for file, nullptr if not indexed
+            const Fingerprint *find(const QString &fileName) const;
+
+            //! Entries of file if size and modification time are unchanged
+            //! \remark cheap check, no file content is read
+            bool findUnchanged(const QFileInfo &fileInfo, CAircraftCfgEntriesList &entries) const;
+
+            //! Entries of file if the content hash is unchanged (e.g. file only touched)
+            bool findByHash(const QString &fileName, const QByteArray &hash, CAircraftCfgEntriesList &entries) const;
+
+            //! Add or replace fingerprint
+            void insert(const QString &fileName, const Fingerprint &fingerprint);
+
+            //! Number of indexed files
+            int size() const { return m_fingerprints.size(); }
+
+            //! Empty index?
+            bool isEmpty() const { return m_fingerprints.isEmpty(); }
+
+            //! Clear index and counters
+            void clear();
+
+            //! All entries of all indexed files
+            CAircraftCfgEntriesList getAllEntries() const;
+
+            //! \name Statistics of the parsing run building this index
+            //! @{
+            int getReusedCount() const { return m_reused; }
+            int getParsedCount() const { return m_parsed; }
+            void countReused() { m_reused++; }
+            void countParsed() { m_parsed++; }
+            //! @}
+
+            //! To JSON
+            QJsonObject toJson() const;
+
+            //! From JSON
+            void convertFromJson(const QJsonObject &json);
+
+            //! Load from file
+            bool loadFromFile(const QString &fileName);
+
+            //! Save to file
+            bool saveToFile(const QString &fileName) const;
+
+            //! Hash of file content
+            static QByteArray contentHash(const QByteArray &content);
+
+            //! Default file name of the persisted index for given simulator
+            static QString defaultIndexFileName(const CSimulatorInfo &simulator);
+
+            //! Key used for file name, case insensitive on Windows
+            static QString fileNameKey(const QString &fileName);
+
+        private:
+            QHash<QString, Fingerprint> m_fingerprints; //!< fingerprints by file name key
+            int m_reused = 0; //!< entries reused from previous index
+            int m_parsed = 0; //!< files parsed
+        };
+    } // namespace fscommon
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_FSCOMMON_AIRCRAFTCFGFINGERPRINTS_H
@@ -18,6 +18,7 @@
 #include <QSettings>
 #include <QStringView>
 #include <QTextStream>
+#include <QVector>
 #include <Qt>
 #include <QtGlobal>
 
@@ -26,6 +27,7 @@
 #include "misc/logmessage.h"
 #include "misc/simulation/fscommon/aircraftcfgentries.h"
 #include "misc/simulation/fscommon/fsdirectories.h"
+#include "misc/simulation/modeldirectoryscanner.h"
 #include "misc/statusmessagelist.h"
 #include "misc/stringutils.h"
 #include "misc/worker.h"
@@ -39,10 +41,12 @@ using namespace swift::misc::network;
 namespace swift::misc::simulation::fscommon
 {
     // response for async. loading
-    using LoaderResponse = std::tuple<CAircraftCfgEntriesList, CAircraftModelList, CStatusMessageList>;
+    using LoaderResponse = std::tuple<CAircraftCfgEntriesList, CAircraftModelList, CStatusMessageList,
+                                      CAircraftCfgFingerprintIndex>;
 
     CAircraftCfgParser::CAircraftCfgParser(const CSimulatorInfo &simInfo, QObject *parent)
-        : IAircraftModelLoader(simInfo, parent)
+        : IAircraftModelLoader(simInfo, parent),
+          m_fingerprintIndexFileName(CAircraftCfgFingerprintIndex::defaultIndexFileName(simInfo))
     {}
 
     CAircraftCfgParser *CAircraftCfgParser::createModelLoader(const CSimulatorInfo &simInfo, QObject *parent)
@@ -68,47 +72,66 @@ namespace swift::misc::simulation::fscommon
         const QStringList modelDirs = this->getInitializedModelDirectories(modelDirectories, simulator);
         const QStringList excludedDirectoryPatterns(
             m_settings.getModelExcludeDirectoryPatternsOrDefault(simulator)); // copy
+        const QString indexFileName = m_fingerprintIndexFileName;
 
         if (mode.testFlag(LoadInBackground))
         {
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
-            m_parserWorker =
-                CWorker::fromTask(this, "CAircraftCfgParser::startLoadingFromDisk",
-                                  [this, modelDirs, excludedDirectoryPatterns, simulator, modelConsolidation]() {
-                                      CStatusMessageList msgs;
-                                      const CAircraftCfgEntriesList aircraftCfgEntriesList =
-                                          this->performParsing(modelDirs, excludedDirectoryPatterns, msgs);
-                                      CAircraftModelList models;
-                                      if (msgs.isSuccess())
-                                      {
-                                          models = aircraftCfgEntriesList.toAircraftModelList(simulator, true, msgs);
-                                          if (modelConsolidation) { modelConsolidation(models, true); }
-                                      }
-                                      return std::make_tuple(aircraftCfgEntriesList, models, msgs);
-                                  });
+            const CAircraftCfgFingerprintIndex inMemoryFingerprints = m_fingerprints; // implicitly shared copy
+            m_parserWorker = CWorker::fromTask(
+                this, "CAircraftCfgParser::startLoadingFromDisk",
+                [this, mode, modelDirs, excludedDirectoryPatterns, simulator, modelConsolidation, indexFileName,
+                 inMemoryFingerprints]() {
+                    CStatusMessageList msgs;
+                    const CAircraftCfgFingerprintIndex previous =
+                        previousFingerprints(mode, inMemoryFingerprints, indexFileName);
+                    CAircraftCfgFingerprintIndex current;
+                    const CAircraftCfgEntriesList aircraftCfgEntriesList =
+                        this->performParsing(modelDirs, excludedDirectoryPatterns, previous, current, msgs);
+                    CAircraftModelList models;
+                    if (msgs.isSuccess() && !m_cancelLoading)
+                    {
+                        models = aircraftCfgEntriesList.toAircraftModelList(simulator, true, msgs);
+                        if (modelConsolidation) { modelConsolidation(models, true); }
+                        if (!indexFileName.isEmpty()) { current.saveToFile(indexFileName); }
+                    }
+                    return std::make_tuple(aircraftCfgEntriesList, models, msgs, current);
+                });
             m_parserWorker->thenWithResult<LoaderResponse>(this, [this, simulator](const LoaderResponse &tuple) {
                 m_loadingMessages = std::get<2>(tuple);
                 if (m_loadingMessages.isSuccess())
                 {
                     m_parsedCfgEntriesList = std::get<0>(tuple);
+                    m_fingerprints = std::get<3>(tuple);
                     const CAircraftModelList models(std::get<1>(tuple));
                     const bool hasData = !models.isEmpty();
                     if (hasData) { this->setModelsForSimulator(models, this->getSimulator()); }
                     // currently I treat no data as error
                     m_loadingMessages.push_front(hasData ? statusLoadingOk : statusLoadingError);
+                    m_loadingMessages.push_back(CStatusMessage(this).info(u"Parsed %1 cfg files, reused %2 unchanged")
+                                                << m_fingerprints.getParsedCount()
+                                                << m_fingerprints.getReusedCount());
                 }
                 m_loadingMessages.freezeOrder();
                 emit this->loadingFinished(m_loadingMessages, simulator, ParsedData);
             });
         }
-        else if (mode == LoadDirectly)
+        else if (mode.testFlag(LoadDirectly))
         {
             emit this->diskLoadingStarted(simulator, mode);
 
             CStatusMessageList msgs;
-            m_parsedCfgEntriesList = this->performParsing(modelDirs, excludedDirectoryPatterns, msgs);
+            const CAircraftCfgFingerprintIndex previous = previousFingerprints(mode, m_fingerprints, indexFileName);
+            CAircraftCfgFingerprintIndex current;
+            m_parsedCfgEntriesList =
+                this->performParsing(modelDirs, excludedDirectoryPatterns, previous, current, msgs);
             const CAircraftModelList models(m_parsedCfgEntriesList.toAircraftModelList(simulator, true, msgs));
+            if (msgs.isSuccess())
+            {
+                m_fingerprints = current;
+                if (!indexFileName.isEmpty()) { m_fingerprints.saveToFile(indexFileName); }
+            }
             m_loadingMessages = msgs;
             m_loadingMessages.freezeOrder();
             const bool hasData = !models.isEmpty();
@@ -122,18 +145,22 @@ namespace swift::misc::simulation::fscommon
 
     CAircraftCfgEntriesList CAircraftCfgParser::performParsing(const QStringList &directories,
                                                                const QStringList &excludeDirectories,
+                                                               const CAircraftCfgFingerprintIndex &previous,
+                                                               CAircraftCfgFingerprintIndex &current,
                                                                CStatusMessageList &messages)
     {
         CAircraftCfgEntriesList entries;
         for (const QString &dir : directories)
         {
-            entries.push_back(this->performParsing(dir, excludeDirectories, messages));
+            entries.push_back(this->performParsing(dir, excludeDirectories, previous, current, messages));
         }
         return entries;
     }
 
     CAircraftCfgEntriesList CAircraftCfgParser::performParsing(const QString &directory,
                                                                const QStringList &excludeDirectories,
+                                                               const CAircraftCfgFingerprintIndex &previous,
+                                                               CAircraftCfgFingerprintIndex &current,
                                                                CStatusMessageList &messages)
     {
         //
@@ -142,97 +169,150 @@ namespace swift::misc::simulation::fscommon
 
         if (m_cancelLoading) { return {}; }
 
-        // excluded?
-        if (CFileUtils::isExcludedDirectory(directory, excludeDirectories) || isExcludedSubDirectory(directory))
-        {
-            const CStatusMessage m = CStatusMessage(this).info(u"Skipping directory '%1' (excluded)") << directory;
-            messages.push_back(m);
-            return {};
-        }
+        const CSimulatorInfo simulator = this->getSimulator();
+        const bool needsAirFiles = simulator.isP3D();
 
-        // set directory with name filters, get aircraft.cfg and sub directories
-        static const QString NoNameFilter;
-        QDir dir(directory, NoNameFilter, QDir::Name, QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot);
         // TODO TZ: still have to figure out how msfs2024 handles this
         // for MSFS2020   we only need aircraft.cfg
         // MSFS2024 has aircraft.cfg only in communityfolder
         // a solution for the aircraft from the marketplace may be prepared by ASOBO
-        dir.setNameFilters(fileNameFilters(getSimulator().isMSFS(), getSimulator().isMSFS2024()));
-        if (!dir.exists())
+        const QStringList &cfgFileNames = fileNameFilters(simulator.isMSFS(), simulator.isMSFS2024());
+
+        CModelDirectoryScanner scanner(m_cancelLoading);
+        scanner.setDirectoryFilter([&](const QString &dir) {
+            // excluded?
+            if (CFileUtils::isExcludedDirectory(dir, excludeDirectories) || isExcludedSubDirectory(dir))
+            {
+                const CStatusMessage m = CStatusMessage(this).info(u"Skipping directory '%1' (excluded)") << dir;
+                messages.push_back(m);
+                return false;
+            }
+            emit this->loadingProgress(simulator, QStringLiteral("Parsing '%1'").arg(dir), -1);
+            return true;
+        });
+        scanner.setFileSelector([&](const QFileInfoList &files) {
+            static const QString airSuffix("air");
+            QFileInfoList cfgFiles;
+            bool hasAirFiles = false;
+            for (const QFileInfo &fileInfo : files)
+            {
+                if (cfgFileNames.contains(fileInfo.fileName(), Qt::CaseInsensitive)) { cfgFiles.push_back(fileInfo); }
+                else if (fileInfo.suffix().compare(airSuffix, Qt::CaseInsensitive) == 0) { hasAirFiles = true; }
+            }
+
+            // the sim.cfg/aircraft.cfg file should have an *.air file sibling
+            // if not we assume these files can be ignored, enforced for P3D only
+            if (needsAirFiles && !hasAirFiles && !cfgFiles.isEmpty())
+            {
+                const CStatusMessage m = CStatusMessage(this).warning(u"No \"air\" files in '%1'")
+                                         << cfgFiles.front().absolutePath();
+                messages.push_back(m);
+                return QFileInfoList();
+            }
+            return cfgFiles;
+        });
+
+        // parsed in the pool threads, merged in enumeration order below
+        struct FileResult
         {
-            return {}; // can happen if there are shortcuts or linked dirs not available
-        }
+            QString fileName;
+            CAircraftCfgFingerprintIndex::Fingerprint fingerprint;
+            CStatusMessageList messages;
+            bool reused = false;
+            bool ok = false;
+        };
+        const QVector<FileResult> fileResults =
+            scanner.scan<FileResult>(directory, [&previous](const QFileInfo &fileInfo) {
+                FileResult r;
+                r.fileName = fileInfo.absoluteFilePath();
+                r.ok = parseOrReuseSingleFile(fileInfo, previous, r.fingerprint, r.reused, r.messages);
+                return r;
+            });
 
-        const QString currentDir = dir.absolutePath();
         CAircraftCfgEntriesList result;
-        emit this->loadingProgress(this->getSimulator(), QStringLiteral("Parsing '%1'").arg(currentDir), -1);
+        for (const FileResult &fileResult : fileResults)
+        {
+            if (!fileResult.ok)
+            {
+                messages.push_back(fileResult.messages);
+                continue;
+            }
+            current.insert(fileResult.fileName, fileResult.fingerprint);
+            if (fileResult.reused) { current.countReused(); }
+            else { current.countParsed(); }
+            result.push_back(fileResult.fingerprint.entries);
+        }
+        return result;
+    }
 
-        // Dirs last is crucial, since I will break recursion on "aircraft.cfg" level
-        // with T514 this behaviour has been changed
-        const QFileInfoList files =
-            dir.entryInfoList(QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot, QDir::DirsLast);
+    CAircraftCfgFingerprintIndex
+    CAircraftCfgParser::previousFingerprints(LoadMode mode, const CAircraftCfgFingerprintIndex &inMemory,
+                                             const QString &indexFileName)
+    {
+        if (!mode.testFlag(IncrementalFromDisk)) { return {}; }
+        if (!inMemory.isEmpty() || indexFileName.isEmpty()) { return inMemory; }
+        CAircraftCfgFingerprintIndex fromDisk;
+        fromDisk.loadFromFile(indexFileName);
+        return fromDisk;
+    }
 
-        // the sim.cfg/aircraft.cfg file should have an *.air file sibling
-        // if not we assume these files can be ignored
-        const QDir dirForAir(directory, CFsDirectories::airFileFilter(), QDir::Name,
-                             QDir::Files | QDir::NoDotAndDotDot);
-        const int airFilesCount = dirForAir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::DirsLast).size();
-        const bool hasAirFiles = airFilesCount > 0;
+    CAircraftCfgEntriesList CAircraftCfgParser::performParsingOfSingleFile(const QFileInfo &fileInfo,
+                                                                           const CAircraftCfgFingerprintIndex &previous,
+                                                                           CAircraftCfgFingerprintIndex &current,
+                                                                           bool &ok, CStatusMessageList &msgs)
+    {
+        CAircraftCfgFingerprintIndex::Fingerprint fingerprint;
+        bool reused = false;
+        ok = parseOrReuseSingleFile(fileInfo, previous, fingerprint, reused, msgs);
+        if (!ok) { return {}; }
+        current.insert(fileInfo.absoluteFilePath(), fingerprint);
+        if (reused) { current.countReused(); }
+        else { current.countParsed(); }
+        return fingerprint.entries;
+    }
 
-        if (getSimulator().isP3D() && !hasAirFiles)
+    bool CAircraftCfgParser::parseOrReuseSingleFile(const QFileInfo &fileInfo,
+                                                    const CAircraftCfgFingerprintIndex &previous,
+                                                    CAircraftCfgFingerprintIndex::Fingerprint &fingerprint,
+                                                    bool &reused, CStatusMessageList &msgs)
+    {
+        const QString fileName = fileInfo.absoluteFilePath();
+        fingerprint.size = fileInfo.size();
+        fingerprint.lastModifiedMs = fileInfo.lastModified().toMSecsSinceEpoch();
+        reused = false;
+
+        // cheap check first, size and timestamp unchanged
+        if (previous.findUnchanged(fileInfo, fingerprint.entries))
         {
-            const CStatusMessage m = CStatusMessage(this).warning(u"No \"air\" files in '%1'") << currentDir;
-            messages.push_back(m);
+            fingerprint.hash = previous.find(fileName)->hash;
+            reused = true;
+            return true;
         }
 
-        for (const auto &fileInfo : files)
+        const QString fnFixed = CFileUtils::fixWindowsUncPath(fileName);
+        QFile file(fnFixed); // includes path
+        if (!file.open(QFile::ReadOnly))
         {
-            if (m_cancelLoading) { return {}; }
-            if (fileInfo.isDir())
-            {
-                const QString nextDir = fileInfo.absoluteFilePath();
-                if (currentDir.startsWith(nextDir, Qt::CaseInsensitive)) { continue; } // do not go up
-                if (dir == currentDir) { continue; } // do not recursively call same directory
-
-                const CAircraftCfgEntriesList subList(performParsing(nextDir, excludeDirectories, messages));
-                if (messages.isSuccess()) { result.push_back(subList); }
-                else
-                {
-                    const CStatusMessage m = CStatusMessage(this).warning(u"Parsing failed for '%1'") << nextDir;
-                    messages.push_back(m);
-                }
-            }
-            else
-            {
-                // Enforce air files only for P3D
-                if (getSimulator().isP3D() && !hasAirFiles) { continue; }
-
-                // due to the filter we expect only "aircraft.cfg"/"sim.cfg" here
-                // remark: in a 1st version I have used QSettings to parse to file as ini file
-                // unfortunately some files are malformed which could end up in wrong data
-
-                const QString fileName = fileInfo.absoluteFilePath(); // full path and name
-                bool fileOk = false;
-                CStatusMessageList fileMsgs;
-                const CAircraftCfgEntriesList fileResults =
-                    CAircraftCfgParser::performParsingOfSingleFile(fileName, fileOk, fileMsgs);
-                if (!fileOk)
-                {
-                    const CStatusMessage m = CStatusMessage(this).warning(u"Parsing of '%1' failed") << fileName;
-                    messages.push_back(fileMsgs);
-                    continue;
-                }
-
-                result.push_back(fileResults);
+            const CStatusMessage m =
+                CStatusMessage(static_cast<CAircraftCfgParser *>(nullptr)).warning(u"Unable to read file '%1'")
+                << fnFixed;
+            msgs.push_back(m);
+            return false;
+        }
+        const QByteArray content = file.readAll();
+        file.close();
 
-                // With T514 we do not skip not anymore
-                // return result; // do not go any deeper in file tree, we found aircraft.cfg
-            }
+        // file touched, but content unchanged
+        fingerprint.hash = CAircraftCfgFingerprintIndex::contentHash(content);
+        if (previous.findByHash(fileName, fingerprint.hash, fingerprint.entries))
+        {
+            reused = true;
+            return true;
         }
 
-        // all files finished,
-        // normally reached when no aircraft.cfg is found
-        return result;
+        bool ok = false;
+        fingerprint.entries = performParsingOfContent(fileName, content, ok, msgs);
+        return ok;
     }
 
     CAircraftCfgEntriesList CAircraftCfgParser::performParsingOfSingleFile(const QString &fileName, bool &ok,
@@ -245,7 +325,7 @@ namespace swift::misc::simulation::fscommon
         ok = false;
         const QString fnFixed = CFileUtils::fixWindowsUncPath(fileName);
         QFile file(fnFixed); // includes path
-        if (!file.open(QFile::ReadOnly | QFile::Text))
+        if (!file.open(QFile::ReadOnly))
         {
             const CStatusMessage m =
                 CStatusMessage(static_cast<CAircraftCfgParser *>(nullptr)).warning(u"Unable to read file '%1'")
@@ -253,8 +333,18 @@ namespace swift::misc::simulation::fscommon
             msgs.push_back(m);
             return {};
         }
+        const QByteArray content = file.readAll();
+        file.close();
+        return performParsingOfContent(fileName, content, ok, msgs);
+    }
 
-        QTextStream in(&file);
+    CAircraftCfgEntriesList CAircraftCfgParser::performParsingOfContent(const QString &fileName,
+                                                                        const QByteArray &content, bool &ok,
+                                                                        CStatusMessageList &msgs)
+    {
+        ok = false;
+        const QString fnFixed = CFileUtils::fixWindowsUncPath(fileName);
+        QTextStream in(content);
         QList<CAircraftCfgEntries> tempEntries;
 
         // parse through the file
@@ -372,7 +462,6 @@ namespace swift::misc::simulation::fscommon
             case Unknown: break;
             }
         } // all lines
-        file.close();
 
         // store all entries
         const QFileInfo fileInfo(fnFixed);
@@ -15,9 +15,11 @@
 #include "misc/simulation/aircraftmodellist.h"
 #include "misc/simulation/aircraftmodelloader.h"
 #include "misc/simulation/fscommon/aircraftcfgentrieslist.h"
+#include "misc/simulation/fscommon/aircraftcfgfingerprints.h"
 #include "misc/simulation/simulatorinfo.h"
 #include "misc/swiftmiscexport.h"
 
+class QFileInfo;
 class QSettings;
 
 namespace swift::misc
@@ -49,6 +51,19 @@ namespace swift::misc
             static CAircraftCfgEntriesList performParsingOfSingleFile(const QString &fileName, bool &ok,
                                                                       CStatusMessageList &msgs);
 
+            //! Parse a single file, reusing the entries of the previous index if the file did not change
+            //! \remark the file's fingerprint is added to the current index
+            static CAircraftCfgEntriesList performParsingOfSingleFile(const QFileInfo &fileInfo,
+                                                                      const CAircraftCfgFingerprintIndex &previous,
+                                                                      CAircraftCfgFingerprintIndex &current,
+                                                                      bool &ok, CStatusMessageList &msgs);
+
+            //! File the fingerprint index is persisted to
+            const QString &getFingerprintIndexFileName() const { return m_fingerprintIndexFileName; }
+
+            //! Set the file the fingerprint index is persisted to, empty disables persistence
+            void setFingerprintIndexFileName(const QString &fileName) { m_fingerprintIndexFileName = fileName; }
+
             //! Create an parser object for given simulator
             static CAircraftCfgParser *createModelLoader(const CSimulatorInfo &simInfo, QObject *parent = nullptr);
 
@@ -72,13 +87,33 @@ namespace swift::misc
             //! \threadsafe
             CAircraftCfgEntriesList performParsing(const QStringList &directories,
                                                    const QStringList &excludeDirectories,
+                                                   const CAircraftCfgFingerprintIndex &previous,
+                                                   CAircraftCfgFingerprintIndex &current,
                                                    swift::misc::CStatusMessageList &messages);
 
-            //! Perform the parsing for one directory
+            //! Perform the parsing for one directory tree, files are parsed in parallel
             //! \threadsafe
             CAircraftCfgEntriesList performParsing(const QString &directory, const QStringList &excludeDirectories,
+                                                   const CAircraftCfgFingerprintIndex &previous,
+                                                   CAircraftCfgFingerprintIndex &current,
                                                    swift::misc::CStatusMessageList &messages);
 
+            //! Previous fingerprints used for an incremental load
+            //! \remark loaded from disk if not available in memory
+            static CAircraftCfgFingerprintIndex previousFingerprints(LoadMode mode,
+                                                                     const CAircraftCfgFingerprintIndex &inMemory,
+                                                                     const QString &indexFileName);
+
+            //! Parse a single file or reuse its entries from the previous index
+            //! \threadsafe
+            static bool parseOrReuseSingleFile(const QFileInfo &fileInfo, const CAircraftCfgFingerprintIndex &previous,
+                                               CAircraftCfgFingerprintIndex::Fingerprint &fingerprint, bool &reused,
+                                               CStatusMessageList &msgs);
+
+            //! Parse the content of an already read file
+            static CAircraftCfgEntriesList performParsingOfContent(const QString &fileName, const QByteArray &content,
+                                                                   bool &ok, CStatusMessageList &msgs);
+
             //! Fix the content read
             static QString fixedStringContent(const QVariant &qv);
 
@@ -95,6 +130,8 @@ namespace swift::misc
             static bool isExcludedSubDirectory(const QString &excludeDirectory);
 
             CAircraftCfgEntriesList m_parsedCfgEntriesList; //!< parsed entries
+            CAircraftCfgFingerprintIndex m_fingerprints; //!< fingerprints of the last parsing
+            QString m_fingerprintIndexFileName; //!< persisted fingerprints
             QPointer<swift::misc::CWorker> m_parserWorker; //!< worker will destroy itself, so weak pointer
         };
     } // namespace simulation::fscommon
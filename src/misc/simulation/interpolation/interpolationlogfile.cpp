@@ -0,0 +1,562 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/interpolation/interpolationlogfile.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <QDataStream>
+#include <QMutexLocker>
+#include <QStringBuilder>
+#include <QThread>
+
+#include "misc/aviation/heading.h"
+#include "misc/aviation/ongroundinfo.h"
+#include "misc/batchfilewriter.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/logmessage.h"
+#include "misc/pq/units.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+
+namespace swift::misc::simulation
+{
+    namespace
+    {
+        const QByteArray &magic()
+        {
+            static const QByteArray m("SWINTLOG");
+            return m;
+        }
+
+        constexpr char Version = 1;
+        constexpr QDataStream::Version StreamVersion = QDataStream::Qt_6_0;
+        constexpr qint64 MaxRecordBytes = 1024 * 1024; //!< larger records are corrupt
+        constexpr int MaxSituationsPerLog = CInterpolationLogFile::SituationSlots / 2; //!< latest ones are written
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        //! @{
+        //! Flags of a log record
+        constexpr quint8 UsePartsFlag = 1 << 0;
+        constexpr quint8 InterpolantRecalcFlag = 1 << 1;
+        constexpr quint8 EmptyPartsFlag = 1 << 2;
+        //! @}
+
+        //! Value in the unit, NaN if null
+        template <class PQ, class Unit>
+        double valueOrNaN(const PQ &quantity, const Unit &unit)
+        {
+            return quantity.isNull() ? NaN : quantity.value(unit);
+        }
+
+        //! Length from ft, null if NaN
+        CLength lengthFromFt(double ft) { return std::isnan(ft) ? CLength::null() : CLength(ft, CLengthUnit::ft()); }
+
+        //! Interpolated situation, values only
+        void writeInterpolatedSituation(QDataStream &stream, const CAircraftSituation &situation)
+        {
+            const bool hasPosition = !situation.isPositionNull();
+            stream << situation.getMSecsSinceEpoch() << situation.getTimeOffsetMs() << hasPosition;
+            if (hasPosition)
+            {
+                stream << situation.latitude().value(CAngleUnit::deg())
+                       << situation.longitude().value(CAngleUnit::deg());
+            }
+            stream << valueOrNaN(situation.getAltitude(), CLengthUnit::ft())
+                   << (situation.hasGroundElevation() ? situation.getGroundElevation().value(CLengthUnit::ft()) : NaN)
+                   << static_cast<qint32>(situation.getGroundElevationInfo())
+                   << valueOrNaN(situation.getHeading(), CAngleUnit::deg())
+                   << static_cast<quint8>(situation.getHeading().getReferenceNorth())
+                   << valueOrNaN(situation.getPitch(), CAngleUnit::deg())
+                   << valueOrNaN(situation.getBank(), CAngleUnit::deg())
+                   << valueOrNaN(situation.getGroundSpeed(), CSpeedUnit::kts()) << situation.getOnGroundInfo();
+        }
+
+        //! Interpolated situation, as written by writeInterpolatedSituation
+        CAircraftSituation readInterpolatedSituation(QDataStream &stream, const CCallsign &callsign)
+        {
+            qint64 ms = 0;
+            qint64 offsetMs = 0;
+            bool hasPosition = false;
+            double latDeg = 0.0;
+            double lngDeg = 0.0;
+            double altitudeFt = NaN;
+            double elevationFt = NaN;
+            qint32 elevationInfo = 0;
+            double headingDeg = NaN;
+            quint8 north = CHeading::True;
+            double pitchDeg = NaN;
+            double bankDeg = NaN;
+            double groundSpeedKts = NaN;
+            COnGroundInfo onGroundInfo;
+            stream >> ms >> offsetMs >> hasPosition;
+            if (hasPosition) { stream >> latDeg >> lngDeg; }
+            stream >> altitudeFt >> elevationFt >> elevationInfo >> headingDeg >> north >> pitchDeg >> bankDeg >>
+                groundSpeedKts >> onGroundInfo;
+
+            CAircraftSituation situation(callsign);
+            if (hasPosition)
+            {
+                situation.setPosition(std::isnan(altitudeFt) ? CCoordinateGeodetic(latDeg, lngDeg) :
+                                                               CCoordinateGeodetic(latDeg, lngDeg, altitudeFt));
+            }
+            else if (!std::isnan(altitudeFt))
+            {
+                situation.setAltitude(CAltitude(altitudeFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
+            }
+            if (!std::isnan(elevationFt))
+            {
+                situation.setGroundElevation(CAltitude(elevationFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()),
+                                             static_cast<CAircraftSituation::GndElevationInfo>(elevationInfo));
+            }
+            if (!std::isnan(headingDeg))
+            {
+                situation.setHeading(
+                    CHeading(headingDeg, static_cast<CHeading::ReferenceNorth>(north), CAngleUnit::deg()));
+            }
+            if (!std::isnan(pitchDeg)) { situation.setPitch(CAngle(pitchDeg, CAngleUnit::deg())); }
+            if (!std::isnan(bankDeg)) { situation.setBank(CAngle(bankDeg, CAngleUnit::deg())); }
+            if (!std::isnan(groundSpeedKts)) { situation.setGroundSpeed(CSpeed(groundSpeedKts, CSpeedUnit::kts())); }
+            situation.setOnGroundInfo(onGroundInfo);
+            situation.setMSecsSinceEpoch(ms);
+            situation.setTimeOffsetMs(offsetMs);
+            return situation;
+        }
+    } // namespace
+
+    /*!
+     * Writer thread of CInterpolationLogFile
+     */
+    class CInterpolationLogFileWriter : public CBatchFileWriter
+    {
+    public:
+        //! Constructor
+        CInterpolationLogFileWriter(CInterpolationLogFile &logFile)
+            : CBatchFileWriter("CInterpolationLogFileWriter"), m_logFile(logFile)
+        {}
+
+        //! Destructor
+        ~CInterpolationLogFileWriter() override { stop(); }
+
+    protected:
+        //! Swapped with the pending entries, keeps the capacity of both buffers
+        void fillBatch(QByteArray &batch) override { m_logFile.takePending(batch); }
+
+        //! Report dropped entries
+        void batchWritten() override
+        {
+            const qint64 dropped = m_logFile.getDroppedCount();
+            if (dropped <= m_reportedDropped) { return; }
+            CLogMessage(static_cast<CInterpolationLogger *>(nullptr))
+                    .warning(u"Interpolation log overloaded, %1 entries dropped")
+                << (dropped - m_reportedDropped);
+            m_reportedDropped = dropped;
+        }
+
+    private:
+        CInterpolationLogFile &m_logFile;
+        qint64 m_reportedDropped = 0;
+    };
+
+    CInterpolationLogFile::CInterpolationLogFile() = default;
+
+    CInterpolationLogFile::~CInterpolationLogFile() { this->stop(); }
+
+    bool CInterpolationLogFile::start(const QString &fileName, QString &errorMessage)
+    {
+        this->stop();
+
+        auto writer = std::make_unique<CInterpolationLogFileWriter>(*this);
+        writer->file().setFileName(fileName);
+        if (!writer->file().open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            errorMessage = writer->file().errorString();
+            return false;
+        }
+        writer->file().write(magic() + Version);
+
+        QMutexLocker l(&m_lock);
+        m_fileName = fileName;
+        m_writer = std::move(writer);
+        m_writer->start(QThread::LowPriority);
+        return true;
+    }
+
+    void CInterpolationLogFile::stop()
+    {
+        std::unique_ptr<CInterpolationLogFileWriter> writer;
+        {
+            QMutexLocker l(&m_lock);
+            writer = std::move(m_writer);
+            m_fileName.clear();
+        }
+        if (writer) { writer->stop(); } // writes the pending entries
+
+        QMutexLocker l(&m_lock);
+        m_pending.clear();
+        m_callsigns.clear();
+        m_nextCallsignNumber = 0;
+    }
+
+    void CInterpolationLogFile::flush()
+    {
+        CInterpolationLogFileWriter *writer = nullptr;
+        {
+            QMutexLocker l(&m_lock);
+            writer = m_writer.get();
+        }
+        if (writer) { writer->flush(); }
+    }
+
+    bool CInterpolationLogFile::isRunning() const
+    {
+        QMutexLocker l(&m_lock);
+        return static_cast<bool>(m_writer);
+    }
+
+    QString CInterpolationLogFile::getFileName() const
+    {
+        QMutexLocker l(&m_lock);
+        return m_fileName;
+    }
+
+    qint64 CInterpolationLogFile::getPendingBytes() const
+    {
+        QMutexLocker l(&m_lock);
+        return m_pending.capacity() + m_record.capacity();
+    }
+
+    bool CInterpolationLogFile::append(const SituationLog &log)
+    {
+        if (log.callsign.isEmpty()) { return false; }
+        QMutexLocker l(&m_lock);
+        if (!m_writer) { return false; }
+        if (m_pending.size() >= MaxPendingBytes)
+        {
+            m_dropped++;
+            m_writer->wakeUp();
+            return false;
+        }
+
+        CallsignState &state = this->callsignState(log.callsign);
+        const int situations = log.interpolationSituations.sizeInt();
+        const int firstSituation = qMax(0, situations - MaxSituationsPerLog);
+        quint32 usedSlots = 0;
+        QByteArray slots;
+        for (int i = firstSituation; i < situations; ++i)
+        {
+            slots.append(static_cast<char>(this->situationSlot(state, log.interpolationSituations[i], usedSlots)));
+        }
+        this->updateParts(state, log.parts);
+
+        {
+            QDataStream stream(&m_record, QIODevice::WriteOnly);
+            stream.setVersion(StreamVersion);
+            const quint8 flags =
+                (log.useParts ? UsePartsFlag : 0) | (log.interpolantRecalc ? InterpolantRecalcFlag : 0);
+            stream << state.number << static_cast<quint8>(log.interpolator.toLatin1()) << flags << log.tsCurrent
+                   << log.tsInterpolated << log.groundFactor << log.simTimeFraction << log.deltaSampleTimesMs
+                   << static_cast<qint32>(log.noNetworkSituations) << static_cast<qint32>(log.noInvalidSituations)
+                   << log.elevationInfo.toUtf8() << log.altCorrection.toUtf8()
+                   << valueOrNaN(log.cgAboveGround, CLengthUnit::ft())
+                   << valueOrNaN(log.sceneryOffset, CLengthUnit::ft()) << slots;
+            writeInterpolatedSituation(stream, log.situationCurrent);
+        }
+        this->appendRecord(SituationLogRecord);
+
+        // the writer wakes up periodically, bursts are written right away
+        if (m_pending.size() >= MaxPendingBytes / 4) { m_writer->wakeUp(); }
+        return true;
+    }
+
+    bool CInterpolationLogFile::append(const PartsLog &log)
+    {
+        if (log.callsign.isEmpty()) { return false; }
+        QMutexLocker l(&m_lock);
+        if (!m_writer) { return false; }
+        if (m_pending.size() >= MaxPendingBytes)
+        {
+            m_dropped++;
+            m_writer->wakeUp();
+            return false;
+        }
+
+        CallsignState &state = this->callsignState(log.callsign);
+        this->updateParts(state, log.parts);
+        {
+            QDataStream stream(&m_record, QIODevice::WriteOnly);
+            stream.setVersion(StreamVersion);
+            stream << state.number << log.tsCurrent << static_cast<quint8>(log.empty ? EmptyPartsFlag : 0)
+                   << static_cast<qint32>(log.noNetworkParts);
+        }
+        this->appendRecord(PartsLogRecord);
+
+        if (m_pending.size() >= MaxPendingBytes / 4) { m_writer->wakeUp(); }
+        return true;
+    }
+
+    CInterpolationLogFile::CallsignState &CInterpolationLogFile::callsignState(const CCallsign &callsign)
+    {
+        const CCallsignHandle handle = CCallsignHandle::intern(callsign);
+        if (CallsignState *state = m_callsigns.find(handle)) { return *state; }
+
+        CallsignState &state = m_callsigns[handle];
+        state.number = m_nextCallsignNumber++;
+        {
+            QDataStream stream(&m_record, QIODevice::WriteOnly);
+            stream.setVersion(StreamVersion);
+            stream << callsign.asString();
+        }
+        this->appendRecord(CallsignRecord);
+        return state;
+    }
+
+    quint8 CInterpolationLogFile::situationSlot(CallsignState &state, const CAircraftSituation &situation,
+                                                quint32 &usedSlots)
+    {
+        for (int slot = 0; slot < SituationSlots; ++slot)
+        {
+            const CAircraftSituation &written = state.situations[static_cast<std::size_t>(slot)];
+            if (written.getMSecsSinceEpoch() == situation.getMSecsSinceEpoch() && written == situation)
+            {
+                usedSlots |= 1U << slot;
+                return static_cast<quint8>(slot);
+            }
+        }
+
+        // the slots of the same log are kept
+        while (usedSlots & (1U << state.nextSlot)) { state.nextSlot = (state.nextSlot + 1) % SituationSlots; }
+        const int slot = state.nextSlot;
+        state.nextSlot = (slot + 1) % SituationSlots;
+        state.situations[static_cast<std::size_t>(slot)] = situation;
+        usedSlots |= 1U << slot;
+        {
+            QDataStream stream(&m_record, QIODevice::WriteOnly);
+            stream.setVersion(StreamVersion);
+            stream << state.number << static_cast<quint8>(slot) << situation;
+        }
+        this->appendRecord(SituationRecord);
+        return static_cast<quint8>(slot);
+    }
+
+    void CInterpolationLogFile::updateParts(CallsignState &state, const CAircraftParts &parts)
+    {
+        if (state.hasParts && state.parts == parts) { return; }
+        state.parts = parts;
+        state.hasParts = true;
+        {
+            QDataStream stream(&m_record, QIODevice::WriteOnly);
+            stream.setVersion(StreamVersion);
+            stream << state.number << parts;
+        }
+        this->appendRecord(PartsRecord);
+    }
+
+    void CInterpolationLogFile::appendRecord(RecordType type)
+    {
+        m_pending.append(static_cast<char>(type));
+        appendVarint(m_pending, static_cast<quint64>(m_record.size()));
+        m_pending.append(m_record);
+    }
+
+    void CInterpolationLogFile::takePending(QByteArray &batch)
+    {
+        QMutexLocker l(&m_lock);
+        batch.swap(m_pending);
+    }
+
+    bool CInterpolationLogFile::isLogFile(const QString &fileName)
+    {
+        QFile file(fileName);
+        return file.open(QIODevice::ReadOnly) && file.read(magic().size()) == magic();
+    }
+
+    bool CInterpolationLogReader::open(const QString &fileName, QString &errorMessage)
+    {
+        m_file.close();
+        m_callsigns.clear();
+        m_errorMessage.clear();
+        m_file.setFileName(fileName);
+        if (!m_file.open(QIODevice::ReadOnly))
+        {
+            errorMessage = m_file.errorString();
+            return false;
+        }
+        const QByteArray header = m_file.read(magic().size() + 1);
+        if (header.size() != magic().size() + 1 || !header.startsWith(magic()) || header.back() != Version)
+        {
+            errorMessage = u"Not an interpolation log: " % fileName;
+            m_file.close();
+            return false;
+        }
+        return true;
+    }
+
+    CInterpolationLogReader::Entry CInterpolationLogReader::next()
+    {
+        char type = 0;
+        qint64 size = 0;
+        while (this->readRecordHeader(type, size))
+        {
+            if (!this->readPayload(size)) { return NoEntry; }
+            QDataStream stream(m_payload);
+            stream.setVersion(StreamVersion);
+            switch (type)
+            {
+            case CInterpolationLogFile::CallsignRecord:
+            {
+                QString callsign;
+                stream >> callsign;
+                m_callsigns.emplace_back();
+                m_callsigns.back().callsign = CCallsign(callsign);
+                break;
+            }
+            case CInterpolationLogFile::SituationRecord:
+            {
+                quint32 number = 0;
+                quint8 slot = 0;
+                CAircraftSituation situation;
+                stream >> number >> slot >> situation;
+                if (number >= m_callsigns.size() || slot >= CInterpolationLogFile::SituationSlots)
+                {
+                    return this->corrupt();
+                }
+                m_callsigns[number].situations[slot] = situation;
+                break;
+            }
+            case CInterpolationLogFile::PartsRecord:
+            {
+                quint32 number = 0;
+                CAircraftParts parts;
+                stream >> number >> parts;
+                if (number >= m_callsigns.size()) { return this->corrupt(); }
+                m_callsigns[number].parts = parts;
+                break;
+            }
+            case CInterpolationLogFile::SituationLogRecord:
+                return this->readSituationLog(stream) ? SituationEntry : this->corrupt();
+            case CInterpolationLogFile::PartsLogRecord:
+                return this->readPartsLog(stream) ? PartsEntry : this->corrupt();
+            default: break; // records of later versions
+            }
+            if (stream.status() != QDataStream::Ok) { return this->corrupt(); }
+        }
+        return NoEntry;
+    }
+
+    bool CInterpolationLogReader::readSituationLog(QDataStream &stream)
+    {
+        quint32 number = 0;
+        quint8 interpolator = 0;
+        quint8 flags = 0;
+        qint32 noNetworkSituations = 0;
+        qint32 noInvalidSituations = 0;
+        QByteArray elevationInfo;
+        QByteArray altCorrection;
+        double cgFt = NaN;
+        double sceneryOffsetFt = NaN;
+        QByteArray slots;
+
+        SituationLog &log = m_situationLog;
+        stream >> number >> interpolator >> flags >> log.tsCurrent >> log.tsInterpolated >> log.groundFactor >>
+            log.simTimeFraction >> log.deltaSampleTimesMs >> noNetworkSituations >> noInvalidSituations >>
+            elevationInfo >> altCorrection >> cgFt >> sceneryOffsetFt >> slots;
+        if (stream.status() != QDataStream::Ok || number >= m_callsigns.size()) { return false; }
+
+        const CallsignState &state = m_callsigns[number];
+        log.interpolator = QChar::fromLatin1(static_cast<char>(interpolator));
+        log.useParts = flags & UsePartsFlag;
+        log.interpolantRecalc = flags & InterpolantRecalcFlag;
+        log.noNetworkSituations = noNetworkSituations;
+        log.noInvalidSituations = noInvalidSituations;
+        log.elevationInfo = QString::fromUtf8(elevationInfo);
+        log.altCorrection = QString::fromUtf8(altCorrection);
+        log.callsign = state.callsign;
+        log.parts = state.parts;
+        log.cgAboveGround = lengthFromFt(cgFt);
+        log.sceneryOffset = lengthFromFt(sceneryOffsetFt);
+        log.interpolationSituations.clear();
+        for (const char slot : std::as_const(slots))
+        {
+            const auto i = static_cast<quint8>(slot);
+            if (i >= CInterpolationLogFile::SituationSlots) { return false; }
+            log.interpolationSituations.push_back(state.situations[i]);
+        }
+        log.situationCurrent = readInterpolatedSituation(stream, state.callsign);
+        return stream.status() == QDataStream::Ok;
+    }
+
+    bool CInterpolationLogReader::readPartsLog(QDataStream &stream)
+    {
+        quint32 number = 0;
+        quint8 flags = 0;
+        qint32 noNetworkParts = 0;
+        PartsLog &log = m_partsLog;
+        stream >> number >> log.tsCurrent >> flags >> noNetworkParts;
+        if (stream.status() != QDataStream::Ok || number >= m_callsigns.size()) { return false; }
+        log.callsign = m_callsigns[number].callsign;
+        log.parts = m_callsigns[number].parts;
+        log.empty = flags & EmptyPartsFlag;
+        log.noNetworkParts = noNetworkParts;
+        return true;
+    }
+
+    bool CInterpolationLogReader::readRecordHeader(char &type, qint64 &size)
+    {
+        if (!m_file.isOpen() || !m_file.getChar(&type)) { return false; }
+        quint64 value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            char c = 0;
+            if (!m_file.getChar(&c)) { break; }
+            const auto byte = static_cast<quint8>(c);
+            value |= static_cast<quint64>(byte & 0x7f) << shift;
+            if (byte & 0x80) { continue; }
+            if (value > static_cast<quint64>(MaxRecordBytes)) { break; }
+            size = static_cast<qint64>(value);
+            return true;
+        }
+        m_errorMessage = u"Truncated interpolation log: " % m_file.fileName();
+        return false;
+    }
+
+    bool CInterpolationLogReader::readPayload(qint64 size)
+    {
+        m_payload.resize(size);
+        if (m_file.read(m_payload.data(), size) == size) { return true; }
+
+        // the writer was interrupted, everything before is fine
+        m_errorMessage = u"Truncated interpolation log: " % m_file.fileName();
+        return false;
+    }
+
+    CInterpolationLogReader::Entry CInterpolationLogReader::corrupt()
+    {
+        m_errorMessage = u"Corrupt interpolation log: " % m_file.fileName();
+        m_file.close();
+        return NoEntry;
+    }
+
+    bool CInterpolationLogReader::countEntries(const QString &fileName, int &situations, int &parts,
+                                               QString &errorMessage)
+    {
+        situations = 0;
+        parts = 0;
+        CInterpolationLogReader reader;
+        if (!reader.open(fileName, errorMessage)) { return false; }
+
+        char type = 0;
+        qint64 size = 0;
+        while (reader.readRecordHeader(type, size))
+        {
+            if (reader.m_file.skip(size) != size) { break; }
+            if (type == CInterpolationLogFile::SituationLogRecord) { situations++; }
+            else if (type == CInterpolationLogFile::PartsLogRecord) { parts++; }
+        }
+        return true;
+    }
+} // namespace swift::misc::simulation
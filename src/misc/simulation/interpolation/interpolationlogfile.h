@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGFILE_H
+#define SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGFILE_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QMutex>
+#include <QString>
+
+#include "misc/aviation/aircraftparts.h"
+#include "misc/aviation/aircraftsituation.h"
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignhandle.h"
+#include "misc/simulation/interpolation/interpolationlogger.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation
+{
+    class CInterpolationLogFileWriter;
+
+    /*!
+     * Append-only binary file of situation and parts logs, written while logging.
+     *
+     * Entries are encoded into a pending buffer and written by a background thread, so logging neither waits for the
+     * disk nor keeps the entries. If the writer cannot keep up, entries are dropped and counted.
+     *
+     * File format: magic "SWINTLOG", version (1 byte), then records of type (1 byte), payload size (varint) and
+     * payload (QDataStream). Callsigns are written once per file, network situations and parts only when changed,
+     * logs refer to them by number. Interpolated situations are written with their values only.
+     * \sa CInterpolationLogReader
+     */
+    class SWIFT_MISC_EXPORT CInterpolationLogFile
+    {
+    public:
+        static constexpr int MaxPendingBytes = 4 * 1024 * 1024; //!< entries are dropped if more are not written
+        static constexpr int SituationSlots = 8; //!< network situations remembered per callsign
+        static constexpr char FileExtension[] = "intlog"; //!< file extension of logs
+
+        //! Constructor
+        CInterpolationLogFile();
+
+        //! Destructor, writes all logged entries
+        ~CInterpolationLogFile();
+
+        //! @{
+        //! Not copyable
+        CInterpolationLogFile(const CInterpolationLogFile &) = delete;
+        CInterpolationLogFile &operator=(const CInterpolationLogFile &) = delete;
+        //! @}
+
+        //! Start writing a new file, an existing file is truncated
+        bool start(const QString &fileName, QString &errorMessage);
+
+        //! Write all logged entries and close the file
+        void stop();
+
+        //! Wait until all entries logged so far are written
+        void flush();
+
+        //! Writing?
+        //! \threadsafe
+        bool isRunning() const;
+
+        //! File written, empty if not running
+        //! \threadsafe
+        QString getFileName() const;
+
+        //! @{
+        //! Log an entry
+        //! \return false if not running or the entry was dropped
+        //! \threadsafe
+        bool append(const SituationLog &log);
+        bool append(const PartsLog &log);
+        //! @}
+
+        //! Entries dropped so far, because the writer could not keep up
+        //! \threadsafe
+        qint64 getDroppedCount() const { return m_dropped; }
+
+        //! Memory of the buffers for entries not yet written
+        //! \threadsafe
+        qint64 getPendingBytes() const;
+
+        //! Is this an interpolation log file?
+        static bool isLogFile(const QString &fileName);
+
+    private:
+        friend class CInterpolationLogFileWriter;
+        friend class CInterpolationLogReader;
+
+        //! Record types
+        enum RecordType : char
+        {
+            CallsignRecord = 'C', //!< callsign, numbered in order of the records
+            SituationRecord = 'S', //!< network situation in a slot of the callsign
+            PartsRecord = 'P', //!< parts of the callsign
+            SituationLogRecord = 'I', //!< SituationLog
+            PartsLogRecord = 'Q' //!< PartsLog
+        };
+
+        //! What has been written for a callsign
+        struct CallsignState
+        {
+            quint32 number = 0; //!< number in the file
+            std::array<aviation::CAircraftSituation, SituationSlots> situations; //!< written network situations
+            int nextSlot = 0; //!< slot overwritten next
+            aviation::CAircraftParts parts; //!< written parts
+            bool hasParts = false; //!< parts written?
+        };
+
+        //! Number of the callsign, written if new
+        CallsignState &callsignState(const aviation::CCallsign &callsign);
+
+        //! Slot of the network situation, written if new, the used slots are not overwritten
+        quint8 situationSlot(CallsignState &state, const aviation::CAircraftSituation &situation, quint32 &usedSlots);
+
+        //! Parts written if changed
+        void updateParts(CallsignState &state, const aviation::CAircraftParts &parts);
+
+        //! Append m_record as record
+        void appendRecord(RecordType type);
+
+        //! Pending entries for the writer, the batch is empty afterwards
+        void takePending(QByteArray &batch);
+
+        mutable QMutex m_lock; //!< guards all but the writer
+        QByteArray m_pending; //!< records not yet written
+        QByteArray m_record; //!< payload being encoded, allocated once
+        aviation::CCallsignHandleMap<CallsignState> m_callsigns;
+        quint32 m_nextCallsignNumber = 0;
+        QString m_fileName;
+        std::atomic<qint64> m_dropped { 0 };
+        std::unique_ptr<CInterpolationLogFileWriter> m_writer;
+    };
+
+    /*!
+     * Reads a CInterpolationLogFile entry by entry, without loading the file
+     */
+    class SWIFT_MISC_EXPORT CInterpolationLogReader
+    {
+    public:
+        //! Entry read
+        enum Entry
+        {
+            NoEntry, //!< end of file or error
+            SituationEntry, //!< getSituationLog
+            PartsEntry //!< getPartsLog
+        };
+
+        //! Open a log file
+        bool open(const QString &fileName, QString &errorMessage);
+
+        //! Read the next entry
+        Entry next();
+
+        //! Situation log of the last SituationEntry
+        const SituationLog &getSituationLog() const { return m_situationLog; }
+
+        //! Parts log of the last PartsEntry
+        const PartsLog &getPartsLog() const { return m_partsLog; }
+
+        //! Error when reading, e.g. the writer was interrupted, entries before are fine
+        const QString &getErrorMessage() const { return m_errorMessage; }
+
+        //! Count the entries of a log file
+        static bool countEntries(const QString &fileName, int &situations, int &parts, QString &errorMessage);
+
+    private:
+        //! What has been read for a callsign
+        struct CallsignState
+        {
+            aviation::CCallsign callsign; //!< callsign
+            std::array<aviation::CAircraftSituation, CInterpolationLogFile::SituationSlots> situations; //!< slots
+            aviation::CAircraftParts parts; //!< parts
+        };
+
+        //! Read type and size of the next record, false at the end
+        bool readRecordHeader(char &type, qint64 &size);
+
+        //! Read the payload of a record, false if truncated
+        bool readPayload(qint64 size);
+
+        //! @{
+        //! Read a log record
+        bool readSituationLog(QDataStream &stream);
+        bool readPartsLog(QDataStream &stream);
+        //! @}
+
+        //! Record refers to unknown data
+        Entry corrupt();
+
+        QFile m_file;
+        QByteArray m_payload;
+        std::vector<CallsignState> m_callsigns; //!< by number
+        SituationLog m_situationLog;
+        PartsLog m_partsLog;
+        QString m_errorMessage;
+    };
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGFILE_H
@@ -4,16 +4,20 @@
 #include "misc/simulation/interpolation/interpolationlogger.h"
 
 #include <QDateTime>
+#include <QDir>
+#include <QFile>
 #include <QStringBuilder>
 
 #include "config/buildconfig.h"
 #include "misc/aviation/callsign.h"
 #include "misc/directoryutils.h"
+#include "misc/fileutils.h"
 #include "misc/geo/kmlutils.h"
 #include "misc/logmessage.h"
 #include "misc/pq/angle.h"
 #include "misc/pq/length.h"
 #include "misc/pq/units.h"
+#include "misc/simulation/interpolation/interpolationlogfile.h"
 #include "misc/stringutils.h"
 #include "misc/swiftdirectories.h"
 #include "misc/worker.h"
@@ -28,11 +32,88 @@ using namespace swift::misc::simulation;
 
 namespace swift::misc::simulation
 {
-    CInterpolationLogger::CInterpolationLogger(QObject *parent) : QObject(parent)
+    namespace
+    {
+        //! Placeholder for the entries in a document
+        const QString &contentMarker()
+        {
+            static const QString m("{{content}}");
+            return m;
+        }
+
+        //! Output file of a log conversion, the entries are written one by one
+        class CLogOutput
+        {
+        public:
+            //! Open the file and write the document up to the content marker
+            bool open(const QString &fileName, const QString &document)
+            {
+                const qsizetype content = document.indexOf(contentMarker());
+                m_file.setFileName(fileName);
+                if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) { return false; }
+                if (content < 0) { this->write(document); }
+                else
+                {
+                    this->write(document.left(content));
+                    m_suffix = document.mid(content + contentMarker().size());
+                }
+                return true;
+            }
+
+            //! Opened?
+            bool isOpen() const { return m_file.isOpen(); }
+
+            //! Write an entry
+            void write(const QString &text) { m_file.write(text.toUtf8()); }
+
+            //! Write the rest of the document and close the file
+            bool close()
+            {
+                this->write(m_suffix);
+                const bool ok = m_file.error() == QFileDevice::NoError;
+                m_file.close();
+                return ok;
+            }
+
+            //! File name
+            QString fileName() const { return m_file.fileName(); }
+
+        private:
+            QFile m_file;
+            QString m_suffix;
+        };
+
+        //! File name of a pattern
+        QString fileOfPattern(const QString &pattern)
+        {
+            QString file = pattern;
+            file.remove('*');
+            return file;
+        }
+
+        //! Quoted for CSV
+        QString csvQuoted(const QString &value)
+        {
+            QString quoted = value;
+            quoted.replace('"', QStringLiteral("\"\""));
+            return inQuotes(quoted);
+        }
+
+        //! Length in ft for CSV, empty if null
+        QString csvFt(const CLength &length)
+        {
+            return length.isNull() ? QString() : QString::number(length.value(CLengthUnit::ft()), 'f', 1);
+        }
+    } // namespace
+
+    CInterpolationLogger::CInterpolationLogger(QObject *parent)
+        : QObject(parent), m_logFile(std::make_unique<CInterpolationLogFile>())
     {
         this->setObjectName("CInterpolationLogger");
     }
 
+    CInterpolationLogger::~CInterpolationLogger() = default;
+
     const QStringList &CInterpolationLogger::getLogCategories()
     {
         static const QStringList cats { CLogCategories::interpolator() };
@@ -41,23 +122,31 @@ namespace swift::misc::simulation
 
     CWorker *CInterpolationLogger::writeLogInBackground(bool clearLog)
     {
-        QList<SituationLog> situations;
-        QList<PartsLog> parts;
-        {
-            QReadLocker l(&m_lockSituations);
-            situations = m_situationLogs;
-        }
+        QString logFile;
         {
-            QReadLocker l(&m_lockParts);
-            parts = m_partsLogs;
+            QMutexLocker l(&m_lockFile);
+            logFile = m_logFile->getFileName();
+            if (clearLog)
+            {
+                m_logFile->stop();
+                m_logFileFailed = false;
+            }
+            else { m_logFile->flush(); }
         }
+        if (clearLog) { this->clearLatestLogs(); }
 
-        QPointer<CInterpolationLogger> myself(this);
-        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", [situations, parts, myself, clearLog]() {
-            const CStatusMessageList msg = CInterpolationLogger::writeLogFiles(situations, parts);
+        const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+        const QString outputPrefix = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), ts);
+        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", [logFile, outputPrefix, clearLog]() {
+            const CStatusMessageList msg =
+                logFile.isEmpty() ?
+                    CStatusMessageList(
+                        CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"No data for log")) :
+                    CInterpolationLogger::convertLogFile(logFile, outputPrefix);
             CLogMessage::preformatted(msg);
 
-            if (clearLog && myself) { myself->clearLog(); }
+            // a closed log file is not continued, the converted files replace it
+            if (clearLog && !logFile.isEmpty() && msg.isSuccess()) { QFile::remove(logFile); }
         });
         return worker;
     }
@@ -79,69 +168,138 @@ namespace swift::misc::simulation
 
     QString CInterpolationLogger::getLogDirectory() { return CSwiftDirectories::logDirectory(); }
 
-    CStatusMessageList CInterpolationLogger::writeLogFiles(const QList<SituationLog> &interpolation,
-                                                           const QList<PartsLog> &parts)
+    CStatusMessageList CInterpolationLogger::convertLogFile(const QString &logFile, const QString &outputPrefix,
+                                                            LogFormats formats)
     {
-        if (parts.isEmpty() && interpolation.isEmpty())
+        int situations = 0;
+        int parts = 0;
+        QString error;
+        CInterpolationLogReader reader;
+        if (!CInterpolationLogReader::countEntries(logFile, situations, parts, error) || !reader.open(logFile, error))
+        {
+            return CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).error(u"Cannot read log '%1': %2")
+                   << logFile << error;
+        }
+        if (situations < 1 && parts < 1)
         {
             return CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"No data for log");
         }
+
+        QString htmlTemplate = CFileUtils::readFileToString(CSwiftDirectories::htmlTemplateFilePath());
+        if (htmlTemplate.isEmpty()) { htmlTemplate = QStringLiteral("%1"); }
         static const QString html = QStringLiteral("Entries: %1\n\n%2");
-        const QString htmlTemplate = CFileUtils::readFileToString(CSwiftDirectories::htmlTemplateFilePath());
+        const CKmlUtils::KMLSettings lineSettings(true, false);
 
         CStatusMessageList msgs;
-        const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
-
-        const QString htmlInterpolation = CInterpolationLogger::getHtmlInterpolationLog(interpolation);
-        if (!htmlInterpolation.isEmpty())
+        const auto open = [&](CLogOutput &output, const QString &fileName, const QString &document) {
+            if (!output.open(fileName, document)) { msgs.push_back(logStatusFileWriting(false, fileName)); }
+        };
+        CLogOutput htmlSituations;
+        CLogOutput htmlParts;
+        CLogOutput kmlChangedSituations;
+        CLogOutput kmlInterpolatedSituations;
+        CLogOutput kmlElevations;
+        CLogOutput csvSituations;
+        CLogOutput csvParts;
+        if (formats.testFlag(LogHtml) && situations > 0)
         {
-            QString file = filePatternInterpolationLog();
-            file.remove('*');
-            const QString fn =
-                CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1 %2").arg(ts, file));
-            const bool s = CFileUtils::writeStringToFile(
-                htmlTemplate.arg(html.arg(interpolation.size()).arg(htmlInterpolation)), fn);
-            msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
+            open(htmlSituations, outputPrefix % u" " % fileOfPattern(filePatternInterpolationLog()),
+                 htmlTemplate.arg(html.arg(situations).arg(QString(u"<table class=\"small\">\n" %
+                                                                   getHtmlInterpolationLogHeader() % u"<tbody>\n" %
+                                                                   contentMarker() % u"</tbody>\n</table>\n"))));
         }
-
-        const QString htmlParts = CInterpolationLogger::getHtmlPartsLog(parts);
-        if (!htmlParts.isEmpty())
+        if (formats.testFlag(LogHtml) && parts > 0)
         {
-            QString file = filePatternPartsLog();
-            file.remove('*');
-            const QString fn =
-                CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1 %2").arg(ts, file));
-            const bool s = CFileUtils::writeStringToFile(htmlTemplate.arg(html.arg(parts.size()).arg(htmlParts)), fn);
-            msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
+            open(htmlParts, outputPrefix % u" " % fileOfPattern(filePatternPartsLog()),
+                 htmlTemplate.arg(html.arg(parts).arg(QString(u"<table class=\"small\">\n" % getHtmlPartsLogHeader() %
+                                                              u"<tbody>\n" % contentMarker() %
+                                                              u"</tbody>\n</table>\n"))));
         }
-
-        QString kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlChangedSituations(interpolation));
-        if (!kml.isEmpty())
+        if (formats.testFlag(LogKml) && situations > 0)
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(),
-                                                           QStringLiteral("%1_changedSituations.kml").arg(ts));
-            const bool s = CFileUtils::writeStringToFile(kml, fn);
-            msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
+            open(kmlChangedSituations, outputPrefix % u"_changedSituations.kml",
+                 CKmlUtils::wrapAsKmlDocument(contentMarker()));
+            open(kmlInterpolatedSituations, outputPrefix % u"_interpolatedSituations.kml",
+                 CKmlUtils::wrapAsKmlDocument(u"<Placemark>\n<name>Interpolation " % QString::number(situations) %
+                                              u"entries</name>\n" %
+                                              CKmlUtils::asLineString(contentMarker(), lineSettings) %
+                                              u"</Placemark>\n"));
+            open(kmlElevations, outputPrefix % u"_elevations.kml", CKmlUtils::wrapAsKmlDocument(contentMarker()));
         }
-
-        kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlInterpolatedSituations(interpolation));
-        if (!kml.isEmpty())
+        if (formats.testFlag(LogCsv) && situations > 0)
+        {
+            open(csvSituations, outputPrefix % u" interpolation.csv", getCsvInterpolationLogHeader());
+        }
+        if (formats.testFlag(LogCsv) && parts > 0)
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(),
-                                                           QStringLiteral("%1_interpolatedSituations.kml").arg(ts));
-            const bool s = CFileUtils::writeStringToFile(kml, fn);
-            msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
+            open(csvParts, outputPrefix % u" parts.csv", getCsvPartsLogHeader());
         }
 
-        kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlElevations(interpolation));
-        if (!kml.isEmpty())
+        qint64 firstTs = -1;
+        qint64 newPosTs = -1; // HTML, starting with the first log
+        qint64 changedPosTs = -1; // KML changed situations
+        qint64 elevationPosTs = -1; // KML elevations
+        int changedNo = 1;
+        int elevationNo = 1;
+        CAircraftParts lastSituationParts; // default, so shown if parts are different from default
+        CAircraftParts lastParts;
+        for (auto entry = reader.next(); entry != CInterpolationLogReader::NoEntry; entry = reader.next())
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(),
-                                                           QStringLiteral("%1_elevations.kml").arg(ts));
-            const bool s = CFileUtils::writeStringToFile(kml, fn);
-            msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
+            if (entry == CInterpolationLogReader::PartsEntry)
+            {
+                const PartsLog &log = reader.getPartsLog();
+                const bool changedParts = (lastParts != log.parts);
+                lastParts = log.parts;
+                if (htmlParts.isOpen()) { htmlParts.write(getHtmlPartsLogRow(log, changedParts)); }
+                if (csvParts.isOpen()) { csvParts.write(getCsvPartsLogRow(log)); }
+                continue;
+            }
+
+            const SituationLog &log = reader.getSituationLog();
+            const qint64 newTs = log.newestInterpolationSituation().getMSecsSinceEpoch();
+            if (firstTs < 0)
+            {
+                firstTs = log.tsCurrent;
+                newPosTs = newTs;
+            }
+            if (htmlSituations.isOpen())
+            {
+                const bool changedParts = (lastSituationParts != log.parts);
+                htmlSituations.write(getHtmlInterpolationLogRow(log, firstTs, newPosTs != newTs, changedParts));
+                newPosTs = newTs;
+                lastSituationParts = log.parts;
+            }
+            if (kmlChangedSituations.isOpen() && (changedPosTs != newTs || log.interpolantRecalc))
+            {
+                kmlChangedSituations.write(getKmlChangedSituation(log, changedNo++, changedPosTs != newTs));
+                changedPosTs = newTs;
+            }
+            if (kmlElevations.isOpen() && (elevationPosTs != newTs || log.interpolantRecalc) &&
+                log.newestInterpolationSituation().hasGroundElevation())
+            {
+                kmlElevations.write(getKmlElevation(log, elevationNo++));
+                elevationPosTs = newTs;
+            }
+            if (kmlInterpolatedSituations.isOpen())
+            {
+                kmlInterpolatedSituations.write(
+                    CKmlUtils::asRawCoordinates(log.situationCurrent, lineSettings.withAltitude) % u"\n");
+            }
+            if (csvSituations.isOpen()) { csvSituations.write(getCsvInterpolationLogRow(log)); }
+        }
+        if (!reader.getErrorMessage().isEmpty())
+        {
+            msgs.push_back(CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"%1")
+                           << reader.getErrorMessage());
         }
 
+        for (CLogOutput *output : { &htmlSituations, &htmlParts, &kmlChangedSituations, &kmlInterpolatedSituations,
+                                    &kmlElevations, &csvSituations, &csvParts })
+        {
+            if (!output->isOpen()) { continue; }
+            const QString fileName = output->fileName();
+            msgs.push_back(CInterpolationLogger::logStatusFileWriting(output->close(), fileName));
+        }
         return msgs;
     }
 
@@ -156,113 +314,177 @@ namespace swift::misc::simulation
 
     void CInterpolationLogger::logInterpolation(const SituationLog &log)
     {
-        QWriteLocker l(&m_lockSituations);
-        m_situationLogs.push_back(log);
-        if (m_situationLogs.size() > m_maxSituations) { m_situationLogs.removeFirst(); }
+        const CCallsignHandle handle = CCallsignHandle::intern(log.callsign);
+        if (handle.isNull()) { return; }
+        {
+            QWriteLocker l(&m_lockSituations);
+            m_lastSituationLogs.insert(handle, log);
+            m_lastSituationCallsign = handle;
+        }
+
+        QMutexLocker l(&m_lockFile);
+        if (m_maxSituations >= 0 && m_situationsInFile >= m_maxSituations)
+        {
+            if (m_situationsInFile == m_maxSituations) // reported once
+            {
+                CLogMessage(this).info(u"Interpolation log has %1 situations, write or clear it to continue")
+                    << m_maxSituations;
+                m_situationsInFile++;
+            }
+            return;
+        }
+        if (!this->startLogFile()) { return; }
+        if (m_logFile->append(log)) { m_situationsInFile++; }
     }
 
     void CInterpolationLogger::logParts(const PartsLog &log)
     {
-        QWriteLocker l(&m_lockParts);
-        m_partsLogs.push_back(log);
-    }
+        const CCallsignHandle handle = CCallsignHandle::intern(log.callsign);
+        if (handle.isNull()) { return; }
+        {
+            QWriteLocker l(&m_lockParts);
+            m_lastPartsLogs.insert(handle, log);
+            m_lastPartsCallsign = handle;
+        }
 
-    void CInterpolationLogger::setMaxSituations(int max)
-    {
-        QReadLocker l(&m_lockSituations);
-        m_maxSituations = max;
+        QMutexLocker l(&m_lockFile);
+        if (!this->startLogFile()) { return; }
+        m_logFile->append(log);
     }
 
-    QList<SituationLog> CInterpolationLogger::getSituationsLog() const
+    bool CInterpolationLogger::startLogFile()
     {
-        QReadLocker l(&m_lockSituations);
-        return m_situationLogs;
-    }
+        if (m_logFile->isRunning()) { return true; }
+        if (m_logFileFailed) { return false; }
 
-    QList<PartsLog> CInterpolationLogger::getPartsLog() const
-    {
-        QReadLocker l(&m_lockParts);
-        return m_partsLogs;
-    }
+        // log files left over, e.g. not converted before shutdown
+        const QString logDir = CSwiftDirectories::logDirectory();
+        QDir dir(logDir);
+        for (const QString &leftOver : dir.entryList({ filePatternLogFile() }, QDir::Files))
+        {
+            dir.remove(leftOver);
+        }
 
-    QList<SituationLog> CInterpolationLogger::getSituationsLog(const CCallsign &cs) const
-    {
-        const QList<SituationLog> copy(this->getSituationsLog());
-        QList<SituationLog> logs;
-        for (const SituationLog &log : copy)
+        const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+        const QString fileName = CFileUtils::appendFilePaths(
+            logDir, QStringLiteral("%1 %2").arg(ts, fileOfPattern(filePatternLogFile())));
+        QString error;
+        if (!QDir().mkpath(logDir) || !m_logFile->start(fileName, error))
         {
-            if (log.callsign != cs) { continue; }
-            logs.push_back(log);
+            m_logFileFailed = true;
+            CLogMessage(this).error(u"Cannot write interpolation log '%1': %2") << fileName << error;
+            return false;
         }
-        return logs;
+        m_situationsInFile = 0;
+        return true;
     }
 
-    QList<PartsLog> CInterpolationLogger::getPartsLog(const CCallsign &cs) const
+    void CInterpolationLogger::setMaxSituations(int max)
     {
-        const QList<PartsLog> copy(this->getPartsLog());
-        QList<PartsLog> logs;
-        for (const PartsLog &log : copy)
-        {
-            if (log.callsign != cs) { continue; }
-            logs.push_back(log);
-        }
-        return logs;
+        QMutexLocker l(&m_lockFile);
+        m_maxSituations = max;
+    }
+
+    QString CInterpolationLogger::getLogFileName() const { return m_logFile->getFileName(); }
+
+    void CInterpolationLogger::addMemoryFootprint(CMemoryFootprint &footprint) const
+    {
+        QReadLocker ls(&m_lockSituations);
+        const int situations = m_lastSituationLogs.size();
+        ls.unlock();
+        QReadLocker lp(&m_lockParts);
+        const int parts = m_lastPartsLogs.size();
+        lp.unlock();
+        footprint.addCount(QStringLiteral("interpolation log"), situations);
+        footprint.addCount(QStringLiteral("interpolation parts log"), parts);
+        footprint.add(QStringLiteral("interpolation log file buffers"), m_logFile->getPendingBytes());
+    }
+
+    CMemoryFootprint::Estimator CInterpolationLogger::getMemoryFootprintEstimator() const
+    {
+        QReadLocker ls(&m_lockSituations);
+        const std::vector<SituationLog> situationLogs = m_lastSituationLogs.values();
+        ls.unlock();
+        QReadLocker lp(&m_lockParts);
+        const std::vector<PartsLog> partsLogs = m_lastPartsLogs.values();
+        lp.unlock();
+        const qint64 pendingBytes = m_logFile->getPendingBytes();
+
+        return [=](CMemoryFootprint &footprint) {
+            qint64 situationBytes = 0;
+            for (const SituationLog &log : situationLogs)
+            {
+                situationBytes += sizeof(SituationLog) + heapSize(log.elevationInfo) + heapSize(log.altCorrection) +
+                                  heapSize(log.callsign) + heapSize(log.parts) +
+                                  heapSize(log.interpolationSituations) + heapSize(log.situationCurrent) +
+                                  heapSize(log.change) + heapSize(log.usedSetup);
+            }
+            footprint.add(QStringLiteral("interpolation log"), situationBytes, static_cast<int>(situationLogs.size()));
+
+            qint64 partsBytes = 0;
+            for (const PartsLog &log : partsLogs)
+            {
+                partsBytes += sizeof(PartsLog) + heapSize(log.callsign) + heapSize(log.parts);
+            }
+            footprint.add(QStringLiteral("interpolation parts log"), partsBytes, static_cast<int>(partsLogs.size()));
+            footprint.add(QStringLiteral("interpolation log file buffers"), pendingBytes);
+        };
     }
 
     SituationLog CInterpolationLogger::getLastSituationLog() const
     {
         QReadLocker l(&m_lockSituations);
-        if (m_situationLogs.isEmpty()) { return {}; }
-        return m_situationLogs.last();
+        return m_lastSituationLogs.value(m_lastSituationCallsign);
     }
 
     SituationLog CInterpolationLogger::getLastSituationLog(const CCallsign &cs) const
     {
-        const QList<SituationLog> copy(this->getSituationsLog(cs));
-        if (copy.isEmpty()) { return {}; }
-        return copy.last();
+        const CCallsignHandle handle = CCallsignHandle::find(cs);
+        QReadLocker l(&m_lockSituations);
+        return m_lastSituationLogs.value(handle);
     }
 
     CAircraftSituation CInterpolationLogger::getLastSituation() const
     {
         QReadLocker l(&m_lockSituations);
-        if (m_situationLogs.isEmpty()) { return {}; }
-        return m_situationLogs.last().situationCurrent;
+        const SituationLog *log = m_lastSituationLogs.find(m_lastSituationCallsign);
+        return log ? log->situationCurrent : CAircraftSituation();
     }
 
     CAircraftSituation CInterpolationLogger::getLastSituation(const CCallsign &cs) const
     {
-        const QList<SituationLog> copy(this->getSituationsLog(cs));
-        if (copy.isEmpty()) { return {}; }
-        return copy.last().situationCurrent;
+        const CCallsignHandle handle = CCallsignHandle::find(cs);
+        QReadLocker l(&m_lockSituations);
+        const SituationLog *log = m_lastSituationLogs.find(handle);
+        return log ? log->situationCurrent : CAircraftSituation();
     }
 
     CAircraftParts CInterpolationLogger::getLastParts() const
     {
         QReadLocker l(&m_lockParts);
-        if (m_partsLogs.isEmpty()) { return {}; }
-        return m_partsLogs.last().parts;
+        const PartsLog *log = m_lastPartsLogs.find(m_lastPartsCallsign);
+        return log ? log->parts : CAircraftParts();
     }
 
     CAircraftParts CInterpolationLogger::getLastParts(const CCallsign &cs) const
     {
-        const QList<PartsLog> copy(this->getPartsLog(cs));
-        if (copy.isEmpty()) { return {}; }
-        return copy.last().parts;
+        const CCallsignHandle handle = CCallsignHandle::find(cs);
+        QReadLocker l(&m_lockParts);
+        const PartsLog *log = m_lastPartsLogs.find(handle);
+        return log ? log->parts : CAircraftParts();
     }
 
     PartsLog CInterpolationLogger::getLastPartsLog() const
     {
         QReadLocker l(&m_lockParts);
-        if (m_partsLogs.isEmpty()) { return {}; }
-        return m_partsLogs.last();
+        return m_lastPartsLogs.value(m_lastPartsCallsign);
     }
 
     PartsLog CInterpolationLogger::getLastPartsLog(const CCallsign &cs) const
     {
-        const QList<PartsLog> copy(this->getPartsLog(cs));
-        if (copy.isEmpty()) { return {}; }
-        return copy.last();
+        const CCallsignHandle handle = CCallsignHandle::find(cs);
+        QReadLocker l(&m_lockParts);
+        return m_lastPartsLogs.value(handle);
     }
 
     const QString &CInterpolationLogger::filePatternInterpolationLog()
@@ -277,15 +499,20 @@ namespace swift::misc::simulation
         return p;
     }
 
+    const QString &CInterpolationLogger::filePatternLogFile()
+    {
+        static const QString p(QStringLiteral("*interpolation.") % QLatin1String(CInterpolationLogFile::FileExtension));
+        return p;
+    }
+
     const QStringList &CInterpolationLogger::filePatterns()
     {
-        static const QStringList l({ filePatternInterpolationLog(), filePatternPartsLog() });
+        static const QStringList l({ filePatternInterpolationLog(), filePatternPartsLog(), filePatternLogFile() });
         return l;
     }
 
-    QString CInterpolationLogger::getHtmlInterpolationLog(const QList<SituationLog> &logs)
+    const QString &CInterpolationLogger::getHtmlInterpolationLogHeader()
     {
-        if (logs.isEmpty()) { return {}; }
         static const QString tableHeader =
             QStringLiteral(u"<thead><tr>"
                            u"<th title=\"changed situation\">cs.</th><th>Int</th>"
@@ -302,191 +529,185 @@ namespace swift::misc::simulation
                            u"<th>CG</th>"
                            u"<th>parts</th><th title=\"changed parts\">cp.</th><th>parts details</th>"
                            u"</tr></thead>\n");
+        return tableHeader;
+    }
 
+    QString CInterpolationLogger::getHtmlInterpolationLogRow(const SituationLog &log, qint64 firstTs,
+                                                             bool changedNewPosition, bool changedParts)
+    {
         static const CLengthUnit ft = CLengthUnit::ft();
-        const SituationLog firstLog = logs.first();
-        qint64 newPosTs = firstLog.newestInterpolationSituation().getMSecsSinceEpoch();
-        CAircraftParts lastParts; // default, so shown if parts are different from default
-
-        QString tableRows("<tbody>\n");
-        for (const SituationLog &log : logs)
-        {
-            const CAircraftSituation situationOld = log.oldestInterpolationSituation();
-            const CAircraftSituation situationNew = log.newestInterpolationSituation();
-            const CAircraftSituation situation2nd = log.secondInterpolationSituation();
-            const bool changedNewPosition = (newPosTs != situationNew.getMSecsSinceEpoch());
-            const bool changedParts = (lastParts != log.parts);
-            newPosTs = situationNew.getMSecsSinceEpoch();
-            lastParts = log.parts;
-
-            // fixme KB 2018/12 comment and tableRows can be removed if there are no further issues
-            // concatenating in multiple steps, otherwise C4503 warnings
-            tableRows +=
-                u"<tr>" %
-                (changedNewPosition ? QStringLiteral("<td class=\"changed\">*</td>") : QStringLiteral("<td></td>")) %
-                u"<td>" % log.interpolator % u"</td>" % u"<td>" % boolToYesNo(log.interpolantRecalc) %
-                u"</td>"
-                u"<td>" %
-                log.callsign.asString() % u"</td>" % u"<td>" % msSinceEpochToTime(log.tsCurrent) % u"</td>" % u"<td>" %
-                QString::number(log.tsCurrent - firstLog.tsCurrent) % u"</td>" %
-
-                u"<td class=\"old\">" % situationOld.getTimestampAndOffset(true) % u"</td>" % u"<td class=\"new\">" %
-                situationNew.getTimestampAndOffset(true) % u"</td>" % u"<td class=\"cur\">" %
-                log.situationCurrent.getTimestampAndOffset(true) % u"</td>" %
-
-                u"<td>" % msSinceEpochToTime(log.tsInterpolated) % u"</td>" % u"<td>" %
-                QString::number(log.deltaSampleTimesMs) % u"ms</td>" % u"<td>" % QString::number(log.simTimeFraction) %
-                u"</td>" %
-
-                // tableRows +=
-                u"<td class=\"old\">" % situationOld.latitudeAsString() % u"</td>" % u"<td class=\"new\">" %
-                situationNew.latitudeAsString() % u"</td>" % u"<td class=\"cur\">" %
-                log.situationCurrent.latitudeAsString() % u"</td>" %
-
-                u"<td class=\"old\">" % situationOld.longitudeAsString() % u"</td>" % u"<td class=\"new\">" %
-                situationNew.longitudeAsString() % u"</td>" % u"<td class=\"cur\">" %
-                log.situationCurrent.longitudeAsString() % u"</td>" %
-
-                // tableRows +=
-                u"<td class=\"old\">" % situationOld.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
-                u"<td class=\"old\">" % situation2nd.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
-                u"<td class=\"new\">" % situationNew.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
-                u"<td class=\"cur\">" % log.situationCurrent.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
-
-                u"<td class=\"old\">" % situationOld.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
-                situationOld.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"old\">" %
-                situation2nd.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
-                situation2nd.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"new\">" %
-                situationNew.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
-                situationNew.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"cur\">" %
-                log.situationCurrent.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
-                log.situationCurrent.getGroundElevationInfoAsString() % u"</td>" %
-
-                u"<td>" % QString::number(log.groundFactor) % u"</td>" % u"<td class=\"old\">" %
-                situationOld.getOnGroundInfo().toQString() % u"</td>" % u"<td class=\"new\">" %
-                situationNew.getOnGroundInfo().toQString() % u"</td>" % u"<td class=\"cur\">" %
-                log.situationCurrent.getOnGroundInfo().toQString() % u"</td>" %
-
-                // tableRows +=
-                u"<td>" % log.cgAboveGround.valueRoundedWithUnit(ft, 0) % u"</td>" % u"<td>" %
-                boolToYesNo(log.useParts) % u"</td>" % (changedParts ? u"<td class=\"changed\">*</td>" : u"<td></td>") %
-                u"<td>" %
-                (!log.useParts || log.parts.isNull() ? QString() : log.parts.toQString(true).toHtmlEscaped()) %
-                u"</td>" % u"</tr>\n";
-        }
-
-        tableRows += QStringLiteral("</tbody>\n");
-        return u"<table class=\"small\">\n" % tableHeader % tableRows % u"</table>\n";
+        const CAircraftSituation situationOld = log.oldestInterpolationSituation();
+        const CAircraftSituation situationNew = log.newestInterpolationSituation();
+        const CAircraftSituation situation2nd = log.secondInterpolationSituation();
+
+        // concatenating in multiple steps, otherwise C4503 warnings
+        QString row =
+            u"<tr>" %
+            (changedNewPosition ? QStringLiteral("<td class=\"changed\">*</td>") : QStringLiteral("<td></td>")) %
+            u"<td>" % log.interpolator % u"</td>" % u"<td>" % boolToYesNo(log.interpolantRecalc) %
+            u"</td>"
+            u"<td>" %
+            log.callsign.asString() % u"</td>" % u"<td>" % msSinceEpochToTime(log.tsCurrent) % u"</td>" % u"<td>" %
+            QString::number(log.tsCurrent - firstTs) % u"</td>" %
+
+            u"<td class=\"old\">" % situationOld.getTimestampAndOffset(true) % u"</td>" % u"<td class=\"new\">" %
+            situationNew.getTimestampAndOffset(true) % u"</td>" % u"<td class=\"cur\">" %
+            log.situationCurrent.getTimestampAndOffset(true) % u"</td>" %
+
+            u"<td>" % msSinceEpochToTime(log.tsInterpolated) % u"</td>" % u"<td>" %
+            QString::number(log.deltaSampleTimesMs) % u"ms</td>" % u"<td>" % QString::number(log.simTimeFraction) %
+            u"</td>";
+
+        row += u"<td class=\"old\">" % situationOld.latitudeAsString() % u"</td>" % u"<td class=\"new\">" %
+               situationNew.latitudeAsString() % u"</td>" % u"<td class=\"cur\">" %
+               log.situationCurrent.latitudeAsString() % u"</td>" %
+
+               u"<td class=\"old\">" % situationOld.longitudeAsString() % u"</td>" % u"<td class=\"new\">" %
+               situationNew.longitudeAsString() % u"</td>" % u"<td class=\"cur\">" %
+               log.situationCurrent.longitudeAsString() % u"</td>";
+
+        row += u"<td class=\"old\">" % situationOld.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
+               u"<td class=\"old\">" % situation2nd.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
+               u"<td class=\"new\">" % situationNew.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
+               u"<td class=\"cur\">" % log.situationCurrent.getAltitude().valueRoundedWithUnit(ft, 1) % u"</td>" %
+
+               u"<td class=\"old\">" % situationOld.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
+               situationOld.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"old\">" %
+               situation2nd.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
+               situation2nd.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"new\">" %
+               situationNew.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
+               situationNew.getGroundElevationInfoAsString() % u"</td>" % u"<td class=\"cur\">" %
+               log.situationCurrent.getGroundElevation().valueRoundedWithUnit(ft, 1) % u" " %
+               log.situationCurrent.getGroundElevationInfoAsString() % u"</td>" %
+
+               u"<td>" % QString::number(log.groundFactor) % u"</td>" % u"<td class=\"old\">" %
+               situationOld.getOnGroundInfo().toQString() % u"</td>" % u"<td class=\"new\">" %
+               situationNew.getOnGroundInfo().toQString() % u"</td>" % u"<td class=\"cur\">" %
+               log.situationCurrent.getOnGroundInfo().toQString() % u"</td>";
+
+        row += u"<td>" % log.cgAboveGround.valueRoundedWithUnit(ft, 0) % u"</td>" % u"<td>" %
+               boolToYesNo(log.useParts) % u"</td>" % (changedParts ? u"<td class=\"changed\">*</td>" : u"<td></td>") %
+               u"<td>" % (!log.useParts || log.parts.isNull() ? QString() : log.parts.toQString(true).toHtmlEscaped()) %
+               u"</td>" % u"</tr>\n";
+        return row;
+    }
+
+    QString CInterpolationLogger::getKmlChangedSituation(const SituationLog &log, int n, bool changedNewPosition)
+    {
+        static const CKmlUtils::KMLSettings s(true, true);
+        const CAircraftSituation situationNew = log.newestInterpolationSituation();
+        return CKmlUtils::asPlacemark(QStringLiteral("%1: %2 new pos: %3 recalc: %4")
+                                          .arg(n)
+                                          .arg(situationNew.getFormattedUtcTimestampHmsz(),
+                                               boolToYesNo(changedNewPosition), boolToYesNo(log.interpolantRecalc)),
+                                      situationNew.toQString(true), situationNew, s) %
+               u"\n";
+    }
+
+    QString CInterpolationLogger::getKmlElevation(const SituationLog &log, int n)
+    {
+        static const CKmlUtils::KMLSettings s(true, true);
+        const CAircraftSituation situationNew = log.newestInterpolationSituation();
+        return CKmlUtils::asPlacemark(QStringLiteral("%1: %2 %3 info: %4 alt.cor: %5")
+                                          .arg(n)
+                                          .arg(situationNew.getFormattedUtcTimestampHmsz(),
+                                               situationNew.getGroundElevationAndInfo(), log.elevationInfo,
+                                               log.altCorrection),
+                                      situationNew.getGroundElevationPlane().toQString(true),
+                                      situationNew.getGroundElevationPlane(), s) %
+               u"\n";
+    }
+
+    const QString &CInterpolationLogger::getHtmlPartsLogHeader()
+    {
+        static const QString tableHeader = QStringLiteral(u"<thead><tr>"
+                                                          u"<th>CS</th><th>timestamp</th>"
+                                                          u"<th>c.</th>"
+                                                          u"<th>parts</th>"
+                                                          u"</tr></thead>\n");
+        return tableHeader;
     }
 
-    QString CInterpolationLogger::getKmlChangedSituations(const QList<SituationLog> &logs)
+    QString CInterpolationLogger::getHtmlPartsLogRow(const PartsLog &log, bool changedParts)
     {
-        if (logs.isEmpty()) { return {}; }
-
-        QString kml;
-        qint64 newPosTs = -1;
-        int n = 1;
-        const CKmlUtils::KMLSettings s(true, true);
-
-        for (const SituationLog &log : logs)
-        {
-            const CAircraftSituation situationNew = log.newestInterpolationSituation();
-            const bool changedNewPosition = (newPosTs != situationNew.getMSecsSinceEpoch());
-            const bool recalc = log.interpolantRecalc;
-            if (!changedNewPosition && !recalc) { continue; }
-            newPosTs = situationNew.getMSecsSinceEpoch();
-            kml += CKmlUtils::asPlacemark(QStringLiteral("%1: %2 new pos: %3 recalc: %4")
-                                              .arg(n++)
-                                              .arg(situationNew.getFormattedUtcTimestampHmsz(),
-                                                   boolToYesNo(changedNewPosition), boolToYesNo(recalc)),
-                                          situationNew.toQString(true), situationNew, s) %
-                   u"\n";
-        }
-
-        return kml;
+        return u"<tr><td>" % log.callsign.asString() % u"</td>" % u"<td>" % msSinceEpochToTime(log.tsCurrent) %
+               u"</td>" % (changedParts ? u"<td class=\"changed\">*</td>" : u"<td></td>") % u"<td>" %
+               (log.empty ? QStringLiteral("empty") : log.parts.toQString()) % u"</td></tr>";
     }
 
-    QString CInterpolationLogger::getKmlElevations(const QList<SituationLog> &logs)
+    const QString &CInterpolationLogger::getCsvInterpolationLogHeader()
     {
-        if (logs.isEmpty()) { return {}; }
-
-        QString kml;
-        qint64 newPosTs = -1;
-        int n = 1;
-        const CKmlUtils::KMLSettings s(true, true);
-
-        for (const SituationLog &log : logs)
-        {
-            const CAircraftSituation situationNew = log.newestInterpolationSituation();
-            const bool changedNewPosition = (newPosTs != situationNew.getMSecsSinceEpoch());
-            const bool recalc = log.interpolantRecalc;
-            if (!changedNewPosition && !recalc) { continue; }
-            if (!situationNew.hasGroundElevation()) { continue; }
-            newPosTs = situationNew.getMSecsSinceEpoch();
-            kml += CKmlUtils::asPlacemark(QStringLiteral("%1: %2 %3 info: %4 alt.cor: %5")
-                                              .arg(n++)
-                                              .arg(situationNew.getFormattedUtcTimestampHmsz(),
-                                                   situationNew.getGroundElevationAndInfo(), log.elevationInfo,
-                                                   log.altCorrection),
-                                          situationNew.getGroundElevationPlane().toQString(true),
-                                          situationNew.getGroundElevationPlane(), s) %
-                   u"\n";
-        }
-
-        return kml;
+        static const QString header =
+            QStringLiteral("callsign,timestamp,interpolator,recalculated,interpolated timestamp,sample dt ms,"
+                           "fraction,latitude,longitude,altitude ft,elevation ft,elevation info,ground factor,"
+                           "on ground,cg ft,scenery offset ft,network situations,invalid situations,"
+                           "old timestamp,new timestamp,uses parts,parts,elevation details,altitude correction\n");
+        return header;
     }
 
-    QString CInterpolationLogger::getKmlInterpolatedSituations(const QList<SituationLog> &logs)
+    QString CInterpolationLogger::getCsvInterpolationLogRow(const SituationLog &log)
     {
-        if (logs.isEmpty()) { return {}; }
-
-        const CKmlUtils::KMLSettings s(true, false);
-        QString coordinates;
-        for (const SituationLog &log : logs)
-        {
-            const CAircraftSituation situation = log.situationCurrent;
-            coordinates += CKmlUtils::asRawCoordinates(situation, s.withAltitude) % u"\n";
-        }
+        const CAircraftSituation &situation = log.situationCurrent;
+        const QString latitude =
+            situation.isPositionNull() ? QString() :
+                                         QString::number(situation.latitude().value(CAngleUnit::deg()), 'f', 8);
+        const QString longitude =
+            situation.isPositionNull() ? QString() :
+                                         QString::number(situation.longitude().value(CAngleUnit::deg()), 'f', 8);
+        QString row = csvQuoted(log.callsign.asString()) % u',' % QString::number(log.tsCurrent) % u',' %
+                      log.interpolator % u',' % boolToYesNo(log.interpolantRecalc) % u',' %
+                      QString::number(log.tsInterpolated) % u',' % QString::number(log.deltaSampleTimesMs) % u',' %
+                      QString::number(log.simTimeFraction) % u',' % latitude % u',' % longitude % u',';
+        row += csvFt(situation.getAltitude()) % u',' %
+               (situation.hasGroundElevation() ? csvFt(situation.getGroundElevation()) : QString()) % u',' %
+               csvQuoted(situation.getGroundElevationInfoAsString()) % u',' % QString::number(log.groundFactor) %
+               u',' % csvQuoted(situation.getOnGroundInfo().toQString()) % u',' % csvFt(log.cgAboveGround) % u',' %
+               csvFt(log.sceneryOffset) % u',' % QString::number(log.noNetworkSituations) % u',' %
+               QString::number(log.noInvalidSituations) % u',';
+        row += QString::number(log.oldestInterpolationSituation().getMSecsSinceEpoch()) % u',' %
+               QString::number(log.newestInterpolationSituation().getMSecsSinceEpoch()) % u',' %
+               boolToYesNo(log.useParts) % u',' %
+               csvQuoted(!log.useParts || log.parts.isNull() ? QString() : log.parts.toQString(true)) % u',' %
+               csvQuoted(log.elevationInfo) % u',' % csvQuoted(log.altCorrection) % u'\n';
+        return row;
+    }
 
-        return u"<Placemark>\n"
-               u"<name>Interpolation " %
-               QString::number(logs.size()) % u"entries</name>\n" % CKmlUtils::asLineString(coordinates, s) %
-               u"</Placemark>\n";
+    const QString &CInterpolationLogger::getCsvPartsLogHeader()
+    {
+        static const QString header = QStringLiteral("callsign,timestamp,empty,network parts,parts\n");
+        return header;
     }
 
-    QString CInterpolationLogger::getHtmlPartsLog(const QList<PartsLog> &logs)
+    QString CInterpolationLogger::getCsvPartsLogRow(const PartsLog &log)
     {
-        if (logs.isEmpty()) { return {}; }
-        static const QString tableHeader = QStringLiteral(u"<thead><tr>"
-                                                          u"<th>CS</th><th>timestamp</th>"
-                                                          u"<th>c.</th>"
-                                                          u"<th>parts</th>"
-                                                          u"</tr></thead>\n");
+        return csvQuoted(log.callsign.asString()) % u',' % QString::number(log.tsCurrent) % u',' %
+               boolToYesNo(log.empty) % u',' % QString::number(log.noNetworkParts) % u',' %
+               csvQuoted(log.empty ? QString() : log.parts.toQString()) % u'\n';
+    }
 
-        CAircraftParts lastParts; // default, so shown if parts are different from default
-        QString tableRows("<tbody>\n");
-        for (const PartsLog &log : logs)
+    void CInterpolationLogger::clearLog()
+    {
         {
-            const bool changedParts = (lastParts != log.parts);
-            lastParts = log.parts;
-            tableRows += u"<tr><td>" % log.callsign.asString() % u"</td>" % u"<td>" %
-                         msSinceEpochToTime(log.tsCurrent) % u"</td>" %
-                         (changedParts ? u"<td class=\"changed\">*</td>" : u"<td></td>") % u"<td>" %
-                         (log.empty ? QStringLiteral("empty") : log.parts.toQString()) % u"</td></tr>";
+            QMutexLocker l(&m_lockFile);
+            const QString fileName = m_logFile->getFileName();
+            m_logFile->stop();
+            if (!fileName.isEmpty()) { QFile::remove(fileName); }
+            m_logFileFailed = false;
         }
-        tableRows += "</tbody>\n";
-        return QStringLiteral("<table class=\"small\">\n") % tableHeader % tableRows % QStringLiteral("</table>\n");
+        this->clearLatestLogs();
     }
 
-    void CInterpolationLogger::clearLog()
+    void CInterpolationLogger::clearLatestLogs()
     {
         {
             QWriteLocker l(&m_lockSituations);
-            m_situationLogs.clear();
+            m_lastSituationLogs.clear();
+            m_lastSituationCallsign = {};
         }
         {
             QWriteLocker l(&m_lockParts);
-            m_partsLogs.clear();
+            m_lastPartsLogs.clear();
+            m_lastPartsCallsign = {};
         }
     }
 
@@ -6,13 +6,20 @@
 #ifndef SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGGER_H
 #define SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGGER_H
 
+#include <memory>
+
+#include <QFlags>
+#include <QMutex>
 #include <QObject>
+#include <QReadWriteLock>
 #include <QStringList>
 #include <QtGlobal>
 
 #include "misc/aviation/aircraftpartslist.h"
 #include "misc/aviation/aircraftsituationchange.h"
 #include "misc/aviation/aircraftsituationlist.h"
+#include "misc/aviation/callsignhandle.h"
+#include "misc/memoryfootprint.h"
 #include "misc/simulation/interpolation/interpolationrenderingsetup.h"
 #include "misc/simulation/remoteaircraftprovider.h"
 
@@ -21,6 +28,8 @@ namespace swift::misc
     class CWorker;
     namespace simulation
     {
+        class CInterpolationLogFile;
+
         //! Log entry for situation interpolation
         struct SWIFT_MISC_EXPORT SituationLog
         {
@@ -86,22 +95,43 @@ namespace swift::misc
             QString toQString(const QString &separator = { " " }) const;
         };
 
-        //! Record internal state of interpolator for debugging
+        /*!
+         * Record internal state of interpolator for debugging.
+         *
+         * Logs are streamed to a binary log file in the log directory while logging, only the latest log per callsign
+         * is kept in memory. Writing the log converts that file into HTML, KML and CSV files.
+         * \sa CInterpolationLogFile
+         */
         class SWIFT_MISC_EXPORT CInterpolationLogger : public QObject
         {
             Q_OBJECT
 
         public:
+            //! Formats of converted logs
+            enum LogFormat
+            {
+                LogHtml = 1 << 0, //!< situations and parts as HTML tables
+                LogKml = 1 << 1, //!< changed, interpolated situations and elevations as KML
+                LogCsv = 1 << 2, //!< situations and parts as CSV
+                LogAllFormats = LogHtml | LogKml | LogCsv
+            };
+            Q_DECLARE_FLAGS(LogFormats, LogFormat)
+
             //! Constructor
             CInterpolationLogger(QObject *parent = nullptr);
 
+            //! Destructor, writes the log file
+            ~CInterpolationLogger() override;
+
             //! Log categories
             static const QStringList &getLogCategories();
 
-            //! Write a log in background
+            //! Convert the log file in background
+            //! \param clearLog close the log file and clear the latest logs, logging continues in a new file,
+            //!                 the converted file is removed
             CWorker *writeLogInBackground(bool clearLog);
 
-            //! Clear log file
+            //! Close and remove the log file, clear the latest logs
             void clearLog();
 
             //! Latest log files: 0: Interpolation / 1: Parts
@@ -110,34 +140,23 @@ namespace swift::misc
             //! Get the log directory
             static QString getLogDirectory();
 
-            //! Log current interpolation cycle, only stores in memory, for performance reasons
-            //! \remark const to allow const interpolator functions
+            //! Log current interpolation cycle, written to the log file in background
             //! \threadsafe
             void logInterpolation(const SituationLog &log);
 
-            //! Log current parts cycle, only stores in memory, for performance reasons
-            //! \remark const to allow const interpolator functions
+            //! Log current parts cycle, written to the log file in background
             //! \threadsafe
             void logParts(const PartsLog &log);
 
-            //! Max.situations logged
+            //! Max.situations written to one log file, < 0 for no limit
+            //! \remark logging stops at the limit until the log is written or cleared
             void setMaxSituations(int max);
 
-            //! All situation logs
-            //! \threadsafe
-            QList<SituationLog> getSituationsLog() const;
-
-            //! All parts logs
-            //! \threadsafe
-            QList<PartsLog> getPartsLog() const;
-
-            //! All situation logs for callsign
-            //! \threadsafe
-            QList<SituationLog> getSituationsLog(const aviation::CCallsign &cs) const;
+            static constexpr int DefaultMaxSituations = 2500; //!< default max.situations per log file
 
-            //! All parts logs for callsign
+            //! The log file written, empty if nothing has been logged since the log was written or cleared
             //! \threadsafe
-            QList<PartsLog> getPartsLog(const aviation::CCallsign &cs) const;
+            QString getLogFileName() const;
 
             //! Get last log
             //! \threadsafe
@@ -171,12 +190,30 @@ namespace swift::misc
             //! \threadsafe
             PartsLog getLastPartsLog(const aviation::CCallsign &cs) const;
 
+            //! Add the number of latest logs and the memory of the log file buffers, cheap enough for periodic logging
+            //! \threadsafe
+            void addMemoryFootprint(CMemoryFootprint &footprint) const;
+
+            //! Estimator for the memory of the latest logs and the log file buffers
+            //! \remark works on copies, so the expensive estimate can run in a worker thread
+            //! \threadsafe
+            CMemoryFootprint::Estimator getMemoryFootprintEstimator() const;
+
+            //! Convert a log file, the files written are named "<outputPrefix> interpolation.html" and so on
+            //! \remark reads the log file entry by entry, also for logs of whole sessions
+            static CStatusMessageList convertLogFile(const QString &logFile, const QString &outputPrefix,
+                                                     LogFormats formats = LogAllFormats);
+
             //! File pattern for interpolation log
             static const QString &filePatternInterpolationLog();
 
             //! File pattern for parts log
             static const QString &filePatternPartsLog();
 
+            //! File pattern for the binary log written while logging
+            //! \remark temporary, removed when converted with clearLog, cleared, or when a new log file is started
+            static const QString &filePatternLogFile();
+
             //! All log.file patterns
             static const QStringList &filePatterns();
 
@@ -190,34 +227,63 @@ namespace swift::misc
             static QString msSinceEpochToTime(qint64 t1, qint64 t2, qint64 t3 = -1);
 
         private:
-            //! Get log as HTML table
-            static QString getHtmlInterpolationLog(const QList<SituationLog> &logs);
+            //! Start the log file if not yet written
+            //! \remark m_lockFile has to be locked
+            bool startLogFile();
+
+            //! Clear the latest logs
+            void clearLatestLogs();
+
+            //! Header of the HTML interpolation table
+            static const QString &getHtmlInterpolationLogHeader();
 
-            //! Get log as KML (changed situations)
-            static QString getKmlChangedSituations(const QList<SituationLog> &logs);
+            //! Row of the HTML interpolation table
+            static QString getHtmlInterpolationLogRow(const SituationLog &log, qint64 firstTs, bool changedNewPosition,
+                                                      bool changedParts);
 
-            //! Get log as KML (elevations)
-            static QString getKmlElevations(const QList<SituationLog> &logs);
+            //! Header of the HTML parts table
+            static const QString &getHtmlPartsLogHeader();
 
-            //! Get log as KML (changed situations)
-            static QString getKmlInterpolatedSituations(const QList<SituationLog> &logs);
+            //! Row of the HTML parts table
+            static QString getHtmlPartsLogRow(const PartsLog &log, bool changedParts);
 
-            //! Get log as HTML table
-            static QString getHtmlPartsLog(const QList<PartsLog> &logs);
+            //! KML placemark of a changed situation
+            static QString getKmlChangedSituation(const SituationLog &log, int n, bool changedNewPosition);
 
-            //! Write log to file
-            static CStatusMessageList writeLogFiles(const QList<SituationLog> &interpolation,
-                                                    const QList<PartsLog> &getPartsLog);
+            //! KML placemark of an elevation
+            static QString getKmlElevation(const SituationLog &log, int n);
+
+            //! Header of the CSV interpolation log
+            static const QString &getCsvInterpolationLogHeader();
+
+            //! Row of the CSV interpolation log
+            static QString getCsvInterpolationLogRow(const SituationLog &log);
+
+            //! Header of the CSV parts log
+            static const QString &getCsvPartsLogHeader();
+
+            //! Row of the CSV parts log
+            static QString getCsvPartsLogRow(const PartsLog &log);
 
             //! Status of file operation
             static CStatusMessage logStatusFileWriting(bool success, const QString &fileName);
 
             mutable QReadWriteLock m_lockSituations; //!< lock logging situations
             mutable QReadWriteLock m_lockParts; //!< lock logging parts
-            int m_maxSituations = 2500; //!< max.number of situations
-            QList<PartsLog> m_partsLogs; //!< logs of parts
-            QList<SituationLog> m_situationLogs; //!< logs of interpolation
+            aviation::CCallsignHandleMap<SituationLog> m_lastSituationLogs; //!< latest log per callsign
+            aviation::CCallsignHandle m_lastSituationCallsign; //!< callsign logged last
+            aviation::CCallsignHandleMap<PartsLog> m_lastPartsLogs; //!< latest log per callsign
+            aviation::CCallsignHandle m_lastPartsCallsign; //!< callsign logged last
+
+            mutable QMutex m_lockFile; //!< lock starting and stopping the log file
+            std::unique_ptr<CInterpolationLogFile> m_logFile; //!< written while logging
+            bool m_logFileFailed = false; //!< log file could not be written, not tried again until cleared
+            int m_maxSituations = DefaultMaxSituations; //!< max.number of situations per log file
+            int m_situationsInFile = 0; //!< situations written to the log file
         };
     } // namespace simulation
 } // namespace swift::misc
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(swift::misc::simulation::CInterpolationLogger::LogFormats)
+
 #endif // SWIFT_MISC_SIMULATION_INTERPOLATION_INTERPOLATIONLOGGER_H
@@ -36,7 +36,7 @@ namespace swift::misc::simulation
     CInterpolator::CInterpolator(const CCallsign &callsign, ISimulationEnvironmentProvider *simEnvProvider,
                                  IInterpolationSetupProvider *setupProvider, IRemoteAircraftProvider *remoteProvider,
                                  CInterpolationLogger *logger)
-        : m_callsign(callsign)
+        : m_callsign(callsign), m_callsignHandle(CCallsignHandle::intern(callsign))
     {
         // normally when created m_cg is still null since there is no CG in the provider yet
 
@@ -83,11 +83,11 @@ namespace swift::misc::simulation
     CAircraftSituationList
     CInterpolator::remoteAircraftSituationsAndChange(const CInterpolationAndRenderingSetupPerCallsign &setup)
     {
-        CAircraftSituationList validSituations = this->remoteAircraftSituations(m_callsign);
+        CAircraftSituationList validSituations = this->remoteAircraftSituations(m_callsignHandle);
 
         // get the changes, we need the second value as we want to look in the past
         // the first value is already based on the latest situation
-        const CAircraftSituationChangeList changes = this->remoteAircraftSituationChanges(m_callsign);
+        const CAircraftSituationChangeList changes = this->remoteAircraftSituationChanges(m_callsignHandle);
         m_pastSituationsChange = changes.indexOrNull(1);
 
         // fixing offset
@@ -372,7 +372,7 @@ namespace swift::misc::simulation
     CAircraftParts CInterpolator::getInterpolatedParts()
     {
         // Parts are supposed to be in correct order, latest first
-        const CAircraftPartsList validParts = this->remoteAircraftParts(m_callsign);
+        const CAircraftPartsList validParts = this->remoteAircraftParts(m_callsignHandle);
 
         // log for empty parts aircraft parts
         if (validParts.isEmpty())
@@ -628,9 +628,9 @@ namespace swift::misc::simulation
     QString CInterpolator::getInterpolatorInfo() const
     {
         return QStringLiteral("Callsign: ") % m_callsign.asString() % QStringLiteral(" situations: ") %
-               QString::number(this->remoteAircraftSituationsCount(m_callsign)) % QStringLiteral(" parts: ") %
-               QString::number(this->remoteAircraftPartsCount(m_callsign)) % QStringLiteral(" 1st interpolation: ") %
-               boolToYesNo(m_lastSituation.isNull());
+               QString::number(this->remoteAircraftSituationsCount(m_callsignHandle)) % QStringLiteral(" parts: ") %
+               QString::number(this->remoteAircraftPartsCount(m_callsignHandle)) %
+               QStringLiteral(" 1st interpolation: ") % boolToYesNo(m_lastSituation.isNull());
     }
 
     void CInterpolator::resetLastInterpolation() { m_lastSituation.setNull(); }
@@ -641,7 +641,7 @@ namespace swift::misc::simulation
     {
         Q_ASSERT_X(!m_callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
 
-        const qint64 lastModifed = this->situationsLastModified(m_callsign);
+        const qint64 lastModifed = this->situationsLastModified(m_callsignHandle);
         const bool slowUpdateStep = (((m_interpolatedSituationsCounter + aircraftNumber) % 25) ==
                                      0); // flag when parts are updated, which need not to be updated every time
         const bool changedSituations = lastModifed > m_situationsLastModified;
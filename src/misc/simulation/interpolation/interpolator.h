@@ -15,6 +15,7 @@
 #include "misc/aviation/aircraftsituation.h"
 #include "misc/aviation/aircraftsituationchange.h"
 #include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignhandle.h"
 #include "misc/simulation/aircraftmodel.h"
 #include "misc/simulation/interpolation/interpolant.h"
 #include "misc/simulation/interpolation/interpolationlogger.h"
@@ -51,6 +52,9 @@ namespace swift::misc::simulation
         //! Latest interpolation result
         const aviation::CAircraftSituation &getLastInterpolatedSituation() const { return m_lastSituation; }
 
+        //! Handle of the corresponding callsign, resolved once for all per frame lookups
+        aviation::CCallsignHandle getCallsignHandle() const { return m_callsignHandle; }
+
         //! Get interpolated situation
         //! \param currentTimeSinceEpoch milliseconds since epoch for which the situation should be interpolated
         //! \param setup interpolation setup
@@ -103,6 +107,7 @@ namespace swift::misc::simulation
         bool doLogging() const;
 
         const aviation::CCallsign m_callsign; //!< corresponding callsign
+        const aviation::CCallsignHandle m_callsignHandle; //!< handle of m_callsign, for the provider lookups
         CAircraftModel m_model; //!< corresponding model (required for CG)
 
         // values for current interpolation step
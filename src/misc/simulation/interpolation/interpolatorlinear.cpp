@@ -11,6 +11,7 @@
 #include "misc/geo/coordinategeodetic.h"
 #include "misc/logmessage.h"
 #include "misc/pq/physicalquantity.h"
+#include "misc/pq/staticquantity.h"
 #include "misc/range.h"
 #include "misc/simulation/interpolation/interpolatorfunctions.h"
 #include "misc/verify.h"
@@ -81,9 +82,13 @@ namespace swift::misc::simulation
         Q_ASSERT_X(oldAlt.getReferenceDatum() == CAltitude::MeanSeaLevel &&
                        oldAlt.getReferenceDatum() == newAlt.getReferenceDatum(),
                    Q_FUNC_INFO, "mismatch in reference"); // otherwise no calculation is possible
-        const CAltitude altitude((newAlt - oldAlt) * tf + oldAlt, oldAlt.getReferenceDatum());
+        // altitudes are in ft, so reading and writing them is no conversion
+        const auto oldFt = CStaticLength::from<static_units::Foot>(oldAlt.value(CLengthUnit::ft()));
+        const auto newFt = CStaticLength::from<static_units::Foot>(newAlt.value(CLengthUnit::ft()));
+        const CStaticLength altitude = (newFt - oldFt) * tf + oldFt;
 
-        return { interpolatedPosition, altitude };
+        return { interpolatedPosition,
+                 CAltitude(altitude.in<static_units::Foot>(), oldAlt.getReferenceDatum(), CLengthUnit::ft()) };
     }
 
     aviation::COnGroundInfo CInterpolatorLinear::CInterpolant::interpolateGroundFactor() const
@@ -4,6 +4,7 @@
 #include "misc/simulation/interpolation/interpolatorlinearpbh.h"
 
 #include "config/buildconfig.h"
+#include "misc/pq/staticquantity.h"
 #include "misc/simulation/interpolation/interpolatorfunctions.h"
 #include "misc/verify.h"
 
@@ -32,9 +33,13 @@ namespace swift::misc::simulation
         //   30 ->  -30 =>   -60 (via 0)
         //  170 -> -170 =>  -340 (via 180)
         // -170 ->  170 =>   340 (via 180)
-        double deltaDeg = (end - begin).value(CAngleUnit::deg());
-        if (deltaDeg > 180.0) { deltaDeg -= 360; }
-        else if (deltaDeg < -180.0) { deltaDeg += 360; }
+        using static_units::Degree;
+        constexpr CStaticAngle HalfTurn = CStaticAngle::from<Degree>(180.0);
+        constexpr CStaticAngle FullTurn = CStaticAngle::from<Degree>(360.0);
+        const CStaticAngle beginAngle = toStatic(begin);
+        CStaticAngle delta = toStatic(end) - beginAngle;
+        if (delta > HalfTurn) { delta -= FullTurn; }
+        else if (delta < -HalfTurn) { delta += FullTurn; }
 
         if (CBuildConfig::isLocalDeveloperDebugBuild())
         {
@@ -42,9 +47,9 @@ namespace swift::misc::simulation
         }
 
         //! make sure to not end up we extrapolation
-        if (timeFraction0to1 >= 1.0) { return begin + CAngle(deltaDeg, CAngleUnit::deg()); }
+        if (timeFraction0to1 >= 1.0) { return toPhysicalQuantity(beginAngle + delta); }
         if (timeFraction0to1 <= 0.0) { return begin; }
-        return begin + CAngle(timeFraction0to1 * deltaDeg, CAngleUnit::deg());
+        return toPhysicalQuantity(beginAngle + timeFraction0to1 * delta);
     }
 
     CHeading CInterpolatorLinearPbh::getHeading() const
@@ -76,8 +81,10 @@ namespace swift::misc::simulation
 
     CSpeed CInterpolatorLinearPbh::getGroundSpeed() const
     {
-        return (m_endSituation.getGroundSpeed() - m_startSituation.getGroundSpeed()) * m_simulationTimeFraction +
-               m_startSituation.getGroundSpeed();
+        const CStaticSpeed start = toStatic(m_startSituation.getGroundSpeed());
+        const CStaticSpeed end = toStatic(m_endSituation.getGroundSpeed());
+        const CStaticSpeed groundSpeed = (end - start) * m_simulationTimeFraction + start;
+        return { groundSpeed.in<static_units::Knot>(), CSpeedUnit::kts() }; // unit as received from the network
     }
 
     void CInterpolatorLinearPbh::setTimeFraction(double tf)
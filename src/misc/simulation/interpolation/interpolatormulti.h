@@ -43,6 +43,9 @@ namespace swift::misc::simulation
         //! Info string
         QString getInterpolatorInfo(CInterpolationAndRenderingSetupBase::InterpolatorMode mode) const;
 
+        //! \copydoc CInterpolator::getCallsignHandle
+        aviation::CCallsignHandle getCallsignHandle() const { return m_linear.getCallsignHandle(); }
+
     private:
         CInterpolatorSpline m_spline;
         CInterpolatorLinear m_linear;
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/modeldirectoryscanner.h"
+
+#include <QDir>
+#include <QRegularExpression>
+#include <QThread>
+
+namespace swift::misc::simulation
+{
+    CModelDirectoryScanner::CModelDirectoryScanner(const std::atomic<bool> &cancel, int maxParserThreads)
+        : m_cancel(cancel), m_maxParserThreads(qMax(1, maxParserThreads))
+    {}
+
+    void CModelDirectoryScanner::setNameFilters(const QStringList &nameFilters)
+    {
+        QList<QRegularExpression> regexes;
+        for (const QString &filter : nameFilters)
+        {
+            regexes.push_back(QRegularExpression(QRegularExpression::wildcardToRegularExpression(filter),
+                                                 QRegularExpression::CaseInsensitiveOption));
+        }
+        m_fileSelector = [regexes](const QFileInfoList &files) {
+            QFileInfoList selected;
+            for (const QFileInfo &file : files)
+            {
+                const QString name = file.fileName();
+                const bool match = std::any_of(regexes.cbegin(), regexes.cend(), [&name](const QRegularExpression &re) {
+                    return re.match(name).hasMatch();
+                });
+                if (match) { selected.push_back(file); }
+            }
+            return selected;
+        };
+    }
+
+    QFileInfoList CModelDirectoryScanner::enumerate(const QString &rootDirectory)
+    {
+        QFileInfoList files;
+        this->enumerate(rootDirectory, [&files](const QFileInfo &file) { files.push_back(file); });
+        return files;
+    }
+
+    int CModelDirectoryScanner::defaultParserThreads()
+    {
+        // parsing is mostly I/O bound, some threads more than cores do not hurt, but keep it bounded
+        return qBound(2, QThread::idealThreadCount(), 8);
+    }
+
+    void CModelDirectoryScanner::enumerate(const QString &rootDirectory,
+                                           const std::function<void(const QFileInfo &)> &onFile)
+    {
+        m_enumeratedFiles = 0;
+        m_enumeratedDirectories = 0;
+        if (rootDirectory.isEmpty()) { return; }
+        QSet<QString> visited;
+        this->enumerateDirectory(QDir(rootDirectory).absolutePath(), visited, onFile);
+    }
+
+    void CModelDirectoryScanner::enumerateDirectory(const QString &directory, QSet<QString> &visited,
+                                                    const std::function<void(const QFileInfo &)> &onFile)
+    {
+        if (m_cancel) { return; }
+
+        // canonical path avoids loops via symbolic links and scanning the same directory twice
+        const QString canonical = QFileInfo(directory).canonicalFilePath();
+        if (canonical.isEmpty() || visited.contains(canonical)) { return; }
+        visited.insert(canonical);
+        if (m_directoryFilter && !m_directoryFilter(directory)) { return; }
+
+        const QDir dir(directory);
+        const QFileInfoList entries =
+            dir.entryInfoList(QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot, QDir::Name | QDir::DirsLast);
+        m_enumeratedDirectories++;
+
+        QFileInfoList files;
+        QFileInfoList subDirectories;
+        for (const QFileInfo &entry : entries)
+        {
+            if (entry.isDir())
+            {
+                if (!m_followSymlinks && entry.isSymLink()) { continue; }
+                subDirectories.push_back(entry);
+            }
+            else { files.push_back(entry); }
+        }
+
+        const QFileInfoList selected = m_fileSelector ? m_fileSelector(files) : files;
+        for (const QFileInfo &file : selected)
+        {
+            if (m_cancel) { return; }
+            m_enumeratedFiles++;
+            onFile(file);
+        }
+
+        for (const QFileInfo &subDirectory : std::as_const(subDirectories))
+        {
+            this->enumerateDirectory(subDirectory.absoluteFilePath(), visited, onFile);
+        }
+    }
+} // namespace swift::misc::simulation
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_MODELDIRECTORYSCANNER_H
+#define SWIFT_MISC_SIMULATION_MODELDIRECTORYSCANNER_H
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <utility>
+
+#include <QFileInfo>
+#include <QFileInfoList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSemaphore>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+#include <QVector>
+
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation
+{
+    /*!
+     * Scanning stage shared by the model loaders.
+     *
+     * The directory tree is enumerated on the calling thread, every selected file becomes a task for a bounded
+     * pool of parser threads. Directories and files are enumerated sorted by name and the results are returned
+     * in enumeration order, so the outcome does not depend on thread scheduling.
+     * Setting the cancel flag stops enumeration and skips all tasks not yet started.
+     */
+    class SWIFT_MISC_EXPORT CModelDirectoryScanner
+    {
+    public:
+        //! Decides if a directory is scanned, false skips the whole sub tree
+        //! \remark called on the enumerating thread
+        using DirectoryFilter = std::function<bool(const QString &directory)>;
+
+        //! Selects the files to be parsed from all files of one directory
+        //! \remark called on the enumerating thread
+        using FileSelector = std::function<QFileInfoList(const QFileInfoList &directoryFiles)>;
+
+        //! Constructor
+        CModelDirectoryScanner(const std::atomic<bool> &cancel, int maxParserThreads = defaultParserThreads());
+
+        //! Directory filter, by default all directories are scanned
+        void setDirectoryFilter(const DirectoryFilter &filter) { m_directoryFilter = filter; }
+
+        //! File selector, replaces the name filters
+        void setFileSelector(const FileSelector &selector) { m_fileSelector = selector; }
+
+        //! Select files by name filters (wildcards, case insensitive)
+        void setNameFilters(const QStringList &nameFilters);
+
+        //! Follow symbolic links to directories
+        void setFollowSymlinks(bool follow) { m_followSymlinks = follow; }
+
+        //! Max. number of parser threads
+        int getMaxParserThreads() const { return m_maxParserThreads; }
+
+        //! Files enumerated by the last scan
+        int getEnumeratedFiles() const { return m_enumeratedFiles; }
+
+        //! Directories enumerated by the last scan
+        int getEnumeratedDirectories() const { return m_enumeratedDirectories; }
+
+        //! Enumerate all selected files below root directory, sorted
+        QFileInfoList enumerate(const QString &rootDirectory);
+
+        //! Enumerate root directory and parse all selected files
+        //! \remark parser is called concurrently from the pool threads, it has to be threadsafe
+        //! \return results in enumeration order, empty if cancelled
+        template <class Result, class Parser>
+        QVector<Result> scan(const QString &rootDirectory, Parser &&parser)
+        {
+            QThreadPool pool;
+            pool.setMaxThreadCount(m_maxParserThreads);
+            QSemaphore queueSlots(m_maxParserThreads * QueuedTasksPerThread); // bounds the queued tasks
+            QMutex mutex;
+            QVector<std::pair<int, Result>> results;
+
+            int index = 0;
+            this->enumerate(rootDirectory, [&](const QFileInfo &file) {
+                queueSlots.acquire();
+                const int taskIndex = index++;
+                pool.start([&, taskIndex, file] {
+                    if (!m_cancel)
+                    {
+                        Result result = parser(file);
+                        QMutexLocker lock(&mutex);
+                        results.push_back({ taskIndex, std::move(result) });
+                    }
+                    queueSlots.release();
+                });
+            });
+            pool.waitForDone();
+            if (m_cancel) { return {}; }
+
+            std::sort(results.begin(), results.end(),
+                      [](const auto &r1, const auto &r2) { return r1.first < r2.first; });
+            QVector<Result> ordered;
+            ordered.reserve(results.size());
+            for (auto &r : results) { ordered.push_back(std::move(r.second)); }
+            return ordered;
+        }
+
+        //! Default number of parser threads
+        static int defaultParserThreads();
+
+    private:
+        static constexpr int QueuedTasksPerThread = 4; //!< queued file tasks per parser thread
+
+        //! Enumerate and call the callback for all selected files
+        void enumerate(const QString &rootDirectory, const std::function<void(const QFileInfo &)> &onFile);
+
+        //! Enumerate one directory recursively
+        void enumerateDirectory(const QString &directory, QSet<QString> &visited,
+                                const std::function<void(const QFileInfo &)> &onFile);
+
+        const std::atomic<bool> &m_cancel;
+        int m_maxParserThreads = 1;
+        bool m_followSymlinks = true;
+        int m_enumeratedFiles = 0;
+        int m_enumeratedDirectories = 0;
+        DirectoryFilter m_directoryFilter;
+        FileSelector m_fileSelector;
+    };
+} // namespace swift::misc::simulation
+
+#endif // SWIFT_MISC_SIMULATION_MODELDIRECTORYSCANNER_H
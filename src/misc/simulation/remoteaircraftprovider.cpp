@@ -18,6 +18,27 @@ using namespace swift::config;
 
 namespace swift::misc::simulation
 {
+    namespace
+    {
+        //! Estimated memory of a callsign handle map
+        template <class T>
+        qint64 handleMapBytes(const CCallsignHandleMap<T> &map)
+        {
+            qint64 bytes = static_cast<qint64>(map.size()) * (sizeof(CCallsignHandle) + sizeof(int));
+            for (const T &value : map.values()) { bytes += deepSize(value); }
+            return bytes;
+        }
+
+        //! Number of list elements in a callsign handle map
+        template <class T>
+        int handleMapElements(const CCallsignHandleMap<T> &map)
+        {
+            int elements = 0;
+            for (const T &list : map.values()) { elements += list.size(); }
+            return elements;
+        }
+    } // namespace
+
     const QStringList &CRemoteAircraftProvider::getLogCategories()
     {
         static const QStringList cats { CLogCategories::matching(), CLogCategories::network() };
@@ -56,10 +77,13 @@ namespace swift::misc::simulation
 
     CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(const CCallsign &callsign) const
     {
-        static const CAircraftSituationList empty;
+        return this->remoteAircraftSituations(CCallsignHandle::find(callsign));
+    }
+
+    CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(CCallsignHandle handle) const
+    {
         QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return empty; }
-        return m_situationsByCallsign[callsign];
+        return m_situationsByCallsign.value(handle);
     }
 
     CAircraftSituation CRemoteAircraftProvider::remoteAircraftSituation(const CCallsign &callsign, int index) const
@@ -79,39 +103,72 @@ namespace swift::misc::simulation
     CAircraftSituationList CRemoteAircraftProvider::latestRemoteAircraftSituations() const
     {
         QReadLocker l(&m_lockSituations);
-        const QList<CAircraftSituation> situations(m_latestSituationByCallsign.values());
+        const QList<CAircraftSituation> situations(m_latestSituationByCallsign.valueList());
         l.unlock();
         return { situations };
     }
 
+    qint64 CRemoteAircraftProvider::latestRemoteAircraftSituationsRevision() const
+    {
+        QReadLocker l(&m_lockSituations);
+        return m_latestSituationsRevision;
+    }
+
+    CAircraftSituationList CRemoteAircraftProvider::latestRemoteAircraftSituationsSince(qint64 revision) const
+    {
+        if (revision < 0) { return this->latestRemoteAircraftSituations(); }
+        CAircraftSituationList situations;
+        QReadLocker l(&m_lockSituations);
+        const std::vector<CCallsignHandle> &handles = m_latestSituationRevisions.keys();
+        const std::vector<qint64> &revisions = m_latestSituationRevisions.values();
+        for (std::size_t i = 0; i < revisions.size(); i++)
+        {
+            if (revisions[i] > revision) { situations.push_back(m_latestSituationByCallsign.value(handles[i])); }
+        }
+        return situations;
+    }
+
     CAircraftSituationList CRemoteAircraftProvider::latestOnGroundProviderElevations() const
     {
         QReadLocker l(&m_lockSituations);
-        const QList<CAircraftSituation> situations(m_latestOnGroundProviderElevation.values());
+        const QList<CAircraftSituation> situations(m_latestOnGroundProviderElevation.valueList());
         l.unlock();
         return { situations };
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationsCount(const CCallsign &callsign) const
+    {
+        return this->remoteAircraftSituationsCount(CCallsignHandle::find(callsign));
+    }
+
+    int CRemoteAircraftProvider::remoteAircraftSituationsCount(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return -1; }
-        return m_situationsByCallsign[callsign].size();
+        const CAircraftSituationList *situations = m_situationsByCallsign.find(handle);
+        return situations ? situations->size() : -1;
     }
 
     CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(const CCallsign &callsign) const
     {
-        static const CAircraftPartsList empty;
+        return this->remoteAircraftParts(CCallsignHandle::find(callsign));
+    }
+
+    CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(CCallsignHandle handle) const
+    {
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return empty; }
-        return m_partsByCallsign[callsign];
+        return m_partsByCallsign.value(handle);
     }
 
     int CRemoteAircraftProvider::remoteAircraftPartsCount(const CCallsign &callsign) const
+    {
+        return this->remoteAircraftPartsCount(CCallsignHandle::find(callsign));
+    }
+
+    int CRemoteAircraftProvider::remoteAircraftPartsCount(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return -1; }
-        return m_partsByCallsign[callsign].size();
+        const CAircraftPartsList *parts = m_partsByCallsign.find(handle);
+        return parts ? parts->size() : -1;
     }
 
     bool CRemoteAircraftProvider::isRemoteAircraftSupportingParts(const CCallsign &callsign) const
@@ -134,15 +191,26 @@ namespace swift::misc::simulation
 
     CAircraftSituationChangeList
     CRemoteAircraftProvider::remoteAircraftSituationChanges(const CCallsign &callsign) const
+    {
+        return this->remoteAircraftSituationChanges(CCallsignHandle::find(callsign));
+    }
+
+    CAircraftSituationChangeList CRemoteAircraftProvider::remoteAircraftSituationChanges(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign];
+        return m_changesByCallsign.value(handle);
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationChangesCount(const CCallsign &callsign) const
+    {
+        return this->remoteAircraftSituationChangesCount(CCallsignHandle::find(callsign));
+    }
+
+    int CRemoteAircraftProvider::remoteAircraftSituationChangesCount(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign].size();
+        const CAircraftSituationChangeList *changes = m_changesByCallsign.find(handle);
+        return changes ? changes->size() : 0;
     }
 
     int CRemoteAircraftProvider::getAircraftInRangeCount() const
@@ -170,6 +238,8 @@ namespace swift::misc::simulation
             m_latestOnGroundProviderElevation.clear();
             m_situationsAdded = 0;
             m_situationsLastModified.clear();
+            m_latestSituationRevisions.clear();
+            m_latestSituationsRevision++;
             m_testOffset.clear();
         }
         {
@@ -188,12 +258,95 @@ namespace swift::misc::simulation
         {
             QWriteLocker l(&m_lockAircraft);
             m_aircraftInRange.clear();
+            m_aircraftIndex.clear();
             m_dbCGPerCallsign.clear();
         }
 
         for (const CCallsign &cs : callsigns) { emit this->removedAircraft(cs); }
     }
 
+    CAirspaceAircraftSnapshot
+    CRemoteAircraftProvider::getAirspaceAircraftSnapshot(bool restricted, bool renderingEnabled, int maxAircraft,
+                                                         const CLength &maxRenderedDistance) const
+    {
+        QReadLocker l(&m_lockAircraft);
+        return CAirspaceAircraftSnapshot(m_aircraftIndex, restricted, renderingEnabled, maxAircraft,
+                                         maxRenderedDistance);
+    }
+
+    void CRemoteAircraftProvider::addMemoryFootprint(CMemoryFootprint &footprint) const
+    {
+        int situations = 0;
+        int parts = 0;
+        int changes = 0;
+        int aircraft = 0;
+        {
+            QReadLocker l(&m_lockSituations);
+            situations = handleMapElements(m_situationsByCallsign);
+        }
+        {
+            QReadLocker l(&m_lockParts);
+            parts = handleMapElements(m_partsByCallsign);
+        }
+        {
+            QReadLocker l(&m_lockChanges);
+            changes = handleMapElements(m_changesByCallsign);
+        }
+        {
+            QReadLocker l(&m_lockAircraft);
+            aircraft = m_aircraftInRange.size();
+        }
+        footprint.addCount(QStringLiteral("remote situations"), situations);
+        footprint.addCount(QStringLiteral("remote parts"), parts);
+        footprint.addCount(QStringLiteral("situation changes"), changes);
+        footprint.addCount(QStringLiteral("aircraft in range"), aircraft);
+    }
+
+    CMemoryFootprint::Estimator CRemoteAircraftProvider::getMemoryFootprintEstimator() const
+    {
+        // the values are implicitly shared, so only the containers are copied while locked
+        QReadLocker ls(&m_lockSituations);
+        const CCallsignHandleMap<CAircraftSituationList> situationsByCallsign = m_situationsByCallsign;
+        const CCallsignHandleMap<CAircraftSituation> latestSituationByCallsign = m_latestSituationByCallsign;
+        const CCallsignHandleMap<CAircraftSituation> latestOnGroundProviderElevation =
+            m_latestOnGroundProviderElevation;
+        ls.unlock();
+
+        QReadLocker lp(&m_lockParts);
+        const CCallsignHandleMap<CAircraftPartsList> partsByCallsign = m_partsByCallsign;
+        lp.unlock();
+
+        QReadLocker lc(&m_lockChanges);
+        const CCallsignHandleMap<CAircraftSituationChangeList> changesByCallsign = m_changesByCallsign;
+        lc.unlock();
+
+        QReadLocker la(&m_lockAircraft);
+        const CSimulatedAircraftPerCallsign aircraftInRange = m_aircraftInRange;
+        la.unlock();
+
+        QReadLocker lm(&m_lockMessages);
+        const CStatusMessageListPerCallsign reverseLookupMessages = m_reverseLookupMessages;
+        lm.unlock();
+
+        QReadLocker lh(&m_lockPartsHistory);
+        const CStatusMessageListPerCallsign aircraftPartsMessages = m_aircraftPartsMessages;
+        lh.unlock();
+
+        return [=](CMemoryFootprint &footprint) {
+            footprint.add(QStringLiteral("remote situations"),
+                          handleMapBytes(situationsByCallsign) + handleMapBytes(latestSituationByCallsign) +
+                              handleMapBytes(latestOnGroundProviderElevation),
+                          handleMapElements(situationsByCallsign));
+            footprint.add(QStringLiteral("remote parts"), handleMapBytes(partsByCallsign),
+                          handleMapElements(partsByCallsign));
+            footprint.add(QStringLiteral("situation changes"), handleMapBytes(changesByCallsign),
+                          handleMapElements(changesByCallsign));
+            footprint.add(QStringLiteral("aircraft in range"), heapSize(aircraftInRange), aircraftInRange.size());
+            footprint.add(QStringLiteral("reverse lookup messages"), heapSize(reverseLookupMessages));
+            footprint.add(QStringLiteral("parts history"), heapSize(aircraftPartsMessages));
+        };
+    }
+
     void CRemoteAircraftProvider::removeReverseLookupMessages(const CCallsign &callsign)
     {
         QWriteLocker l(&m_lockMessages);
@@ -208,6 +361,7 @@ namespace swift::misc::simulation
         {
             QWriteLocker l(&m_lockAircraft);
             m_aircraftInRange.insert(aircraft.getCallsign(), aircraft);
+            m_aircraftIndex.update(aircraft);
         }
         emit this->addedAircraft(aircraft);
         emit this->changedAircraftInRange();
@@ -222,7 +376,9 @@ namespace swift::misc::simulation
         {
             QWriteLocker l(&m_lockAircraft);
             if (!m_aircraftInRange.contains(callsign)) { return 0; }
-            c = m_aircraftInRange[callsign].apply(vm, skipEqualValues).size();
+            CSimulatedAircraft &aircraft = m_aircraftInRange[callsign];
+            c = aircraft.apply(vm, skipEqualValues).size();
+            if (c > 0) { m_aircraftIndex.update(aircraft); }
         }
         if (c > 0) { emit this->changedAircraftInRange(); }
         return c;
@@ -239,7 +395,11 @@ namespace swift::misc::simulation
             CSimulatedAircraft &aircraft = m_aircraftInRange[callsign];
             aircraft.setSituation(situation);
             if (!bearing.isNull()) { aircraft.setRelativeBearing(bearing); }
-            if (!distance.isNull()) { aircraft.setRelativeDistance(distance); }
+            if (!distance.isNull())
+            {
+                aircraft.setRelativeDistance(distance);
+                m_aircraftIndex.updateDistance(callsign, distance.value(CLengthUnit::m()));
+            }
         }
         return true;
     }
@@ -249,6 +409,7 @@ namespace swift::misc::simulation
     {
         const CCallsign cs = situation.getCallsign();
         if (cs.isEmpty()) { return situation; }
+        const CCallsignHandle handle = CCallsignHandle::intern(cs);
 
         // testing
         if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -271,8 +432,8 @@ namespace swift::misc::simulation
             const qint64 now = QDateTime::currentMSecsSinceEpoch();
             QWriteLocker lock(&m_lockSituations);
             m_situationsAdded++;
-            m_situationsLastModified[cs] = now;
-            CAircraftSituationList &newSituationsList = m_situationsByCallsign[cs];
+            m_situationsLastModified[handle] = now;
+            CAircraftSituationList &newSituationsList = m_situationsByCallsign[handle];
             newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
             const int situations = newSituationsList.size();
             if (situations < 1)
@@ -300,7 +461,8 @@ namespace swift::misc::simulation
                     newSituationsList.setOnGroundDetails(situation.getOnGroundInfo().getGroundDetails());
                 }
             }
-            m_latestSituationByCallsign[cs] = situationCorrected;
+            m_latestSituationByCallsign[handle] = situationCorrected;
+            m_latestSituationRevisions[handle] = ++m_latestSituationsRevision;
 
             // check sort order
             if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -321,7 +483,7 @@ namespace swift::misc::simulation
                 // guess GND
                 simpleChange.guessOnGround(newSituationsList.front(), aircraftModel);
             }
-            updatedSituations = m_situationsByCallsign[cs];
+            updatedSituations = newSituationsList;
 
         } // lock
 
@@ -345,13 +507,14 @@ namespace swift::misc::simulation
         if (callsign.isEmpty()) { return; }
 
         // list sorted from new to old
+        const CCallsignHandle handle = CCallsignHandle::intern(callsign);
         const qint64 ts = QDateTime::currentMSecsSinceEpoch();
         CAircraftPartsList correctiveParts;
         {
             QWriteLocker lock(&m_lockParts);
             m_partsAdded++;
-            m_partsLastModified[callsign] = ts;
-            CAircraftPartsList &partsList = m_partsByCallsign[callsign];
+            m_partsLastModified[handle] = ts;
+            CAircraftPartsList &partsList = m_partsByCallsign[handle];
             partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, IRemoteAircraftProvider::MaxPartsPerCallsign);
             partsList.setAdjustedSortHint(CAircraftPartsList::AdjustedTimestampLatestFirst);
 
@@ -368,9 +531,9 @@ namespace swift::misc::simulation
         if (!correctiveParts.isEmpty())
         {
             QWriteLocker lock(&m_lockSituations);
-            CAircraftSituationList &situationList = m_situationsByCallsign[callsign];
+            CAircraftSituationList &situationList = m_situationsByCallsign[handle];
             const int c = situationList.adjustGroundFlag(parts);
-            if (c > 0) { m_situationsLastModified[callsign] = ts; }
+            if (c > 0) { m_situationsLastModified[handle] = ts; }
         }
 
         // update aircraft
@@ -486,9 +649,10 @@ namespace swift::misc::simulation
     void CRemoteAircraftProvider::storeChange(const CAircraftSituationChange &change)
     {
         // a change with the same timestamp will be replaced
-        const CCallsign cs(change.getCallsign());
+        const CCallsignHandle handle = CCallsignHandle::intern(change.getCallsign());
+        if (handle.isNull()) { return; }
         QWriteLocker lock(&m_lockChanges);
-        CAircraftSituationChangeList &changeList = m_changesByCallsign[cs];
+        CAircraftSituationChangeList &changeList = m_changesByCallsign[handle];
         changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
     }
 
@@ -511,6 +675,7 @@ namespace swift::misc::simulation
     {
         QWriteLocker l(&m_lockAircraft);
         if (!m_aircraftInRange.contains(callsign)) { return false; }
+        m_aircraftIndex.updateEnabled(callsign, enabledForRendering);
         return m_aircraftInRange[callsign].setEnabled(enabledForRendering);
     }
 
@@ -522,6 +687,7 @@ namespace swift::misc::simulation
         for (const CCallsign &cs : callsigns)
         {
             if (!m_aircraftInRange.contains(cs)) { continue; }
+            m_aircraftIndex.updateEnabled(cs, enabledForRendering);
             if (m_aircraftInRange[cs].setEnabled(enabledForRendering)) { c++; }
         }
         return c;
@@ -556,6 +722,7 @@ namespace swift::misc::simulation
     {
         QWriteLocker l(&m_lockAircraft);
         if (!m_aircraftInRange.contains(callsign)) { return false; }
+        m_aircraftIndex.updateRendered(callsign, rendered);
         return m_aircraftInRange[callsign].setRendered(rendered);
     }
 
@@ -566,6 +733,7 @@ namespace swift::misc::simulation
         for (const CCallsign &cs : callsigns)
         {
             if (!m_aircraftInRange.contains(cs)) { continue; }
+            m_aircraftIndex.updateRendered(cs, rendered);
             if (m_aircraftInRange[cs].setRendered(rendered)) { c++; }
         }
         return c;
@@ -586,17 +754,18 @@ namespace swift::misc::simulation
 
         int updated = 0;
         {
+            const CCallsignHandle handle = CCallsignHandle::find(callsign);
             QWriteLocker l(&m_lockSituations);
-            CAircraftSituationList &situations = m_situationsByCallsign[callsign];
-            if (situations.isEmpty()) { return 0; }
-            updated = setGroundElevationCheckedAndGuessGround(situations, elevation, info, model, &change,
+            CAircraftSituationList *situations = m_situationsByCallsign.find(handle);
+            if (!situations || situations->isEmpty()) { return 0; }
+            updated = setGroundElevationCheckedAndGuessGround(*situations, elevation, info, model, &change,
                                                               &setForOnGndPosition);
             if (updated < 1) { return 0; }
-            m_situationsLastModified[callsign] = now;
-            const CAircraftSituation latestSituation = situations.front();
+            m_situationsLastModified[handle] = now;
+            const CAircraftSituation latestSituation = situations->front();
             if (info == CAircraftSituation::FromProvider && latestSituation.isOnGround())
             {
-                m_latestOnGroundProviderElevation[callsign] = latestSituation;
+                m_latestOnGroundProviderElevation[handle] = latestSituation;
             }
         }
 
@@ -678,7 +847,11 @@ namespace swift::misc::simulation
     {
         const CCallsignSet callsigns = this->getAircraftInRangeCallsigns();
         QWriteLocker l(&m_lockAircraft);
-        for (const CCallsign &cs : callsigns) { m_aircraftInRange[cs].setRendered(false); }
+        for (const CCallsign &cs : callsigns)
+        {
+            m_aircraftInRange[cs].setRendered(false);
+            m_aircraftIndex.updateRendered(cs, false);
+        }
     }
 
     void CRemoteAircraftProvider::enableReverseLookupMessages(ReverseLookupLogging enable)
@@ -735,28 +908,34 @@ namespace swift::misc::simulation
     bool CRemoteAircraftProvider::hasTestAltitudeOffset(const CCallsign &callsign) const
     {
         if (callsign.isEmpty()) { return false; }
+        const CCallsignHandle handle = CCallsignHandle::find(callsign);
         QReadLocker l(&m_lockSituations);
-        return m_testOffset.contains(callsign);
+        return m_testOffset.contains(handle);
     }
 
     bool CRemoteAircraftProvider::hasTestAltitudeOffsetGlobalValue() const
     {
+        const CCallsignHandle handle = CCallsignHandle::find(testAltitudeOffsetCallsign());
         QReadLocker l(&m_lockSituations);
-        return m_testOffset.contains(testAltitudeOffsetCallsign());
+        return m_testOffset.contains(handle);
     }
 
     CAircraftSituation
     CRemoteAircraftProvider::addTestAltitudeOffsetToSituation(const CAircraftSituation &situation) const
     {
-        const CCallsign cs(situation.getCallsign());
-        const bool globalOffset = this->hasTestAltitudeOffsetGlobalValue();
-        if (!globalOffset && !this->hasTestAltitudeOffset(cs)) { return situation; }
+        {
+            // normally there are no test offsets, so do not look up the callsign for each situation
+            QReadLocker l(&m_lockSituations);
+            if (m_testOffset.isEmpty()) { return situation; }
+        }
 
+        const CCallsignHandle handle = CCallsignHandle::find(situation.getCallsign());
+        const CCallsignHandle globalHandle = CCallsignHandle::find(testAltitudeOffsetCallsign());
         QReadLocker l(&m_lockSituations);
-        const CLength os =
-            m_testOffset.contains(cs) ? m_testOffset.value(cs) : m_testOffset.value(testAltitudeOffsetCallsign());
-        if (os.isNull() || os.isZeroEpsilonConsidered()) { return situation; }
-        return situation.withAltitudeOffset(os);
+        const CLength *os = m_testOffset.find(handle);
+        if (!os) { os = m_testOffset.find(globalHandle); }
+        if (!os || os->isNull() || os->isZeroEpsilonConsidered()) { return situation; }
+        return situation.withAltitudeOffset(*os);
     }
 
     ReverseLookupLogging CRemoteAircraftProvider::whatToReverseLog() const
@@ -841,15 +1020,25 @@ namespace swift::misc::simulation
     }
 
     qint64 CRemoteAircraftProvider::situationsLastModified(const CCallsign &callsign) const
+    {
+        return this->situationsLastModified(CCallsignHandle::find(callsign));
+    }
+
+    qint64 CRemoteAircraftProvider::situationsLastModified(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockSituations);
-        return m_situationsLastModified.value(callsign, -1);
+        return m_situationsLastModified.value(handle, -1);
     }
 
     qint64 CRemoteAircraftProvider::partsLastModified(const CCallsign &callsign) const
+    {
+        return this->partsLastModified(CCallsignHandle::find(callsign));
+    }
+
+    qint64 CRemoteAircraftProvider::partsLastModified(CCallsignHandle handle) const
     {
         QReadLocker l(&m_lockParts);
-        return m_partsLastModified.value(callsign, -1);
+        return m_partsLastModified.value(handle, -1);
     }
 
     CElevationPlane CRemoteAircraftProvider::averageElevationOfNonMovingAircraft(const CAircraftSituation &reference,
@@ -863,14 +1052,16 @@ namespace swift::misc::simulation
     bool CRemoteAircraftProvider::testAddAltitudeOffset(const CCallsign &callsign, const CLength &offset)
     {
         const bool remove = offset.isNull() || offset.isZeroEpsilonConsidered();
+        const CCallsignHandle handle = CCallsignHandle::intern(callsign);
+        if (handle.isNull()) { return false; }
         QWriteLocker l(&m_lockSituations);
         if (remove)
         {
-            m_testOffset.remove(callsign);
+            m_testOffset.remove(handle);
             return false;
         }
 
-        m_testOffset[callsign] = offset;
+        m_testOffset[handle] = offset;
         return true;
     }
 
@@ -929,18 +1120,24 @@ namespace swift::misc::simulation
 
     bool CRemoteAircraftProvider::removeAircraft(const CCallsign &callsign)
     {
+        const CCallsignHandle handle = CCallsignHandle::find(callsign);
         {
             QWriteLocker l1(&m_lockParts);
-            m_partsByCallsign.remove(callsign);
+            m_partsByCallsign.remove(handle);
             m_aircraftWithParts.remove(callsign);
-            m_partsLastModified.remove(callsign);
+            m_partsLastModified.remove(handle);
         }
         {
             QWriteLocker l2(&m_lockSituations);
-            m_situationsByCallsign.remove(callsign);
-            m_latestSituationByCallsign.remove(callsign);
-            m_latestOnGroundProviderElevation.remove(callsign);
-            m_situationsLastModified.remove(callsign);
+            m_situationsByCallsign.remove(handle);
+            m_latestSituationByCallsign.remove(handle);
+            m_latestOnGroundProviderElevation.remove(handle);
+            m_situationsLastModified.remove(handle);
+            m_latestSituationRevisions.remove(handle);
+        }
+        {
+            QWriteLocker l3(&m_lockChanges);
+            m_changesByCallsign.remove(handle);
         }
         {
             QWriteLocker l4(&m_lockPartsHistory);
@@ -951,6 +1148,7 @@ namespace swift::misc::simulation
             QWriteLocker l(&m_lockAircraft);
             m_dbCGPerCallsign.remove(callsign);
             const int c = m_aircraftInRange.remove(callsign);
+            m_aircraftIndex.remove(callsign);
             removedCallsign = c > 0;
         }
         return removedCallsign;
@@ -1143,6 +1341,48 @@ namespace swift::misc::simulation
         return this->provider()->partsLastModified(callsign);
     }
 
+    CAircraftSituationList CRemoteAircraftAware::remoteAircraftSituations(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftSituations(handle);
+    }
+
+    int CRemoteAircraftAware::remoteAircraftSituationsCount(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftSituationsCount(handle);
+    }
+
+    CAircraftPartsList CRemoteAircraftAware::remoteAircraftParts(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftParts(handle);
+    }
+
+    int CRemoteAircraftAware::remoteAircraftPartsCount(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftPartsCount(handle);
+    }
+
+    CAircraftSituationChangeList CRemoteAircraftAware::remoteAircraftSituationChanges(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftSituationChanges(handle);
+    }
+
+    qint64 CRemoteAircraftAware::situationsLastModified(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->situationsLastModified(handle);
+    }
+
+    qint64 CRemoteAircraftAware::partsLastModified(CCallsignHandle handle) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->partsLastModified(handle);
+    }
+
     CElevationPlane CRemoteAircraftAware::averageElevationOfNonMovingAircraft(const CAircraftSituation &reference,
                                                                               const CLength &range, int minValues) const
     {
@@ -19,11 +19,14 @@
 #include "misc/aviation/aircraftpartslist.h"
 #include "misc/aviation/aircraftsituationchangelist.h"
 #include "misc/aviation/aircraftsituationlist.h"
+#include "misc/aviation/callsignhandle.h"
 #include "misc/aviation/callsignset.h"
 #include "misc/aviation/percallsign.h"
 #include "misc/identifiable.h"
+#include "misc/memoryfootprint.h"
 #include "misc/provider.h"
 #include "misc/simulation/aircraftmodel.h"
+#include "misc/simulation/airspaceaircraftindex.h"
 #include "misc/simulation/airspaceaircraftsnapshot.h"
 #include "misc/simulation/reverselookup.h"
 #include "misc/simulation/simulatedaircraftlist.h"
@@ -267,6 +270,22 @@ namespace swift::misc
             //! \threadsafe
             virtual qint64 partsLastModified(const aviation::CCallsign &callsign) const = 0;
 
+            //! @{
+            //! Per callsign data by callsign handle
+            //! \remark for loops running per aircraft and frame, the callsign versions look up the handle each call
+            //! \threadsafe
+            virtual aviation::CAircraftSituationList
+            remoteAircraftSituations(aviation::CCallsignHandle handle) const = 0;
+            virtual int remoteAircraftSituationsCount(aviation::CCallsignHandle handle) const = 0;
+            virtual aviation::CAircraftPartsList remoteAircraftParts(aviation::CCallsignHandle handle) const = 0;
+            virtual int remoteAircraftPartsCount(aviation::CCallsignHandle handle) const = 0;
+            virtual aviation::CAircraftSituationChangeList
+            remoteAircraftSituationChanges(aviation::CCallsignHandle handle) const = 0;
+            virtual int remoteAircraftSituationChangesCount(aviation::CCallsignHandle handle) const = 0;
+            virtual qint64 situationsLastModified(aviation::CCallsignHandle handle) const = 0;
+            virtual qint64 partsLastModified(aviation::CCallsignHandle handle) const = 0;
+            //! @}
+
             //! Average elevation of aircraft in given range, which are NOT moving
             //! \remark can be used to anticipate field elevation
             //! \threadsafe
@@ -373,6 +392,15 @@ namespace swift::misc::simulation
         int aircraftPartsAdded() const override;
         qint64 situationsLastModified(const aviation::CCallsign &callsign) const override;
         qint64 partsLastModified(const aviation::CCallsign &callsign) const override;
+        aviation::CAircraftSituationList remoteAircraftSituations(aviation::CCallsignHandle handle) const override;
+        int remoteAircraftSituationsCount(aviation::CCallsignHandle handle) const override;
+        aviation::CAircraftPartsList remoteAircraftParts(aviation::CCallsignHandle handle) const override;
+        int remoteAircraftPartsCount(aviation::CCallsignHandle handle) const override;
+        aviation::CAircraftSituationChangeList
+        remoteAircraftSituationChanges(aviation::CCallsignHandle handle) const override;
+        int remoteAircraftSituationChangesCount(aviation::CCallsignHandle handle) const override;
+        qint64 situationsLastModified(aviation::CCallsignHandle handle) const override;
+        qint64 partsLastModified(aviation::CCallsignHandle handle) const override;
         geo::CElevationPlane averageElevationOfNonMovingAircraft(const aviation::CAircraftSituation &reference,
                                                                  const physical_quantities::CLength &range,
                                                                  int minValues = 1,
@@ -383,6 +411,16 @@ namespace swift::misc::simulation
             std::function<void(const aviation::CCallsign &)> removedAircraftSlot,
             std::function<void(const CAirspaceAircraftSnapshot &)> aircraftSnapshotSlot) override;
 
+        //! Revision of the latest situations, increased whenever a latest situation is stored or all are removed
+        //! \remark never decreases, removed aircraft are signalled by removedAircraft
+        //! \threadsafe
+        qint64 latestRemoteAircraftSituationsRevision() const;
+
+        //! Latest situations stored after the given revision, all for a negative revision
+        //! \remark lets displays update only the aircraft which have moved
+        //! \threadsafe
+        aviation::CAircraftSituationList latestRemoteAircraftSituationsSince(qint64 revision) const;
+
         void enableReverseLookupMessages(ReverseLookupLogging enable) override;
         ReverseLookupLogging isReverseLookupMessagesEnabled() const override;
         swift::misc::CStatusMessageList
@@ -404,6 +442,21 @@ namespace swift::misc::simulation
         //! Clear all data
         void clear();
 
+        //! Snapshot of the aircraft in range, without copying the aircraft
+        //! \threadsafe
+        CAirspaceAircraftSnapshot
+        getAirspaceAircraftSnapshot(bool restricted, bool renderingEnabled, int maxAircraft,
+                                    const physical_quantities::CLength &maxRenderedDistance) const;
+
+        //! Add the number of situations, parts, changes and aircraft, cheap enough for periodic logging
+        //! \threadsafe
+        void addMemoryFootprint(CMemoryFootprint &footprint) const;
+
+        //! Estimator for the memory of situations, parts, aircraft and message histories
+        //! \remark works on copies, so the expensive estimate can run in a worker thread
+        //! \threadsafe
+        CMemoryFootprint::Estimator getMemoryFootprintEstimator() const;
+
         // ------------------- testing ---------------
 
         //! Has test offset value?
@@ -517,18 +570,18 @@ namespace swift::misc::simulation
         //! \threadsafe
         void storeChange(const aviation::CAircraftSituationChange &change);
 
-        aviation::CAircraftSituationListPerCallsign
-            m_situationsByCallsign; //!< situations, for performance reasons per callsign, thread safe access required
-        aviation::CAircraftSituationPerCallsign
-            m_latestSituationByCallsign; //!< latest situations, for performance reasons per callsign, thread safe
-                                         //!< access required
-        aviation::CAircraftSituationPerCallsign
+        // per callsign data of the situation, parts and changes locks, indexed by callsign handle
+        // callsigns are interned when storing and only looked up otherwise
+        aviation::CCallsignHandleMap<aviation::CAircraftSituationList>
+            m_situationsByCallsign; //!< situations, thread safe access required
+        aviation::CCallsignHandleMap<aviation::CAircraftSituation>
+            m_latestSituationByCallsign; //!< latest situations, thread safe access required
+        aviation::CCallsignHandleMap<aviation::CAircraftSituation>
             m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
-        aviation::CAircraftPartsListPerCallsign
-            m_partsByCallsign; //!< parts, for performance reasons per callsign, thread safe access required
-        aviation::CAircraftSituationChangeListPerCallsign
-            m_changesByCallsign; //!< changes, for performance reasons per callsign, thread safe access required (same
-                                 //!< timestamps as corresponding situations)
+        aviation::CCallsignHandleMap<aviation::CAircraftPartsList>
+            m_partsByCallsign; //!< parts, thread safe access required
+        aviation::CCallsignHandleMap<aviation::CAircraftSituationChangeList>
+            m_changesByCallsign; //!< changes, thread safe access required (same timestamps as corresponding situations)
         aviation::CCallsignSet m_aircraftWithParts; //!< aircraft supporting parts, thread safe access required
         int m_situationsAdded = 0; //!< total number of situations added, thread safe access required
         int m_partsAdded = 0; //!< total number of parts added, thread safe access required
@@ -536,11 +589,14 @@ namespace swift::misc::simulation
         ReverseLookupLogging m_enableReverseLookupMsgs =
             RevLogSimplifiedInfo; //!< shall we log. information about the matching process
         simulation::CSimulatedAircraftPerCallsign m_aircraftInRange; //!< aircraft, thread safe access required
+        simulation::CAirspaceAircraftIndex m_aircraftIndex; //!< snapshot data of m_aircraftInRange, same lock
         aviation::CStatusMessageListPerCallsign m_reverseLookupMessages; //!< reverse lookup messages
         aviation::CStatusMessageListPerCallsign m_aircraftPartsMessages; //!< status messages for parts history
-        aviation::CTimestampPerCallsign m_situationsLastModified; //!< when situations last modified
-        aviation::CTimestampPerCallsign m_partsLastModified; //!< when parts last modified
-        aviation::CLengthPerCallsign m_testOffset; //!< offsets
+        aviation::CCallsignHandleMap<qint64> m_situationsLastModified; //!< when situations last modified
+        aviation::CCallsignHandleMap<qint64> m_latestSituationRevisions; //!< when latest situations were stored
+        qint64 m_latestSituationsRevision = 0; //!< never reset, so readers can tell changes after clearing
+        aviation::CCallsignHandleMap<qint64> m_partsLastModified; //!< when parts last modified
+        aviation::CCallsignHandleMap<physical_quantities::CLength> m_testOffset; //!< offsets
         aviation::CLengthPerCallsign m_dbCGPerCallsign; //!< DB CG per callsign
         QHash<QString, physical_quantities::CLength> m_dbCGPerModelString; //!< DB CG per model string
 
@@ -550,7 +606,7 @@ namespace swift::misc::simulation
         mutable QReadWriteLock m_lockSituations; //!< lock for situations: m_situationsByCallsign
         mutable QReadWriteLock m_lockParts; //!< lock for parts: m_partsByCallsign, m_aircraftSupportingParts
         mutable QReadWriteLock m_lockChanges; //!< lock for changes: m_changesByCallsign
-        mutable QReadWriteLock m_lockAircraft; //!< lock aircraft: m_aircraftInRange, m_dbCGPerCallsign
+        mutable QReadWriteLock m_lockAircraft; //!< lock aircraft: m_aircraftInRange, m_aircraftIndex, m_dbCGPerCallsign
         mutable QReadWriteLock m_lockMessages; //!< lock for messages
         mutable QReadWriteLock m_lockPartsHistory; //!< lock for aircraft parts
     };
@@ -673,6 +729,17 @@ namespace swift::misc::simulation
         //! \copydoc IRemoteAircraftProvider::partsLastModified
         qint64 partsLastModified(const aviation::CCallsign &callsign) const;
 
+        //! @{
+        //! Per callsign data by callsign handle, \sa IRemoteAircraftProvider
+        aviation::CAircraftSituationList remoteAircraftSituations(aviation::CCallsignHandle handle) const;
+        int remoteAircraftSituationsCount(aviation::CCallsignHandle handle) const;
+        aviation::CAircraftPartsList remoteAircraftParts(aviation::CCallsignHandle handle) const;
+        int remoteAircraftPartsCount(aviation::CCallsignHandle handle) const;
+        aviation::CAircraftSituationChangeList remoteAircraftSituationChanges(aviation::CCallsignHandle handle) const;
+        qint64 situationsLastModified(aviation::CCallsignHandle handle) const;
+        qint64 partsLastModified(aviation::CCallsignHandle handle) const;
+        //! @}
+
         //! \copydoc IRemoteAircraftProvider::averageElevationOfNonMovingAircraft
         geo::CElevationPlane averageElevationOfNonMovingAircraft(const aviation::CAircraftSituation &reference,
                                                                  const physical_quantities::CLength &range,
@@ -393,6 +393,13 @@ namespace swift::misc::simulation::settings
         m_technicalLogLevel = static_cast<int>(severity);
     }
 
+    CStatusMessage::StatusSeverity CSimulatorMessagesSettings::getTechnicalLogSeverity() const
+    {
+        return static_cast<CStatusMessage::StatusSeverity>(qBound(static_cast<int>(CStatusMessage::SeverityDebug),
+                                                                  m_technicalLogLevel,
+                                                                  static_cast<int>(CStatusMessage::SeverityError)));
+    }
+
     void CSimulatorMessagesSettings::disableTechnicalMessages() { m_technicalLogLevel = -1; }
 
     bool CSimulatorMessagesSettings::isRelayErrorsMessages() const
@@ -612,6 +612,10 @@ namespace swift::misc::simulation::settings
         //! Log severity
         void setTechnicalLogSeverity(CStatusMessage::StatusSeverity severity);
 
+        //! Log severity, lowest severity relayed
+        //! \remark meaningless if isRelayTechnicalMessages is false
+        CStatusMessage::StatusSeverity getTechnicalLogSeverity() const;
+
         //! Globally enable / disable
         void setRelayGloballyEnabled(bool enabled) { m_relayGloballyEnabled = enabled; }
 
@@ -33,16 +33,12 @@ namespace swift::misc::simulation
         const CLength minRange = ISimulationEnvironmentProvider::minRange(epsilon);
         const double elvFt = elevationCoordinate.geodeticHeight().value(CLengthUnit::ft());
 
-        CCoordinateGeodetic alreadyInRange;
-        CCoordinateGeodetic alreadyInRangeGnd;
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            if (!m_enableElevation) { return false; }
+        if (!m_enableElevation) { return false; }
 
-            // check if we have already an elevation within range
-            alreadyInRangeGnd = m_elvCoordinatesGnd.findFirstWithinRangeOrDefault(elevationCoordinate, minRange);
-            alreadyInRange = m_elvCoordinates.findFirstWithinRangeOrDefault(elevationCoordinate, minRange);
-        }
+        // check if we have already an elevation within range
+        const CCoordinateGeodetic alreadyInRangeGnd =
+            m_elvCacheGnd.findClosestWithinRange(elevationCoordinate, minRange);
+        const CCoordinateGeodetic alreadyInRange = m_elvCache.findClosestWithinRange(elevationCoordinate, minRange);
 
         constexpr double maxDistFt = 30.0;
 
@@ -82,23 +78,12 @@ namespace swift::misc::simulation
         }
 
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
-        {
-            // we keep latest at front
-            // * we assume we find them faster
-            // * and need them more frequently (the recent ones)
-            QWriteLocker l(&m_lockElvCoordinates);
-            if (likelyOnGroundElevation)
-            {
-                if (m_elvCoordinatesGnd.size() > m_maxElevationsGnd) { m_elvCoordinatesGnd.pop_back(); }
-                m_elvCoordinatesGnd.push_front(elevationCoordinate);
-            }
-            else
-            {
-                if (m_elvCoordinates.size() > m_maxElevations) { m_elvCoordinates.pop_back(); }
-                m_elvCoordinates.push_front(elevationCoordinate);
-            }
+        if (likelyOnGroundElevation) { m_elvCacheGnd.insert(elevationCoordinate); }
+        else { m_elvCache.insert(elevationCoordinate); }
 
+        {
             // statistics
+            QWriteLocker l(&m_lockElvCoordinates);
             if (m_pendingElevationRequests.contains(requestedForCallsign))
             {
                 const qint64 startedMs = m_pendingElevationRequests.value(requestedForCallsign);
@@ -272,22 +257,20 @@ namespace swift::misc::simulation
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates() const
     {
-        QReadLocker l(&m_lockElvCoordinates);
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
+        CCoordinateGeodeticList cl(m_elvCacheGnd.getElevations());
+        cl.push_back(m_elvCache.getElevations());
         return cl;
     }
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getElevationCoordinatesOnGround() const
     {
-        QReadLocker l(&m_lockElvCoordinates);
-        return m_elvCoordinatesGnd;
+        return m_elvCacheGnd.getElevations();
     }
 
     CElevationPlane ISimulationEnvironmentProvider::averageElevationOfOnGroundAircraft(
         const CAircraftSituation &reference, const CLength &range, int minValues, int sufficientValues) const
     {
-        const CCoordinateGeodeticList coordinates = this->getElevationCoordinatesOnGround();
+        const CCoordinateGeodeticList coordinates = m_elvCacheGnd.findWithinRange(reference, range);
         return coordinates.averageGeodeticHeight(reference, range, CAircraftSituation::allowedAltitudeDeviation(),
                                                  minValues, sufficientValues);
     }
@@ -301,28 +284,14 @@ namespace swift::misc::simulation
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates(int &maxRemembered) const
     {
-        QReadLocker l(&m_lockElvCoordinates);
-        maxRemembered = m_maxElevations;
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
-        return cl;
+        maxRemembered = m_elvCache.getCapacity();
+        return this->getAllElevationCoordinates();
     }
 
     int ISimulationEnvironmentProvider::cleanUpElevations(const ICoordinateGeodetic &referenceCoordinate, int maxNumber)
     {
-        int currentMax {};
-        CCoordinateGeodeticList coordinates(this->getAllElevationCoordinates(currentMax));
-        if (maxNumber < 0) { maxNumber = currentMax; }
-        const int size = coordinates.size();
-        if (size <= maxNumber) { return 0; }
-        coordinates.sortByEuclideanDistanceSquared(referenceCoordinate);
-        coordinates.truncate(maxNumber);
-        const int delta = size - coordinates.size();
-        {
-            QWriteLocker l(&m_lockElvCoordinates);
-            m_elvCoordinates = coordinates;
-        }
-        return delta;
+        if (maxNumber < 0) { maxNumber = m_elvCache.getCapacity(); }
+        return m_elvCache.keepClosest(referenceCoordinate, maxNumber);
     }
 
     CElevationPlane
@@ -331,28 +300,26 @@ namespace swift::misc::simulation
     {
         if (!this->isElevationProviderEnabled()) { return CElevationPlane::null(); }
 
-        // for single point we use a slightly optimized version
+        // for a single point any elevation on ground is good enough, otherwise the closest one
         const bool singlePoint = (&range == &CElevationPlane::singlePointRadius() || range.isNull() ||
                                   range <= CElevationPlane::singlePointRadius());
-        const CCoordinateGeodeticList elevations = this->getAllElevationCoordinates();
-        const CCoordinateGeodetic coordinate =
-            singlePoint ? elevations.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()) :
-                          elevations.findClosestWithinRange(reference, range);
-        const bool found = !coordinate.isNull();
+        const CLength &r = singlePoint ? CElevationPlane::singlePointRadius() : range;
+        CCoordinateGeodetic coordinate = m_elvCacheGnd.findClosestWithinRange(reference, r);
+        if (coordinate.isNull() || !singlePoint)
+        {
+            const CCoordinateGeodetic other = m_elvCache.findClosestWithinRange(reference, r);
+            const bool closer = coordinate.isNull() || calculateEuclideanDistanceSquared(other, reference) <
+                                                           calculateEuclideanDistanceSquared(coordinate, reference);
+            if (!other.isNull() && closer) { coordinate = other; }
+        }
 
+        if (coordinate.isNull())
         {
-            QWriteLocker l { &m_lockElvCoordinates };
-            if (found)
-            {
-                m_elvFound++;
-                return { coordinate, reference }; // plane with radius = distance to reference
-            }
-            else
-            {
-                m_elvMissed++;
-                return CElevationPlane::null();
-            }
+            m_elvMissed++;
+            return CElevationPlane::null();
         }
+        m_elvFound++;
+        return { coordinate, reference }; // plane with radius = distance to reference
     }
 
     CElevationPlane ISimulationEnvironmentProvider::findClosestElevationWithinRangeOrRequest(
@@ -378,26 +345,30 @@ namespace swift::misc::simulation
 
     QPair<int, int> ISimulationEnvironmentProvider::getElevationsFoundMissed() const
     {
-        QReadLocker l(&m_lockElvCoordinates);
         return { m_elvFound, m_elvMissed };
     }
 
+    qint64 ISimulationEnvironmentProvider::getElevationsEvicted() const
+    {
+        return m_elvCache.getEvictedCount() + m_elvCacheGnd.getEvictedCount();
+    }
+
     QString ISimulationEnvironmentProvider::getElevationsFoundMissedInfo() const
     {
-        static const QString info("%1/%2 %3% in %4 (all)/%5 (gnd)");
+        static const QString info("%1/%2 %3% in %4 (all)/%5 (gnd), %6 evicted");
         const QPair<int, int> foundMissed = this->getElevationsFoundMissed();
         const int f = foundMissed.first;
         const int m = foundMissed.second;
         const double hitRatioPercent = 100.0 * static_cast<double>(f) / static_cast<double>(f + m);
 
-        int elvGnd {};
-        int elv {};
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            elvGnd = m_elvCoordinatesGnd.sizeInt();
-            elv = m_elvCoordinates.sizeInt();
-        }
-        return info.arg(f).arg(m).arg(QString::number(hitRatioPercent, 'f', 1)).arg(elv).arg(elvGnd);
+        const int elvGnd = m_elvCacheGnd.size();
+        const int elv = m_elvCache.size();
+        return info.arg(f)
+            .arg(m)
+            .arg(QString::number(hitRatioPercent, 'f', 1))
+            .arg(elv)
+            .arg(elvGnd)
+            .arg(this->getElevationsEvicted());
     }
 
     QPair<qint64, qint64> ISimulationEnvironmentProvider::getElevationRequestTimes() const
@@ -546,15 +517,21 @@ namespace swift::misc::simulation
 
     int ISimulationEnvironmentProvider::setMaxElevationsRemembered(int max)
     {
-        QWriteLocker l(&m_lockElvCoordinates);
-        m_maxElevations = qMax(max, 50);
-        return m_maxElevations;
+        m_elvCache.setCapacity(qMax(max, MinMaxElevations));
+        return m_elvCache.getCapacity();
     }
 
-    int ISimulationEnvironmentProvider::getMaxElevationsRemembered() const
+    int ISimulationEnvironmentProvider::getMaxElevationsRemembered() const { return m_elvCache.getCapacity(); }
+
+    int ISimulationEnvironmentProvider::setMaxElevationsRememberedOnGround(int max)
     {
-        QReadLocker l(&m_lockElvCoordinates);
-        return m_maxElevations;
+        m_elvCacheGnd.setCapacity(qMax(max, MinMaxElevations));
+        return m_elvCacheGnd.getCapacity();
+    }
+
+    int ISimulationEnvironmentProvider::getMaxElevationsRememberedOnGround() const
+    {
+        return m_elvCacheGnd.getCapacity();
     }
 
     void ISimulationEnvironmentProvider::resetSimulationEnvironmentStatistics()
@@ -562,15 +539,16 @@ namespace swift::misc::simulation
         QWriteLocker l(&m_lockElvCoordinates);
         m_statsCurrentElevRequestTimeMs = -1;
         m_statsMaxElevRequestTimeMs = -1;
-        m_elvFound = m_elvMissed = 0;
+        m_elvFound = 0;
+        m_elvMissed = 0;
+        m_elvCache.resetStatistics();
+        m_elvCacheGnd.resetStatistics();
     }
 
     int ISimulationEnvironmentProvider::removeElevationValues(const CAircraftSituation &reference,
                                                               const CLength &removeRange)
     {
-        QWriteLocker l(&m_lockElvCoordinates);
-        const int r = m_elvCoordinatesGnd.removeInsideRange(reference, removeRange);
-        return r;
+        return m_elvCacheGnd.removeInsideRange(reference, removeRange);
     }
 
     bool ISimulationEnvironmentProvider::cleanElevationValues(const CAircraftSituation &reference,
@@ -579,43 +557,12 @@ namespace swift::misc::simulation
         if (reference.isNull() || keptRange.isNull()) { return false; }
         const CLength r = minRange(keptRange);
 
-        CCoordinateGeodeticList cleanedKeptElvs;
-        bool maxReached = false;
         bool cleaned = false;
-
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinates;
-            maxReached = m_elvCoordinates.size() >= m_maxElevations;
-        }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
-        {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinates = cleanedKeptElvs;
-            }
-        }
-
-        cleanedKeptElvs.clear();
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinatesGnd;
-            maxReached = m_elvCoordinatesGnd.size() >= m_maxElevationsGnd;
-        }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
+        for (CElevationCache *cache : { &m_elvCache, &m_elvCacheGnd })
         {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinatesGnd = cleanedKeptElvs;
-            }
+            if (!forced && cache->size() < cache->getCapacity()) { continue; }
+            if (cache->removeOutsideRange(reference, r) > 0) { cleaned = true; }
         }
-
         return cleaned;
     }
 
@@ -636,11 +583,7 @@ namespace swift::misc::simulation
         return m_enableCG;
     }
 
-    bool ISimulationEnvironmentProvider::isElevationProviderEnabled() const
-    {
-        QReadLocker l(&m_lockElvCoordinates);
-        return m_enableElevation;
-    }
+    bool ISimulationEnvironmentProvider::isElevationProviderEnabled() const { return m_enableElevation; }
 
     void ISimulationEnvironmentProvider::setCgProviderEnabled(bool enabled)
     {
@@ -648,11 +591,7 @@ namespace swift::misc::simulation
         m_enableCG = enabled;
     }
 
-    void ISimulationEnvironmentProvider::setElevationProviderEnabled(bool enabled)
-    {
-        QWriteLocker l(&m_lockElvCoordinates);
-        m_enableElevation = enabled;
-    }
+    void ISimulationEnvironmentProvider::setElevationProviderEnabled(bool enabled) { m_enableElevation = enabled; }
 
     void ISimulationEnvironmentProvider::setSimulationProviderEnabled(bool elvEnabled, bool cgEnabled)
     {
@@ -717,13 +656,14 @@ namespace swift::misc::simulation
 
     void ISimulationEnvironmentProvider::clearElevations()
     {
+        m_elvCache.clear();
+        m_elvCacheGnd.clear();
         QWriteLocker l(&m_lockElvCoordinates);
-        m_elvCoordinates.clear();
-        m_elvCoordinatesGnd.clear();
         m_pendingElevationRequests.clear();
         m_statsCurrentElevRequestTimeMs = -1;
         m_statsMaxElevRequestTimeMs = -1;
-        m_elvFound = m_elvMissed = 0;
+        m_elvFound = 0;
+        m_elvMissed = 0;
     }
 
     void ISimulationEnvironmentProvider::clearCGs()
@@ -791,6 +731,12 @@ namespace swift::misc::simulation
         return this->provider()->getElevationsFoundMissed();
     }
 
+    qint64 CSimulationEnvironmentAware::getElevationsEvicted() const
+    {
+        if (!this->hasProvider()) { return 0; }
+        return this->provider()->getElevationsEvicted();
+    }
+
     QString CSimulationEnvironmentAware::getElevationsFoundMissedInfo() const
     {
         if (!this->hasProvider()) { return {}; }
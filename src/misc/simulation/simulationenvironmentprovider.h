@@ -6,6 +6,8 @@
 #ifndef SWIFT_MISC_SIMULATION_SIMULATIONENVIRONMENTPROVIDER_H
 #define SWIFT_MISC_SIMULATION_SIMULATIONENVIRONMENTPROVIDER_H
 
+#include <atomic>
+
 #include <QHash>
 #include <QObject>
 #include <QPair>
@@ -17,6 +19,7 @@
 #include "misc/pq/length.h"
 #include "misc/provider.h"
 #include "misc/simulation/aircraftmodel.h"
+#include "misc/simulation/elevationcache.h"
 #include "misc/simulation/settings/simulatorsettings.h"
 #include "misc/simulation/simulatorplugininfo.h"
 
@@ -27,6 +30,10 @@ namespace swift::misc::simulation
     class SWIFT_MISC_EXPORT ISimulationEnvironmentProvider : public IProvider
     {
     public:
+        static constexpr int DefaultMaxElevations = 1000; //!< How many elevations we keep initially
+        static constexpr int DefaultMaxElevationsGnd = 4000; //!< How many elevations we keep for elevations on gnd.
+        static constexpr int MinMaxElevations = 50; //!< Lower bound for the number of elevations kept
+
         //! All remembered coordinates
         //! \threadsafe
         geo::CCoordinateGeodeticList getAllElevationCoordinates() const;
@@ -69,6 +76,10 @@ namespace swift::misc::simulation
         //! \threadsafe
         QPair<int, int> getElevationsFoundMissed() const;
 
+        //! Elevations evicted from the caches because their capacity was exceeded
+        //! \threadsafe
+        qint64 getElevationsEvicted() const;
+
         //! The elevation request times
         //! \threadsafe
         QPair<qint64, qint64> getElevationRequestTimes() const;
@@ -136,7 +147,7 @@ namespace swift::misc::simulation
         //! \threadsafe
         bool hasSameSimulatorCG(const physical_quantities::CLength &cg, const aviation::CCallsign &callsign) const;
 
-        //! Set number of elevations kept
+        //! Set number of elevations kept, at least 50
         //! \threadsafe
         int setMaxElevationsRemembered(int max);
 
@@ -144,6 +155,14 @@ namespace swift::misc::simulation
         //! \threadsafe
         int getMaxElevationsRemembered() const;
 
+        //! Set number of elevations kept for on ground situations, at least 50
+        //! \threadsafe
+        int setMaxElevationsRememberedOnGround(int max);
+
+        //! Get number of max. number of elevations for on ground situations
+        //! \threadsafe
+        int getMaxElevationsRememberedOnGround() const;
+
         //! Reset statistics
         //! \threadsafe
         void resetSimulationEnvironmentStatistics();
@@ -303,10 +322,8 @@ namespace swift::misc::simulation
         CAircraftModel m_defaultModel; //!< default model
 
         // idea: the elevations on gnd are likely taxiways and runways, so we keep those
-        int m_maxElevations = 100; //!< How many elevations we keep
-        int m_maxElevationsGnd = 400; //!< How many elevations we keep for elevations on gnd.
-        geo::CCoordinateGeodeticList m_elvCoordinates; //!< elevation cache
-        geo::CCoordinateGeodeticList m_elvCoordinatesGnd; //!< elevation cache for on ground situations
+        CElevationCache m_elvCache { DefaultMaxElevations }; //!< elevation cache
+        CElevationCache m_elvCacheGnd { DefaultMaxElevationsGnd }; //!< elevation cache for on ground situations
 
         aviation::CTimestampPerCallsign
             m_pendingElevationRequests; //!< pending elevation requests for aircraft callsign
@@ -318,15 +335,15 @@ namespace swift::misc::simulation
         qint64 m_statsMaxElevRequestTimeMs = -1;
         qint64 m_statsCurrentElevRequestTimeMs = -1;
 
-        bool m_enableElevation = true;
+        std::atomic_bool m_enableElevation { true };
         bool m_enableCG = true;
 
-        mutable int m_elvFound = 0; //!< statistics only
-        mutable int m_elvMissed = 0; //!< statistics only
+        mutable std::atomic_int m_elvFound { 0 }; //!< statistics only
+        mutable std::atomic_int m_elvMissed { 0 }; //!< statistics only
 
         mutable QReadWriteLock m_lockElvCoordinates {
             QReadWriteLock::Recursive
-        }; //!< lock m_coordinates, m_pendingElevationRequests
+        }; //!< lock m_pendingElevationRequests and request times, the caches have their own
         mutable QReadWriteLock m_lockCG { QReadWriteLock::Recursive }; //!< lock CGs
         mutable QReadWriteLock m_lockModel { QReadWriteLock::Recursive }; //!< lock models
         mutable QReadWriteLock m_lockSimInfo { QReadWriteLock::Recursive }; //!< lock plugin info
@@ -367,6 +384,9 @@ namespace swift::misc::simulation
         //! \copydoc ISimulationEnvironmentProvider::getElevationsFoundMissed
         QPair<int, int> getElevationsFoundMissed() const;
 
+        //! \copydoc ISimulationEnvironmentProvider::getElevationsEvicted
+        qint64 getElevationsEvicted() const;
+
         //! \copydoc ISimulationEnvironmentProvider::getElevationsFoundMissedInfo
         QString getElevationsFoundMissedInfo() const;
 
@@ -4,8 +4,6 @@
 #include "misc/simulation/xplane/aircraftmodelloaderxplane.h"
 
 #include <algorithm>
-#include <cstring>
-#include <functional>
 
 #include <QChar>
 #include <QDateTime>
@@ -16,10 +14,10 @@
 #include <QFlags>
 #include <QIODevice>
 #include <QList>
-#include <QMap>
 #include <QRegularExpression>
 #include <QStringBuilder>
-#include <QTextStream>
+#include <QThreadPool>
+#include <QVector>
 
 #include "config/buildconfig.h"
 #include "misc/aviation/aircrafticaocode.h"
@@ -31,6 +29,8 @@
 #include "misc/simulation/aircraftmodel.h"
 #include "misc/simulation/aircraftmodelutils.h"
 #include "misc/simulation/distributor.h"
+#include "misc/simulation/modeldirectoryscanner.h"
+#include "misc/simulation/xplane/cslpackageparser.h"
 #include "misc/simulation/xplane/qtfreeutils.h"
 #include "misc/simulation/xplane/xplaneutil.h"
 #include "misc/statusmessage.h"
@@ -46,15 +46,6 @@ using namespace swift::misc::network;
 
 namespace swift::misc::simulation::xplane
 {
-    //! Normalizes CSL model "designators" e.g. __XPFW_Jets:A320_a:A320_a_Austrian_Airlines.obj
-    static void normalizePath(QString &path)
-    {
-        for (auto &e : path)
-        {
-            if (e == '/' || e == ':' || e == '\\') { e = '/'; }
-        }
-    }
-
     //! Create a description string for a model that doesn't already have one
     static QString descriptionForFlyableModel(const CAircraftModel &model)
     {
@@ -147,13 +138,6 @@ namespace swift::misc::simulation::xplane
         m_loadingMessages.push_back(m);
     }
 
-    QString CAircraftModelLoaderXPlane::CSLPlane::getModelName() const
-    {
-        QString modelName = dirNames.join(' ') % u' ' % objectName;
-        if (objectVersion == OBJ7) { modelName += u' ' % textureName; }
-        return std::move(modelName).trimmed();
-    }
-
     CAircraftModelList CAircraftModelLoaderXPlane::performParsing(const QStringList &rootDirectories,
                                                                   const QStringList &excludeDirectories)
     {
@@ -183,54 +167,60 @@ namespace swift::misc::simulation::xplane
     CAircraftModelList CAircraftModelLoaderXPlane::parseFlyableAirplanes(const QString &rootDirectory,
                                                                          const QStringList &excludeDirectories)
     {
-        Q_UNUSED(excludeDirectories)
         if (rootDirectory.isEmpty()) { return {}; }
 
-        QDir searchPath(rootDirectory, fileFilterFlyable());
-        QDirIterator aircraftIt(searchPath, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
-
         emit loadingProgress(this->getSimulator(),
                              QStringLiteral("Parsing flyable airplanes in '%1'").arg(rootDirectory), -1);
 
+        CModelDirectoryScanner scanner(m_cancelLoading);
+        scanner.setNameFilters({ fileFilterFlyable() });
+        scanner.setDirectoryFilter([&excludeDirectories](const QString &dir) {
+            return !CFileUtils::isExcludedDirectory(dir, excludeDirectories, Qt::CaseInsensitive);
+        });
+
+        // one *.acf file yields the model and its liveries
+        const QVector<QVector<CAircraftModel>> acfModels =
+            scanner.scan<QVector<CAircraftModel>>(rootDirectory, [](const QFileInfo &acfFile) {
+                using namespace swift::misc::simulation::xplane::qtfreeutils;
+                const AcfProperties acfProperties = extractAcfProperties(acfFile.filePath().toStdString());
+
+                const CDistributor dist({}, QString::fromStdString(acfProperties.author), {}, {},
+                                        CSimulatorInfo::XPLANE);
+                CAircraftModel model;
+                model.setAircraftIcaoCode(QString::fromStdString(acfProperties.aircraftIcaoCode));
+                model.setDescription(QString::fromStdString(acfProperties.modelDescription));
+                model.setName(QString::fromStdString(acfProperties.modelName));
+                model.setDistributor(dist);
+                model.setModelString(QString::fromStdString(acfProperties.modelString));
+                if (!model.hasDescription()) { model.setDescription(descriptionForFlyableModel(model)); }
+                model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
+                model.setSimulator(CSimulatorInfo::xplane());
+                model.setFileDetailsAndTimestamp(acfFile);
+                model.setModelMode(CAircraftModel::Exclude);
+
+                QVector<CAircraftModel> models { model };
+                const QString baseModelString = model.getModelString();
+                QDirIterator liveryIt(CFileUtils::appendFilePaths(acfFile.canonicalPath(), QStringLiteral("liveries")),
+                                      QDir::Dirs | QDir::NoDotAndDotDot);
+                QStringList liveries;
+                while (liveryIt.hasNext())
+                {
+                    liveryIt.next();
+                    liveries.push_back(liveryIt.fileName());
+                }
+                liveries.sort(); // deterministic order
+                for (const QString &livery : std::as_const(liveries))
+                {
+                    model.setModelString(baseModelString % u' ' % livery);
+                    models.push_back(model);
+                }
+                return models;
+            });
+
         CAircraftModelList installedModels;
-        while (aircraftIt.hasNext())
+        for (const QVector<CAircraftModel> &models : acfModels)
         {
-            aircraftIt.next();
-            if (CFileUtils::isExcludedDirectory(aircraftIt.fileInfo(), excludeDirectories, Qt::CaseInsensitive))
-            {
-                continue;
-            }
-
-            using namespace swift::misc::simulation::xplane::qtfreeutils;
-            AcfProperties acfProperties = extractAcfProperties(aircraftIt.filePath().toStdString());
-
-            const CDistributor dist({}, QString::fromStdString(acfProperties.author), {}, {}, CSimulatorInfo::XPLANE);
-            CAircraftModel model;
-            model.setAircraftIcaoCode(QString::fromStdString(acfProperties.aircraftIcaoCode));
-            model.setDescription(QString::fromStdString(acfProperties.modelDescription));
-            model.setName(QString::fromStdString(acfProperties.modelName));
-            model.setDistributor(dist);
-            model.setModelString(QString::fromStdString(acfProperties.modelString));
-            if (!model.hasDescription()) { model.setDescription(descriptionForFlyableModel(model)); }
-            model.setModelType(CAircraftModel::TypeOwnSimulatorModel);
-            model.setSimulator(CSimulatorInfo::xplane());
-            model.setFileDetailsAndTimestamp(aircraftIt.fileInfo());
-            model.setModelMode(CAircraftModel::Exclude);
-            addUniqueModel(model, installedModels);
-
-            const QString baseModelString = model.getModelString();
-            QDirIterator liveryIt(
-                CFileUtils::appendFilePaths(aircraftIt.fileInfo().canonicalPath(), QStringLiteral("liveries")),
-                QDir::Dirs | QDir::NoDotAndDotDot);
-            emit this->loadingProgress(
-                this->getSimulator(),
-                QStringLiteral("Parsing flyable liveries in '%1'").arg(aircraftIt.fileInfo().canonicalPath()), -1);
-            while (liveryIt.hasNext())
-            {
-                liveryIt.next();
-                model.setModelString(baseModelString % u' ' % liveryIt.fileName());
-                addUniqueModel(model, installedModels);
-            }
+            for (const CAircraftModel &model : models) { addUniqueModel(model, installedModels); }
         }
         return installedModels;
     }
@@ -238,50 +228,70 @@ namespace swift::misc::simulation::xplane
     CAircraftModelList CAircraftModelLoaderXPlane::parseCslPackages(const QString &rootDirectory,
                                                                     const QStringList &excludeDirectories)
     {
-        Q_UNUSED(excludeDirectories);
         if (rootDirectory.isEmpty()) { return {}; }
 
         m_cslPackages.clear();
 
-        QDir searchPath(rootDirectory, fileFilterCsl());
-        QDirIterator it(searchPath, QDirIterator::Subdirectories);
-        while (it.hasNext())
+        CModelDirectoryScanner scanner(m_cancelLoading);
+        scanner.setFollowSymlinks(false);
+        scanner.setNameFilters({ fileFilterCsl() });
+        scanner.setDirectoryFilter([&excludeDirectories](const QString &dir) {
+            return !CFileUtils::isExcludedDirectory(dir, excludeDirectories);
+        });
+
+        // headers are read in parallel, package names are checked for uniqueness in enumeration order
+        const CCslPackageParser headerParser;
+        const QVector<CSLPackage> headers =
+            scanner.scan<CSLPackage>(rootDirectory, [&headerParser](const QFileInfo &packageFile) {
+                bool ok = false;
+                const QString path = packageFile.absolutePath();
+                const QByteArray content = CCslPackageParser::readPackageFile(path, ok);
+                SWIFT_VERIFY_X(ok, Q_FUNC_INFO, "Could not open package file");
+                return headerParser.parseHeader(path, content);
+            });
+        for (const CSLPackage &header : headers)
         {
-            QString packageFile = it.next();
-            if (CFileUtils::isExcludedDirectory(it.filePath(), excludeDirectories)) { continue; }
-
-            const QString packageFilePath = it.fileInfo().absolutePath();
-            QFile file(packageFile);
-            const bool res = file.open(QIODevice::ReadOnly);
-            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open package file");
-            QString content;
-
-            QTextStream ts(&file);
-            content.append(ts.readAll());
-            file.close();
-
-            const auto package = parsePackageHeader(packageFilePath, content);
-            if (package.hasValidHeader()) m_cslPackages.push_back(package);
+            m_loadingMessages.push_back(header.messages);
+            if (!header.hasValidHeader()) { continue; }
+            auto p = std::find_if(m_cslPackages.cbegin(), m_cslPackages.cend(),
+                                  [&header](const CSLPackage &p) { return p.name == header.name; });
+            if (p != m_cslPackages.cend())
+            {
+                const CStatusMessage m =
+                    CStatusMessage(this).error(
+                        u"XPlane package name '%1' already in use by '%2' reqested by use by '%3'")
+                    << header.name << p->path << header.path;
+                m_loadingMessages.push_back(m);
+                continue;
+            }
+            CSLPackage package(header);
+            package.messages.clear();
+            m_cslPackages.push_back(package);
         }
 
-        CAircraftModelList installedModels;
-
-        // Now we do a full run
+        // Now we do a full run on the content read with the headers, packages are parsed in parallel
+        emit this->loadingProgress(this->getSimulator(),
+                                   QStringLiteral("Parsing %1 CSL packages in '%2'")
+                                       .arg(m_cslPackages.size())
+                                       .arg(rootDirectory),
+                                   -1);
+        const CCslPackageParser parser(m_cslPackages);
+        QThreadPool pool;
+        pool.setMaxThreadCount(CModelDirectoryScanner::defaultParserThreads());
         for (auto &package : m_cslPackages)
         {
-            const QString packageFile = CFileUtils::appendFilePaths(package.path, QStringLiteral("xsb_aircraft.txt"));
-            emit this->loadingProgress(this->getSimulator(), QStringLiteral("Parsing CSL '%1'").arg(packageFile), -1);
-
-            QFile file(packageFile);
-            const bool res = file.open(QIODevice::ReadOnly);
-            SWIFT_VERIFY_X(res, Q_FUNC_INFO, "Could not open package file");
-            QString content;
-
-            QTextStream ts(&file);
-            content.append(ts.readAll());
-            file.close();
-            parseFullPackage(content, package);
+            pool.start([this, &parser, &package] {
+                if (m_cancelLoading) { return; }
+                parser.parseFull(package);
+            });
+        }
+        pool.waitForDone();
+        if (m_cancelLoading) { return {}; }
 
+        CAircraftModelList installedModels;
+        for (const auto &package : std::as_const(m_cslPackages))
+        {
+            m_loadingMessages.push_back(package.messages);
             for (const auto &plane : std::as_const(package.planes))
             {
                 if (installedModels.containsModelString(plane.getModelName()))
@@ -322,438 +332,6 @@ namespace swift::misc::simulation::xplane
         return installedModels;
     }
 
-    bool CAircraftModelLoaderXPlane::doPackageSub(QString &ioPath)
-    {
-        for (auto i = m_cslPackages.cbegin(); i != m_cslPackages.cend(); ++i)
-        {
-            if (strncmp(qPrintable(i->name), qPrintable(ioPath), static_cast<size_t>(i->name.size())) == 0)
-            {
-                ioPath.remove(0, i->name.size());
-                ioPath.insert(0, i->path);
-                return true;
-            }
-        }
-        return false;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseExportCommand(const QStringList &tokens, CSLPackage &package,
-                                                        const QString &path, int lineNum)
-    {
-        if (tokens.size() != 2)
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : EXPORT_NAME command requires 1 argument.")
-                << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-
-        auto p = std::find_if(m_cslPackages.cbegin(), m_cslPackages.cend(),
-                              [&tokens](const CSLPackage &p) { return p.name == tokens[1]; });
-        if (p == m_cslPackages.cend())
-        {
-            package.path = path;
-            package.name = tokens[1];
-            return true;
-        }
-        else
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"XPlane package name '%1' already in use by '%2' reqested by use by '%3'")
-                << tokens[1] << p->path << path;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-    }
-
-    bool CAircraftModelLoaderXPlane::parseDependencyCommand(const QStringList &tokens, CSLPackage &package,
-                                                            const QString &path, int lineNum)
-    {
-        Q_UNUSED(package);
-        if (tokens.size() != 2)
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : DEPENDENCY command requires 1 argument.")
-                << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-
-        if (std::count_if(m_cslPackages.cbegin(), m_cslPackages.cend(),
-                          [&tokens](const CSLPackage &p) { return p.name == tokens[1]; }) == 0)
-        {
-            const CStatusMessage m = CStatusMessage(this).error(
-                                         u"XPlane required package %1 not found. Aborting processing of this package.")
-                                     << tokens[1];
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-
-        return true;
-    }
-
-    //! Reads the next line from stream ignoring empty ones.
-    //! Returns a null QString if stream is at the end.
-    QString readLineFrom(QTextStream &stream)
-    {
-        QString line;
-        do {
-            line = stream.readLine();
-        }
-        while (line.isEmpty() && !stream.atEnd());
-        return line;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseObjectCommand(const QStringList &, CSLPackage &package, const QString &path,
-                                                        int lineNum)
-    {
-        package.planes.push_back(CSLPlane());
-
-        const auto m = CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unsupported legacy CSL format.")
-                       << path << lineNum;
-        m_loadingMessages.push_back(m);
-        return false;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseTextureCommand(const QStringList &, CSLPackage &package, const QString &path,
-                                                         int lineNum)
-    {
-        if (!package.planes.isEmpty() && !package.planes.back().hasErrors)
-        {
-            const auto m = CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unsupported legacy CSL format.")
-                           << path << lineNum;
-            m_loadingMessages.push_back(m);
-        }
-        return false;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseAircraftCommand(const QStringList &, CSLPackage &package, const QString &path,
-                                                          int lineNum)
-    {
-        package.planes.push_back(CSLPlane());
-
-        const auto m = CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unsupported legacy CSL format.")
-                       << path << lineNum;
-        m_loadingMessages.push_back(m);
-        return false;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseObj8AircraftCommand(const QStringList &tokens, CSLPackage &package,
-                                                              const QString &path, int lineNum)
-    {
-        package.planes.push_back(CSLPlane());
-
-        // OBJ8_AIRCRAFT <path>
-        if (tokens.size() != 2)
-        {
-            const CStatusMessage m = CStatusMessage(this).warning(
-                                         u"%1/xsb_aircraft.txt Line %2 : OBJ8_AIRCARFT command requires 1 argument.")
-                                     << path << lineNum;
-            m_loadingMessages.push_back(m);
-            if (tokens.size() < 2) { return false; }
-        }
-
-        package.planes.back().objectName = tokens[1];
-        package.planes.back().objectVersion = CSLPlane::OBJ8;
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseObj8Command(const QStringList &tokens, CSLPackage &package,
-                                                      const QString &path, int lineNum)
-    {
-        // OBJ8 <group> <animate YES|NO> <filename>
-        if (tokens.size() != 4)
-        {
-            if (tokens.size() == 5 || tokens.size() == 6)
-            {
-                const CStatusMessage m =
-                    CStatusMessage(this).error(
-                        u"%1/xsb_aircraft.txt Line %2 : Unsupported IVAO CSL format - consider using CSL2XSB.")
-                    << path << lineNum;
-                m_loadingMessages.push_back(m);
-            }
-            else
-            {
-                const CStatusMessage m =
-                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : OBJ8 command takes 3 arguments.")
-                    << path << lineNum;
-                m_loadingMessages.push_back(m);
-            }
-            return false;
-        }
-        if (package.planes.isEmpty())
-        {
-            m_loadingMessages.push_back(
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
-                << path << lineNum);
-            return false;
-        }
-
-        if (tokens[1] != "SOLID") { return true; }
-
-        QString relativePath(tokens[3]);
-        normalizePath(relativePath);
-        QString fullPath(relativePath);
-        if (!doPackageSub(fullPath))
-        {
-            const CStatusMessage m = CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : package not found.")
-                                     << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-
-        // just the name of the dir containing xsbaircraft.txt
-        QString packageRootDir = package.path.mid(package.path.lastIndexOf('/') + 1);
-        package.planes.back().dirNames = QStringList { packageRootDir };
-
-        package.planes.back().filePath = fullPath;
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseHasGearCommand(const QStringList &tokens, CSLPackage &package,
-                                                         const QString &path, int lineNum)
-    {
-        Q_UNUSED(tokens)
-        Q_UNUSED(package)
-        Q_UNUSED(path)
-        Q_UNUSED(lineNum)
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseIcaoCommand(const QStringList &tokens, CSLPackage &package,
-                                                      const QString &path, int lineNum)
-    {
-        // ICAO <code>
-        if (tokens.size() != 2)
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : ICAO command requires 1 argument.")
-                << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-        if (package.planes.isEmpty())
-        {
-            m_loadingMessages.push_back(
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
-                << path << lineNum);
-            return false;
-        }
-
-        QString icao = tokens[1];
-        package.planes.back().icao = icao;
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseAirlineCommand(const QStringList &tokens, CSLPackage &package,
-                                                         const QString &path, int lineNum)
-    {
-        // AIRLINE <code> <airline>
-        if (tokens.size() != 3)
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : AIRLINE command requires 2 arguments.")
-                << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-        if (package.planes.isEmpty())
-        {
-            m_loadingMessages.push_back(
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
-                << path << lineNum);
-            return false;
-        }
-
-        QString icao = tokens[1];
-        package.planes.back().icao = icao;
-        QString airline = tokens[2];
-        package.planes.back().airline = airline;
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseLiveryCommand(const QStringList &tokens, CSLPackage &package,
-                                                        const QString &path, int lineNum)
-    {
-        // LIVERY <code> <airline> <livery>
-        if (tokens.size() != 4)
-        {
-            const CStatusMessage m =
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : LIVERY command requires 3 arguments.")
-                << path << lineNum;
-            m_loadingMessages.push_back(m);
-            return false;
-        }
-        if (package.planes.isEmpty())
-        {
-            m_loadingMessages.push_back(
-                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
-                << path << lineNum);
-            return false;
-        }
-
-        QString icao = tokens[1];
-        package.planes.back().icao = icao;
-        QString airline = tokens[2];
-        package.planes.back().airline = airline;
-        QString livery = tokens[3];
-        package.planes.back().livery = livery;
-        return true;
-    }
-
-    bool CAircraftModelLoaderXPlane::parseDummyCommand(const QStringList & /* tokens */, CSLPackage & /* package */,
-                                                       const QString & /* path */, int /*lineNum*/)
-    {
-        return true;
-    }
-
-    CAircraftModelLoaderXPlane::CSLPackage CAircraftModelLoaderXPlane::parsePackageHeader(const QString &path,
-                                                                                          const QString &content)
-    {
-        using command = std::function<bool(const QStringList &, CSLPackage &, const QString &, int)>;
-        using namespace std::placeholders;
-
-        const QMap<QString, command> commands { { "EXPORT_NAME",
-                                                  [this](auto &&tokens, auto &&package, auto &&path, auto &&lineNum) {
-                                                      return parseExportCommand(
-                                                          std::forward<decltype(tokens)>(tokens),
-                                                          std::forward<decltype(package)>(package),
-                                                          std::forward<decltype(path)>(path),
-                                                          std::forward<decltype(lineNum)>(lineNum));
-                                                  } } };
-
-        CSLPackage package;
-        int lineNum = 0;
-
-        QString localCopy(content);
-        QTextStream in(&localCopy);
-        while (!in.atEnd())
-        {
-            ++lineNum;
-            QString line = in.readLine();
-            auto tokens = splitString(line, [](QChar c) { return c.isSpace(); });
-            if (!tokens.empty())
-            {
-                auto it = commands.find(tokens[0]);
-                if (it != commands.end())
-                {
-                    bool result = it.value()(tokens, package, path, lineNum);
-                    // Stop loop once we found EXPORT command
-                    if (result) break;
-                }
-            }
-        }
-        return package;
-    }
-
-    void CAircraftModelLoaderXPlane::parseFullPackage(const QString &content, CSLPackage &package)
-    {
-        using command = std::function<bool(const QStringList &, CSLPackage &, const QString &, int)>;
-        using namespace std::placeholders;
-
-        const QMap<QString, command> commands {
-            { "EXPORT_NAME",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseDummyCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                           std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "DEPENDENCY",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseDependencyCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                                std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "OBJECT",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseObjectCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                            std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "TEXTURE",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseTextureCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                             std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            {
-                "AIRCRAFT",
-                [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                    return parseAircraftCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                                std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-                },
-            },
-            { "OBJ8_AIRCRAFT",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseObj8AircraftCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                                  std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "OBJ8",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseObj8Command(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                          std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "HASGEAR",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseHasGearCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                             std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "ICAO",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseIcaoCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                          std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "AIRLINE",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseAirlineCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                             std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "LIVERY",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseLiveryCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                            std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-            { "VERT_OFFSET",
-              [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                  return parseDummyCommand(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2),
-                                           std::forward<decltype(PH3)>(PH3), std::forward<decltype(PH4)>(PH4));
-              } },
-        };
-
-        int lineNum = 0;
-
-        QString localCopy(content);
-        QTextStream in(&localCopy);
-
-        while (!in.atEnd())
-        {
-            ++lineNum;
-            QString line = in.readLine();
-            if (line.isEmpty() || line[0] == '#') continue;
-            auto tokens = splitString(line, [](QChar c) { return c.isSpace(); });
-            if (!tokens.empty())
-            {
-                auto it = commands.find(tokens[0]);
-                if (it != commands.end())
-                {
-                    bool result = it.value()(tokens, package, package.path, lineNum);
-                    if (!result)
-                    {
-                        if (!package.planes.empty()) { package.planes.back().hasErrors = true; }
-                    }
-                }
-                else
-                {
-                    const CStatusMessage m =
-                        CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unrecognized CSL command: '%3'")
-                        << package.path << lineNum << tokens[0];
-                    m_loadingMessages.push_back(m);
-                }
-            }
-        }
-
-        // Remove all planes with errors
-        auto it = std::remove_if(package.planes.begin(), package.planes.end(),
-                                 [](const CSLPlane &plane) { return plane.hasErrors; });
-        package.planes.erase(it, package.planes.end());
-    }
-
     const QString &CAircraftModelLoaderXPlane::fileFilterFlyable()
     {
         static const QString f("*.acf");
@@ -0,0 +1,324 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "misc/simulation/xplane/cslpackageparser.h"
+
+#include <algorithm>
+
+#include <QFile>
+#include <QIODevice>
+#include <QStringBuilder>
+
+#include "misc/fileutils.h"
+#include "misc/logcategories.h"
+#include "misc/statusmessage.h"
+
+namespace swift::misc::simulation::xplane
+{
+    //! Normalizes CSL model "designators" e.g. __XPFW_Jets:A320_a:A320_a_Austrian_Airlines.obj
+    static void normalizePath(QString &path)
+    {
+        for (auto &e : path)
+        {
+            if (e == '/' || e == ':' || e == '\\') { e = '/'; }
+        }
+    }
+
+    //! Whitespace as used by the CSL files
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f'; }
+
+    QString CCslPackageParser::CSLPlane::getModelName() const
+    {
+        QString modelName = dirNames.join(' ') % u' ' % objectName;
+        if (objectVersion == OBJ7) { modelName += u' ' % textureName; }
+        return std::move(modelName).trimmed();
+    }
+
+    const QStringList &CCslPackageParser::getLogCategories()
+    {
+        static const QStringList cats({ CLogCategories::modelLoader() });
+        return cats;
+    }
+
+    CCslPackageParser::CCslPackageParser(const QVector<CSLPackage> &packages)
+    {
+        m_packages.reserve(packages.size());
+        for (const CSLPackage &package : packages)
+        {
+            m_packages.push_back({ package.name, package.path });
+            if (!m_packagePaths.contains(package.name)) { m_packagePaths.insert(package.name, package.path); }
+        }
+    }
+
+    QByteArray CCslPackageParser::readPackageFile(const QString &path, bool &ok)
+    {
+        QFile file(CFileUtils::appendFilePaths(path, QStringLiteral("xsb_aircraft.txt")));
+        ok = file.open(QIODevice::ReadOnly);
+        if (!ok) { return {}; }
+        return file.readAll();
+    }
+
+    void CCslPackageParser::tokenize(QByteArrayView line, Tokens &tokens)
+    {
+        tokens.clear();
+        const char *const end = line.data() + line.size();
+        const char *begin = line.data();
+        while (true)
+        {
+            begin = std::find_if_not(begin, end, isSpace);
+            if (begin == end) { return; }
+            const char *tokenEnd = std::find_if(begin, end, isSpace);
+            tokens.push_back(QByteArrayView(begin, tokenEnd - begin));
+            begin = tokenEnd;
+        }
+    }
+
+    QString CCslPackageParser::intern(QByteArrayView token, Interned &interned)
+    {
+        auto it = interned.constFind(token);
+        if (it == interned.constEnd()) { it = interned.insert(token, QString::fromUtf8(token)); }
+        return it.value();
+    }
+
+    bool CCslPackageParser::doPackageSub(QString &ioPath) const
+    {
+        // the package name usually is the first path element, only fall back to the prefix search otherwise
+        const qsizetype separator = ioPath.indexOf('/');
+        if (separator > 0)
+        {
+            const auto it = m_packagePaths.constFind(ioPath.left(separator));
+            if (it != m_packagePaths.constEnd())
+            {
+                ioPath.replace(0, separator, it.value());
+                return true;
+            }
+        }
+        for (const auto &[name, path] : m_packages)
+        {
+            if (!name.isEmpty() && ioPath.startsWith(name))
+            {
+                ioPath.replace(0, name.size(), path);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    CCslPackageParser::CSLPackage CCslPackageParser::parseHeader(const QString &path, const QByteArray &content) const
+    {
+        CSLPackage package;
+        package.content = content;
+        int lineNum = 0;
+        Tokens tokens;
+        qsizetype pos = content.startsWith("\xEF\xBB\xBF") ? 3 : 0;
+        while (pos < content.size())
+        {
+            ++lineNum;
+            qsizetype eol = content.indexOf('\n', pos);
+            if (eol < 0) { eol = content.size(); }
+            tokenize(QByteArrayView(content).sliced(pos, eol - pos), tokens);
+            pos = eol + 1;
+            if (tokens.isEmpty() || tokens[0] != "EXPORT_NAME") { continue; }
+            if (tokens.size() != 2)
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(
+                        u"%1/xsb_aircraft.txt Line %2 : EXPORT_NAME command requires 1 argument.")
+                    << path << lineNum);
+                continue;
+            }
+
+            // Stop once we found the EXPORT command, uniqueness of the name is checked when the headers are merged
+            package.path = path;
+            package.name = QString::fromUtf8(tokens[1]);
+            break;
+        }
+        return package;
+    }
+
+    void CCslPackageParser::parseFull(CSLPackage &package) const
+    {
+        // views into content stay valid for the whole run
+        const QByteArray content = std::move(package.content);
+        package.content = QByteArray();
+
+        // just the name of the dir containing xsb_aircraft.txt, shared by all planes
+        const QStringList dirNames { package.path.mid(package.path.lastIndexOf('/') + 1) };
+        Interned interned;
+        Tokens tokens;
+        int lineNum = 0;
+        qsizetype pos = content.startsWith("\xEF\xBB\xBF") ? 3 : 0;
+        while (pos < content.size())
+        {
+            ++lineNum;
+            qsizetype eol = content.indexOf('\n', pos);
+            if (eol < 0) { eol = content.size(); }
+            QByteArrayView line = QByteArrayView(content).sliced(pos, eol - pos);
+            pos = eol + 1;
+            if (line.endsWith('\r')) { line.chop(1); }
+            if (line.isEmpty() || line[0] == '#') { continue; }
+
+            tokenize(line, tokens);
+            if (tokens.isEmpty()) { continue; }
+            if (!parseLine(tokens, package, lineNum, dirNames, interned))
+            {
+                if (!package.planes.empty()) { package.planes.back().hasErrors = true; }
+            }
+        }
+
+        // Remove all planes with errors
+        auto it = std::remove_if(package.planes.begin(), package.planes.end(),
+                                 [](const CSLPlane &plane) { return plane.hasErrors; });
+        package.planes.erase(it, package.planes.end());
+    }
+
+    bool CCslPackageParser::parseLine(const Tokens &tokens, CSLPackage &package, int lineNum,
+                                      const QStringList &dirNames, Interned &interned) const
+    {
+        const QByteArrayView command = tokens[0];
+        const QString &path = package.path;
+
+        // most frequent commands first
+        if (command == "OBJ8")
+        {
+            // OBJ8 <group> <animate YES|NO> <filename>
+            if (tokens.size() != 4)
+            {
+                if (tokens.size() == 5 || tokens.size() == 6)
+                {
+                    package.messages.push_back(
+                        CStatusMessage(this).error(
+                            u"%1/xsb_aircraft.txt Line %2 : Unsupported IVAO CSL format - consider using CSL2XSB.")
+                        << path << lineNum);
+                }
+                else
+                {
+                    package.messages.push_back(
+                        CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : OBJ8 command takes 3 arguments.")
+                        << path << lineNum);
+                }
+                return false;
+            }
+            if (package.planes.isEmpty())
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
+                    << path << lineNum);
+                return false;
+            }
+
+            if (tokens[1] != "SOLID") { return true; }
+
+            QString fullPath = QString::fromUtf8(tokens[3]);
+            normalizePath(fullPath);
+            if (!doPackageSub(fullPath))
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : package not found.") << path << lineNum);
+                return false;
+            }
+
+            package.planes.back().dirNames = dirNames;
+            package.planes.back().filePath = fullPath;
+            return true;
+        }
+        if (command == "OBJ8_AIRCRAFT")
+        {
+            package.planes.push_back(CSLPlane());
+
+            // OBJ8_AIRCRAFT <path>
+            if (tokens.size() != 2)
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).warning(
+                        u"%1/xsb_aircraft.txt Line %2 : OBJ8_AIRCARFT command requires 1 argument.")
+                    << path << lineNum);
+                if (tokens.size() < 2) { return false; }
+            }
+
+            package.planes.back().objectName = QString::fromUtf8(tokens[1]);
+            package.planes.back().objectVersion = CSLPlane::OBJ8;
+            return true;
+        }
+        if (command == "ICAO" || command == "AIRLINE" || command == "LIVERY")
+        {
+            // ICAO <code>, AIRLINE <code> <airline>, LIVERY <code> <airline> <livery>
+            const int arguments = command == "ICAO" ? 1 : command == "AIRLINE" ? 2 : 3;
+            if (tokens.size() != arguments + 1)
+            {
+                const QString cmd = QString::fromLatin1(command);
+                if (arguments == 1)
+                {
+                    package.messages.push_back(
+                        CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : %3 command requires 1 argument.")
+                        << path << lineNum << cmd);
+                }
+                else
+                {
+                    package.messages.push_back(
+                        CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : %3 command requires %4 arguments.")
+                        << path << lineNum << cmd << QString::number(arguments));
+                }
+                return false;
+            }
+            if (package.planes.isEmpty())
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : invalid position for command.")
+                    << path << lineNum);
+                return false;
+            }
+
+            CSLPlane &plane = package.planes.back();
+            plane.icao = intern(tokens[1], interned);
+            if (arguments >= 2) { plane.airline = intern(tokens[2], interned); }
+            if (arguments >= 3) { plane.livery = intern(tokens[3], interned); }
+            return true;
+        }
+        if (command == "EXPORT_NAME" || command == "HASGEAR" || command == "VERT_OFFSET") { return true; }
+        if (command == "DEPENDENCY")
+        {
+            if (tokens.size() != 2)
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : DEPENDENCY command requires 1 argument.")
+                    << path << lineNum);
+                return false;
+            }
+
+            const QString dependency = QString::fromUtf8(tokens[1]);
+            if (!m_packagePaths.contains(dependency))
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(
+                        u"XPlane required package %1 not found. Aborting processing of this package.")
+                    << dependency);
+                return false;
+            }
+            return true;
+        }
+        if (command == "OBJECT" || command == "AIRCRAFT")
+        {
+            package.planes.push_back(CSLPlane());
+            package.messages.push_back(
+                CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unsupported legacy CSL format.")
+                << path << lineNum);
+            return false;
+        }
+        if (command == "TEXTURE")
+        {
+            if (!package.planes.isEmpty() && !package.planes.back().hasErrors)
+            {
+                package.messages.push_back(
+                    CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unsupported legacy CSL format.")
+                    << path << lineNum);
+            }
+            return false;
+        }
+
+        package.messages.push_back(
+            CStatusMessage(this).error(u"%1/xsb_aircraft.txt Line %2 : Unrecognized CSL command: '%3'")
+            << path << lineNum << QString::fromUtf8(command));
+        return true;
+    }
+} // namespace swift::misc::simulation::xplane
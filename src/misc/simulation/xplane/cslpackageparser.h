@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SIMULATION_XPLANE_CSLPACKAGEPARSER_H
+#define SWIFT_MISC_SIMULATION_XPLANE_CSLPACKAGEPARSER_H
+
+#include <utility>
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QVector>
+
+#include "misc/statusmessagelist.h"
+#include "misc/swiftmiscexport.h"
+
+namespace swift::misc::simulation::xplane
+{
+    /*!
+     * Parser for the xsb_aircraft.txt files of X-Plane CSL packages.
+     *
+     * The file content is parsed as bytes in a single pass, lines are split into token views
+     * and only the values kept in the planes are converted to strings. Codes repeated across planes
+     * (ICAO, airline, livery) and the package directory names are interned, so they share one string.
+     * \remark all parse functions are const and can be used from several threads at once
+     */
+    class SWIFT_MISC_EXPORT CCslPackageParser
+    {
+    public:
+        //! CSL Plane data
+        struct CSLPlane
+        {
+            //! Object version
+            enum ObjectVersion
+            {
+                OBJ7,
+                OBJ8
+            };
+
+            //! Model name as used for the model string
+            QString getModelName() const;
+
+            // Model name parts
+            QStringList dirNames; //!< List dir names starting from xsb_aircrafts.txt parent down to obj folder
+            QString objectName; //!< Complete basename of the object file
+            QString textureName; //!< Complete basename of the texture file. Can be empty.
+
+            QString filePath; //!< object filePath
+            QString icao; //!< Icao type of this model
+            QString airline; //!< Airline identifier. Can be empty.
+            QString livery; //!< Livery identifier. Can be empty.
+
+            ObjectVersion objectVersion = OBJ8; //!< object version
+
+            bool hasErrors = false; //!< plane will be removed
+        };
+
+        //! CSL package
+        struct CSLPackage
+        {
+            //! Name and path found?
+            bool hasValidHeader() const { return !name.isEmpty() && !path.isEmpty(); }
+
+            QString name; //!< EXPORT_NAME
+            QString path; //!< directory of xsb_aircraft.txt
+            QVector<CSLPlane> planes; //!< planes of the package
+            CStatusMessageList messages; //!< parsing messages, packages are parsed concurrently
+            QByteArray content; //!< file content, kept between header and full parsing
+        };
+
+        //! Log categories
+        static const QStringList &getLogCategories();
+
+        //! Constructor
+        //! \param packages all packages with a valid header, used for DEPENDENCY and the path substitution
+        explicit CCslPackageParser(const QVector<CSLPackage> &packages = {});
+
+        //! Parse the header (EXPORT_NAME) of a package
+        CSLPackage parseHeader(const QString &path, const QByteArray &content) const;
+
+        //! Parse all planes of a package, the content is released afterwards
+        void parseFull(CSLPackage &package) const;
+
+        //! Read xsb_aircraft.txt of a package directory
+        static QByteArray readPackageFile(const QString &path, bool &ok);
+
+    private:
+        //! Token views of one line
+        using Tokens = QVarLengthArray<QByteArrayView, 8>;
+
+        //! Strings repeated across the planes of a package
+        using Interned = QHash<QByteArrayView, QString>;
+
+        //! Split a line at whitespace
+        static void tokenize(QByteArrayView line, Tokens &tokens);
+
+        //! Shared string for token
+        static QString intern(QByteArrayView token, Interned &interned);
+
+        //! Replace the package name prefix of a path by the package path
+        bool doPackageSub(QString &ioPath) const;
+
+        //! Parse one line, false marks the current plane as erroneous
+        bool parseLine(const Tokens &tokens, CSLPackage &package, int lineNum, const QStringList &dirNames,
+                       Interned &interned) const;
+
+        QVector<std::pair<QString, QString>> m_packages; //!< name and path of the known packages, in order
+        QHash<QString, QString> m_packagePaths; //!< package path by name
+    };
+} // namespace swift::misc::simulation::xplane
+
+#endif // SWIFT_MISC_SIMULATION_XPLANE_CSLPACKAGEPARSER_H
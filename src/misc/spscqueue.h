@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef SWIFT_MISC_SPSCQUEUE_H
+#define SWIFT_MISC_SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <QtGlobal>
+
+namespace swift::misc
+{
+    /*!
+     * Bounded lock-free ring buffer for one producer thread and one consumer thread.
+     *
+     * All slots are allocated up front and reused, values are written and read in place, so pushing and popping
+     * never allocates. Suited for real time threads like audio callbacks.
+     */
+    template <typename T>
+    class CSpscQueue
+    {
+    public:
+        //! Constructor
+        explicit CSpscQueue(int capacity) : m_slots(static_cast<std::size_t>(qMax(1, capacity))) {}
+
+        //! @{
+        //! Not copyable
+        CSpscQueue(const CSpscQueue &) = delete;
+        CSpscQueue &operator=(const CSpscQueue &) = delete;
+        //! @}
+
+        //! Slot to be written, nullptr if the queue is full, published by endPush
+        //! \remark only to be called by the producer thread
+        T *beginPush()
+        {
+            const std::size_t write = m_write.load(std::memory_order_relaxed);
+            if (write - m_read.load(std::memory_order_acquire) >= m_slots.size()) { return nullptr; }
+            return &m_slots[write % m_slots.size()];
+        }
+
+        //! Publish the slot returned by beginPush
+        //! \remark only to be called by the producer thread
+        void endPush() { m_write.store(m_write.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+        //! Append a copy, false if the queue is full
+        //! \remark only to be called by the producer thread
+        bool tryPush(const T &value)
+        {
+            T *slot = beginPush();
+            if (!slot) { return false; }
+            *slot = value;
+            endPush();
+            return true;
+        }
+
+        //! Oldest value, nullptr if the queue is empty, released by pop
+        //! \remark only to be called by the consumer thread
+        T *front()
+        {
+            const std::size_t read = m_read.load(std::memory_order_relaxed);
+            if (read == m_write.load(std::memory_order_acquire)) { return nullptr; }
+            return &m_slots[read % m_slots.size()];
+        }
+
+        //! Release the value returned by front, the slot can be written again
+        //! \remark only to be called by the consumer thread
+        void pop() { m_read.store(m_read.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+        //! Take the oldest value, false if the queue is empty
+        //! \remark only to be called by the consumer thread
+        bool tryPop(T &value)
+        {
+            T *slot = front();
+            if (!slot) { return false; }
+            value = *slot;
+            pop();
+            return true;
+        }
+
+        //! Number of queued values, exact when called by producer or consumer, otherwise approximate
+        //! \threadsafe
+        int size() const
+        {
+            const std::size_t read = m_read.load(std::memory_order_acquire);
+            return static_cast<int>(m_write.load(std::memory_order_acquire) - read);
+        }
+
+        //! Empty?
+        //! \threadsafe
+        bool isEmpty() const { return size() == 0; }
+
+        //! Max. number of queued values
+        int capacity() const { return static_cast<int>(m_slots.size()); }
+
+    private:
+        std::vector<T> m_slots;
+        alignas(64) std::atomic<std::size_t> m_write { 0 }; //!< written by the producer only
+        alignas(64) std::atomic<std::size_t> m_read { 0 }; //!< written by the consumer only
+    };
+} // namespace swift::misc
+
+#endif // SWIFT_MISC_SPSCQUEUE_H
@@ -4,6 +4,7 @@
 #include "simulatoremulated.h"
 
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QTimer>
 
@@ -196,9 +197,9 @@ namespace swift::simplugin::emulated
         return true;
     }
 
-    bool CSimulatorEmulated::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign)
+    bool CSimulatorEmulated::requestElevationProbe(const ICoordinateGeodetic &reference, const CCallsign &callsign)
     {
-        const bool hasRequested = CSimulatorPluginCommon::requestElevation(reference, callsign);
+        const bool hasRequested = CSimulatorPluginCommon::requestElevationProbe(reference, callsign);
         if (hasRequested || !m_enablePseudoElevation) { return hasRequested; }
 
         // For TESTING purposes ONLY
@@ -502,9 +503,12 @@ namespace swift::simplugin::emulated
 
     void CSimulatorEmulated::updateRemoteAircraft()
     {
+        this->startUpdateRemoteAircraftAndStatistics();
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(now);
         uint32_t aircraftNumber = 0;
+        QElapsedTimer phaseTimer;
+        phaseTimer.start();
 
         for (const CSimulatedAircraft &aircraft : m_renderedAircraft)
         {
@@ -512,6 +516,7 @@ namespace swift::simplugin::emulated
             if (!m_interpolators.contains(callsign)) { continue; }
             const CInterpolationAndRenderingSetupPerCallsign setup =
                 this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
+            this->addUpdatePhaseTime(UpdatePhaseSetup, phaseTimer);
             CInterpolatorMulti *im = m_interpolators[callsign];
             Q_ASSERT_X(im, Q_FUNC_INFO, "interpolator missing");
             const CInterpolationResult result = im->getInterpolation(now, setup, aircraftNumber++);
@@ -521,6 +526,7 @@ namespace swift::simplugin::emulated
             m_countInterpolatedSituations++;
             Q_UNUSED(s)
             Q_UNUSED(p)
+            this->addUpdatePhaseTime(UpdatePhaseInterpolation, phaseTimer);
         }
 
         this->finishUpdateRemoteAircraftAndSetStatistics(now);
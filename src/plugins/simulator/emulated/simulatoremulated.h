@@ -67,8 +67,6 @@ namespace swift::simplugin::emulated
         bool testSendSituationAndParts(const swift::misc::aviation::CCallsign &callsign,
                                        const swift::misc::aviation::CAircraftSituation &situation,
                                        const swift::misc::aviation::CAircraftParts &parts) override;
-        bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                              const swift::misc::aviation::CCallsign &callsign) override;
 
         // ----- functions just logged -------
         bool logicallyAddRemoteAircraft(const swift::misc::simulation::CSimulatedAircraft &remoteAircraft) override;
@@ -132,6 +130,8 @@ namespace swift::simplugin::emulated
         bool physicallyAddRemoteAircraft(const swift::misc::simulation::CSimulatedAircraft &remoteAircraft) override;
         bool physicallyRemoveRemoteAircraft(const swift::misc::aviation::CCallsign &callsign) override;
         int physicallyRemoveAllRemoteAircraft() override;
+        bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                   const swift::misc::aviation::CCallsign &callsign) override;
 
         //! \copydoc swift::core::ISimulator::parseDetails
         bool parseDetails(const swift::misc::CSimpleCommandParser &parser) override;
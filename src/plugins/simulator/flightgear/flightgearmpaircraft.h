@@ -71,6 +71,12 @@ namespace swift::simplugin::flightgear
         //! Interpolator
         swift::misc::simulation::CInterpolatorMulti *getInterpolator() const { return m_interpolator.data(); }
 
+        //! \copydoc swift::misc::simulation::CInterpolator::getCallsignHandle
+        swift::misc::aviation::CCallsignHandle getCallsignHandle() const
+        {
+            return m_interpolator ? m_interpolator->getCallsignHandle() : swift::misc::aviation::CCallsignHandle();
+        }
+
     private:
         swift::misc::simulation::CSimulatedAircraft m_aircraft; //!< corresponding aircraft
         QSharedPointer<swift::misc::simulation::CInterpolatorMulti>
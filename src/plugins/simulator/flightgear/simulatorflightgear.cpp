@@ -7,6 +7,7 @@
 
 #include <QColor>
 #include <QDBusServiceWatcher>
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QString>
 #include <QTimer>
@@ -614,8 +615,10 @@ namespace swift::simplugin::flightgear
         if (remoteAircraftNo < 1) { return; }
 
         // values used for position and parts
-        m_updateRemoteAircraftInProgress = true;
+        this->startUpdateRemoteAircraftAndStatistics();
         const qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
+        QElapsedTimer phaseTimer;
+        phaseTimer.start();
 
         // interpolation for all remote aircraft
         PlanesPositions planesPositions;
@@ -648,18 +651,20 @@ namespace swift::simplugin::flightgear
             // setup
             const CInterpolationAndRenderingSetupPerCallsign setup =
                 this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
+            this->addUpdatePhaseTime(UpdatePhaseSetup, phaseTimer);
 
             // interpolated situation/parts
             const CInterpolationResult result =
                 flightgearAircraft.getInterpolation(currentTimestamp, setup, aircraftNumber++);
+            const CCallsignHandle callsignHandle = flightgearAircraft.getCallsignHandle();
             if (result.getInterpolationStatus().hasValidSituation())
             {
                 const CAircraftSituation interpolatedSituation(result);
 
                 // update situation
-                if (updateAllAircraft || !this->isEqualLastSent(interpolatedSituation))
+                if (updateAllAircraft || !this->isEqualLastSent(interpolatedSituation, callsignHandle))
                 {
-                    this->rememberLastSent(interpolatedSituation);
+                    this->rememberLastSent(interpolatedSituation, callsignHandle);
                     planesPositions.push_back(interpolatedSituation);
                 }
             }
@@ -669,15 +674,18 @@ namespace swift::simplugin::flightgear
                     this->getInvalidSituationLogMessage(callsign, result.getInterpolationStatus()));
             }
 
+            this->addUpdatePhaseTime(UpdatePhaseInterpolation, phaseTimer);
+
             const CAircraftParts parts(result);
             if (result.getPartsStatus().isSupportingParts() || parts.getPartsDetails() == CAircraftParts::GuessedParts)
             {
-                if (updateAllAircraft || !this->isEqualLastSent(parts, callsign))
+                if (updateAllAircraft || !this->isEqualLastSent(parts, callsignHandle))
                 {
-                    this->rememberLastSent(parts, callsign);
+                    this->rememberLastSent(parts, callsignHandle);
                     planesSurfaces.push_back(flightgearAircraft.getCallsign(), parts);
                 }
             }
+            this->addUpdatePhaseTime(UpdatePhaseParts, phaseTimer);
 
         } // all callsigns
 
@@ -699,6 +707,7 @@ namespace swift::simplugin::flightgear
         {
             m_trafficProxy->setPlanesSurfaces(planesSurfaces);
         }
+        this->addUpdatePhaseTime(UpdatePhaseSend, phaseTimer);
 
         // stats
         this->finishUpdateRemoteAircraftAndSetStatistics(currentTimestamp);
@@ -853,8 +862,8 @@ namespace swift::simplugin::flightgear
         emit this->aircraftRenderingChanged(addedRemoteAircraft);
     }
 
-    bool CSimulatorFlightgear::requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                                                const swift::misc::aviation::CCallsign &callsign)
+    bool CSimulatorFlightgear::requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                                     const swift::misc::aviation::CCallsign &callsign)
     {
         if (this->isShuttingDownOrDisconnected()) { return false; }
         if (reference.isNull()) { return false; }
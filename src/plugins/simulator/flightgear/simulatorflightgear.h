@@ -141,8 +141,8 @@ namespace swift::simplugin::flightgear
         bool testSendSituationAndParts(const swift::misc::aviation::CCallsign &callsign,
                                        const swift::misc::aviation::CAircraftSituation &situation,
                                        const swift::misc::aviation::CAircraftParts &parts) override;
-        bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                              const swift::misc::aviation::CCallsign &callsign) override;
+        bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                   const swift::misc::aviation::CCallsign &callsign) override;
         //! @}
 
     protected:
@@ -303,6 +303,12 @@ namespace swift::simplugin::fsxcommon
         //! Interpolator
         swift::misc::simulation::CInterpolatorMulti *getInterpolator() const { return m_interpolator.data(); }
 
+        //! \copydoc swift::misc::simulation::CInterpolator::getCallsignHandle
+        swift::misc::aviation::CCallsignHandle getCallsignHandle() const
+        {
+            return m_interpolator ? m_interpolator->getCallsignHandle() : swift::misc::aviation::CCallsignHandle();
+        }
+
         //! SimObject as string
         QString toQString() const;
 
@@ -322,7 +322,8 @@ namespace swift::simplugin::fsxcommon
             .arg(m_requestSimObjectDataCount);
     }
 
-    bool CSimulatorFsxCommon::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &aircraftCallsign)
+    bool CSimulatorFsxCommon::requestElevationProbe(const ICoordinateGeodetic &reference,
+                                                    const CCallsign &aircraftCallsign)
     {
         // this is the 32bit FSX version, the P3D x64 is overridden!
 
@@ -904,7 +905,7 @@ namespace swift::simplugin::fsxcommon
 
         // Near ground we use faster updates
         const CCallsign cs(simObject.getCallsign());
-        CAircraftSituation lastSituation = m_lastSentSituations[cs];
+        CAircraftSituation lastSituation = m_lastSentSituations.value(simObject.getCallsignHandle());
         const bool moving = lastSituation.isMoving();
         const bool onGround = remoteAircraftData.isOnGround();
 
@@ -2112,7 +2113,9 @@ namespace swift::simplugin::fsxcommon
             this->finishUpdateRemoteAircraftAndSetStatistics(currentTimestamp, true);
             return;
         }
-        m_updateRemoteAircraftInProgress = true;
+        this->startUpdateRemoteAircraftAndStatistics();
+        QElapsedTimer phaseTimer;
+        phaseTimer.start();
 
         // interpolation for all remote aircraft
         const QList<CSimConnectObject> simObjects(m_simConnectObjects.values());
@@ -2133,21 +2136,24 @@ namespace swift::simplugin::fsxcommon
             SWIFT_AUDIT_X(hasValidIds, Q_FUNC_INFO, "Missing ids");
             if (!hasCs || !hasValidIds) { continue; } // not supposed to happen
             const DWORD objectId = simObject.getObjectId();
+            const CCallsignHandle callsignHandle = simObject.getCallsignHandle();
 
             // setup
             const CInterpolationAndRenderingSetupPerCallsign setup =
                 this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
             const bool sendGround = setup.isSendingGndFlagToSimulator();
+            this->addUpdatePhaseTime(UpdatePhaseSetup, phaseTimer);
 
             // Interpolated situation
             // simObjectNumber is passed to equally distributed steps like guessing parts
             const bool slowUpdate = (((m_statsUpdateAircraftRuns + simObjectNumber) % 40) == 0);
             const CInterpolationResult result = simObject.getInterpolation(currentTimestamp, setup, simObjectNumber++);
             const bool forceUpdate = slowUpdate || updateAllAircraft || setup.isForcingFullInterpolation();
+            this->addUpdatePhaseTime(UpdatePhaseInterpolation, phaseTimer);
             if (result.getInterpolationStatus().hasValidSituation())
             {
                 // update situation
-                if (forceUpdate || !this->isEqualLastSent(result.getInterpolatedSituation()))
+                if (forceUpdate || !this->isEqualLastSent(result.getInterpolatedSituation(), callsignHandle))
                 {
                     // adjust altitude to compensate for FS2020 temperature effect
                     CAircraftSituation situation = result;
@@ -2159,6 +2165,7 @@ namespace swift::simplugin::fsxcommon
                                             situation.getAltitude().getReferenceDatum() });
 
                     SIMCONNECT_DATA_INITPOSITION position = this->aircraftSituationToFsxPosition(situation, sendGround);
+                    this->addUpdatePhaseTime(UpdatePhaseInterpolation, phaseTimer);
                     const HRESULT hr = this->logAndTraceSendId(
                         SimConnect_SetDataOnSimObject(m_hSimConnect,
                                                       CSimConnectDefinitions::DataRemoteAircraftSetPosition,
@@ -2167,8 +2174,9 @@ namespace swift::simplugin::fsxcommon
                         traceSendId, simObject, "Failed to set position", Q_FUNC_INFO, "SimConnect_SetDataOnSimObject");
                     if (isOk(hr))
                     {
-                        this->rememberLastSent(result); // remember situation
+                        this->rememberLastSent(result.getInterpolatedSituation(), callsignHandle); // remember situation
                     }
+                    this->addUpdatePhaseTime(UpdatePhaseSend, phaseTimer);
                 }
             }
             else
@@ -2180,6 +2188,7 @@ namespace swift::simplugin::fsxcommon
             // Interpolated parts
             const bool updatedParts = this->updateRemoteAircraftParts(simObject, result, forceUpdate);
             Q_UNUSED(updatedParts)
+            this->addUpdatePhaseTime(UpdatePhaseParts, phaseTimer);
 
         } // all callsigns
 
@@ -2200,14 +2209,14 @@ namespace swift::simplugin::fsxcommon
             return false;
         }
 
-        const CCallsign cs = simObject.getCallsign();
-        if (!forcedUpdate && (result.getPartsStatus().isReusedParts() || this->isEqualLastSent(parts, cs)))
+        const CCallsignHandle handle = simObject.getCallsignHandle();
+        if (!forcedUpdate && (result.getPartsStatus().isReusedParts() || this->isEqualLastSent(parts, handle)))
         {
             return true;
         }
 
         const bool ok = this->sendRemoteAircraftPartsToSimulator(simObject, parts);
-        if (ok) { this->rememberLastSent(parts, cs); }
+        if (ok) { this->rememberLastSent(parts, handle); }
         return ok;
     }
 
@@ -160,11 +160,11 @@ namespace swift::simplugin::fsxcommon
                                                const swift::misc::aviation::CAircraftParts &parts) override;
         //! @}
 
-        //! \copydoc swift::misc::simulation::ISimulationEnvironmentProvider::requestElevation
+        //! \copydoc swift::core::ISimulator::requestElevationProbe
         //! \remark x86 FSX version, x64 version is overridden
         //! \sa CSimulatorFsxCommon::is
-        virtual bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                                      const swift::misc::aviation::CCallsign &aircraftCallsign) override;
+        virtual bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                           const swift::misc::aviation::CCallsign &aircraftCallsign) override;
 
         //! Tracing right now?
         bool isTracingSendId() const;
@@ -92,7 +92,7 @@ namespace swift::simplugin::p3d
     }
 
     // P3D version with new P3D simconnect functions
-    bool CSimulatorP3D::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign)
+    bool CSimulatorP3D::requestElevationProbe(const ICoordinateGeodetic &reference, const CCallsign &callsign)
     {
         if (reference.isNull()) { return false; }
         if (this->isShuttingDown()) { return false; }
@@ -184,7 +184,7 @@ namespace swift::simplugin::p3d
         **/
 
         // Observer is P3D only, not FSX
-        const CAircraftSituation situation = m_lastSentSituations[callsign];
+        const CAircraftSituation situation = m_lastSentSituations.value(CCallsignHandle::find(callsign));
         if (situation.isNull()) { return false; }
         SIMCONNECT_DATA_OBSERVER obs;
         SIMCONNECT_DATA_PBH pbh;
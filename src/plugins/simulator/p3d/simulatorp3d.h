@@ -41,9 +41,9 @@ namespace swift::simplugin::p3d
         //! @}
 
 #ifdef Q_OS_WIN64
-        //! \copydoc swift::misc::simulation::ISimulationEnvironmentProvider::requestElevation
-        virtual bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                                      const swift::misc::aviation::CCallsign &callsign) override;
+        //! \copydoc swift::core::ISimulator::requestElevationProbe
+        virtual bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                           const swift::misc::aviation::CCallsign &callsign) override;
 
         //! \copydoc swift::core::ISimulator::followAircraft
         virtual bool followAircraft(const swift::misc::aviation::CCallsign &callsign) override;
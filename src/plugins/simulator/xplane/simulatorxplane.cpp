@@ -43,6 +43,7 @@
 #include "misc/pq/length.h"
 #include "misc/pq/pressure.h"
 #include "misc/pq/speed.h"
+#include "misc/pq/staticquantity.h"
 #include "misc/pq/temperature.h"
 #include "misc/setbuilder.h"
 #include "misc/simulation/aircraftmodel.h"
@@ -207,6 +208,7 @@ namespace swift::simplugin::xplane
         if (!this->handleProbeValue(plane, callsign, isWater, hint, false))
         {
             this->removePendingElevationRequest(callsign);
+            this->ignoreElevationProbe(callsign);
             return;
         }
         CSimulatorPluginCommon::callbackReceivedRequestedElevation(plane, callsign, isWater);
@@ -245,7 +247,7 @@ namespace swift::simplugin::xplane
         m_minSuspicousTerrainProbe.setNull();
     }
 
-    bool CSimulatorXPlane::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign)
+    bool CSimulatorXPlane::requestElevationProbe(const ICoordinateGeodetic &reference, const CCallsign &callsign)
     {
         if (this->isShuttingDownOrDisconnected()) { return false; }
         if (reference.isNull()) { return false; }
@@ -900,14 +902,20 @@ namespace swift::simplugin::xplane
         if (remoteAircraftNo < 1) { return; }
 
         // values used for position and parts
-        m_updateRemoteAircraftInProgress = true;
+        this->startUpdateRemoteAircraftAndStatistics();
         const qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
+        QElapsedTimer phaseTimer;
+        phaseTimer.start();
 
         // interpolation for all remote aircraft
         PlanesPositions planesPositions;
         PlanesSurfaces planesSurfaces;
         PlanesTransponders planesTransponders;
 
+        // XP12 altitude correction, the same for all aircraft in this frame
+        const CStaticLength ownHeight = toStatic(this->getOwnAircraftPosition().geodeticHeight());
+        const CStaticLength altitudeDelta = toStatic(m_altitudeDelta);
+
         uint32_t aircraftNumber = 0;
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(currentTimestamp);
         const CCallsignSet callsignsInRange = this->getAircraftInRangeCallsigns();
@@ -934,28 +942,33 @@ namespace swift::simplugin::xplane
             // setup
             const CInterpolationAndRenderingSetupPerCallsign setup =
                 this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
+            this->addUpdatePhaseTime(UpdatePhaseSetup, phaseTimer);
 
             // interpolated situation/parts
             const CInterpolationResult result =
                 xplaneAircraft.getInterpolation(currentTimestamp, setup, aircraftNumber++);
+            const CCallsignHandle callsignHandle = xplaneAircraft.getCallsignHandle();
             if (result.getInterpolationStatus().hasValidSituation())
             {
                 CAircraftSituation interpolatedSituation(result);
 
                 // adjust altitude to compensate for XP12 temperature effect
-                const CLength relativeAltitude =
-                    interpolatedSituation.geodeticHeight() - getOwnAircraftPosition().geodeticHeight();
+                // altitudes are in ft, so reading and writing them is no conversion
+                const CAltitude &altitude = interpolatedSituation.getAltitude();
+                const auto interpolatedAltitude =
+                    CStaticLength::from<static_units::Foot>(altitude.value(CLengthUnit::ft()));
+                const CStaticLength relativeAltitude = interpolatedAltitude - ownHeight;
                 const double altitudeDeltaWeight =
-                    2 - qBound(3000.0, relativeAltitude.abs().value(CLengthUnit::ft()), 6000.0) / 3000;
-                const CLength alt = interpolatedSituation.getAltitude() +
-                                    m_altitudeDelta * altitudeDeltaWeight *
-                                        (1 - interpolatedSituation.getOnGroundInfo().getGroundFactor());
-                interpolatedSituation.setAltitude({ alt, interpolatedSituation.getAltitude().getReferenceDatum() });
+                    2 - qBound(3000.0, relativeAltitude.abs().in<static_units::Foot>(), 6000.0) / 3000;
+                const double airborneFactor = 1 - interpolatedSituation.getOnGroundInfo().getGroundFactor();
+                const CStaticLength alt = interpolatedAltitude + altitudeDelta * altitudeDeltaWeight * airborneFactor;
+                interpolatedSituation.setAltitude(
+                    { alt.in<static_units::Foot>(), altitude.getReferenceDatum(), CLengthUnit::ft() });
 
                 // update situation
-                if (updateAllAircraft || !this->isEqualLastSent(interpolatedSituation))
+                if (updateAllAircraft || !this->isEqualLastSent(interpolatedSituation, callsignHandle))
                 {
-                    this->rememberLastSent(interpolatedSituation);
+                    this->rememberLastSent(interpolatedSituation, callsignHandle);
                     planesPositions.push_back(interpolatedSituation);
                 }
             }
@@ -965,15 +978,18 @@ namespace swift::simplugin::xplane
                     this->getInvalidSituationLogMessage(callsign, result.getInterpolationStatus()));
             }
 
+            this->addUpdatePhaseTime(UpdatePhaseInterpolation, phaseTimer);
+
             const CAircraftParts parts(result);
             if (result.getPartsStatus().isSupportingParts() || parts.getPartsDetails() == CAircraftParts::GuessedParts)
             {
-                if (updateAllAircraft || !this->isEqualLastSent(parts, callsign))
+                if (updateAllAircraft || !this->isEqualLastSent(parts, callsignHandle))
                 {
-                    this->rememberLastSent(parts, callsign);
+                    this->rememberLastSent(parts, callsignHandle);
                     planesSurfaces.push_back(xplaneAircraft.getCallsign(), parts);
                 }
             }
+            this->addUpdatePhaseTime(UpdatePhaseParts, phaseTimer);
 
         } // all callsigns
 
@@ -989,6 +1005,7 @@ namespace swift::simplugin::xplane
         }
 
         if (!planesSurfaces.isEmpty()) { m_trafficProxy->setPlanesSurfaces(planesSurfaces); }
+        this->addUpdatePhaseTime(UpdatePhaseSend, phaseTimer);
 
         // stats
         this->finishUpdateRemoteAircraftAndSetStatistics(currentTimestamp);
@@ -153,9 +153,9 @@ namespace swift::simplugin::xplane
         void setOwnCallsign(const swift::misc::aviation::CCallsign &callsign) override;
         //! @}
 
-        //! \copydoc swift::misc::simulation::ISimulationEnvironmentProvider::requestElevation
-        bool requestElevation(const swift::misc::geo::ICoordinateGeodetic &reference,
-                              const swift::misc::aviation::CCallsign &callsign) override;
+        //! \copydoc swift::core::ISimulator::requestElevationProbe
+        bool requestElevationProbe(const swift::misc::geo::ICoordinateGeodetic &reference,
+                                   const swift::misc::aviation::CCallsign &callsign) override;
 
     protected:
         //! \name ISimulator implementations
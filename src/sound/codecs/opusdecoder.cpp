@@ -21,7 +21,7 @@ namespace swift::sound::codecs
         return bufferSize / bytesPerSample;
     }
 
-    QVector<qint16> COpusDecoder::decode(const QByteArray &opusData, int dataLength, int *decodedLength)
+    QVector<qint16> COpusDecoder::decode(QByteArrayView opusData, int dataLength, int *decodedLength)
     {
         QVector<qint16> decoded(MaxDataBytes, 0);
         int count = frameCount(MaxDataBytes);
@@ -35,6 +35,12 @@ namespace swift::sound::codecs
         return decoded;
     }
 
+    int COpusDecoder::decode(QByteArrayView opusData, qint16 *pcm, int maxSamples)
+    {
+        const auto *data = opusData.isEmpty() ? nullptr : reinterpret_cast<const unsigned char *>(opusData.data());
+        return opus_decode(m_opusDecoder, data, static_cast<opus_int32>(opusData.size()), pcm, maxSamples, 0);
+    }
+
     void COpusDecoder::resetState()
     {
         if (!m_opusDecoder) { return; }
@@ -6,6 +6,7 @@
 #ifndef SWIFT_SOUND_CODECS_OPUSDECODER_H
 #define SWIFT_SOUND_CODECS_OPUSDECODER_H
 
+#include <QByteArrayView>
 #include <QVector>
 
 #include "opus/opus.h"
@@ -34,7 +35,11 @@ namespace swift::sound::codecs
         int frameCount(int bufferSize);
 
         //! Decode
-        QVector<qint16> decode(const QByteArray &opusData, int dataLength, int *decodedLength);
+        QVector<qint16> decode(QByteArrayView opusData, int dataLength, int *decodedLength);
+
+        //! Decode into a buffer, empty data conceals a lost packet
+        //! \return decoded samples per channel, negative on errors
+        int decode(QByteArrayView opusData, qint16 *pcm, int maxSamples);
 
         //! Reset
         void resetState();
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testswiftcore
+ */
+
+#include <QTest>
+
+#include "test.h"
+
+#include "core/afv/crypto/cryptodtochannel.h"
+#include "core/afv/crypto/cryptodtocontext.h"
+#include "core/afv/crypto/cryptodtoserializer.h"
+#include "core/afv/dto.h"
+
+using namespace swift::core::afv;
+using namespace swift::core::afv::crypto;
+
+namespace SwiftCoreTest
+{
+    //! Crypto DTO context
+    class CTestCryptoDtoContext : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Serialize and deserialize, also with the CryptoDtoSerializer
+        void roundTrip();
+
+        //! Tampered and truncated packets
+        void invalidPackets();
+
+        //! Steady voice traffic does not allocate
+        void steadyState();
+
+    private:
+        //! Channel with the same keys for both directions
+        static CryptoDtoChannelConfigDto channelConfig();
+
+        //! Voice packet
+        static AudioRxOnTransceiversDto voicePacket(uint sequence);
+    };
+
+    CryptoDtoChannelConfigDto CTestCryptoDtoContext::channelConfig()
+    {
+        const QByteArray key(crypto_aead_chacha20poly1305_IETF_KEYBYTES, 'k');
+        return { "2f9bd1d4-3c6a-4a5e-9a3f-8d6c2e1b7a90", key, key, key };
+    }
+
+    AudioRxOnTransceiversDto CTestCryptoDtoContext::voicePacket(uint sequence)
+    {
+        AudioRxOnTransceiversDto dto;
+        dto.callsign = "DLH123";
+        dto.sequenceCounter = sequence;
+        dto.audio = std::vector<char>(80 + sequence % 40, static_cast<char>(sequence));
+        dto.lastPacket = false;
+        dto.transceivers = { { 0, 122800000, 1.0F }, { 1, 121500000, 0.25F } };
+        return dto;
+    }
+
+    void CTestCryptoDtoContext::roundTrip()
+    {
+        CCryptoDtoChannel channel(channelConfig());
+        CCryptoDtoContext context;
+        const AudioRxOnTransceiversDto sent = voicePacket(7);
+
+        const QByteArray packet =
+            context.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, sent).toByteArray();
+        QVERIFY(!packet.isEmpty());
+        QVERIFY(context.deserialize(channel, packet, true));
+        QCOMPARE(context.getDtoName(), AudioRxOnTransceiversDto::getShortDtoName());
+
+        AudioRxOnTransceiversDto received;
+        QVERIFY(context.getDto(received));
+        QCOMPARE(received.callsign, sent.callsign);
+        QCOMPARE(received.sequenceCounter, sent.sequenceCounter);
+        QVERIFY(received.audio == sent.audio);
+        QCOMPARE(received.transceivers.size(), sent.transceivers.size());
+        QCOMPARE(received.transceivers[1].frequency, sent.transceivers[1].frequency);
+
+        HeartbeatAckDto ack;
+        QVERIFY(!context.getDto(ack));
+
+        // same wire format as the CryptoDtoSerializer
+        CryptoDtoSerializer::Deserializer deserializer = CryptoDtoSerializer::deserialize(channel, packet, true);
+        QVERIFY(deserializer.m_verified);
+        QCOMPARE(deserializer.getDto<AudioRxOnTransceiversDto>().callsign, sent.callsign);
+
+        const QByteArray serialized =
+            CryptoDtoSerializer::serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, sent);
+        QVERIFY(context.deserialize(channel, serialized, true));
+        QVERIFY(context.getDto(received));
+        QVERIFY(received.audio == sent.audio);
+    }
+
+    void CTestCryptoDtoContext::invalidPackets()
+    {
+        CCryptoDtoChannel channel(channelConfig());
+        CCryptoDtoContext context;
+        QByteArray packet =
+            context.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, voicePacket(1)).toByteArray();
+
+        QByteArray tampered = packet;
+        tampered[tampered.size() - 20] = static_cast<char>(tampered[tampered.size() - 20] ^ 1);
+        QVERIFY(!context.deserialize(channel, tampered, true));
+        QVERIFY(!context.isVerified());
+        QVERIFY(context.getDtoName().isEmpty());
+
+        QVERIFY(!context.deserialize(channel, packet.left(packet.size() - 1), true));
+        QVERIFY(!context.deserialize(channel, packet.left(1), true));
+        QVERIFY(!context.deserialize(channel, QByteArray(64, '\xff'), true));
+
+        // wrong key
+        CryptoDtoChannelConfigDto otherConfig = channelConfig();
+        otherConfig.aeadTransmitKey.fill('o');
+        CCryptoDtoChannel other(otherConfig);
+        QVERIFY(!context.deserialize(other, packet, true));
+        QVERIFY(context.deserialize(channel, packet, true));
+    }
+
+    void CTestCryptoDtoContext::steadyState()
+    {
+        CCryptoDtoChannel channel(channelConfig());
+        CCryptoDtoContext transmit;
+        CCryptoDtoContext receive;
+        QCOMPARE(transmit.getGrowthCount(), 0);
+
+        AudioRxOnTransceiversDto received;
+        const char *packetData = nullptr;
+        for (uint i = 0; i < 500; i++)
+        {
+            const AudioRxOnTransceiversDto sent = voicePacket(i);
+            const QByteArrayView packet = transmit.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, sent);
+            if (!packetData) { packetData = packet.data(); }
+            QVERIFY(packet.data() == packetData); // same buffer
+            QVERIFY(receive.deserialize(channel, packet, true));
+            QVERIFY(receive.getDto(received));
+            QCOMPARE(received.sequenceCounter, i);
+        }
+        QCOMPARE(transmit.getGrowthCount(), 0);
+        QCOMPARE(receive.getGrowthCount(), 0);
+
+        // larger than preallocated, grows once and then stays
+        AudioRxOnTransceiversDto large = voicePacket(1);
+        large.audio.resize(CCryptoDtoContext::MaxPacketSize);
+        QVERIFY(!transmit.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, large).isEmpty());
+        const int growths = transmit.getGrowthCount();
+        QVERIFY(growths > 0);
+        QVERIFY(!transmit.serialize(channel, CryptoDtoMode::AEAD_ChaCha20Poly1305, large).isEmpty());
+        QCOMPARE(transmit.getGrowthCount(), growths);
+    }
+} // namespace SwiftCoreTest
+
+//! main
+SWIFTTEST_APPLESS_MAIN(SwiftCoreTest::CTestCryptoDtoContext);
+
+#include "testcryptodtocontext.moc"
+
+//! \endcond
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testswiftcore
+ */
+
+#include <QTest>
+#include <QVector>
+#include <QtMath>
+
+#include "test.h"
+
+#include "core/afv/audio/jitterbuffer.h"
+#include "core/afv/audio/opusdecodeworker.h"
+#include "sound/codecs/opusencoder.h"
+
+using namespace swift::core::afv::audio;
+using namespace swift::sound::codecs;
+
+namespace SwiftCoreTest
+{
+    //! Jitter buffer, the test decodes in place of the worker thread
+    class CTestJitterBuffer : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Packets in order are decoded and played
+        void inOrder();
+
+        //! Lost packets are concealed, up to MaxConcealedFrames
+        void lossConcealment();
+
+        //! Packets after a later packet are dropped as late
+        void latePackets();
+
+        //! Target depth follows the jitter
+        void adaptiveDepth();
+
+        //! Reset starts a new transmission, old frames are not played
+        void generationReset();
+
+    private:
+        static constexpr int SampleRate = 48000;
+
+        //! Opus packet of a frame of a tone
+        static QByteArray packet();
+    };
+
+    QByteArray CTestJitterBuffer::packet()
+    {
+        static const QByteArray encoded = [] {
+            QVector<qint16> pcm(CJitterBuffer::FrameSize);
+            for (int i = 0; i < pcm.size(); i++)
+            {
+                pcm[i] = static_cast<qint16>(8000 * qSin(2.0 * M_PI * 440.0 * i / SampleRate));
+            }
+            COpusEncoder encoder(SampleRate, 1);
+            int length = 0;
+            return encoder.encode(pcm, pcm.size(), &length);
+        }();
+        return encoded;
+    }
+
+    void CTestJitterBuffer::inOrder()
+    {
+        COpusDecodeWorker worker(this);
+        CJitterBuffer buffer(SampleRate, &worker);
+        for (uint sequence = 0; sequence < 5; sequence++)
+        {
+            QVERIFY(buffer.addPacket(packet(), sequence, sequence == 4));
+        }
+        buffer.decodePending();
+
+        const JitterBufferStatistics statistics = buffer.getStatistics();
+        QCOMPARE(statistics.received, qint64(5));
+        QCOMPARE(statistics.late, qint64(0));
+        QCOMPARE(statistics.lost, qint64(0));
+        QCOMPARE(statistics.depthFrames, 5);
+
+        QVector<float> samples;
+        QCOMPARE(buffer.readSamples(samples, 5 * CJitterBuffer::FrameSize), 5 * CJitterBuffer::FrameSize);
+        QCOMPARE(buffer.getStatistics().underruns, qint64(0));
+    }
+
+    void CTestJitterBuffer::lossConcealment()
+    {
+        COpusDecodeWorker worker(this);
+        CJitterBuffer buffer(SampleRate, &worker);
+        buffer.addPacket(packet(), 0, false);
+        buffer.addPacket(packet(), 1, false);
+        buffer.addPacket(packet(), 3, false); // 2 lost
+        buffer.decodePending();
+
+        JitterBufferStatistics statistics = buffer.getStatistics();
+        QCOMPARE(statistics.lost, qint64(1));
+        QCOMPARE(statistics.concealed, qint64(1));
+        QCOMPARE(statistics.depthFrames, 4);
+
+        buffer.addPacket(packet(), 10, false); // 4..9 lost, only some are concealed
+        buffer.decodePending();
+        statistics = buffer.getStatistics();
+        QCOMPARE(statistics.lost, qint64(7));
+        QCOMPARE(statistics.concealed, qint64(1 + CJitterBuffer::MaxConcealedFrames));
+        QCOMPARE(statistics.depthFrames, 5 + CJitterBuffer::MaxConcealedFrames);
+    }
+
+    void CTestJitterBuffer::latePackets()
+    {
+        COpusDecodeWorker worker(this);
+        CJitterBuffer buffer(SampleRate, &worker);
+        buffer.addPacket(packet(), 5, false);
+        buffer.addPacket(packet(), 6, false);
+        buffer.addPacket(packet(), 6, false); // duplicate
+        buffer.addPacket(packet(), 4, false); // after a later one
+        buffer.decodePending();
+
+        const JitterBufferStatistics statistics = buffer.getStatistics();
+        QCOMPARE(statistics.received, qint64(4));
+        QCOMPARE(statistics.late, qint64(2));
+        QCOMPARE(statistics.depthFrames, 2);
+    }
+
+    void CTestJitterBuffer::adaptiveDepth()
+    {
+        COpusDecodeWorker worker(this);
+        CJitterBuffer buffer(SampleRate, &worker);
+        const int initialDepth = buffer.getStatistics().targetDepthFrames;
+        QVERIFY(initialDepth >= CJitterBuffer::MinDepthFrames);
+
+        // a burst arrives at once instead of every 20ms, which is the worst jitter
+        for (uint sequence = 0; sequence < 12; sequence++)
+        {
+            buffer.addPacket(packet(), sequence, false);
+            buffer.decodePending();
+        }
+        const JitterBufferStatistics statistics = buffer.getStatistics();
+        QVERIFY(statistics.jitterMs > CJitterBuffer::InitialJitterMs);
+        QVERIFY(statistics.targetDepthFrames > initialDepth);
+        QVERIFY(statistics.targetDepthFrames <= CJitterBuffer::MaxDepthFrames);
+
+        // playing waits for the target depth
+        CJitterBuffer waiting(SampleRate, &worker);
+        QVector<float> samples;
+        uint sequence = 0;
+        for (;;)
+        {
+            waiting.addPacket(packet(), sequence++, false);
+            waiting.decodePending();
+            const JitterBufferStatistics waitingStatistics = waiting.getStatistics();
+            if (waitingStatistics.depthFrames >= waitingStatistics.targetDepthFrames) { break; }
+            QCOMPARE(waiting.readSamples(samples, CJitterBuffer::FrameSize), 0);
+            QVERIFY(static_cast<int>(sequence) < CJitterBuffer::MaxDepthFrames);
+        }
+        QVERIFY(static_cast<int>(sequence) >= CJitterBuffer::MinDepthFrames);
+        QCOMPARE(waiting.readSamples(samples, CJitterBuffer::FrameSize), CJitterBuffer::FrameSize);
+    }
+
+    void CTestJitterBuffer::generationReset()
+    {
+        COpusDecodeWorker worker(this);
+        CJitterBuffer buffer(SampleRate, &worker);
+        for (uint sequence = 100; sequence < 105; sequence++) { buffer.addPacket(packet(), sequence, false); }
+        buffer.decodePending();
+        buffer.reset();
+
+        // the new transmission starts with a lower sequence, which is not late
+        buffer.addPacket(packet(), 0, true);
+        buffer.decodePending();
+        const JitterBufferStatistics statistics = buffer.getStatistics();
+        QCOMPARE(statistics.received, qint64(6));
+        QCOMPARE(statistics.late, qint64(0));
+
+        // only the frame of the new transmission is played
+        QVector<float> samples;
+        QCOMPARE(buffer.readSamples(samples, 3 * CJitterBuffer::FrameSize), CJitterBuffer::FrameSize);
+        QCOMPARE(buffer.getStatistics().underruns, qint64(0));
+    }
+} // namespace SwiftCoreTest
+
+//! main
+SWIFTTEST_APPLESS_MAIN(SwiftCoreTest::CTestJitterBuffer);
+
+#include "testjitterbuffer.moc"
+
+//! \endcond
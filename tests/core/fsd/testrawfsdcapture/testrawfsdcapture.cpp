@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testswiftfsd
+ */
+
+#include <QFile>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "test.h"
+
+#include "core/fsd/rawfsdcapture.h"
+
+using namespace swift::core::fsd;
+
+namespace MiscTest
+{
+    //! Binary raw FSD message capture
+    class CTestRawFsdCapture : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Messages read back as recorded
+        void roundTrip();
+
+        //! Appending continues a capture
+        void append();
+
+        //! Buffer wrapping around while the writer drains it
+        void wrapAround();
+
+        //! Conversion to the text log format
+        void toText();
+
+    private:
+        QTemporaryDir m_dir;
+    };
+
+    void CTestRawFsdCapture::roundTrip()
+    {
+        const QString fileName = m_dir.filePath("roundtrip.fsdcapture");
+        QString error;
+        CRawFsdCapture capture;
+        QVERIFY(!capture.isRunning());
+        capture.record(1000, false, u"ignored, not running");
+        QVERIFY(capture.start(fileName, false, error));
+        QVERIFY(capture.isRunning());
+
+        const qint64 start = Q_INT64_C(1700000000000);
+        capture.record(start, false, u"@N:DLH123:2000:1:48.12345:11.12345:5000:250:12345678:10");
+        capture.record(start + 5, true, u"#TMSWIFT1:DLH123:Grüß Gott");
+        capture.record(start + 3, false, u"older timestamp");
+        capture.stop();
+        QVERIFY(!capture.isRunning());
+        QCOMPARE(capture.getRecordedCount(), qint64(3));
+        QCOMPARE(capture.getDroppedCount(), qint64(0));
+
+        QVERIFY(CRawFsdCapture::isCaptureFile(fileName));
+        QVector<CRawFsdCapture::Record> records;
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QCOMPARE(records.size(), 3);
+        QCOMPARE(records.at(0).timestampMs, start);
+        QVERIFY(!records.at(0).sent);
+        QCOMPARE(records.at(0).message, QByteArray("@N:DLH123:2000:1:48.12345:11.12345:5000:250:12345678:10"));
+        QCOMPARE(records.at(1).timestampMs, start + 5);
+        QVERIFY(records.at(1).sent);
+        QCOMPARE(QString::fromUtf8(records.at(1).message), QStringLiteral("#TMSWIFT1:DLH123:Grüß Gott"));
+        QCOMPARE(records.at(2).timestampMs, start + 5); // clock steps backwards are not recorded
+
+        // truncated files are read up to the last complete message
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.resize(file.size() - 2));
+        file.close();
+        records.clear();
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QCOMPARE(records.size(), 2);
+        QVERIFY(!error.isEmpty());
+
+        const QString textFileName = m_dir.filePath("text.log");
+        QVERIFY(!CRawFsdCapture::isCaptureFile(textFileName));
+        QVERIFY(CRawFsdCapture::convertToText(fileName, textFileName, error));
+        QVERIFY(!CRawFsdCapture::readCapture(textFileName, records, error));
+    }
+
+    void CTestRawFsdCapture::append()
+    {
+        const QString fileName = m_dir.filePath("append.fsdcapture");
+        QString error;
+        CRawFsdCapture capture;
+        QVERIFY(capture.start(fileName, true, error)); // no file yet
+        capture.record(1700000000000, false, u"first");
+        capture.stop();
+
+        QVERIFY(capture.start(fileName, true, error));
+        capture.record(1700000001000, true, u"second");
+        capture.stop();
+
+        QVector<CRawFsdCapture::Record> records;
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QCOMPARE(records.size(), 2);
+        QCOMPARE(records.at(0).message, QByteArray("first"));
+        QCOMPARE(records.at(1).message, QByteArray("second"));
+        QCOMPARE(records.at(1).timestampMs, Q_INT64_C(1700000001000));
+
+        // a partially written message is cut off before appending
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.resize(file.size() - 2));
+        file.close();
+        QVERIFY(capture.start(fileName, true, error));
+        capture.record(1700000002000, false, u"third");
+        capture.stop();
+        records.clear();
+        error.clear();
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QVERIFY(error.isEmpty());
+        QCOMPARE(records.size(), 2);
+        QCOMPARE(records.at(1).message, QByteArray("third"));
+        QCOMPARE(records.at(1).timestampMs, Q_INT64_C(1700000002000));
+
+        QVERIFY(capture.start(fileName, false, error));
+        capture.stop();
+        records.clear();
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QVERIFY(records.isEmpty());
+    }
+
+    void CTestRawFsdCapture::wrapAround()
+    {
+        const QString fileName = m_dir.filePath("wrap.fsdcapture");
+        QString error;
+        CRawFsdCapture capture(1); // smallest possible buffer
+        QVERIFY(capture.start(fileName, false, error));
+
+        constexpr int count = 20000;
+        for (int i = 0; i < count; i++)
+        {
+            const QString message = QStringLiteral("%1:").arg(i) + QString(i % 200, u'x');
+            capture.record(1700000000000 + i, i % 2, message);
+            if (i % 1000 == 0) { QTest::qWait(1); }
+        }
+        capture.stop();
+        QCOMPARE(capture.getRecordedCount() + capture.getDroppedCount(), qint64(count));
+
+        QVector<CRawFsdCapture::Record> records;
+        QVERIFY(CRawFsdCapture::readCapture(fileName, records, error));
+        QCOMPARE(records.size(), static_cast<qsizetype>(capture.getRecordedCount()));
+        int previous = -1;
+        for (const CRawFsdCapture::Record &record : std::as_const(records))
+        {
+            const int i = record.message.left(record.message.indexOf(':')).toInt();
+            QVERIFY(i > previous);
+            QCOMPARE(record.message.size(), QByteArray::number(i).size() + 1 + i % 200);
+            QCOMPARE(record.sent, i % 2 == 1);
+            previous = i;
+        }
+    }
+
+    void CTestRawFsdCapture::toText()
+    {
+        const CRawFsdCapture::Record received { 1700000000123, false, "@N:DLH123:2000" };
+        const CRawFsdCapture::Record sent { 1700000000123, true, "$AXSWIFT1:SERVER:METAR:EDDM" };
+        QCOMPARE(CRawFsdCapture::toText(received), QStringLiteral("22:13:20.123 FSD Recv=>@N:DLH123:2000"));
+        QCOMPARE(CRawFsdCapture::toText(sent), QStringLiteral("22:13:20.123 FSD Sent=>$AXSWIFT1:SERVER:METAR:EDDM"));
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestRawFsdCapture);
+
+#include "testrawfsdcapture.moc"
+
+//! \endcond
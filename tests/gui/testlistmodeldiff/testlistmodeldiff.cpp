@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testswiftgui
+
+#include <QTest>
+
+#include "test.h"
+
+#include "gui/models/listmodeldiff.h"
+
+using namespace swift::gui::models;
+
+namespace SwiftGuiTest
+{
+    //! Test the diff of list model rows
+    class CTestListModelDiff : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Same keys, nothing to signal but changed values
+        void unchanged();
+
+        //! Removed and inserted rows
+        void removedInserted();
+
+        //! Kept rows in another order
+        void reordered();
+
+        //! Cases where the model has to be reset
+        void invalid();
+
+        //! Consecutive rows as ranges
+        void ranges();
+    };
+
+    void CTestListModelDiff::unchanged()
+    {
+        const QStringList keys { "DLH1", "BAW2", "AFR3" };
+        CListModelDiff diff = CListModelDiff::fromKeys(keys, keys);
+        QVERIFY(diff.isValid());
+        QVERIFY(!diff.hasChanges());
+        QVERIFY(!diff.isReordered());
+        QCOMPARE(diff.getKeptOldRows(), QVector<int>({ 0, 1, 2 }));
+        QCOMPARE(diff.getKeptNewRows(), QVector<int>({ 0, 1, 2 }));
+
+        diff.setChangedRows({ 1 });
+        QVERIFY(diff.hasChanges());
+    }
+
+    void CTestListModelDiff::removedInserted()
+    {
+        const QStringList oldKeys { "A", "B", "C", "D", "E", "F", "G" };
+        const QStringList newKeys { "X", "A", "C", "E", "F", "G", "Y" };
+        const CListModelDiff diff = CListModelDiff::fromKeys(oldKeys, newKeys);
+        QVERIFY(diff.isValid());
+        QVERIFY(!diff.isReordered());
+        QCOMPARE(diff.getRemovedRows(), QVector<int>({ 1, 3 }));
+        QCOMPARE(diff.getInsertedRows(), QVector<int>({ 0, 6 }));
+        QCOMPARE(diff.getKeptOldRows(), QVector<int>({ 0, 2, 4, 5, 6 }));
+        QCOMPARE(diff.getKeptNewRows(), QVector<int>({ 1, 2, 3, 4, 5 }));
+    }
+
+    void CTestListModelDiff::reordered()
+    {
+        const QStringList oldKeys { "A", "B", "C", "D" };
+        const QStringList newKeys { "D", "B", "A", "C" };
+        const CListModelDiff diff = CListModelDiff::fromKeys(oldKeys, newKeys);
+        QVERIFY(diff.isValid());
+        QVERIFY(diff.isReordered());
+        QVERIFY(diff.hasChanges());
+        QVERIFY(diff.getRemovedRows().isEmpty());
+        QVERIFY(diff.getInsertedRows().isEmpty());
+        QCOMPARE(diff.getKeptNewRows(), QVector<int>({ 2, 1, 3, 0 }));
+    }
+
+    void CTestListModelDiff::invalid()
+    {
+        QVERIFY(!CListModelDiff().isValid());
+        QVERIFY(!CListModelDiff::fromKeys({}, { "A" }).isValid());
+        QVERIFY(!CListModelDiff::fromKeys({ "A" }, {}).isValid());
+        QVERIFY(!CListModelDiff::fromKeys({ "A", "" }, { "A" }).isValid()); // missing key
+        QVERIFY(!CListModelDiff::fromKeys({ "A", "B" }, { "A", "A" }).isValid()); // duplicate key
+        QVERIFY(!CListModelDiff::fromKeys({ "A", "B", "C" }, { "A", "X", "Y" }).isValid()); // mostly replaced
+        QVERIFY(CListModelDiff::fromKeys({ "A", "B", "C" }, { "A", "B", "Y" }).isValid());
+    }
+
+    void CTestListModelDiff::ranges()
+    {
+        using Ranges = QVector<QPair<int, int>>;
+        QCOMPARE(CListModelDiff::toRanges({}), Ranges());
+        QCOMPARE(CListModelDiff::toRanges({ 3 }), Ranges({ { 3, 3 } }));
+        QCOMPARE(CListModelDiff::toRanges({ 0, 1, 2, 5, 7, 8 }), Ranges({ { 0, 2 }, { 5, 5 }, { 7, 8 } }));
+    }
+} // namespace SwiftGuiTest
+
+//! main
+SWIFTTEST_APPLESS_MAIN(SwiftGuiTest::CTestListModelDiff);
+
+#include "testlistmodeldiff.moc"
+
+//! \endcond
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testswiftgui
+
+#include <QDateTime>
+#include <QList>
+#include <QStringList>
+#include <QTest>
+#include <QTimeZone>
+
+#include "test.h"
+
+#include "gui/models/distributorlistmodel.h"
+#include "gui/models/listmodelbase.h"
+#include "misc/orderable.h"
+#include "misc/propertyindex.h"
+#include "misc/simulation/distributor.h"
+#include "misc/simulation/distributorlist.h"
+#include "misc/simulation/simulatorinfo.h"
+#include "misc/variant.h"
+
+using namespace swift::misc;
+using namespace swift::misc::simulation;
+using namespace swift::gui::models;
+
+namespace SwiftGuiTest
+{
+    //! Test sorting of list models
+    class CTestListModelSort : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Typed keys of property values
+        void sortKeys();
+
+        //! Numbers are sorted as numbers, not as formatted strings
+        void typedKeyColumn();
+
+        //! Rows with equal keys keep their order
+        void stableOnEqualKeys();
+
+        //! Tie breakers, and stable sorts of several columns in different orders
+        void multiColumn();
+
+    private:
+        //! Model columns
+        enum Column
+        {
+            OrderColumn,
+            KeyColumn,
+            DescriptionColumn
+        };
+
+        //! Model with the order, key and description columns
+        static void setupModel(CDistributorListModel &model);
+
+        //! Distributor with order
+        static CDistributor distributor(const QString &key, const QString &description, int order,
+                                        const QString &alias1 = {});
+
+        //! Orders of the distributors
+        static QList<int> orders(const CDistributorList &distributors);
+
+        //! Alias 1 of the distributors
+        static QStringList aliases(const CDistributorList &distributors);
+    };
+
+    void CTestListModelSort::sortKeys()
+    {
+        using Private::SortKey;
+        int c = 0;
+
+        // numbers compare as numbers
+        QVERIFY(
+            SortKey::compare(SortKey::fromVariant(CVariant::from(9)), SortKey::fromVariant(CVariant::from(10)), c));
+        QVERIFY(c < 0);
+        QVERIFY(
+            SortKey::compare(SortKey::fromVariant(CVariant::from(2.5)), SortKey::fromVariant(CVariant::from(2)), c));
+        QVERIFY(c > 0);
+        QVERIFY(
+            SortKey::compare(SortKey::fromVariant(CVariant::from(true)), SortKey::fromVariant(CVariant::from(1)), c));
+        QCOMPARE(c, 0);
+
+        // strings case insensitive
+        QVERIFY(SortKey::compare(SortKey::fromVariant(CVariant::from(QStringLiteral("abc"))),
+                                 SortKey::fromVariant(CVariant::from(QStringLiteral("ABD"))), c));
+        QVERIFY(c < 0);
+        QVERIFY(SortKey::compare(SortKey::fromVariant(CVariant::from(QStringLiteral("Swift"))),
+                                 SortKey::fromVariant(CVariant::from(QStringLiteral("SWIFT"))), c));
+        QCOMPARE(c, 0);
+
+        // timestamps as numbers
+        const QDateTime earlier = QDateTime::fromMSecsSinceEpoch(1000, QTimeZone::UTC);
+        const QDateTime later = QDateTime::fromMSecsSinceEpoch(2000, QTimeZone::UTC);
+        QVERIFY(SortKey::compare(SortKey::fromVariant(CVariant::from(later)),
+                                 SortKey::fromVariant(CVariant::from(earlier)), c));
+        QVERIFY(c > 0);
+
+        // other values and different kinds are left to the objects
+        const SortKey other = SortKey::fromVariant(CVariant::from(CSimulatorInfo(CSimulatorInfo::FSX)));
+        QCOMPARE(other.kind, SortKey::Other);
+        QVERIFY(!SortKey::compare(other, other, c));
+        QVERIFY(!SortKey::compare(SortKey::fromVariant(CVariant::from(1)),
+                                  SortKey::fromVariant(CVariant::from(QStringLiteral("1"))), c));
+    }
+
+    void CTestListModelSort::typedKeyColumn()
+    {
+        CDistributorListModel model;
+        setupModel(model);
+        CDistributorList distributors;
+        distributors.push_back(distributor("C", "c", 10));
+        distributors.push_back(distributor("A", "a", 9));
+        distributors.push_back(distributor("B", "b", 100));
+
+        // as strings "10" < "100" < "9"
+        QCOMPARE(orders(model.sortContainerByColumn(distributors, OrderColumn, Qt::AscendingOrder)),
+                 QList<int>({ 9, 10, 100 }));
+        QCOMPARE(orders(model.sortContainerByColumn(distributors, OrderColumn, Qt::DescendingOrder)),
+                 QList<int>({ 100, 10, 9 }));
+    }
+
+    void CTestListModelSort::stableOnEqualKeys()
+    {
+        CDistributorListModel model;
+        setupModel(model);
+
+        // equal description and key, only the alias differs, enough rows to sort in chunks
+        constexpr int Rows = 20000;
+        CDistributorList distributors;
+        for (int i = 0; i < Rows; i++)
+        {
+            const QString description = QStringLiteral("D%1").arg(i % 7);
+            distributors.push_back(distributor("SAME", description, 0, QString::number(i)));
+        }
+
+        for (const Qt::SortOrder order : { Qt::AscendingOrder, Qt::DescendingOrder })
+        {
+            const CDistributorList sorted = model.sortContainerByColumn(distributors, DescriptionColumn, order);
+            QCOMPARE(sorted.size(), distributors.size());
+            for (int i = 1; i < sorted.size(); i++)
+            {
+                const int c = sorted[i - 1].getDescription().compare(sorted[i].getDescription());
+                QVERIFY(order == Qt::AscendingOrder ? c <= 0 : c >= 0);
+                if (c == 0) { QVERIFY(sorted[i - 1].getAlias1().toInt() < sorted[i].getAlias1().toInt()); }
+            }
+        }
+
+        // a resort does not move anything
+        const CDistributorList sorted =
+            model.sortContainerByColumn(distributors, DescriptionColumn, Qt::AscendingOrder);
+        QCOMPARE(aliases(model.sortContainerByColumn(sorted, DescriptionColumn, Qt::AscendingOrder)),
+                 aliases(sorted));
+    }
+
+    void CTestListModelSort::multiColumn()
+    {
+        CDistributorListModel model;
+        setupModel(model);
+
+        // equal descriptions are sorted by the key tie breaker, in the same order
+        CDistributorList distributors;
+        distributors.push_back(distributor("B", "x", 1, "Bx"));
+        distributors.push_back(distributor("A", "y", 2, "Ay"));
+        distributors.push_back(distributor("C", "x", 3, "Cx"));
+        distributors.push_back(distributor("A", "x", 4, "Ax"));
+        QCOMPARE(aliases(model.sortContainerByColumn(distributors, DescriptionColumn, Qt::AscendingOrder)),
+                 QStringList({ "Ax", "Bx", "Cx", "Ay" }));
+        QCOMPARE(aliases(model.sortContainerByColumn(distributors, DescriptionColumn, Qt::DescendingOrder)),
+                 QStringList({ "Ay", "Cx", "Bx", "Ax" }));
+
+        // description ascending, then order descending: sort by the order first, the stable sort keeps it
+        distributors.clear();
+        distributors.push_back(distributor("A", "x", 1, "x1"));
+        distributors.push_back(distributor("B", "y", 5, "y5"));
+        distributors.push_back(distributor("A", "x", 3, "x3"));
+        distributors.push_back(distributor("B", "y", 2, "y2"));
+        distributors.push_back(distributor("A", "x", 2, "x2"));
+        const CDistributorList byOrder =
+            model.sortContainerByColumn(distributors, OrderColumn, Qt::DescendingOrder);
+        QCOMPARE(orders(byOrder), QList<int>({ 5, 3, 2, 2, 1 }));
+        QCOMPARE(aliases(model.sortContainerByColumn(byOrder, DescriptionColumn, Qt::AscendingOrder)),
+                 QStringList({ "x3", "x2", "x1", "y5", "y2" }));
+    }
+
+    void CTestListModelSort::setupModel(CDistributorListModel &model)
+    {
+        model.setDistributorMode(CDistributorListModel::MinimalWithOrder);
+        QVERIFY(model.columnToPropertyIndex(OrderColumn) == CPropertyIndex(IOrderable::IndexOrder));
+        QVERIFY(model.columnToPropertyIndex(KeyColumn) == CPropertyIndex(CDistributor::IndexDbStringKey));
+        QVERIFY(model.columnToPropertyIndex(DescriptionColumn) == CPropertyIndex(CDistributor::IndexDescription));
+    }
+
+    CDistributor CTestListModelSort::distributor(const QString &key, const QString &description, int order,
+                                                 const QString &alias1)
+    {
+        CDistributor distributor(key, description, alias1, {});
+        distributor.setOrder(order);
+        return distributor;
+    }
+
+    QList<int> CTestListModelSort::orders(const CDistributorList &distributors)
+    {
+        QList<int> orders;
+        for (const CDistributor &distributor : distributors) { orders.push_back(distributor.getOrder()); }
+        return orders;
+    }
+
+    QStringList CTestListModelSort::aliases(const CDistributorList &distributors)
+    {
+        QStringList aliases;
+        for (const CDistributor &distributor : distributors) { aliases.push_back(distributor.getAlias1()); }
+        return aliases;
+    }
+} // namespace SwiftGuiTest
+
+//! main
+SWIFTTEST_MAIN(SwiftGuiTest::CTestListModelSort);
+
+#include "testlistmodelsort.moc"
+
+//! \endcond
@@ -17,6 +17,7 @@
 #include "misc/aviation/altitude.h"
 #include "misc/aviation/atcstation.h"
 #include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignhandle.h"
 #include "misc/aviation/callsignset.h"
 #include "misc/aviation/comsystem.h"
 #include "misc/aviation/heading.h"
@@ -67,6 +68,9 @@ namespace MiscTest
         //! Callsigns and callsign containers
         void callsignWithContainers();
 
+        //! Interned callsign handles and handle maps
+        void callsignHandles();
+
         //! Testing copying and equality of objects
         void copyAndEqual();
 
@@ -298,6 +302,47 @@ namespace MiscTest
         QVERIFY2(set.size() == 0, "Last should be gone");
     }
 
+    void CTestAviation::callsignHandles()
+    {
+        QVERIFY(CCallsignHandle().isNull());
+        QVERIFY(CCallsignHandle::intern(CCallsign()).isNull());
+        QVERIFY(CCallsignHandle::find(CCallsign("TESTHANDLE1")).isNull()); // never interned
+
+        const int count = CCallsignHandle::internedCount();
+        const CCallsignHandle h1 = CCallsignHandle::intern(CCallsign("TestHandle1"));
+        const CCallsignHandle h2 = CCallsignHandle::intern(CCallsign("TESTHANDLE2"));
+        QVERIFY(!h1.isNull() && !h2.isNull() && h1 != h2);
+        QVERIFY(CCallsignHandle::intern(CCallsign("testhandle1")) == h1);
+        QVERIFY(CCallsignHandle::find(CCallsign("TESTHANDLE1")) == h1);
+        QCOMPARE(CCallsignHandle::internedCount(), count + 2);
+        QCOMPARE(h1.asString(), QStringLiteral("TESTHANDLE1"));
+        QVERIFY(h2.toCallsign() == CCallsign("TESTHANDLE2"));
+
+        CCallsignHandleMap<int> map;
+        QVERIFY(map.isEmpty());
+        QVERIFY(!map.contains(h1));
+        QVERIFY(!map.contains(CCallsignHandle()));
+        QCOMPARE(map.value(h1, -1), -1);
+        map[h1] = 1;
+        map.insert(h2, 2);
+        QCOMPARE(map.size(), 2);
+        QCOMPARE(map.value(h1), 1);
+        QCOMPARE(*map.find(h2), 2);
+        map[h1] += 10;
+        QCOMPARE(map.value(h1), 11);
+
+        // removing moves the last value, the others stay reachable
+        QVERIFY(map.remove(h1));
+        QVERIFY(!map.remove(h1));
+        QVERIFY(!map.contains(h1));
+        QCOMPARE(map.value(h2), 2);
+        QVERIFY(map.keys().front() == h2);
+        QCOMPARE(map.valueList(), QList<int>({ 2 }));
+        map.clear();
+        QVERIFY(!map.contains(h2));
+        QVERIFY(map.isEmpty());
+    }
+
     void CTestAviation::copyAndEqual()
     {
         const CFrequency f1(123.45, CFrequencyUnit::MHz());
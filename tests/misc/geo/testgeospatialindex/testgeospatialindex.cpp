@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <cmath>
+
+#include <QRandomGenerator>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/geo/coordinategeodeticlist.h"
+#include "misc/geo/geospatialindex.h"
+#include "misc/pq/length.h"
+#include "misc/pq/units.h"
+
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+
+namespace MiscTest
+{
+    //! Queries with spatial index compared to the linear search
+    class CTestGeoSpatialIndex : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Range queries
+        void withinRange();
+
+        //! Closest objects
+        void closest();
+
+        //! Closest object within range
+        void closestWithinRange();
+
+        //! Index not matching the list
+        void staleIndex();
+
+    private:
+        //! Random coordinates, partly clustered around a few airports and with some NULL positions
+        static CCoordinateGeodeticList randomCoordinates(QRandomGenerator &random, int number);
+
+        //! Random coordinate
+        static CCoordinateGeodetic randomCoordinate(QRandomGenerator &random);
+
+        static constexpr int NumberOfCoordinates = 3000;
+        static constexpr int NumberOfQueries = 500;
+    };
+
+    CCoordinateGeodetic CTestGeoSpatialIndex::randomCoordinate(QRandomGenerator &random)
+    {
+        return { random.bounded(180.0) - 90.0, random.bounded(360.0) - 180.0 };
+    }
+
+    CCoordinateGeodeticList CTestGeoSpatialIndex::randomCoordinates(QRandomGenerator &random, int number)
+    {
+        const CCoordinateGeodeticList clusters { CCoordinateGeodetic(48.353, 11.786),
+                                                 CCoordinateGeodetic(50.033, 8.570),
+                                                 CCoordinateGeodetic(40.640, -73.779) };
+        CCoordinateGeodeticList coordinates;
+        for (int i = 0; i < number; i++)
+        {
+            const int kind = random.bounded(10);
+            if (kind == 0) { coordinates.push_back(CCoordinateGeodetic()); }
+            else if (kind < 5)
+            {
+                const CCoordinateGeodetic &c = clusters[random.bounded(clusters.size())];
+                coordinates.push_back({ c.latitude().value(CAngleUnit::deg()) + random.bounded(0.2) - 0.1,
+                                        c.longitude().value(CAngleUnit::deg()) + random.bounded(0.2) - 0.1 });
+            }
+            else { coordinates.push_back(randomCoordinate(random)); }
+        }
+        return coordinates;
+    }
+
+    void CTestGeoSpatialIndex::withinRange()
+    {
+        QRandomGenerator random(4711);
+        const CCoordinateGeodeticList coordinates = randomCoordinates(random, NumberOfCoordinates);
+        const CGeoSpatialIndex index = coordinates.createSpatialIndex();
+        QCOMPARE(index.size(), coordinates.size());
+
+        for (int q = 0; q < NumberOfQueries; q++)
+        {
+            // queries near the clusters and anywhere, ranges from a few hundred meters to half the globe
+            const CCoordinateGeodetic reference =
+                q % 2 ? randomCoordinate(random) : coordinates[random.bounded(coordinates.size())];
+            const CLength range(std::pow(10.0, random.bounded(5.0)), CLengthUnit::km());
+            const CCoordinateGeodeticList expected = coordinates.findWithinRange(reference, range);
+            const CCoordinateGeodeticList indexed = coordinates.findWithinRange(reference, range, index);
+            QCOMPARE(indexed, expected);
+        }
+    }
+
+    void CTestGeoSpatialIndex::closest()
+    {
+        QRandomGenerator random(815);
+        const CCoordinateGeodeticList coordinates = randomCoordinates(random, NumberOfCoordinates);
+        const CGeoSpatialIndex index = coordinates.createSpatialIndex();
+
+        for (int q = 0; q < NumberOfQueries; q++)
+        {
+            const CCoordinateGeodetic reference = randomCoordinate(random);
+            const int number = 1 + random.bounded(20);
+            const CCoordinateGeodeticList expected = coordinates.findClosest(number, reference);
+            const CCoordinateGeodeticList indexed = coordinates.findClosest(number, reference, index);
+            QCOMPARE(indexed.size(), expected.size());
+
+            // ties may be ordered differently, but the distances have to be the same
+            for (int i = 0; i < expected.size(); i++)
+            {
+                const double e = calculateEuclideanDistance(expected[i], reference);
+                const double d = calculateEuclideanDistance(indexed[i], reference);
+                QVERIFY2(std::abs(e - d) < 1e-6, qPrintable(QStringLiteral("%1 %2").arg(e).arg(d)));
+            }
+        }
+        QVERIFY(coordinates.findClosest(0, CCoordinateGeodetic(), index).isEmpty());
+        QCOMPARE(coordinates.findClosest(2 * NumberOfCoordinates, CCoordinateGeodetic(), index).size(),
+                 coordinates.size());
+    }
+
+    void CTestGeoSpatialIndex::closestWithinRange()
+    {
+        QRandomGenerator random(42);
+        const CCoordinateGeodeticList coordinates = randomCoordinates(random, NumberOfCoordinates);
+        const CGeoSpatialIndex index = coordinates.createSpatialIndex();
+
+        int found = 0;
+        for (int q = 0; q < NumberOfQueries; q++)
+        {
+            const CCoordinateGeodetic reference =
+                q % 2 ? randomCoordinate(random) : coordinates[random.bounded(coordinates.size())];
+            const CLength range(std::pow(10.0, random.bounded(4.0)), CLengthUnit::km());
+            const CCoordinateGeodetic expected = coordinates.findClosestWithinRange(reference, range);
+            const CCoordinateGeodetic indexed = coordinates.findClosestWithinRange(reference, range, index);
+            QCOMPARE(indexed, expected);
+            if (!expected.isNull()) { found++; }
+        }
+        QVERIFY(found > 0);
+    }
+
+    void CTestGeoSpatialIndex::staleIndex()
+    {
+        QRandomGenerator random(1);
+        CCoordinateGeodeticList coordinates = randomCoordinates(random, 100);
+        const CGeoSpatialIndex index = coordinates.createSpatialIndex();
+        coordinates.push_back(CCoordinateGeodetic(48.353, 11.786));
+
+        // the index does not fit, falls back to the linear search
+        const CLength range(50, CLengthUnit::km());
+        const CCoordinateGeodetic reference(48.0, 11.5);
+        QCOMPARE(coordinates.findWithinRange(reference, range, index), coordinates.findWithinRange(reference, range));
+        QCOMPARE(coordinates.findClosestWithinRange(reference, range, index),
+                 coordinates.findClosestWithinRange(reference, range));
+        QVERIFY(CCoordinateGeodeticList().findWithinRange(reference, range, CGeoSpatialIndex()).isEmpty());
+
+        // different list of the same size, and the same list modified in place
+        const CCoordinateGeodeticList other = randomCoordinates(random, coordinates.size());
+        const CGeoSpatialIndex otherIndex = other.createSpatialIndex();
+        QVERIFY(other.isIndexedBy(otherIndex));
+        QVERIFY(!coordinates.isIndexedBy(otherIndex));
+        QCOMPARE(coordinates.findWithinRange(reference, range, otherIndex),
+                 coordinates.findWithinRange(reference, range));
+
+        CCoordinateGeodeticList modified = other;
+        QVERIFY(modified.isIndexedBy(otherIndex)); // shares the data
+        modified[0] = reference;
+        QVERIFY(!modified.isIndexedBy(otherIndex));
+        QCOMPARE(modified.findClosestWithinRange(reference, range, otherIndex), reference);
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestGeoSpatialIndex);
+
+#include "testgeospatialindex.moc"
+
+//! \endcond
@@ -24,6 +24,7 @@
 #include "misc/pq/pqstring.h"
 #include "misc/pq/pressure.h"
 #include "misc/pq/speed.h"
+#include "misc/pq/staticquantity.h"
 #include "misc/pq/temperature.h"
 #include "misc/pq/time.h"
 #include "misc/pq/units.h"
@@ -81,6 +82,9 @@ namespace MiscTest
 
         //! Test user-defined literals
         void literalsTest();
+
+        //! Compile time unit quantities and conversion from/to physical quantities
+        void staticQuantities();
     };
 
     void CTestPhysicalQuantities::unitsBasics()
@@ -349,6 +353,44 @@ namespace MiscTest
         QVERIFY2(a1.valueInteger(CAngleUnit::deg()) == 450, "Expect 450 degrees");
     }
 
+    void CTestPhysicalQuantities::staticQuantities()
+    {
+        using namespace swift::misc::physical_quantities::static_units;
+
+        // conversions are evaluated at compile time
+        constexpr CStaticLength oneNm = CStaticLength::from<NauticalMile>(1.0);
+        static_assert(oneNm.si() == 1852.0);
+        static_assert(CStaticAngle::from<Degree>(180.0) + CStaticAngle::from<Degree>(180.0) ==
+                      CStaticAngle::from<Degree>(360.0));
+        static_assert((CStaticLength::from<Meter>(100.0) / CStaticTime::from<Second>(10.0)).in<MeterPerSecond>() ==
+                      10.0);
+
+        QCOMPARE(CStaticLength::from<Foot>(1000.0).in<Meter>(), 304.8);
+        QVERIFY(qFuzzyCompare(oneNm.in<Foot>(), CLength(1, CLengthUnit::NM()).value(CLengthUnit::ft())));
+        QVERIFY(qFuzzyCompare(CStaticSpeed::from<Knot>(120.0).in<FootPerMinute>(),
+                              CSpeed(120, CSpeedUnit::kts()).value(CSpeedUnit::ft_min())));
+        QVERIFY(qFuzzyCompare(CStaticAngle::from<Degree>(90.0).in<Radian>(), CAngle::PI() / 2));
+        QCOMPARE((CStaticLength::from<Meter>(-5.0)).abs().in<Meter>(), 5.0);
+        QCOMPARE(CStaticLength::from<Meter>(10.0) / CStaticLength::from<Meter>(4.0), 2.5);
+        QCOMPARE((CStaticSpeed::from<MeterPerSecond>(2.0) * CStaticTime::from<Millisecond>(1500.0)).in<Meter>(), 3.0);
+
+        // physical quantities in any unit
+        const CLength length(3000, CLengthUnit::ft());
+        QVERIFY(qFuzzyCompare(toStatic(length).in<Foot>(), 3000.0));
+        QVERIFY(toPhysicalQuantity(toStatic(length)) == length);
+        const CAngle angle(1.5, CAngleUnit::rad());
+        QVERIFY(qFuzzyCompare(toStatic(angle).in<Radian>(), 1.5));
+        QVERIFY(toPhysicalQuantity(toStatic(angle)) == angle);
+        QVERIFY(toPhysicalQuantity(toStatic(angle)).getUnit() == CAngleUnit::deg());
+        const CSpeed speed(250, CSpeedUnit::kts());
+        QVERIFY(toPhysicalQuantity(toStatic(speed)) == speed);
+        const CTime time(2, CTimeUnit::min());
+        QCOMPARE(toStatic(time).in<Second>(), 120.0);
+
+        // null is zero
+        QCOMPARE(toStatic(CLength(0, CLengthUnit::nullUnit())).si(), 0.0);
+    }
+
     void CTestPhysicalQuantities::literalsTest()
     {
         using namespace swift::misc::physical_quantities::Literals;
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/simulation/fscommon/aircraftcfgfingerprints.h"
+#include "misc/simulation/fscommon/aircraftcfgparser.h"
+#include "misc/statusmessagelist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::simulation::fscommon;
+
+namespace MiscTest
+{
+    //! Incremental aircraft.cfg parsing on a generated package tree
+    class CTestAircraftCfgParser : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Unchanged, touched, changed, added and removed files
+        void incrementalParsing();
+
+        //! A changed file is read again, an unchanged one is not
+        void rescanChangedOnly();
+
+        //! Index persisted to disk
+        void persistedIndex();
+
+    private:
+        //! Write a package with an aircraft.cfg
+        static bool writePackage(const QDir &root, int number, const QString &variant = {});
+
+        //! Parse all aircraft.cfg files below root, as the loader does
+        static CAircraftCfgEntriesList parseTree(const QDir &root, const CAircraftCfgFingerprintIndex &previous,
+                                                 CAircraftCfgFingerprintIndex &current);
+
+        static constexpr int NumberOfPackages = 200;
+    };
+
+    bool CTestAircraftCfgParser::writePackage(const QDir &root, int number, const QString &variant)
+    {
+        const QString pkg = QStringLiteral("package%1/SimObjects/Airplanes/aircraft%1").arg(number);
+        if (!root.mkpath(pkg)) { return false; }
+        QFile file(root.filePath(pkg + "/aircraft.cfg"));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) { return false; }
+        const QString content = QStringLiteral("[GENERAL]\n"
+                                               "atc_type=BOEING\n"
+                                               "icao_type_designator=B738\n"
+                                               "[FLTSIM.0]\n"
+                                               "title=Test model %1%2\n"
+                                               "ui_manufacturer=Boeing\n"
+                                               "ui_type=737-800\n"
+                                               "atc_airline=SWIFT\n"
+                                               "[FLTSIM.1]\n"
+                                               "title=Test model %1 livery 2%2\n")
+                                    .arg(number)
+                                    .arg(variant);
+        return file.write(content.toUtf8()) > 0;
+    }
+
+    CAircraftCfgEntriesList CTestAircraftCfgParser::parseTree(const QDir &root,
+                                                              const CAircraftCfgFingerprintIndex &previous,
+                                                              CAircraftCfgFingerprintIndex &current)
+    {
+        CAircraftCfgEntriesList entries;
+        QDirIterator it(root.absolutePath(), { "aircraft.cfg" }, QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext())
+        {
+            bool ok = false;
+            CStatusMessageList msgs;
+            entries.push_back(
+                CAircraftCfgParser::performParsingOfSingleFile(QFileInfo(it.next()), previous, current, ok, msgs));
+        }
+        return entries;
+    }
+
+    void CTestAircraftCfgParser::incrementalParsing()
+    {
+        QTemporaryDir tempDir;
+        QVERIFY(tempDir.isValid());
+        const QDir root(tempDir.path());
+        for (int i = 0; i < NumberOfPackages; i++) { QVERIFY(writePackage(root, i)); }
+
+        // full parsing
+        CAircraftCfgFingerprintIndex first;
+        const CAircraftCfgEntriesList fullEntries = parseTree(root, {}, first);
+        QCOMPARE(fullEntries.size(), 2 * NumberOfPackages);
+        QCOMPARE(first.size(), NumberOfPackages);
+        QCOMPARE(first.getParsedCount(), NumberOfPackages);
+        QCOMPARE(first.getReusedCount(), 0);
+
+        // nothing changed
+        CAircraftCfgFingerprintIndex second;
+        const CAircraftCfgEntriesList unchangedEntries = parseTree(root, first, second);
+        QCOMPARE(unchangedEntries.size(), fullEntries.size());
+        QCOMPARE(second.getParsedCount(), 0);
+        QCOMPARE(second.getReusedCount(), NumberOfPackages);
+        QVERIFY(unchangedEntries.containsTitle("Test model 42"));
+
+        // touched only, changed content, added and removed package
+        const QString touched = root.filePath("package1/SimObjects/Airplanes/aircraft1/aircraft.cfg");
+        QFile touchedFile(touched);
+        QVERIFY(touchedFile.open(QIODevice::ReadWrite));
+        QVERIFY(touchedFile.setFileTime(QDateTime::currentDateTimeUtc().addSecs(60),
+                                        QFileDevice::FileModificationTime));
+        touchedFile.close();
+        QVERIFY(writePackage(root, 2, " changed"));
+        QVERIFY(writePackage(root, NumberOfPackages));
+        QVERIFY(QDir(root.filePath("package3")).removeRecursively());
+
+        CAircraftCfgFingerprintIndex third;
+        const CAircraftCfgEntriesList changedEntries = parseTree(root, second, third);
+        QCOMPARE(third.size(), NumberOfPackages);
+        QCOMPARE(third.getParsedCount(), 2); // changed and added
+        QCOMPARE(third.getReusedCount(), NumberOfPackages - 2);
+        QVERIFY(changedEntries.containsTitle("Test model 2 changed"));
+        QVERIFY(!changedEntries.containsTitle("Test model 2"));
+        QVERIFY(changedEntries.containsTitle(QStringLiteral("Test model %1").arg(NumberOfPackages)));
+        QVERIFY(!changedEntries.containsTitle("Test model 3"));
+        QVERIFY(changedEntries.containsTitle("Test model 1"));
+    }
+
+    void CTestAircraftCfgParser::rescanChangedOnly()
+    {
+        QTemporaryDir tempDir;
+        QVERIFY(tempDir.isValid());
+        const QDir root(tempDir.path());
+        QVERIFY(writePackage(root, 0));
+        QVERIFY(writePackage(root, 1));
+        const QString unchangedFile = root.filePath("package0/SimObjects/Airplanes/aircraft0/aircraft.cfg");
+        const QString changedFile = root.filePath("package1/SimObjects/Airplanes/aircraft1/aircraft.cfg");
+
+        CAircraftCfgFingerprintIndex first;
+        parseTree(root, {}, first);
+        QCOMPARE(first.size(), 2);
+
+        // plant entries no parser could produce, only files which are not read again keep them
+        CAircraftCfgFingerprintIndex planted;
+        for (const QString &fileName : { unchangedFile, changedFile })
+        {
+            const CAircraftCfgFingerprintIndex::Fingerprint *fingerprint = first.find(fileName);
+            QVERIFY(fingerprint);
+            CAircraftCfgFingerprintIndex::Fingerprint plantedFingerprint = *fingerprint;
+            for (CAircraftCfgEntries &entries : plantedFingerprint.entries)
+            {
+                entries.setTitle(QStringLiteral("Planted %1").arg(QFileInfo(fileName).absolutePath()));
+            }
+            planted.insert(fileName, plantedFingerprint);
+        }
+        QVERIFY(writePackage(root, 1, " changed"));
+
+        CAircraftCfgFingerprintIndex second;
+        const CAircraftCfgEntriesList entries = parseTree(root, planted, second);
+        QCOMPARE(second.getReusedCount(), 1);
+        QCOMPARE(second.getParsedCount(), 1);
+        QVERIFY(entries.containsTitle(QStringLiteral("Planted %1").arg(QFileInfo(unchangedFile).absolutePath())));
+        QVERIFY(!entries.containsTitle("Test model 0"));
+        QVERIFY(!entries.containsTitle(QStringLiteral("Planted %1").arg(QFileInfo(changedFile).absolutePath())));
+        QVERIFY(entries.containsTitle("Test model 1 changed"));
+        QVERIFY(second.find(changedFile)->hash != first.find(changedFile)->hash);
+        QCOMPARE(second.find(unchangedFile)->hash, first.find(unchangedFile)->hash);
+    }
+
+    void CTestAircraftCfgParser::persistedIndex()
+    {
+        QTemporaryDir tempDir;
+        QVERIFY(tempDir.isValid());
+        const QDir root(tempDir.path());
+        QVERIFY(root.mkpath("tree"));
+        const QDir tree(root.filePath("tree"));
+        for (int i = 0; i < 10; i++) { QVERIFY(writePackage(tree, i)); }
+
+        CAircraftCfgFingerprintIndex index;
+        const CAircraftCfgEntriesList entries = parseTree(tree, {}, index);
+        const QString indexFile = root.filePath("index/fingerprints.json");
+        QVERIFY(index.saveToFile(indexFile));
+
+        CAircraftCfgFingerprintIndex loaded;
+        QVERIFY(loaded.loadFromFile(indexFile));
+        QCOMPARE(loaded.size(), index.size());
+        QCOMPARE(loaded.getAllEntries().size(), entries.size());
+
+        CAircraftCfgFingerprintIndex reloaded;
+        parseTree(tree, loaded, reloaded);
+        QCOMPARE(reloaded.getParsedCount(), 0);
+        QCOMPARE(reloaded.getReusedCount(), 10);
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestAircraftCfgParser);
+
+#include "testaircraftcfgparser.moc"
+
+//! \endcond
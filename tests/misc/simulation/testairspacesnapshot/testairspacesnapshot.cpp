@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QRandomGenerator>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/aviation/callsign.h"
+#include "misc/pq/length.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/airspaceaircraftindex.h"
+#include "misc/simulation/airspaceaircraftsnapshot.h"
+#include "misc/simulation/simulatedaircraftlist.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+
+namespace MiscTest
+{
+    //! Airspace snapshot from the aircraft list and from the incrementally maintained index
+    class CTestAirspaceSnapshot : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Both snapshots are the same, also after changes
+        void indexSnapshot();
+
+    private:
+        //! Compare all callsign sets
+        static bool sameSnapshot(const CAirspaceAircraftSnapshot &s1, const CAirspaceAircraftSnapshot &s2);
+    };
+
+    bool CTestAirspaceSnapshot::sameSnapshot(const CAirspaceAircraftSnapshot &s1, const CAirspaceAircraftSnapshot &s2)
+    {
+        return s1.getAircraftCallsignsByDistance() == s2.getAircraftCallsignsByDistance() &&
+               s1.getEnabledAircraftCallsignsByDistance() == s2.getEnabledAircraftCallsignsByDistance() &&
+               s1.getDisabledAircraftCallsignsByDistance() == s2.getDisabledAircraftCallsignsByDistance() &&
+               s1.getVtolAircraftCallsignsByDistance() == s2.getVtolAircraftCallsignsByDistance() &&
+               s1.getEnabledVtolAircraftCallsignsByDistance() == s2.getEnabledVtolAircraftCallsignsByDistance();
+    }
+
+    void CTestAirspaceSnapshot::indexSnapshot()
+    {
+        QRandomGenerator random(4711);
+        CSimulatedAircraftList aircraft;
+        CAirspaceAircraftIndex index;
+        for (int i = 0; i < 300; i++)
+        {
+            CSimulatedAircraft a;
+            a.setCallsign(CCallsign(QStringLiteral("TST%1").arg(i)));
+            a.setRelativeDistance(CLength(random.bounded(2000), CLengthUnit::m()));
+            a.setEnabled(random.bounded(4) > 0);
+            aircraft.push_back(a);
+            index.update(a);
+        }
+        QCOMPARE(index.size(), aircraft.size());
+
+        const CLength maxDistance(1500, CLengthUnit::m());
+        for (int round = 0; round < 20; round++)
+        {
+            for (bool restricted : { false, true })
+            {
+                for (int maxAircraft : { -1, 10, 100, 1000 })
+                {
+                    const CAirspaceAircraftSnapshot fromList(aircraft, restricted, true, maxAircraft, maxDistance);
+                    const CAirspaceAircraftSnapshot fromIndex(index, restricted, true, maxAircraft, maxDistance);
+                    QVERIFY2(sameSnapshot(fromList, fromIndex), qPrintable(QString::number(round)));
+                }
+            }
+            QVERIFY(sameSnapshot(CAirspaceAircraftSnapshot(aircraft, true, false, 10, maxDistance),
+                                 CAirspaceAircraftSnapshot(index, true, false, 10, maxDistance)));
+
+            // some aircraft move, get enabled/disabled or leave
+            for (CSimulatedAircraft &a : aircraft)
+            {
+                const int change = random.bounded(10);
+                if (change < 3)
+                {
+                    const int distanceM = random.bounded(2000);
+                    a.setRelativeDistance(CLength(distanceM, CLengthUnit::m()));
+                    index.updateDistance(a.getCallsign(), distanceM);
+                }
+                else if (change == 3)
+                {
+                    a.setEnabled(!a.isEnabled());
+                    index.updateEnabled(a.getCallsign(), a.isEnabled());
+                }
+            }
+            const CCallsign leaving = aircraft.front().getCallsign();
+            aircraft.removeByCallsign(leaving);
+            index.remove(leaving);
+        }
+        QCOMPARE(index.size(), aircraft.size());
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestAirspaceSnapshot);
+
+#include "testairspacesnapshot.moc"
+
+//! \endcond
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QRandomGenerator>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/geo/coordinategeodeticlist.h"
+#include "misc/pq/length.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/elevationcache.h"
+
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+
+namespace MiscTest
+{
+    //! Grid elevation cache compared to searching a list
+    class CTestElevationCache : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Closest elevation and elevations within range
+        void lookup();
+
+        //! Positions near the poles and the date line
+        void poleAndDateLine();
+
+        //! Least recently used elevations are evicted
+        void eviction();
+
+        //! Removing elevations
+        void remove();
+
+    private:
+        //! Random position around a reference
+        static CCoordinateGeodetic randomAround(QRandomGenerator &random, double latDeg, double lngDeg,
+                                                double deltaDeg);
+    };
+
+    CCoordinateGeodetic CTestElevationCache::randomAround(QRandomGenerator &random, double latDeg, double lngDeg,
+                                                          double deltaDeg)
+    {
+        double lat = latDeg + random.bounded(2 * deltaDeg) - deltaDeg;
+        double lng = lngDeg + random.bounded(2 * deltaDeg) - deltaDeg;
+        lat = qBound(-90.0, lat, 90.0);
+        if (lng > 180.0) { lng -= 360.0; }
+        if (lng < -180.0) { lng += 360.0; }
+        return { lat, lng, 1000.0 + random.bounded(100.0) };
+    }
+
+    void CTestElevationCache::lookup()
+    {
+        // a busy airport, elevations of all aircraft on ground
+        QRandomGenerator random(4711);
+        CElevationCache cache(100000);
+        CCoordinateGeodeticList elevations;
+        for (int i = 0; i < 5000; i++)
+        {
+            const CCoordinateGeodetic elevation = randomAround(random, 48.353, 11.786, i % 10 ? 0.03 : 2.0);
+            cache.insert(elevation);
+            elevations.push_back(elevation);
+        }
+        QCOMPARE(cache.size(), elevations.size());
+
+        int found = 0;
+        for (int q = 0; q < 1000; q++)
+        {
+            const CCoordinateGeodetic reference = randomAround(random, 48.353, 11.786, q % 10 ? 0.03 : 2.0);
+            const CLength range(q % 5 ? 10.0 + random.bounded(200.0) : random.bounded(20000.0), CLengthUnit::m());
+            const CCoordinateGeodetic expected = elevations.findClosestWithinRange(reference, range);
+            QCOMPARE(cache.findClosestWithinRange(reference, range), expected);
+            if (!expected.isNull()) { found++; }
+
+            const CCoordinateGeodeticList within = cache.findWithinRange(reference, range);
+            QCOMPARE(within.size(), elevations.findWithinRange(reference, range).size());
+        }
+        QVERIFY(found > 100);
+    }
+
+    void CTestElevationCache::poleAndDateLine()
+    {
+        QRandomGenerator random(815);
+        CElevationCache cache(10000);
+        CCoordinateGeodeticList elevations;
+        for (int i = 0; i < 2000; i++)
+        {
+            const CCoordinateGeodetic elevation =
+                i % 2 ? randomAround(random, 0.0, 180.0, 0.02) : randomAround(random, 89.99, 0.0, 0.02);
+            cache.insert(elevation);
+            elevations.push_back(elevation);
+        }
+
+        for (int q = 0; q < 500; q++)
+        {
+            const CCoordinateGeodetic reference =
+                q % 2 ? randomAround(random, 0.0, 180.0, 0.02) : randomAround(random, 89.99, 0.0, 0.02);
+            const CLength range(50.0 + random.bounded(500.0), CLengthUnit::m());
+            QCOMPARE(cache.findClosestWithinRange(reference, range),
+                     elevations.findClosestWithinRange(reference, range));
+        }
+    }
+
+    void CTestElevationCache::eviction()
+    {
+        QRandomGenerator random(42);
+        CElevationCache cache(100);
+        CCoordinateGeodeticList elevations;
+        for (int i = 0; i < 100; i++)
+        {
+            elevations.push_back(randomAround(random, 50.033, 8.570, 0.05));
+            cache.insert(elevations.back());
+        }
+        QCOMPARE(cache.size(), 100);
+        QCOMPARE(cache.getEvictedCount(), qint64(0));
+
+        // used recently, so they are kept
+        const CLength range(1.0, CLengthUnit::m());
+        for (int i = 0; i < 10; i++) { QCOMPARE(cache.findClosestWithinRange(elevations[i], range), elevations[i]); }
+
+        cache.insert(randomAround(random, 50.033, 8.570, 0.05));
+        QCOMPARE(cache.size(), 90);
+        QCOMPARE(cache.getEvictedCount(), qint64(11));
+        for (int i = 0; i < 10; i++) { QCOMPARE(cache.findClosestWithinRange(elevations[i], range), elevations[i]); }
+        for (int i = 10; i < 21; i++) { QVERIFY(cache.findClosestWithinRange(elevations[i], range).isNull()); }
+
+        QCOMPARE(cache.getElevations().front(), elevations[9]);
+        cache.setCapacity(50);
+        QCOMPARE(cache.size(), 45);
+        cache.resetStatistics();
+        QCOMPARE(cache.getEvictedCount(), qint64(0));
+    }
+
+    void CTestElevationCache::remove()
+    {
+        QRandomGenerator random(1);
+        CElevationCache cache(1000);
+        CCoordinateGeodeticList elevations;
+        for (int i = 0; i < 500; i++)
+        {
+            elevations.push_back(randomAround(random, 40.640, -73.779, 0.1));
+            cache.insert(elevations.back());
+        }
+
+        const CCoordinateGeodetic reference(40.640, -73.779);
+        const CLength range(3, CLengthUnit::km());
+        const int inside = elevations.findWithinRange(reference, range).size();
+        QCOMPARE(cache.removeInsideRange(reference, range), inside);
+        QCOMPARE(cache.size(), elevations.size() - inside);
+        QVERIFY(cache.findWithinRange(reference, range).isEmpty());
+
+        const CLength outsideRange(6, CLengthUnit::km());
+        const int outside = elevations.findOutsideRange(reference, outsideRange).size();
+        QCOMPARE(cache.removeOutsideRange(reference, outsideRange), outside);
+        QCOMPARE(cache.size(), elevations.size() - inside - outside);
+
+        const int remaining = cache.size();
+        QCOMPARE(cache.keepClosest(reference, 10), remaining - 10);
+        QCOMPARE(cache.size(), 10);
+        cache.clear();
+        QCOMPARE(cache.size(), 0);
+        QVERIFY(cache.getElevations().isEmpty());
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestElevationCache);
+
+#include "testelevationcache.moc"
+
+//! \endcond
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignset.h"
+#include "misc/geo/coordinategeodetic.h"
+#include "misc/pq/length.h"
+#include "misc/pq/units.h"
+#include "misc/simulation/elevationrequestscheduler.h"
+
+using namespace swift::misc::aviation;
+using namespace swift::misc::geo;
+using namespace swift::misc::physical_quantities;
+using namespace swift::misc::simulation;
+
+namespace MiscTest
+{
+    //! Coalescing, ranking and limiting elevation probes
+    class CTestElevationRequestScheduler : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Requests in the same cell share one probe
+        void coalescing();
+
+        //! Close aircraft and aircraft on ground first
+        void ranking();
+
+        //! Per frame and outstanding limits
+        void limits();
+
+        //! Unanswered probes are given up
+        void expiry();
+    };
+
+    void CTestElevationRequestScheduler::coalescing()
+    {
+        CElevationRequestScheduler scheduler;
+        const CCoordinateGeodetic position(48.10012, 11.50012, 500.0);
+        const CCoordinateGeodetic nearby(48.10013, 11.50013, 500.0); // ~1m
+        const CCoordinateGeodetic faraway(48.2, 11.5, 500.0);
+
+        QVERIFY(scheduler.enqueue(position, CCallsign("DLH1"), 1.0, 0));
+        QVERIFY(!scheduler.enqueue(nearby, CCallsign("DLH2"), 1.0, 0));
+        QVERIFY(scheduler.enqueue(faraway, CCallsign("DLH3"), 1.0, 0));
+        QCOMPARE(scheduler.getQueuedCount(), 2);
+        QCOMPARE(scheduler.getCoalescedCount(), qint64(1));
+
+        const QVector<CElevationRequestScheduler::Probe> probes = scheduler.takeProbes(10);
+        QCOMPARE(probes.size(), 2);
+        QCOMPARE(scheduler.getOutstandingCount(), 2);
+
+        // a request for a cell already probed waits for that answer
+        QVERIFY(!scheduler.enqueue(nearby, CCallsign("DLH4"), 1.0, 20));
+        QCOMPARE(scheduler.getQueuedCount(), 0);
+
+        const CCallsignSet waiting = scheduler.completed(CCallsign("DLH1"), 100);
+        QCOMPARE(waiting.size(), 3);
+        QVERIFY(waiting.contains(CCallsign("DLH1")));
+        QVERIFY(waiting.contains(CCallsign("DLH2")));
+        QVERIFY(waiting.contains(CCallsign("DLH4")));
+        QVERIFY(scheduler.completed(CCallsign("DLH1"), 100).isEmpty());
+        QCOMPARE(scheduler.getResponseLatency().getCount(), qint64(1));
+
+        // a callsign moving to another cell is no longer waiting in the old one
+        QVERIFY(scheduler.enqueue(position, CCallsign("DLH5"), 1.0, 200));
+        QVERIFY(scheduler.enqueue(CCoordinateGeodetic(47.0, 11.0, 0), CCallsign("DLH5"), 1.0, 200));
+        QCOMPARE(scheduler.getQueuedCount(), 1);
+    }
+
+    void CTestElevationRequestScheduler::ranking()
+    {
+        const CLength close(1, CLengthUnit::km());
+        const CLength far(10, CLengthUnit::km());
+        QVERIFY(CElevationRequestScheduler::rank(close, false) < CElevationRequestScheduler::rank(far, false));
+        QVERIFY(CElevationRequestScheduler::rank(far, true) < CElevationRequestScheduler::rank(far, false));
+        QVERIFY(CElevationRequestScheduler::rank(far, false) < CElevationRequestScheduler::rank(CLength::null(), true));
+
+        CElevationRequestScheduler scheduler(1, 1);
+        scheduler.enqueue(CCoordinateGeodetic(48.0, 11.0, 0), CCallsign("FAR"),
+                          CElevationRequestScheduler::rank(far, false), 0);
+        scheduler.enqueue(CCoordinateGeodetic(48.1, 11.0, 0), CCallsign("GND"),
+                          CElevationRequestScheduler::rank(far, true), 0);
+        scheduler.enqueue(CCoordinateGeodetic(48.2, 11.0, 0), CCallsign("CLOSE"),
+                          CElevationRequestScheduler::rank(close, false), 0);
+
+        const QStringList expected { "CLOSE", "GND", "FAR" };
+        qint64 now = 0;
+        for (const QString &callsign : expected)
+        {
+            const QVector<CElevationRequestScheduler::Probe> probes = scheduler.takeProbes(now);
+            QCOMPARE(probes.size(), 1);
+            QCOMPARE(probes.front().callsign.asString(), callsign);
+            QCOMPARE(scheduler.completed(probes.front().callsign, now).size(), 1);
+            now += CElevationRequestScheduler::MaxFrameMs;
+        }
+        QCOMPARE(scheduler.getQueueLatency().getCount(), qint64(3));
+    }
+
+    void CTestElevationRequestScheduler::limits()
+    {
+        CElevationRequestScheduler scheduler(3, 2);
+        for (int i = 0; i < 10; i++)
+        {
+            const CCallsign callsign(QStringLiteral("AUA%1").arg(i));
+            QVERIFY(scheduler.enqueue(CCoordinateGeodetic(40.0 + i * 0.01, 10.0, 0), callsign, i, 0));
+        }
+
+        // per frame
+        QCOMPARE(scheduler.takeProbes(0).size(), 2);
+        QCOMPARE(scheduler.takeProbes(1).size(), 0);
+
+        // outstanding, only one more slot in the next frame
+        scheduler.beginFrame(10);
+        QCOMPARE(scheduler.takeProbes(10).size(), 1);
+        scheduler.beginFrame(20);
+        QCOMPARE(scheduler.takeProbes(20).size(), 0);
+
+        // answered or failed probes free their slots
+        scheduler.completed(CCallsign("AUA0"), 30);
+        scheduler.failed(CCallsign("AUA1"));
+        QCOMPARE(scheduler.getOutstandingCount(), 1);
+        QVERIFY(!scheduler.isWaiting(CCallsign("AUA0")));
+        QVERIFY(!scheduler.isWaiting(CCallsign("AUA1")));
+        QVERIFY(scheduler.isWaiting(CCallsign("AUA2"))); // outstanding
+        QVERIFY(scheduler.isWaiting(CCallsign("AUA9"))); // queued
+        scheduler.beginFrame(40);
+        QCOMPARE(scheduler.takeProbes(40).size(), 2);
+        QCOMPARE(scheduler.getQueuedCount(), 5);
+
+        // without frames, a new budget is granted after some time
+        scheduler.completed(CCallsign("AUA2"), 50);
+        scheduler.completed(CCallsign("AUA3"), 50);
+        scheduler.completed(CCallsign("AUA4"), 50);
+        QCOMPARE(scheduler.takeProbes(50).size(), 0);
+        QCOMPARE(scheduler.takeProbes(40 + CElevationRequestScheduler::MaxFrameMs).size(), 2);
+    }
+
+    void CTestElevationRequestScheduler::expiry()
+    {
+        CElevationRequestScheduler scheduler(1, 1);
+        scheduler.enqueue(CCoordinateGeodetic(48.0, 11.0, 0), CCallsign("DLH1"), 1.0, 0);
+        scheduler.enqueue(CCoordinateGeodetic(49.0, 11.0, 0), CCallsign("DLH2"), 2.0, 0);
+        QCOMPARE(scheduler.takeProbes(0).size(), 1);
+
+        QCOMPARE(scheduler.expire(1000, 5000), 0);
+        QCOMPARE(scheduler.expire(5000, 5000), 1);
+        QCOMPARE(scheduler.getExpiredCount(), qint64(1));
+        QVERIFY(scheduler.completed(CCallsign("DLH1"), 6000).isEmpty());
+
+        const QVector<CElevationRequestScheduler::Probe> probes = scheduler.takeProbes(6000);
+        QCOMPARE(probes.size(), 1);
+        QCOMPARE(probes.front().callsign, CCallsign("DLH2"));
+
+        scheduler.clear();
+        QCOMPARE(scheduler.getQueuedCount(), 0);
+        QCOMPARE(scheduler.getOutstandingCount(), 0);
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestElevationRequestScheduler);
+
+#include "testelevationrequestscheduler.moc"
+
+//! \endcond
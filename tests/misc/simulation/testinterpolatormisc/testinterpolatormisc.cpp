@@ -6,14 +6,19 @@
 //! \ingroup testmisc
 
 #include <QDebug>
+#include <QFile>
+#include <QTemporaryDir>
 #include <QTest>
 #include <QtDebug>
 
 #include "test.h"
 
 #include "misc/aviation/aircraftsituation.h"
+#include "misc/simulation/interpolation/interpolationlogfile.h"
+#include "misc/simulation/interpolation/interpolationlogger.h"
 #include "misc/simulation/interpolation/interpolationrenderingsetup.h"
 
+using namespace swift::misc;
 using namespace swift::misc::aviation;
 using namespace swift::misc::geo;
 using namespace swift::misc::physical_quantities;
@@ -32,6 +37,9 @@ namespace MiscTest
 
         //! Equal situations
         void equalSituationTests();
+
+        //! Writing, reading and converting the interpolation log file
+        void logFile();
     };
 
     void CTestInterpolatorMisc::setupTests()
@@ -122,6 +130,79 @@ namespace MiscTest
             QVERIFY2(!s1.equalPbhVectorAltitude(s2), "Heading test, expect same PHB/Vector/Altitude");
         }
     }
+
+    void CTestInterpolatorMisc::logFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString fileName = dir.filePath("test interpolation.intlog");
+
+        const CCallsign cs("DAMBZ");
+        const CCoordinateGeodetic geoPos =
+            CCoordinateGeodetic::fromWgs84("48° 21′ 13″ N", "11° 47′ 09″ E", { 1487, CLengthUnit::ft() });
+        CAircraftSituationList situations;
+        for (int i = 0; i < 3; i++)
+        {
+            CAircraftSituation situation(cs, geoPos, CHeading(90 + i, CAngleUnit::deg()));
+            situation.setMSecsSinceEpoch(1000 * (i + 1));
+            situations.push_back(situation);
+        }
+
+        CInterpolationLogFile file;
+        QString error;
+        QVERIFY2(file.start(fileName, error), qPrintable(error));
+        for (int i = 0; i < 10; i++)
+        {
+            SituationLog log;
+            log.callsign = cs;
+            log.interpolator = 'S';
+            log.tsCurrent = 2000 + 100 * i;
+            log.tsInterpolated = log.tsCurrent - 500;
+            log.interpolationSituations = situations;
+            log.situationCurrent = situations.back();
+            log.situationCurrent.setMSecsSinceEpoch(log.tsInterpolated);
+            QVERIFY(file.append(log));
+        }
+        PartsLog partsLog;
+        partsLog.callsign = cs;
+        partsLog.tsCurrent = 3000;
+        partsLog.parts.setGearDown(true);
+        QVERIFY(file.append(partsLog));
+        file.stop();
+        QVERIFY(!file.isRunning());
+        QCOMPARE(file.getDroppedCount(), qint64(0));
+
+        int situationEntries = 0;
+        int partsEntries = 0;
+        QVERIFY2(CInterpolationLogReader::countEntries(fileName, situationEntries, partsEntries, error),
+                 qPrintable(error));
+        QCOMPARE(situationEntries, 10);
+        QCOMPARE(partsEntries, 1);
+
+        CInterpolationLogReader reader;
+        QVERIFY2(reader.open(fileName, error), qPrintable(error));
+        for (int i = 0; i < 10; i++)
+        {
+            QCOMPARE(reader.next(), CInterpolationLogReader::SituationEntry);
+            const SituationLog &log = reader.getSituationLog();
+            QVERIFY(log.callsign == cs);
+            QCOMPARE(log.interpolator, QChar('S'));
+            QCOMPARE(log.tsCurrent, qint64(2000 + 100 * i));
+            QVERIFY2(log.interpolationSituations == situations, "Expect the network situations");
+            QCOMPARE(log.situationCurrent.getMSecsSinceEpoch(), log.tsInterpolated);
+        }
+        QCOMPARE(reader.next(), CInterpolationLogReader::PartsEntry);
+        QVERIFY(reader.getPartsLog().parts.isGearDown());
+        QCOMPARE(reader.next(), CInterpolationLogReader::NoEntry);
+        QVERIFY(reader.getErrorMessage().isEmpty());
+
+        const QString prefix = dir.filePath("converted");
+        const CStatusMessageList msgs = CInterpolationLogger::convertLogFile(fileName, prefix);
+        QVERIFY2(!msgs.hasErrorMessages(), qPrintable(msgs.toQString()));
+        QVERIFY(QFile::exists(prefix + " interpolation.html"));
+        QVERIFY(QFile::exists(prefix + " parts.csv"));
+        QVERIFY(QFile::exists(prefix + "_interpolatedSituations.kml"));
+    }
 } // namespace MiscTest
 
 //! main
@@ -12,10 +12,12 @@
 #include "misc/directoryutils.h"
 #include "misc/simulation/settings/xswiftbussettings.h"
 #include "misc/simulation/settings/xswiftbussettingsqtfree.inc"
+#include "misc/simulation/xplane/cslpackageparser.h"
 #include "misc/simulation/xplane/qtfreeutils.h"
 #include "misc/swiftdirectories.h"
 
 using namespace swift::misc;
+using namespace swift::misc::simulation::xplane;
 using namespace swift::misc::simulation::xplane::qtfreeutils;
 using namespace swift::misc::simulation::settings;
 
@@ -34,6 +36,7 @@ namespace MiscTest
         void acfPropertiesTest();
         void xSwiftBusSettingsTest();
         void qtFreeUtils();
+        void cslPackageParser();
     };
 
     void CTestXPlane::getFileNameTest()
@@ -174,6 +177,67 @@ namespace MiscTest
         vOut = normalizeValue(-190, -180.0, 180.0);
         QVERIFY2(qFuzzyCompare(170, vOut), "Wrong normalize +-180");
     }
+
+    void CTestXPlane::cslPackageParser()
+    {
+        const QByteArray content = "EXPORT_NAME __Test\r\n"
+                                   "DEPENDENCY __Test\r\n"
+                                   "\r\n"
+                                   "# comment\r\n"
+                                   "OBJ8_AIRCRAFT A320_DLH\r\n"
+                                   "OBJ8 SOLID YES __Test:A320:A320.obj\r\n"
+                                   "ICAO A320\r\n"
+                                   "LIVERY A320 DLH DLH\r\n"
+                                   "OBJ8_AIRCRAFT A320_BAW\n"
+                                   "OBJ8 SOLID YES __Test/A320/A320.obj\n"
+                                   "AIRLINE A320 BAW\n"
+                                   "VERT_OFFSET 1.2\n"
+                                   "OBJ8_AIRCRAFT A320_IVAO\n"
+                                   "OBJ8 SOLID YES __Test/A320/A320.obj tex.png lit.png\n"
+                                   "ICAO A320\n"
+                                   "OBJ8_AIRCRAFT B738_MISSING\n"
+                                   "OBJ8 SOLID YES __Missing/B738/B738.obj\n"
+                                   "FOO bar\n"
+                                   "OBJ8_AIRCRAFT B738\n"
+                                   "OBJ8 SOLID YES __Test/B738/B738.obj\n"
+                                   "AIRLINE B738";
+
+        const CCslPackageParser headerParser;
+        CCslPackageParser::CSLPackage package = headerParser.parseHeader("/csl/Test", content);
+        QVERIFY(package.hasValidHeader());
+        QCOMPARE(package.name, QString("__Test"));
+        QCOMPARE(package.path, QString("/csl/Test"));
+        QVERIFY(package.messages.isEmpty());
+
+        const CCslPackageParser parser({ package });
+        parser.parseFull(package);
+        QVERIFY(package.content.isEmpty());
+
+        // IVAO format, missing package and incomplete AIRLINE are removed
+        QCOMPARE(package.planes.size(), 2);
+        const CCslPackageParser::CSLPlane &dlh = package.planes[0];
+        const CCslPackageParser::CSLPlane &baw = package.planes[1];
+        QCOMPARE(dlh.objectName, QString("A320_DLH"));
+        QCOMPARE(dlh.filePath, QString("/csl/Test/A320/A320.obj"));
+        QCOMPARE(dlh.icao, QString("A320"));
+        QCOMPARE(dlh.airline, QString("DLH"));
+        QCOMPARE(dlh.livery, QString("DLH"));
+        QCOMPARE(dlh.getModelName(), QString("Test A320_DLH"));
+        QCOMPARE(baw.filePath, QString("/csl/Test/A320/A320.obj"));
+        QCOMPARE(baw.airline, QString("BAW"));
+        QVERIFY(baw.livery.isEmpty());
+
+        // interned codes share their data
+        QVERIFY(dlh.icao.constData() == baw.icao.constData());
+        QVERIFY(dlh.dirNames.constData() == baw.dirNames.constData());
+
+        // IVAO format, missing package, unknown command and AIRLINE arguments
+        QCOMPARE(package.messages.size(), 4);
+        QVERIFY(package.messages[0].getMessage().contains("Line 14"));
+        QVERIFY(package.messages[1].getMessage().contains("package not found"));
+        QVERIFY(package.messages[2].getMessage().contains("'FOO'"));
+        QVERIFY(package.messages[3].getMessage().contains("AIRLINE command requires 2 arguments"));
+    }
 } // namespace MiscTest
 
 //! main
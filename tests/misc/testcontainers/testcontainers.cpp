@@ -33,6 +33,7 @@
 #include "misc/dictionary.h"
 #include "misc/iterator.h"
 #include "misc/math/mathutils.h"
+#include "misc/memoryfootprint.h"
 #include "misc/range.h"
 #include "misc/registermetadata.h"
 #include "misc/sequence.h"
@@ -66,6 +67,9 @@ namespace MiscTest
         void dictionaryBasics();
         void timestampList();
         void offsetTimestampList();
+
+        //! Memory estimates
+        void memoryFootprint();
     };
 
     void CTestContainers::initTestCase() { swift::misc::registerMetadata(); }
@@ -402,6 +406,37 @@ namespace MiscTest
             }
         }
     }
+
+    void CTestContainers::memoryFootprint()
+    {
+        QCOMPARE(heapSize(42), qint64(0));
+        QCOMPARE(heapSize(QString()), qint64(0));
+        QVERIFY(heapSize(QStringLiteral("DLH123")) >= 6 * static_cast<qint64>(sizeof(QChar)));
+        QVERIFY(heapSize(CCallsign("DLH123")) > heapSize(CCallsign()));
+
+        CAircraftSituationList situations;
+        QCOMPARE(heapSize(situations), qint64(0));
+        CAircraftSituation situation(CCallsign("DLH123"));
+        situations.push_back(situation);
+        const qint64 one = heapSize(situations);
+        QVERIFY(one >= static_cast<qint64>(sizeof(CAircraftSituation)));
+        for (int i = 0; i < 9; ++i) { situations.push_back(situation); }
+        QVERIFY(heapSize(situations) > 9 * one / 2);
+        QCOMPARE(deepSize(situations), static_cast<qint64>(sizeof(situations)) + heapSize(situations));
+
+        CMemoryFootprint footprint;
+        footprint.add("situations", deepSize(situations), situations.sizeInt());
+        footprint.add("other", 1024);
+        QCOMPARE(footprint.getEntries().size(), qsizetype(2));
+        QCOMPARE(footprint.getTotalBytes(), deepSize(situations) + 1024);
+        QVERIFY(footprint.toQString().contains("situations"));
+        QVERIFY(footprint.toQString(true).contains('\n'));
+
+        // counts only do not change the total
+        footprint.addCount("aircraft", 3);
+        QCOMPARE(footprint.getTotalBytes(), deepSize(situations) + 1024);
+        QVERIFY(footprint.toQString().contains("aircraft: 3"));
+    }
 } // namespace MiscTest
 
 //! main
@@ -13,6 +13,7 @@
 
 #include "test.h"
 
+#include "misc/dbusblob.h"
 #include "misc/registermetadata.h"
 #include "misc/simulation/simulatedaircraftlist.h"
 #include "misc/test/testservice.h"
@@ -36,6 +37,9 @@ namespace MiscTest
 
         //! Test marshaling/unmarshaling
         void marshalUnmarshal();
+
+        //! Test CDBusBlob
+        void blob();
     };
 
     void CTestDataStream::initTestCase() { swift::misc::registerMetadata(); }
@@ -58,6 +62,35 @@ namespace MiscTest
             QVERIFY2(result == testData, "roundtrip marshal/unmarshal compares equal");
         }
     }
+
+    void CTestDataStream::blob()
+    {
+        CSimulatedAircraftList testData;
+        for (int i = 0; i < 1000; i++) { testData.push_back({ CCallsign(QStringLiteral("DLH%1").arg(i)), {}, {} }); }
+
+        const QByteArray plain = CDBusBlob::toBlob(testData, false);
+        const QByteArray compressed = CDBusBlob::toBlob(testData, true);
+        QVERIFY2(plain.size() > CDBusBlob::CompressThresholdBytes, "large enough to be compressed");
+        QVERIFY2(compressed.size() < plain.size(), "compressed is smaller");
+
+        CSimulatedAircraftList result;
+        QVERIFY(CDBusBlob::fromBlob(plain, result));
+        QVERIFY2(result == testData, "roundtrip plain blob compares equal");
+        result.clear();
+        QVERIFY(CDBusBlob::fromBlob(compressed, result));
+        QVERIFY2(result == testData, "roundtrip compressed blob compares equal");
+
+        // small values are not compressed
+        const CSimulatedAircraftList small { testData.front() };
+        QVERIFY(CDBusBlob::toBlob(small, true) == CDBusBlob::toBlob(small, false));
+
+        // invalid blobs leave the value unchanged
+        QVERIFY(!CDBusBlob::fromBlob(QByteArray(), result));
+        QVERIFY(!CDBusBlob::fromBlob(QByteArray(10, '\x7f'), result));
+        QVERIFY(!CDBusBlob::fromBlob(plain.left(plain.size() / 2), result));
+        QVERIFY(!CDBusBlob::fromBlob(compressed.left(compressed.size() / 2), result));
+        QVERIFY(result == testData);
+    }
 } // namespace MiscTest
 
 //! main
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QList>
+#include <QSet>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/aviation/callsign.h"
+#include "misc/aviation/callsignhandle.h"
+#include "misc/expiryqueue.h"
+
+using namespace swift::misc;
+using namespace swift::misc::aviation;
+
+namespace MiscTest
+{
+    //! CExpiryQueue tests, as used by the airspace watchdog
+    class CTestExpiryQueue : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Touch, remove and expire single keys
+        void basics();
+
+        //! 2000 callsigns, some of them stop sending
+        void callsigns();
+    };
+
+    void CTestExpiryQueue::basics()
+    {
+        CExpiryQueue<int> queue(2);
+        queue.touch(1);
+        queue.touch(2);
+        queue.touch(3);
+        QCOMPARE(queue.size(), 3);
+        QVERIFY(queue.remove(3));
+        QVERIFY(!queue.remove(3));
+
+        QList<int> expired;
+        const auto collect = [&expired](int key, qint64 idleTicks) {
+            Q_UNUSED(idleTicks)
+            expired.push_back(key);
+        };
+
+        queue.advance();
+        queue.touch(1); // moves 1 behind 2
+        queue.advance();
+        QCOMPARE(queue.expire(collect), 0);
+        queue.advance(); // 2 untouched for 3 ticks
+        QCOMPARE(queue.expire(collect), 1);
+        QCOMPARE(expired, QList<int>({ 2 }));
+        QVERIFY(queue.contains(1));
+
+        queue.advance();
+        QCOMPARE(queue.expire(collect), 1);
+        QCOMPARE(expired, QList<int>({ 2, 1 }));
+        QCOMPARE(queue.size(), 0);
+    }
+
+    void CTestExpiryQueue::callsigns()
+    {
+        constexpr int Callsigns = 2000;
+        constexpr qint64 TimeoutTicks = 2;
+        QList<CCallsign> callsigns;
+        QList<CCallsignHandle> handles; // keyed like the airspace watchdog
+        for (int i = 0; i < Callsigns; i++)
+        {
+            callsigns.push_back(CCallsign(QStringLiteral("TST%1").arg(i), QStringLiteral("TEST"), CCallsign::Aircraft));
+            handles.push_back(CCallsignHandle::intern(callsigns.back()));
+        }
+
+        CExpiryQueue<CCallsignHandle, CCallsign> queue(TimeoutTicks);
+        QSet<CCallsignHandle> expired;
+        const auto collect = [&expired](const CCallsign &callsign, qint64 idleTicks) {
+            QVERIFY(idleTicks > TimeoutTicks);
+            QCOMPARE(callsign.getTelephonyDesignator(), QStringLiteral("TEST")); // the callsign as touched
+            QCOMPARE(callsign.getTypeHint(), CCallsign::Aircraft);
+            expired.insert(CCallsignHandle::find(callsign));
+        };
+
+        // every callsign sends several positions per tick
+        for (int tick = 0; tick < 10; tick++)
+        {
+            for (int position = 0; position < 3; position++)
+            {
+                for (int i = 0; i < Callsigns; i++) { queue.touch(handles[i], callsigns[i]); }
+            }
+            queue.advance();
+            QCOMPARE(queue.expire(collect), 0);
+        }
+        QCOMPARE(queue.size(), Callsigns);
+
+        // every 4th callsign goes silent
+        for (int tick = 0; tick <= TimeoutTicks; tick++)
+        {
+            for (int i = 0; i < Callsigns; i++)
+            {
+                if (i % 4 != 0) { queue.touch(handles[i], callsigns[i]); }
+            }
+            queue.advance();
+            queue.expire(collect);
+        }
+
+        // 10 more are removed regularly
+        for (int i = 0; i < 10; i++) { QVERIFY(queue.remove(handles[4 * i + 1])); }
+
+        QCOMPARE(expired.size(), Callsigns / 4);
+        for (int i = 0; i < Callsigns; i++) { QCOMPARE(expired.contains(handles[i]), i % 4 == 0); }
+        QCOMPARE(queue.size(), Callsigns - Callsigns / 4 - 10);
+        QVERIFY(!queue.contains(handles[1]));
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestExpiryQueue);
+
+#include "testexpiryqueue.moc"
+
+//! \endcond
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/latencyhistogram.h"
+
+using namespace swift::misc;
+
+namespace MiscTest
+{
+    //! CLatencyHistogram tests
+    class CTestLatencyHistogram : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Empty and small values
+        void basics();
+
+        //! Percentiles within the bucket precision
+        void percentiles();
+    };
+
+    void CTestLatencyHistogram::basics()
+    {
+        CLatencyHistogram histogram;
+        QCOMPARE(histogram.getCount(), qint64(0));
+        QCOMPARE(histogram.getPercentileNs(50), qint64(0));
+        QCOMPARE(histogram.getMaxNs(), qint64(0));
+
+        // small values are exact
+        for (int ns = 1; ns <= 10; ns++) { histogram.record(ns); }
+        QCOMPARE(histogram.getCount(), qint64(10));
+        QCOMPARE(histogram.getMinNs(), qint64(1));
+        QCOMPARE(histogram.getMaxNs(), qint64(10));
+        QCOMPARE(histogram.getPercentileNs(50), qint64(5));
+        QCOMPARE(histogram.getPercentileNs(100), qint64(10));
+        QCOMPARE(histogram.getMeanNs(), 5.5);
+
+        // huge values go to the last bucket, but max. is exact
+        const qint64 hour = 3600LL * 1000 * 1000 * 1000;
+        histogram.record(hour);
+        QCOMPARE(histogram.getMaxNs(), hour);
+        QCOMPARE(histogram.getPercentileNs(100), hour);
+
+        histogram.reset();
+        QCOMPARE(histogram.getCount(), qint64(0));
+        QCOMPARE(histogram.getMaxNs(), qint64(0));
+    }
+
+    void CTestLatencyHistogram::percentiles()
+    {
+        // 1..100000us uniformly
+        CLatencyHistogram histogram;
+        for (qint64 us = 1; us <= 100000; us++) { histogram.record(us * 1000); }
+        const auto near = [](qint64 value, qint64 expected) {
+            return qAbs(value - expected) <= expected / 16 + 1; // bucket precision
+        };
+        QVERIFY(near(histogram.getPercentileNs(50), 50000LL * 1000));
+        QVERIFY(near(histogram.getPercentileNs(90), 90000LL * 1000));
+        QVERIFY(near(histogram.getPercentileNs(99), 99000LL * 1000));
+        QVERIFY(near(histogram.getPercentileNs(99.9), 99900LL * 1000));
+        QCOMPARE(histogram.getPercentileNs(100), qint64(100000) * 1000);
+        QVERIFY(histogram.getPercentileNs(50) <= histogram.getPercentileNs(90));
+        QVERIFY(histogram.toQString().startsWith("n=100000 p50="));
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestLatencyHistogram);
+
+#include "testlatencyhistogram.moc"
+
+//! \endcond
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <QObject>
+#include <QTest>
+
+#include "test.h"
+
+#include "misc/logcategorylist.h"
+#include "misc/loghandler.h"
+#include "misc/logmessage.h"
+#include "misc/logpattern.h"
+
+using namespace swift::misc;
+
+namespace MiscTest
+{
+    //! Log handler interest tests
+    class CTestLogHandler : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Install the handler without console output
+        void initTestCase();
+
+        //! Debug message nobody is interested in is dropped before formatting
+        void debugDroppedWithoutSubscriber();
+
+        //! Listeners of localMessageLogged with a minimum severity
+        void localMessageListener();
+
+        //! Subscribed patterns
+        void subscriber();
+
+    private:
+        //! Category used by the tests
+        static const CLogCategoryList &categories();
+    };
+
+    void CTestLogHandler::initTestCase()
+    {
+        CLogHandler::instance()->install();
+        CLogHandler::instance()->enableConsoleOutput(false);
+    }
+
+    void CTestLogHandler::debugDroppedWithoutSubscriber()
+    {
+        QTRY_VERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+        QVERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityError, categories()));
+
+        const qint64 suppressed = CLogHandler::getSuppressedMessageCount();
+        CLogMessage(categories()).debug(u"nobody receives this");
+        QCOMPARE(CLogHandler::getSuppressedMessageCount(), suppressed + 1);
+    }
+
+    void CTestLogHandler::localMessageListener()
+    {
+        {
+            QObject listener;
+            const QMetaObject::Connection connection = CLogHandler::instance()->connectLocalMessageListener(
+                &listener, [](const CStatusMessage &) {}, CStatusMessage::SeverityInfo);
+            QTRY_VERIFY(CLogHandler::isInterestedIn(CStatusMessage::SeverityInfo, categories()));
+            QVERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+
+            // a receiver of the plain signal did not tell what it needs and gets everything
+            QObject unknown;
+            connect(CLogHandler::instance(), &CLogHandler::localMessageLogged, &unknown,
+                    [](const CStatusMessage &) {});
+            QTRY_VERIFY(CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+
+            // disconnected, but not destroyed
+            CLogHandler::instance()->disconnect(&unknown);
+            QTRY_VERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+            QVERIFY(CLogHandler::isInterestedIn(CStatusMessage::SeverityInfo, categories()));
+
+            QObject::disconnect(connection);
+            QTRY_VERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityInfo, categories()));
+
+            // the registration ends with the listener
+            CLogHandler::instance()->connectLocalMessageListener(
+                &listener, [](const CStatusMessage &) {}, CStatusMessage::SeverityWarning);
+            QTRY_VERIFY(CLogHandler::isInterestedIn(CStatusMessage::SeverityWarning, categories()));
+        }
+        QTRY_VERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityWarning, categories()));
+    }
+
+    void CTestLogHandler::subscriber()
+    {
+        const CLogCategoryList other({ CLogCategory("swift.test.loghandler.other") });
+        {
+            CLogSubscriber subscriber(this, [](const CStatusMessage &) {});
+            subscriber.changeSubscription(
+                CLogPattern::exactMatch(categories().front()).withSeverityAtOrAbove(CStatusMessage::SeverityDebug));
+            QTRY_VERIFY(CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+            QVERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, other));
+        }
+        QTRY_VERIFY(!CLogHandler::isInterestedIn(CStatusMessage::SeverityDebug, categories()));
+    }
+
+    const CLogCategoryList &CTestLogHandler::categories()
+    {
+        static const CLogCategoryList cats({ CLogCategory("swift.test.loghandler") });
+        return cats;
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestLogHandler);
+
+#include "testloghandler.moc"
+
+//! \endcond
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QTest>
+#include <QThread>
+
+#include "test.h"
+
+#include "misc/mpscqueue.h"
+
+using namespace swift::misc;
+
+namespace MiscTest
+{
+    //! CMpscQueue tests
+    class CTestMpscQueue : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Single thread, order and bound
+        void singleThread();
+
+        //! Several producers, one consumer
+        void producers();
+    };
+
+    void CTestMpscQueue::singleThread()
+    {
+        CMpscQueue<int> queue(3);
+        int value = 0;
+        QVERIFY(!queue.tryPop(value));
+        QVERIFY(queue.tryPush(1));
+        QVERIFY(queue.tryPush(2));
+        QVERIFY(queue.tryPush(3));
+        QVERIFY(!queue.tryPush(4));
+        QCOMPARE(queue.size(), 3);
+
+        QVERIFY(queue.tryPop(value));
+        QCOMPARE(value, 1);
+        QVERIFY(queue.tryPush(5));
+        for (int expected : { 2, 3, 5 })
+        {
+            QVERIFY(queue.tryPop(value));
+            QCOMPARE(value, expected);
+        }
+        QVERIFY(!queue.tryPop(value));
+        QCOMPARE(queue.size(), 0);
+    }
+
+    void CTestMpscQueue::producers()
+    {
+        constexpr int Producers = 4;
+        constexpr int PerProducer = 20000;
+        CMpscQueue<std::pair<int, int>> queue(1000);
+        std::atomic_int rejected { 0 };
+
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (int p = 0; p < Producers; p++)
+        {
+            threads.emplace_back(QThread::create([&queue, &rejected, p] {
+                for (int i = 0; i < PerProducer; i++)
+                {
+                    while (!queue.tryPush({ p, i }))
+                    {
+                        rejected++;
+                        QThread::yieldCurrentThread();
+                    }
+                }
+            }));
+            threads.back()->start();
+        }
+
+        // values of each producer arrive in order, none is lost
+        std::vector<int> next(Producers, 0);
+        int received = 0;
+        std::pair<int, int> value;
+        while (received < Producers * PerProducer)
+        {
+            if (!queue.tryPop(value))
+            {
+                QThread::yieldCurrentThread();
+                continue;
+            }
+            QCOMPARE(value.second, next[value.first]);
+            next[value.first]++;
+            received++;
+            QVERIFY(queue.size() <= queue.capacity() + Producers);
+        }
+        for (const auto &thread : threads) { QVERIFY(thread->wait(10000)); }
+        QVERIFY(!queue.tryPop(value));
+        QCOMPARE(queue.size(), 0);
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestMpscQueue);
+
+#include "testmpscqueue.moc"
+
+//! \endcond
@@ -20,6 +20,7 @@
 #include "misc/registermetadata.h"
 #include "misc/sharedstate/datalinkdbus.h"
 #include "misc/sharedstate/datalinklocal.h"
+#include "misc/sharedstate/listpage.h"
 
 using namespace QTest;
 using namespace swift::misc;
@@ -45,6 +46,9 @@ namespace MiscTest
         //! Test list value shared over local datalink
         void localList();
 
+        //! Test bounded list journal and paged list observer over local datalink
+        void localListPaged();
+
         //! Test scalar value shared over dbus datalink
         void dbusScalar();
 
@@ -120,6 +124,50 @@ namespace MiscTest
         QVERIFY2(ok, "expected value received");
     }
 
+    void CTestSharedState::localListPaged()
+    {
+        CDataLinkLocal dataLink;
+        CTestListMutator mutator(this);
+        CTestListJournal journal(this);
+        mutator.initialize(&dataLink);
+        journal.initialize(&dataLink);
+
+        // the oldest elements are removed when full, some more at once
+        journal.setMaxElements(16);
+        for (int e = 1; e <= 20; ++e) { mutator.addElement(e); }
+        bool ok = qWaitFor([&] { return journal.getElementCount() + journal.getRemovedCount() == 20; });
+        QVERIFY2(ok, "all elements received");
+        QCOMPARE(journal.getElementCount(), 16);
+        QCOMPARE(journal.getRemovedCount(), qint64(4));
+        QCOMPARE(journal.getBytes(), qint64(16 * sizeof(int)));
+
+        const CListPage all = journal.page({ {}, -1, -1 });
+        QCOMPARE(all.getValues().size(), 16);
+        QCOMPARE(all.getValues().front().to<int>(), 5);
+        QCOMPARE(all.getFirstSequence(), qint64(4));
+        QVERIFY(all.isComplete());
+
+        // only the newest page is received, older pages on request
+        CTestListObserver observer(this);
+        observer.setPageSize(3);
+        observer.initialize(&dataLink);
+        observer.setFilter({ 1 });
+        ok = qWaitFor([&] { return observer.allValues() == QList<int> { 15, 17, 19 }; });
+        QVERIFY2(ok, "newest page received");
+        QVERIFY(observer.hasOlderValues());
+
+        QVERIFY(observer.requestOlderValues());
+        ok = qWaitFor([&] { return observer.allValues() == QList<int> { 9, 11, 13, 15, 17, 19 }; });
+        QVERIFY2(ok, "older page received");
+        QVERIFY(observer.hasOlderValues());
+
+        QVERIFY(observer.requestOlderValues());
+        ok = qWaitFor([&] { return observer.allValues() == QList<int> { 5, 7, 9, 11, 13, 15, 17, 19 }; });
+        QVERIFY2(ok, "oldest page received");
+        QVERIFY(!observer.hasOlderValues());
+        QVERIFY(!observer.requestOlderValues());
+    }
+
     //! RAII wrapper
     class Server
     {
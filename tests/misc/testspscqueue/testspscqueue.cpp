@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testmisc
+
+#include <array>
+#include <memory>
+
+#include <QTest>
+#include <QThread>
+
+#include "test.h"
+
+#include "misc/spscqueue.h"
+
+using namespace swift::misc;
+
+namespace MiscTest
+{
+    //! CSpscQueue tests
+    class CTestSpscQueue : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Single thread, order and bound
+        void singleThread();
+
+        //! Values written in place
+        void inPlace();
+
+        //! One producer, one consumer
+        void producerConsumer();
+    };
+
+    void CTestSpscQueue::singleThread()
+    {
+        CSpscQueue<int> queue(3);
+        int value = 0;
+        QVERIFY(queue.isEmpty());
+        QVERIFY(!queue.tryPop(value));
+        QVERIFY(queue.tryPush(1));
+        QVERIFY(queue.tryPush(2));
+        QVERIFY(queue.tryPush(3));
+        QVERIFY(!queue.tryPush(4));
+        QCOMPARE(queue.size(), 3);
+
+        QVERIFY(queue.tryPop(value));
+        QCOMPARE(value, 1);
+        QVERIFY(queue.tryPush(5));
+        for (int expected : { 2, 3, 5 })
+        {
+            QVERIFY(queue.tryPop(value));
+            QCOMPARE(value, expected);
+        }
+        QVERIFY(!queue.tryPop(value));
+        QCOMPARE(queue.size(), 0);
+    }
+
+    void CTestSpscQueue::inPlace()
+    {
+        CSpscQueue<std::array<int, 4>> queue(2);
+        const std::array<int, 4> *first = nullptr;
+        for (int round = 0; round < 5; round++)
+        {
+            std::array<int, 4> *slot = queue.beginPush();
+            QVERIFY(slot);
+            slot->fill(round);
+            queue.endPush();
+
+            // slots are reused
+            if (round == 0) { first = slot; }
+            if (round % 2 == 0) { QVERIFY(slot == first); }
+
+            const std::array<int, 4> *front = queue.front();
+            QVERIFY(front == slot);
+            QCOMPARE(front->back(), round);
+            queue.pop();
+            QVERIFY(!queue.front());
+        }
+    }
+
+    void CTestSpscQueue::producerConsumer()
+    {
+        constexpr int Values = 20000;
+        CSpscQueue<int> queue(64);
+
+        std::unique_ptr<QThread> producer(QThread::create([&queue] {
+            for (int i = 0; i < Values; i++)
+            {
+                while (!queue.tryPush(i)) { QThread::yieldCurrentThread(); }
+            }
+        }));
+        producer->start();
+
+        // all values arrive in order
+        int value = -1;
+        for (int expected = 0; expected < Values; expected++)
+        {
+            while (!queue.tryPop(value)) { QThread::yieldCurrentThread(); }
+            QCOMPARE(value, expected);
+            QVERIFY(queue.size() <= queue.capacity());
+        }
+        QVERIFY(producer->wait(10000));
+        QVERIFY(queue.isEmpty());
+    }
+} // namespace MiscTest
+
+//! main
+SWIFTTEST_MAIN(MiscTest::CTestSpscQueue);
+
+#include "testspscqueue.moc"
+
+//! \endcond